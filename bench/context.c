@@ -0,0 +1,128 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "context.h"
+#include "state.h"
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+void* get_gles_lib_handle();
+
+static EGLDisplay g_display = EGL_NO_DISPLAY;
+static EGLContext g_context = EGL_NO_CONTEXT;
+static struct state_context* g_state;
+static GLuint g_framebuffer;
+static GLuint g_renderbuffer;
+
+static int has_extension(const char* extensions, const char* name) {
+    size_t length = strlen(name);
+    for (const char* p = extensions; p && (p = strstr(p, name)); p += length) {
+        if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) return 1;
+    }
+    return 0;
+}
+
+// Mesa's eglGetProcAddress returns a stub for any name, so extension entry
+// points the measured paths depend on are dropped unless the driver
+// advertises them.
+static void drop_unsupported_extensions(void) {
+    const char* extensions = (const char*)gles.core.glGetString(GL_EXTENSIONS);
+    if (!has_extension(extensions, "GL_EXT_multi_draw_indirect")) {
+        gles.ext.glMultiDrawArraysIndirectEXT = NULL;
+        gles.ext.glMultiDrawElementsIndirectEXT = NULL;
+    }
+    if (!has_extension(extensions, "GL_EXT_draw_transform_feedback")) {
+        gles.ext.glDrawTransformFeedbackEXT = NULL;
+        gles.ext.glDrawTransformFeedbackInstancedEXT = NULL;
+    }
+}
+
+int bench_context_init(void) {
+    if (load_gles_functions(get_gles_lib_handle()) != 0) return 0;
+    if (egl.eglGetPlatformDisplay) g_display = egl.eglGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    EGLint major, minor;
+    if (g_display == EGL_NO_DISPLAY || !egl.eglInitialize(g_display, &major, &minor)) {
+        fprintf(stderr, "bench: no surfaceless EGL display (0x%x)\n", egl.eglGetError());
+        return 0;
+    }
+    egl.eglBindAPI(EGL_OPENGL_ES_API);
+    const EGLint context_attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 2, EGL_NONE };
+    g_context = egl.eglCreateContext(g_display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, context_attribs);
+    if (g_context == EGL_NO_CONTEXT || !egl.eglMakeCurrent(g_display, EGL_NO_SURFACE, EGL_NO_SURFACE, g_context)) {
+        fprintf(stderr, "bench: no GLES 3.2 context (0x%x)\n", egl.eglGetError());
+        return 0;
+    }
+    gles_version.major = 3;
+    gles_version.minor = 2;
+    drop_unsupported_extensions();
+    g_state = state_context_create(NULL);
+    if (!g_state) return 0;
+    state_context_make_current(g_state);
+
+    glGenRenderbuffers(1, &g_renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, g_renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, BENCH_TARGET_SIZE, BENCH_TARGET_SIZE);
+    glGenFramebuffers(1, &g_framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, g_framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, g_renderbuffer);
+    glViewport(0, 0, BENCH_TARGET_SIZE, BENCH_TARGET_SIZE);
+    fprintf(stderr, "bench: %s\n", (const char*)gles.core.glGetString(GL_RENDERER));
+    return 1;
+}
+
+void bench_context_shutdown(void) {
+    glDeleteFramebuffers(1, &g_framebuffer);
+    glDeleteRenderbuffers(1, &g_renderbuffer);
+    state_context_destroy(g_state);
+    state_context_make_current(NULL);
+    egl.eglMakeCurrent(g_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    egl.eglDestroyContext(g_display, g_context);
+    egl.eglTerminate(g_display);
+}
+
+static GLuint bench_shader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "bench: shader compile failed: %s\n", log);
+        exit(1);
+    }
+    return shader;
+}
+
+GLuint bench_program(const char* vertex_source, const char* fragment_source, const char* varying) {
+    GLuint program = glCreateProgram();
+    GLuint vertex = bench_shader(GL_VERTEX_SHADER, vertex_source);
+    GLuint fragment = bench_shader(GL_FRAGMENT_SHADER, fragment_source);
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    if (varying) glTransformFeedbackVaryings(program, 1, &varying, GL_INTERLEAVED_ATTRIBS);
+    glLinkProgram(program);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        fprintf(stderr, "bench: program link failed: %s\n", log);
+        exit(1);
+    }
+    return program;
+}
+
+double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
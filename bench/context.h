@@ -0,0 +1,27 @@
+#ifndef BENCH_CONTEXT_H
+#define BENCH_CONTEXT_H
+
+// Layer setup shared by the benchmarks that draw. They link the layer itself
+// and make a GLES context current the way the GLX bridge does, but on Mesa's
+// surfaceless EGL platform so no X server is needed; run them with
+// LIBGL_ALWAYS_SOFTWARE=1 for llvmpipe. Rendering goes to a small
+// framebuffer object.
+
+#include "gles.h"
+#define GL_GLEXT_PROTOTYPES
+#include <GL/glcorearb.h>
+
+#define BENCH_TARGET_SIZE 64
+
+// Returns 0 and prints why on failure.
+int bench_context_init(void);
+void bench_context_shutdown(void);
+
+// Compiles and links a program from desktop GLSL through the layer, capturing
+// varying with transform feedback unless it is NULL. Exits on failure.
+GLuint bench_program(const char* vertex_source, const char* fragment_source, const char* varying);
+
+// Monotonic time in seconds.
+double bench_now(void);
+
+#endif
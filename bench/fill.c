@@ -0,0 +1,81 @@
+// Throughput of fill_pattern for the clear value sizes glClearBufferData
+// commonly sees, against memset and memcpy of the same size. The 256 KiB
+// size matches the staging buffer of the copy-based clear path. Built with
+// -DGLT_BUILD_BENCHMARKS=ON.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fill.h"
+
+#define BENCH_BYTES (1ull << 32) // Bytes written per measurement
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double gbps(size_t size, double elapsed_ns, size_t reps) {
+    return (double)size * reps / elapsed_ns;
+}
+
+static double bench_fill(void* dst, size_t size, size_t pattern_size) {
+    static const uint8_t pattern[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+    size_t reps = BENCH_BYTES / size;
+    double start = now_ns();
+    for (size_t r = 0; r < reps; ++r) fill_pattern(dst, size, pattern, pattern_size);
+    return gbps(size, now_ns() - start, reps);
+}
+
+static double bench_memset(void* dst, size_t size) {
+    size_t reps = BENCH_BYTES / size;
+    double start = now_ns();
+    for (size_t r = 0; r < reps; ++r) {
+        memset(dst, (int)r, size);
+        __asm__ volatile("" : : "r"(dst) : "memory");
+    }
+    return gbps(size, now_ns() - start, reps);
+}
+
+static double bench_memcpy(void* dst, const void* src, size_t size) {
+    size_t reps = BENCH_BYTES / size;
+    double start = now_ns();
+    for (size_t r = 0; r < reps; ++r) {
+        memcpy(dst, src, size);
+        __asm__ volatile("" : : "r"(dst) : "memory");
+    }
+    return gbps(size, now_ns() - start, reps);
+}
+
+int main(void) {
+    static const size_t sizes[] = { 16 << 10, 256 << 10, 64 << 20 };
+    static const size_t pattern_sizes[] = { 1, 4, 12, 16 };
+
+    printf("%10s", "bytes");
+    for (size_t p = 0; p < sizeof(pattern_sizes) / sizeof(pattern_sizes[0]); ++p) printf("   fill %2zuB", pattern_sizes[p]);
+    printf("%11s%11s   (GB/s)\n", "memset", "memcpy");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        size_t size = sizes[s];
+        uint8_t* dst = malloc(size);
+        uint8_t* src = malloc(size);
+        if (!dst || !src) return 1;
+        memset(dst, 0, size);
+        memset(src, 0x5a, size);
+
+        printf("%10zu", size);
+        for (size_t p = 0; p < sizeof(pattern_sizes) / sizeof(pattern_sizes[0]); ++p) {
+            printf("%11.2f", bench_fill(dst, size, pattern_sizes[p]));
+        }
+        printf("%11.2f%11.2f\n", bench_memset(dst, size), bench_memcpy(dst, src, size));
+
+        free(dst);
+        free(src);
+    }
+    return 0;
+}
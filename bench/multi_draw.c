@@ -0,0 +1,229 @@
+// Draws per second of every multi-draw path on the current driver, meant for
+// llvmpipe (LIBGL_ALWAYS_SOFTWARE=1), which has neither EXT_multi_draw_indirect
+// nor gl_DrawID. Each call draws DRAWS small triangles. Built with
+// -DGLT_BUILD_BENCHMARKS=ON.
+//
+// The path is picked the way applications pick it: by whether the program
+// reads gl_DrawID or gl_BaseInstance, by LIBGL_INDIRECT_MIRROR (toggled here
+// through g_config before the buffers are bound), and by whether the GPU
+// command rewrite is available (disabled here through the scratch objects to
+// measure the readback fallback).
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "context.h"
+#include "config.h"
+#include "state.h"
+
+#define DRAWS 1024
+#define MIN_SECONDS 0.25
+
+static const char* vertex_draw_id =
+    "#version 460 core\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(gl_VertexID % 2, gl_VertexID / 2) * 0.05;\n"
+    "    vec2 cell = vec2(gl_DrawID % 32, gl_DrawID / 32 % 32) / 16.0 - 1.0;\n"
+    "    gl_Position = vec4(cell + corner, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* vertex_base_instance =
+    "#version 460 core\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(gl_VertexID % 2, gl_VertexID / 2) * 0.05;\n"
+    "    vec2 cell = vec2(gl_BaseInstance % 32, gl_BaseInstance / 32 % 32) / 16.0 - 1.0;\n"
+    "    gl_Position = vec4(cell + corner, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* vertex_plain =
+    "#version 460 core\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(gl_VertexID % 2, gl_VertexID / 2) * 0.05;\n"
+    "    gl_Position = vec4(corner, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* fragment_source =
+    "#version 460 core\n"
+    "layout(location = 0) out vec4 color;\n"
+    "void main() {\n"
+    "    color = vec4(1.0);\n"
+    "}\n";
+
+enum call {
+    CALL_ARRAYS_INDIRECT,
+    CALL_ELEMENTS_INDIRECT,
+    CALL_ARRAYS_INDIRECT_COUNT,
+    CALL_ELEMENTS_INDIRECT_COUNT,
+    CALL_ARRAYS_CLIENT,
+};
+
+enum program {
+    PROGRAM_PLAIN,
+    PROGRAM_DRAW_ID,
+    PROGRAM_BASE_INSTANCE,
+};
+
+struct path {
+    const char* name;
+    enum call call;
+    enum program program;
+    int mirror;
+    int rewrite;
+};
+
+static const struct path g_paths[] = {
+    { "native EXT multi-draw",        CALL_ARRAYS_INDIRECT,         PROGRAM_PLAIN,         0, 1 },
+    { "per-command indirect draws",   CALL_ARRAYS_INDIRECT,         PROGRAM_DRAW_ID,       0, 1 },
+    { "per-command indirect draws",   CALL_ELEMENTS_INDIRECT,       PROGRAM_DRAW_ID,       0, 1 },
+    { "CPU mirror",                   CALL_ARRAYS_INDIRECT,         PROGRAM_BASE_INSTANCE, 1, 1 },
+    { "CPU mirror",                   CALL_ELEMENTS_INDIRECT,       PROGRAM_BASE_INSTANCE, 1, 1 },
+    { "CPU mirror",                   CALL_ARRAYS_INDIRECT_COUNT,   PROGRAM_BASE_INSTANCE, 1, 1 },
+    { "GPU rewrite",                  CALL_ARRAYS_INDIRECT,         PROGRAM_BASE_INSTANCE, 0, 1 },
+    { "GPU rewrite",                  CALL_ELEMENTS_INDIRECT,       PROGRAM_BASE_INSTANCE, 0, 1 },
+    { "GPU rewrite, culled count",    CALL_ARRAYS_INDIRECT_COUNT,   PROGRAM_DRAW_ID,       0, 1 },
+    { "GPU rewrite, culled count",    CALL_ELEMENTS_INDIRECT_COUNT, PROGRAM_BASE_INSTANCE, 0, 1 },
+    { "blocking readback",            CALL_ARRAYS_INDIRECT,         PROGRAM_BASE_INSTANCE, 0, 0 },
+    { "blocking readback",            CALL_ELEMENTS_INDIRECT_COUNT, PROGRAM_BASE_INSTANCE, 0, 0 },
+    { "draw ID uniform per draw",     CALL_ARRAYS_CLIENT,           PROGRAM_DRAW_ID,       0, 1 },
+};
+
+static const char* g_call_names[] = {
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glMultiDrawArraysIndirectCount",
+    "glMultiDrawElementsIndirectCount",
+    "glMultiDrawArrays",
+};
+
+static GLuint g_programs[3];
+static GLuint g_indirect_buffer;
+static GLuint g_parameter_buffer;
+static GLint g_firsts[DRAWS];
+static GLsizei g_counts[DRAWS];
+
+// Indirect and parameter buffers are recreated per path so the mirror setting
+// applies from their first bind.
+static void create_buffers(enum call call) {
+    glDeleteBuffers(1, &g_indirect_buffer);
+    glDeleteBuffers(1, &g_parameter_buffer);
+
+    int elements = call == CALL_ELEMENTS_INDIRECT || call == CALL_ELEMENTS_INDIRECT_COUNT;
+    GLuint commands[DRAWS * 5];
+    GLuint words = elements ? 5 : 4;
+    for (GLuint i = 0; i < DRAWS; ++i) {
+        GLuint* command = commands + i * words;
+        command[0] = 3;     // count
+        command[1] = 1;     // instanceCount
+        command[2] = 0;     // first or firstIndex
+        command[3] = i;     // baseInstance or baseVertex
+        if (elements) {
+            command[3] = 0;
+            command[4] = i; // baseInstance
+        }
+    }
+    glGenBuffers(1, &g_indirect_buffer);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, g_indirect_buffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, DRAWS * words * sizeof(GLuint), commands, GL_STATIC_DRAW);
+
+    GLuint count = DRAWS;
+    glGenBuffers(1, &g_parameter_buffer);
+    glBindBuffer(GL_PARAMETER_BUFFER, g_parameter_buffer);
+    glBufferData(GL_PARAMETER_BUFFER, sizeof(count), &count, GL_STATIC_DRAW);
+}
+
+static void issue(enum call call) {
+    switch (call) {
+        case CALL_ARRAYS_INDIRECT:
+            glMultiDrawArraysIndirect(GL_TRIANGLES, NULL, DRAWS, 0);
+            break;
+        case CALL_ELEMENTS_INDIRECT:
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, NULL, DRAWS, 0);
+            break;
+        case CALL_ARRAYS_INDIRECT_COUNT:
+            glMultiDrawArraysIndirectCount(GL_TRIANGLES, NULL, 0, DRAWS, 0);
+            break;
+        case CALL_ELEMENTS_INDIRECT_COUNT:
+            glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_SHORT, NULL, 0, DRAWS, 0);
+            break;
+        case CALL_ARRAYS_CLIENT:
+            glMultiDrawArrays(GL_TRIANGLES, g_firsts, g_counts, DRAWS);
+            break;
+    }
+}
+
+// Returns draws per second, or 0 when the path can't run on this driver.
+static double run(const struct path* path) {
+    if (path->program == PROGRAM_PLAIN && !gles.ext.glMultiDrawArraysIndirectEXT) return 0;
+
+    g_config.indirect_mirror = path->mirror;
+    create_buffers(path->call);
+    glUseProgram(g_programs[path->program]);
+
+    // Without the rewrite program the layer falls back to reading the commands back.
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    GLuint rewrite_program = scratch->indirect_program;
+    GLboolean rewrite_failed = scratch->indirect_program_failed;
+    if (!path->rewrite) {
+        scratch->indirect_program = 0;
+        scratch->indirect_program_failed = GL_TRUE;
+    }
+
+    issue(path->call);
+    glFinish();
+    long calls = 0;
+    double start = bench_now(), elapsed;
+    do {
+        issue(path->call);
+        calls++;
+        if (calls % 8 == 0) glFinish();
+        elapsed = bench_now() - start;
+    } while (elapsed < MIN_SECONDS || calls < 8);
+    glFinish();
+    elapsed = bench_now() - start;
+
+    if (!path->rewrite) {
+        scratch->indirect_program = rewrite_program;
+        scratch->indirect_program_failed = rewrite_failed;
+    }
+    GLenum error = glGetError();
+    if (error != GL_NO_ERROR) fprintf(stderr, "bench: GL error 0x%x on %s\n", error, path->name);
+    return calls * (double)DRAWS / elapsed;
+}
+
+int main(void) {
+    if (!bench_context_init()) return 1;
+
+    g_programs[PROGRAM_PLAIN] = bench_program(vertex_plain, fragment_source, NULL);
+    g_programs[PROGRAM_DRAW_ID] = bench_program(vertex_draw_id, fragment_source, NULL);
+    g_programs[PROGRAM_BASE_INSTANCE] = bench_program(vertex_base_instance, fragment_source, NULL);
+    for (GLsizei i = 0; i < DRAWS; ++i) {
+        g_firsts[i] = 0;
+        g_counts[i] = 3;
+    }
+
+    GLuint vertex_array, element_buffer;
+    static const GLushort indices[] = { 0, 1, 2 };
+    glGenVertexArrays(1, &vertex_array);
+    glBindVertexArray(vertex_array);
+    glGenBuffers(1, &element_buffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    printf("%-34s %-28s %14s\n", "entry point", "path", "draws/s");
+    for (size_t i = 0; i < sizeof(g_paths) / sizeof(g_paths[0]); ++i) {
+        const struct path* path = &g_paths[i];
+        double rate = run(path);
+        if (rate > 0) printf("%-34s %-28s %14.0f\n", g_call_names[path->call], path->name, rate);
+        else printf("%-34s %-28s %14s\n", g_call_names[path->call], path->name, "unavailable");
+    }
+
+    glDeleteBuffers(1, &g_indirect_buffer);
+    glDeleteBuffers(1, &g_parameter_buffer);
+    glDeleteBuffers(1, &element_buffer);
+    glDeleteVertexArrays(1, &vertex_array);
+    for (int i = 0; i < 3; ++i) glDeleteProgram(g_programs[i]);
+    bench_context_shutdown();
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Lookup cost of the paged object table against the stb_ds hash map it
+// replaced, at 1k, 100k and 1M live names. Built with -DGLT_BUILD_BENCHMARKS=ON.
+
+#define _GNU_SOURCE
+#define STB_DS_IMPLEMENTATION
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "object_table.h"
+#include "stb_ds.h"
+
+#define LOOKUPS (1u << 24)
+
+struct record {
+    uint32_t flags;
+    uint32_t size;
+};
+
+struct map_entry {
+    uint32_t key;
+    struct record value;
+};
+
+static volatile uint32_t g_sink;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Names in the order the lookups visit them: either as generated or shuffled.
+static uint32_t* lookup_order(uint32_t count, int shuffled) {
+    uint32_t* names = malloc(LOOKUPS * sizeof(*names));
+    uint64_t seed = 0x9e3779b97f4a7c15ull;
+    for (uint32_t i = 0; i < LOOKUPS; ++i) {
+        if (shuffled) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            names[i] = 1 + (uint32_t)((seed >> 33) % count);
+        } else {
+            names[i] = 1 + i % count;
+        }
+    }
+    return names;
+}
+
+static double bench_table(struct object_table* table, const uint32_t* names) {
+    uint32_t sum = 0;
+    double start = now_ns();
+    for (uint32_t i = 0; i < LOOKUPS; ++i) {
+        struct record* record = object_table_lookup(table, names[i]);
+        sum += record->size;
+    }
+    double elapsed = now_ns() - start;
+    g_sink = sum;
+    return elapsed / LOOKUPS;
+}
+
+static double bench_map(struct map_entry* map, const uint32_t* names) {
+    uint32_t sum = 0;
+    double start = now_ns();
+    for (uint32_t i = 0; i < LOOKUPS; ++i) {
+        sum += hmget(map, names[i]).size;
+    }
+    double elapsed = now_ns() - start;
+    g_sink = sum;
+    return elapsed / LOOKUPS;
+}
+
+int main(void) {
+    static const uint32_t counts[] = { 1000, 100000, 1000000 };
+
+    printf("%10s %12s %12s %12s %12s\n", "objects", "table seq", "table rand", "map seq", "map rand");
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        uint32_t count = counts[c];
+        struct object_table table = OBJECT_TABLE_INIT(struct record);
+        struct map_entry* map = NULL;
+        for (uint32_t name = 1; name <= count; ++name) {
+            struct record record = { .flags = 1, .size = name };
+            *(struct record*)object_table_fetch(&table, name) = record;
+            hmput(map, name, record);
+        }
+
+        uint32_t* sequential = lookup_order(count, 0);
+        uint32_t* random = lookup_order(count, 1);
+        printf("%10u %9.2f ns %9.2f ns %9.2f ns %9.2f ns\n", count,
+            bench_table(&table, sequential), bench_table(&table, random),
+            bench_map(map, sequential), bench_map(map, random));
+
+        free(sequential);
+        free(random);
+        hmfree(map);
+        object_table_free(&table);
+    }
+    return 0;
+}
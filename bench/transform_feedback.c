@@ -0,0 +1,177 @@
+// Cost of getting the vertex count of a transform feedback pass for the
+// redraw, the way particle systems use glDrawTransformFeedback. Each frame
+// captures PARTICLES points in one pass and draws them in a second. The count
+// comes from, in turn:
+//   - nowhere, the draw uses the known particle count, as the baseline
+//   - the layer's query ring, which draws the newest finished pass's count
+//   - the ring with LIBGL_XFB_STRICT, which waits for the pass just issued
+//   - the application's own primitives-written query, read back blocking
+//     before a plain glDrawArrays, which is what the emulation replaces
+// Reported are frames per second, best of RUNS, the passes the drawn count
+// lagged behind the newest one, and the time the CPU stalled for the count:
+// in glGetQueryObjectuiv for the readback, in the layer (STATS_XFB_WAIT_US)
+// for the ring.
+// Run with LIBGL_ALWAYS_SOFTWARE=1 for llvmpipe. Built with
+// -DGLT_BUILD_BENCHMARKS=ON.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+
+#include "context.h"
+#include "config.h"
+#include "stats.h"
+
+#define PARTICLES 65536
+#define FRAMES 200
+#define RUNS 3
+
+static const char* capture_vertex_source =
+    "#version 460 core\n"
+    "out vec4 particle;\n"
+    "void main() {\n"
+    "    float t = float(gl_VertexID) * 0.001;\n"
+    "    vec4 p = vec4(sin(t), cos(t), 0.0, 1.0);\n"
+    "    for (int i = 0; i < 32; ++i) p.xy = p.yx * 0.99 + vec2(0.01, -0.01);\n"
+    "    particle = p;\n"
+    "    gl_Position = p;\n"
+    "}\n";
+
+static const char* draw_vertex_source =
+    "#version 460 core\n"
+    "layout(location = 0) in vec4 particle;\n"
+    "void main() {\n"
+    "    gl_Position = particle;\n"
+    "    gl_PointSize = 1.0;\n"
+    "}\n";
+
+static const char* fragment_source =
+    "#version 460 core\n"
+    "layout(location = 0) out vec4 color;\n"
+    "void main() {\n"
+    "    color = vec4(1.0);\n"
+    "}\n";
+
+enum mode {
+    MODE_KNOWN_COUNT,
+    MODE_RING,
+    MODE_STRICT,
+    MODE_APP_READBACK,
+};
+
+static const char* g_mode_names[] = {
+    "known count",
+    "query ring",
+    "query ring, LIBGL_XFB_STRICT",
+    "application blocking readback",
+};
+
+static GLuint g_capture_program;
+static GLuint g_draw_program;
+static GLuint g_feedback;
+static GLuint g_buffer;
+static GLuint g_vertex_array;
+static GLuint g_query;
+
+struct result {
+    double frames_per_second;
+    double passes_behind; // Per draw
+    double stall_us;      // Per frame
+};
+
+static struct result run(enum mode mode) {
+    g_config.xfb_strict = mode == MODE_STRICT;
+    uint64_t draws = g_stats[STATS_XFB_DRAWS];
+    uint64_t behind = g_stats[STATS_XFB_PASSES_BEHIND];
+    uint64_t wait_us = g_stats[STATS_XFB_WAIT_US];
+
+    double stall_seconds = 0;
+    glFinish();
+    double start = bench_now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        glEnable(GL_RASTERIZER_DISCARD);
+        glUseProgram(g_capture_program);
+        glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, g_feedback);
+        if (mode == MODE_APP_READBACK) glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, g_query);
+        glBeginTransformFeedback(GL_POINTS);
+        glDrawArrays(GL_POINTS, 0, PARTICLES);
+        glEndTransformFeedback();
+        if (mode == MODE_APP_READBACK) glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+        glDisable(GL_RASTERIZER_DISCARD);
+
+        glUseProgram(g_draw_program);
+        glBindVertexArray(g_vertex_array);
+        if (mode == MODE_KNOWN_COUNT) {
+            glDrawArrays(GL_POINTS, 0, PARTICLES);
+        } else if (mode == MODE_APP_READBACK) {
+            GLuint primitives = 0;
+            double stall_start = bench_now();
+            glGetQueryObjectuiv(g_query, GL_QUERY_RESULT, &primitives);
+            stall_seconds += bench_now() - stall_start;
+            glDrawArrays(GL_POINTS, 0, primitives);
+        } else {
+            glDrawTransformFeedback(GL_POINTS, g_feedback);
+        }
+        glBindVertexArray(0);
+    }
+    glFinish();
+    double elapsed = bench_now() - start;
+
+    draws = g_stats[STATS_XFB_DRAWS] - draws;
+    behind = g_stats[STATS_XFB_PASSES_BEHIND] - behind;
+    wait_us = g_stats[STATS_XFB_WAIT_US] - wait_us;
+    return (struct result){
+        .frames_per_second = FRAMES / elapsed,
+        .passes_behind = draws ? (double)behind / draws : 0.0,
+        .stall_us = (stall_seconds * 1e6 + wait_us) / FRAMES,
+    };
+}
+
+int main(void) {
+    if (!bench_context_init()) return 1;
+    if (gles.ext.glDrawTransformFeedbackEXT) {
+        fprintf(stderr, "bench: the driver has EXT_draw_transform_feedback, nothing is emulated\n");
+    }
+
+    g_capture_program = bench_program(capture_vertex_source, fragment_source, "particle");
+    g_draw_program = bench_program(draw_vertex_source, fragment_source, NULL);
+
+    glGenBuffers(1, &g_buffer);
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, g_buffer);
+    glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, PARTICLES * 4 * sizeof(GLfloat), NULL, GL_DYNAMIC_COPY);
+    glGenTransformFeedbacks(1, &g_feedback);
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, g_feedback);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, g_buffer);
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+
+    glGenVertexArrays(1, &g_vertex_array);
+    glBindVertexArray(g_vertex_array);
+    glBindBuffer(GL_ARRAY_BUFFER, g_buffer);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+    glGenQueries(1, &g_query);
+
+    // Modes are interleaved so drift in the driver's speed hits them alike.
+    struct result best[4] = { 0 };
+    for (int r = 0; r < RUNS; ++r) {
+        for (int mode = 0; mode < 4; ++mode) {
+            struct result result = run(mode);
+            if (result.frames_per_second > best[mode].frames_per_second) best[mode] = result;
+        }
+    }
+    printf("%-30s %10s %14s %14s\n", "count source", "frames/s", "passes behind", "stall us/frm");
+    for (int mode = 0; mode < 4; ++mode) {
+        printf("%-30s %10.1f %14.2f %14.1f\n", g_mode_names[mode], best[mode].frames_per_second,
+            best[mode].passes_behind, best[mode].stall_us);
+    }
+
+    glDeleteQueries(1, &g_query);
+    glDeleteVertexArrays(1, &g_vertex_array);
+    glDeleteTransformFeedbacks(1, &g_feedback);
+    glDeleteBuffers(1, &g_buffer);
+    glDeleteProgram(g_capture_program);
+    glDeleteProgram(g_draw_program);
+    bench_context_shutdown();
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+struct config_t g_config;
+
+static int env_flag(const char* name) {
+    const char* value = getenv(name);
+    if (!value || value[0] == '\0') return 0;
+    return atoi(value) != 0 || value[0] == 'y' || value[0] == 'Y' || value[0] == 't' || value[0] == 'T';
+}
+
+void config_init(void) {
+    g_config.filter_state = env_flag("LIBGL_FILTER_STATE");
+    g_config.stats = env_flag("LIBGL_STATS");
+    g_config.indirect_mirror = env_flag("LIBGL_INDIRECT_MIRROR");
+    g_config.draw_id_attrib = env_flag("LIBGL_DRAW_ID_ATTRIB");
+    g_config.batch_draws = env_flag("LIBGL_BATCH_DRAWS");
+    g_config.glthread = env_flag("LIBGL_GLTHREAD");
+    g_config.narrow_indices = env_flag("LIBGL_NARROW_INDICES");
+    g_config.xfb_strict = env_flag("LIBGL_XFB_STRICT");
+    g_config.stream_uploads = env_flag("LIBGL_STREAM_UPLOADS");
+    g_config.async_readback = env_flag("LIBGL_ASYNC_READBACK");
+
+    if (g_config.filter_state) fprintf(stderr, "Layer: Redundant state filtering enabled.\n");
+    if (g_config.indirect_mirror) fprintf(stderr, "Layer: CPU mirrors of indirect buffers enabled.\n");
+    if (g_config.draw_id_attrib) fprintf(stderr, "Layer: gl_DrawID is fed from a vertex attribute.\n");
+    if (g_config.batch_draws) fprintf(stderr, "Layer: Draw batching enabled.\n");
+    if (g_config.glthread) fprintf(stderr, "Layer: Threaded dispatch enabled.\n");
+    if (g_config.narrow_indices) fprintf(stderr, "Layer: 32-bit index narrowing enabled.\n");
+    if (g_config.xfb_strict) fprintf(stderr, "Layer: Transform feedback draws wait for the last pass.\n");
+    if (g_config.stream_uploads) fprintf(stderr, "Layer: Streaming buffer uploads enabled.\n");
+    if (g_config.async_readback) fprintf(stderr, "Layer: Asynchronous buffer readback enabled, results may be one call behind.\n");
+}
@@ -0,0 +1,30 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Layer options, read once from the environment when the library is loaded.
+struct config_t {
+    int filter_state; // LIBGL_FILTER_STATE: drop state changes that would not change driver state
+    int stats;        // LIBGL_STATS: print layer statistics on shutdown
+    int indirect_mirror; // LIBGL_INDIRECT_MIRROR: keep CPU copies of indirect buffers for emulated indirect draws
+    int draw_id_attrib;  // LIBGL_DRAW_ID_ATTRIB: feed gl_DrawID from a vertex attribute instead of a uniform
+    int batch_draws;     // LIBGL_BATCH_DRAWS: coalesce consecutive glDrawElements calls into multi-draws
+    int glthread;        // LIBGL_GLTHREAD: run driver calls on a layer-owned GL thread
+    int narrow_indices;  // LIBGL_NARROW_INDICES: draw 32-bit indices that fit in 16 bits from 16-bit copies
+    int xfb_strict;      // LIBGL_XFB_STRICT: emulated glDrawTransformFeedback waits for the last pass's count
+    int stream_uploads;  // LIBGL_STREAM_UPLOADS: route uploads to buffers updated every frame through a staging ring
+    int async_readback;  // LIBGL_ASYNC_READBACK: glGetBufferSubData answers from a fenced copy made by an earlier call
+};
+
+extern struct config_t g_config;
+
+void config_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONFIG_H
@@ -2,7 +2,17 @@
 #include "translate.h"
 #include "cache.h"
 #include "state.h"
+#include "config.h"
+#include "stats.h"
+#include "index.h"
+#include "fill.h"
+#include "page_track.h"
+#include "stb_ds.h"
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #define UNIMPLEMENTED() \
     do { \
@@ -13,49 +23,1985 @@
         } \
     } while (0)
 
+// Drops a call that would not change the driver state, when filtering is enabled.
+#define FILTER_UNCHANGED(changed, counter) \
+    do { \
+        if (!(changed) && g_config.filter_state) { \
+            stats_inc(counter); \
+            return; \
+        } \
+    } while (0)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 // Reusable implementations marked "internal"
-void * glMapBufferRange_internal(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+// The buffer is passed along with the target since the named variants bind it
+// behind the shadow state's back.
+void * glMapBufferRange_internal(GLenum target, GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    // Persistent writes can land at any time, the mirror can't follow them.
+    if (g_config.indirect_mirror && (access & GL_MAP_PERSISTENT_BIT_EXT) && (access & GL_MAP_WRITE_BIT)) {
+        state_buffer_mirror_invalidate(buffer);
+    }
+    // Persistent mappings the layer couldn't shadow fall back to plain ones.
     if ((access & GL_MAP_PERSISTENT_BIT_EXT) && !gles.ext.glBufferStorageEXT) {
         access &= ~(GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT);
     }
 
-    return gles.core.glMapBufferRange(target, offset, length, access);
+    void* pointer = gles.core.glMapBufferRange(target, offset, length, access);
+    if (pointer) state_buffer_set_mapping(buffer, pointer, offset, length, access);
+    return pointer;
 }
 
-void * glMapBuffer_internal(GLenum target, GLenum access) {
-    if(gles.ext.glMapBufferOES) return gles.ext.glMapBufferOES(target, access);
-    GLint size;
-    gles.core.glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+void * glMapBuffer_internal(GLenum target, GLuint buffer, GLenum access) {
     GLbitfield access_flags = 0;
     if (access == GL_READ_ONLY)  access_flags = GL_MAP_READ_BIT;
     if (access == GL_WRITE_ONLY) access_flags = GL_MAP_WRITE_BIT;
     if (access == GL_READ_WRITE) access_flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
-    return gles.core.glMapBufferRange(target, 0, size, access_flags);
+
+    GLsizeiptr size;
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (info) {
+        size = info->size;
+    } else {
+        GLint driver_size = 0;
+        gles.core.glGetBufferParameteriv(target, GL_BUFFER_SIZE, &driver_size);
+        size = driver_size;
+    }
+
+    void* pointer;
+    if(gles.ext.glMapBufferOES) pointer = gles.ext.glMapBufferOES(target, access);
+    else pointer = gles.core.glMapBufferRange(target, 0, size, access_flags);
+    if (pointer) state_buffer_set_mapping(buffer, pointer, 0, size, access_flags);
+    return pointer;
+}
+
+// --- Scratch bindings for DSA emulation ---
+
+// Binds buffer for a DSA emulation and returns the target it is bound to. The
+// binding is left in place, so back-to-back calls on one buffer bind it once.
+static GLenum buffer_bind_scratch(GLuint buffer) {
+    if (state_buffer_get_scratch_binding(GL_COPY_READ_BUFFER) == buffer) return GL_COPY_READ_BUFFER;
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    return GL_COPY_WRITE_BUFFER;
+}
+
+
+// Returns the target a buffer entry point should pass to the driver. Puts the
+// application's copy buffer binding back if a DSA emulation replaced it, and
+// routes GL_PARAMETER_BUFFER, which GLES lacks, through a scratch binding.
+static GLenum buffer_sync_target(GLenum target) {
+    if (target == GL_PARAMETER_BUFFER) return buffer_bind_scratch(state_buffer_get_binding(GL_PARAMETER_BUFFER));
+    if ((target == GL_COPY_READ_BUFFER || target == GL_COPY_WRITE_BUFFER) && state_buffer_sync_scratch(target)) {
+        gles.core.glBindBuffer(target, state_buffer_get_binding(target));
+    }
+    return target;
+}
+
+
+// The last texture unit is reserved for DSA emulation and hidden from
+// GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS.
+static GLuint texture_scratch_unit(void) {
+    static GLint scratch_unit = -1;
+    if (scratch_unit < 0) {
+        GLint max_units = 0;
+        gles.core.glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &max_units);
+        if (max_units > STATE_MAX_TEXTURE_UNITS) max_units = STATE_MAX_TEXTURE_UNITS;
+        scratch_unit = max_units - 1;
+    }
+    return scratch_unit;
+}
+
+// Makes the application's active texture unit current again after DSA emulation.
+static inline void texture_sync_active_unit(void) {
+    if (state_texture_sync_active_unit()) gles.core.glActiveTexture(state_texture_get_active_unit());
+}
+
+// Binds texture on the scratch unit for a DSA emulation and returns its target.
+static GLenum texture_bind_scratch(GLuint texture) {
+    GLenum target = state_texture_get_target(texture);
+    GLuint unit = texture_scratch_unit();
+    if (state_texture_set_driver_active_unit(unit)) gles.core.glActiveTexture(GL_TEXTURE0 + unit);
+    if (state_texture_bind_unit(unit, target, texture)) gles.core.glBindTexture(target, texture);
+    return target;
+}
+
+// Answers a level query from the recorded texture metadata. Returns 0 when the
+// layer doesn't know the value and the driver has to be asked.
+static int texture_level_parameter(GLuint texture, GLint level, GLenum pname, GLint* param) {
+    const struct state_texture_level* info = state_texture_get_level(texture, level);
+    if (!info) return 0;
+    switch (pname) {
+        case GL_TEXTURE_WIDTH:           *param = info->width; return 1;
+        case GL_TEXTURE_HEIGHT:          *param = info->height; return 1;
+        case GL_TEXTURE_DEPTH:           *param = info->depth; return 1;
+        case GL_TEXTURE_INTERNAL_FORMAT: *param = info->internal_format; return 1;
+        case GL_TEXTURE_SAMPLES:         *param = info->samples; return 1;
+        case GL_TEXTURE_COMPRESSED:
+            if (!info->compressed_size) return 0; // Could still be compressed storage
+            *param = GL_TRUE;
+            return 1;
+        case GL_TEXTURE_COMPRESSED_IMAGE_SIZE:
+            if (!info->compressed_size) return 0;
+            *param = info->compressed_size;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Limits that include the texture unit, storage buffer bindings and vertex
+// inputs reserved by the layer are reported without them.
+static GLint64 application_limit(GLenum pname, GLint64 value) {
+    GLint base_instance_binding;
+    switch (pname) {
+        case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+            return texture_scratch_unit();
+        case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS:
+            base_instance_binding = shader_base_instance_binding();
+            return base_instance_binding >= 0 ? base_instance_binding - 1 : value;
+        case GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS:
+        case GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS:
+            return shader_base_instance_binding() >= 0 ? value - 1 : value;
+        case GL_MAX_VERTEX_ATTRIBS:
+        case GL_MAX_VERTEX_ATTRIB_BINDINGS:
+            if (shader_draw_id_attribute() >= 0) value -= 1;
+            // Base instance emulation only offsets the bindings it records.
+            if (!gles.ext.glDrawArraysInstancedBaseInstanceEXT && value > STATE_MAX_VERTEX_BINDINGS) value = STATE_MAX_VERTEX_BINDINGS;
+            return value;
+        default:
+            return value;
+    }
+}
+
+// Driver queries must see the application's bindings.
+static void sync_scratch_bindings(void) {
+    buffer_sync_target(GL_COPY_READ_BUFFER);
+    buffer_sync_target(GL_COPY_WRITE_BUFFER);
+    texture_sync_active_unit();
+}
+
+// Records the result of a link or binary load and resolves the emulation
+// uniforms, so draws don't have to look them up by name.
+static void program_update_link_status(GLuint program) {
+    GLint status = GL_FALSE;
+    gles.core.glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        state_program_set_unlinked(program);
+        return;
+    }
+    struct state_program_info info = {
+        .draw_id_location = gles.core.glGetUniformLocation(program, "glt_draw_id"),
+        .base_instance_location = gles.core.glGetUniformLocation(program, "glt_base_instance"),
+        .draw_id_attribute = gles.core.glGetAttribLocation(program, "glt_draw_id"),
+    };
+    state_program_set_linked(program, &info);
+}
+
+// Never NULL, programs without a record use no emulation.
+static const struct state_program_info* current_program_info(void) {
+    static const struct state_program_info no_emulation = { -1, -1, -1 };
+    GLuint program = state_program_get_current();
+    if (program == 0) return &no_emulation;
+    const struct state_program_info* info = state_program_get_info(program);
+    if (!info) {
+        // Linked before its record existed, or the record was dropped by glDeleteProgram while still current.
+        program_update_link_status(program);
+        info = state_program_get_info(program);
+    }
+    return info ? info : &no_emulation;
+}
+
+static inline int uses_draw_id(const struct state_program_info* info) {
+    return info->draw_id_location != -1 || info->draw_id_attribute != -1;
+}
+
+// The glt_draw_id attribute has no array enabled outside of
+// multi_draw_draw_id_attribute, so draws read its generic value.
+static inline void set_draw_id(const struct state_program_info* info, GLint draw_id) {
+    if (info->draw_id_location != -1) gles.core.glUniform1i(info->draw_id_location, draw_id);
+    else if (info->draw_id_attribute != -1) gles.core.glVertexAttribI4i(info->draw_id_attribute, draw_id, 0, 0, 0);
+}
+
+// Plain draws after a multi-draw loop must see gl_DrawID 0 again.
+static inline void reset_draw_id(const struct state_program_info* info) {
+    if (info->draw_id_attribute != -1) gles.core.glVertexAttribI4i(info->draw_id_attribute, 0, 0, 0, 0);
+}
+
+// --- Base instance emulation ---
+
+// Without EXT_base_instance, the instanced bindings of the vertex array are
+// offset by base_instance elements instead. The offsets stay applied until a
+// draw needs another base instance, so repeated draws of one instance range
+// rebind nothing. array must be bound in the driver.
+static void vertex_array_apply_base_instance(GLuint array, GLuint base_instance) {
+    if (state_vertex_array_get_base_instance(array) == base_instance) return;
+    const struct state_vertex_binding* bindings = state_vertex_array_get_bindings(array);
+    GLuint instanced = state_vertex_array_get_instanced(array);
+    if (!bindings) return;
+    for (GLuint i = 0; i < STATE_MAX_VERTEX_BINDINGS; ++i) {
+        if (!(instanced & (1u << i))) continue;
+        GLintptr offset = bindings[i].offset + (GLintptr)base_instance * bindings[i].stride;
+        gles.core.glBindVertexBuffer(i, bindings[i].buffer, offset, bindings[i].stride);
+    }
+    state_vertex_array_set_base_instance(array, base_instance);
+}
+
+// Draws, queries and binding changes outside the emulation see the
+// application's offsets.
+static inline void vertex_array_restore_base_instance(void) {
+    GLuint array = state_vertex_array_get_binding();
+    if (state_vertex_array_get_base_instance(array) != 0) vertex_array_apply_base_instance(array, 0);
+}
+
+static inline void set_base_instance(const struct state_program_info* info, GLuint base_instance) {
+    if (info->base_instance_location != -1) gles.core.glUniform1i(info->base_instance_location, base_instance);
+}
+
+// Bytes per vertex of a tightly packed glVertexAttribPointer array.
+static GLsizei vertex_attrib_size(GLint size, GLenum type) {
+    if (size == GL_BGRA) size = 4;
+    switch (type) {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+            return size;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:
+            return size * 2;
+        case GL_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_10F_11F_11F_REV:
+            return 4;
+        case GL_DOUBLE:
+            return size * 8;
+        default:
+            return size * 4;
+    }
+}
+
+// --- Indirect draw emulation ---
+
+typedef struct {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+} DrawArraysIndirectCommand;
+
+typedef struct {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+} DrawElementsIndirectCommand;
+
+static GLsizei index_type_size(GLenum type) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+        default:                return 4;
+    }
+}
+
+// Size in words of the indirect commands of the arrays (type 0) or elements draws.
+static inline GLuint indirect_command_words(GLenum type) {
+    return type ? sizeof(DrawElementsIndirectCommand) / sizeof(GLuint) : sizeof(DrawArraysIndirectCommand) / sizeof(GLuint);
+}
+
+// Issues indirect commands that are readable on the CPU one at a time, feeding
+// the emulated gl_DrawID and gl_BaseInstance.
+static void draw_indirect_commands(GLenum mode, GLenum type, const void* commands, GLsizei drawcount, GLsizei stride, const struct state_program_info* info) {
+    GLint base_instance_loc = info->base_instance_location;
+    for (GLsizei i = 0; i < drawcount; ++i) {
+        const void* command = (const uint8_t*)commands + i * stride;
+        if (type) {
+            const DrawElementsIndirectCommand* cmd = command;
+            if (cmd->instanceCount == 0) continue;
+            set_draw_id(info, i);
+            if (base_instance_loc != -1) gles.core.glUniform1i(base_instance_loc, cmd->baseInstance);
+            const void* indices = (const void*)(uintptr_t)(cmd->firstIndex * index_type_size(type));
+            gles.core.glDrawElementsInstancedBaseVertex(mode, cmd->count, type, indices, cmd->instanceCount, cmd->baseVertex);
+        } else {
+            const DrawArraysIndirectCommand* cmd = command;
+            if (cmd->instanceCount == 0) continue;
+            set_draw_id(info, i);
+            if (base_instance_loc != -1) gles.core.glUniform1i(base_instance_loc, cmd->baseInstance);
+            gles.core.glDrawArraysInstanced(mode, cmd->first, cmd->count, cmd->instanceCount);
+        }
+    }
+    reset_draw_id(info);
+    set_base_instance(info, 0);
+}
+
+// Issues the commands at offset in the bound indirect buffer one at a time.
+static void draw_indirect_offsets(GLenum mode, GLenum type, GLintptr offset, GLsizei drawcount, GLsizei stride, const struct state_program_info* info) {
+    for (GLsizei i = 0; i < drawcount; ++i) {
+        set_draw_id(info, i);
+        const void* command = (const void*)(offset + i * stride);
+        if (type) gles.core.glDrawElementsIndirect(mode, type, command);
+        else gles.core.glDrawArraysIndirect(mode, command);
+    }
+    reset_draw_id(info);
+}
+
+// Buffers bound as indirect or parameter buffers get a CPU mirror, and buffers
+// bound where the GPU can write to them lose theirs and stop being cached.
+static inline void buffer_track_binding(GLenum target, GLuint buffer) {
+    if (buffer == 0) return;
+    switch (target) {
+        case GL_DRAW_INDIRECT_BUFFER:
+        case GL_PARAMETER_BUFFER:
+            if (g_config.indirect_mirror) state_buffer_mirror_enable(buffer);
+            break;
+        case GL_PIXEL_PACK_BUFFER:
+        case GL_SHADER_STORAGE_BUFFER:
+        case GL_TRANSFORM_FEEDBACK_BUFFER:
+        case GL_ATOMIC_COUNTER_BUFFER:
+            state_buffer_mark_gpu_written(buffer);
+            if (g_config.indirect_mirror) state_buffer_mirror_invalidate(buffer);
+            break;
+        default:
+            break;
+    }
+}
+
+// Copies what the application wrote through a mapping into the mirror. Explicitly
+// flushed mappings are copied as they are flushed instead.
+static void buffer_mirror_unmap(GLuint buffer) {
+    if (!g_config.indirect_mirror) return;
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (!info || !info->map_pointer || !(info->map_access & GL_MAP_WRITE_BIT)) return;
+    if (info->map_access & GL_MAP_FLUSH_EXPLICIT_BIT) return;
+    state_buffer_mirror_write(buffer, info->map_offset, info->map_length, info->map_pointer);
+}
+
+static void buffer_mirror_flush(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    if (!g_config.indirect_mirror) return;
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (!info || !info->map_pointer) return;
+    state_buffer_mirror_write(buffer, info->map_offset + offset, length, (const char*)info->map_pointer + offset);
+}
+
+// --- GPU rewrite of indirect draw commands ---
+//
+// GLES requires baseInstance to be zero in indirect commands and has no
+// *IndirectCount draws. Rather than reading the buffers back, a compute pass
+// copies the commands into a scratch buffer laid out as
+//
+//     [base instance per draw] [commands] [draw count]
+//
+// with baseInstance cleared and commands past the draw count culled to zero
+// instances. The translated vertex shaders read the base instances from the
+// front of the buffer (see shader_base_instance_binding).
+
+static const char* indirect_rewrite_source =
+    "#version 310 es\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std430, binding = %d) readonly buffer commands_in { uint src[]; };\n"
+    "layout(std430, binding = %d) buffer commands_out { uint dst[]; };\n"
+    "layout(location = 0) uniform uint src_offset;\n"
+    "layout(location = 1) uniform uint src_stride;\n"
+    "layout(location = 2) uniform uint draw_count;\n"
+    "layout(location = 3) uniform uint command_words;\n"
+    "layout(location = 4) uniform bool use_count;\n"
+    "void main() {\n"
+    "    uint i = gl_GlobalInvocationID.x;\n"
+    "    if (i >= draw_count) return;\n"
+    "    uint d = draw_count + i * command_words;\n"
+    "    if (use_count && i >= dst[draw_count * (command_words + 1u)]) {\n"
+    "        dst[i] = 0u;\n"
+    "        for (uint j = 0u; j < command_words; ++j) dst[d + j] = 0u;\n"
+    "        return;\n"
+    "    }\n"
+    "    uint s = src_offset + i * src_stride;\n"
+    "    dst[i] = src[s + command_words - 1u];\n"
+    "    for (uint j = 0u; j < command_words - 1u; ++j) dst[d + j] = src[s + j];\n"
+    "    dst[d + command_words - 1u] = 0u;\n"
+    "}\n";
+
+static GLuint indirect_rewrite_program(struct state_scratch_objects* scratch) {
+    if (scratch->indirect_program || scratch->indirect_program_failed) return scratch->indirect_program;
+    GLint binding = shader_base_instance_binding();
+    GLuint program = 0;
+    GLint linked = GL_FALSE;
+    if (binding >= 0 && gles.core.glCreateShaderProgramv) {
+        char source[1536];
+        snprintf(source, sizeof(source), indirect_rewrite_source, binding - 1, binding);
+        const GLchar* sources[] = { source };
+        program = gles.core.glCreateShaderProgramv(GL_COMPUTE_SHADER, 1, sources);
+        if (program) gles.core.glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    }
+    if (!linked) {
+        fprintf(stderr, "Warning: GPU indirect command rewrite is unavailable, indirect buffers will be read back\n");
+        if (program) gles.core.glDeleteProgram(program);
+        scratch->indirect_program_failed = GL_TRUE;
+        return 0;
+    }
+    scratch->indirect_program = program;
+    return program;
+}
+
+// Rewrites drawcount commands of the given indirect buffer. When count_buffer
+// is non-zero, the draw count at count_offset in it culls the commands past it.
+// Returns the offset of the first rewritten command in scratch->indirect_buffer,
+// or -1 if the GPU path can't be used.
+static GLintptr indirect_rewrite_commands(GLenum type, GLuint indirect_buffer, GLintptr offset, GLsizei drawcount, GLsizei stride, GLuint count_buffer, GLintptr count_offset) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    GLuint program = indirect_rewrite_program(scratch);
+    if (!program || drawcount <= 0 || ((offset | stride | count_offset) & 3)) return -1;
+
+    GLuint command_words = indirect_command_words(type);
+    GLintptr commands_offset = drawcount * sizeof(GLuint);
+    GLintptr count_word_offset = commands_offset + drawcount * command_words * sizeof(GLuint);
+    GLsizeiptr size = count_word_offset + sizeof(GLuint);
+    if (!scratch->indirect_buffer) gles.core.glGenBuffers(1, &scratch->indirect_buffer);
+    if (scratch->indirect_buffer_size < size) {
+        GLsizeiptr new_size = scratch->indirect_buffer_size * 2 > size ? scratch->indirect_buffer_size * 2 : size;
+        GLenum target = buffer_bind_scratch(scratch->indirect_buffer);
+        gles.core.glBufferData(target, new_size, NULL, GL_DYNAMIC_COPY);
+        scratch->indirect_buffer_size = new_size;
+    }
+    if (count_buffer) {
+        // The draw count stays on the GPU too.
+        if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, count_buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, count_buffer);
+        if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, scratch->indirect_buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, scratch->indirect_buffer);
+        gles.core.glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, count_offset, count_word_offset, sizeof(GLuint));
+    }
+
+    GLint binding = shader_base_instance_binding();
+    gles.core.glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding - 1, indirect_buffer);
+    gles.core.glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, scratch->indirect_buffer);
+    // glBindBufferBase also replaces the generic binding.
+    gles.core.glBindBuffer(GL_SHADER_STORAGE_BUFFER, state_buffer_get_binding(GL_SHADER_STORAGE_BUFFER));
+
+    gles.core.glProgramUniform1ui(program, 0, offset / sizeof(GLuint));
+    gles.core.glProgramUniform1ui(program, 1, stride / sizeof(GLuint));
+    gles.core.glProgramUniform1ui(program, 2, drawcount);
+    gles.core.glProgramUniform1ui(program, 3, command_words);
+    gles.core.glProgramUniform1i(program, 4, count_buffer != 0);
+    gles.core.glUseProgram(program);
+    gles.core.glDispatchCompute((drawcount + 63) / 64, 1, 1);
+    gles.core.glUseProgram(state_program_get_current());
+    gles.core.glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+    return commands_offset;
+}
+
+// Reads a draw count from the parameter buffer, from its mirror if it has one.
+// Without one this waits for the GPU.
+static GLsizei indirect_read_count(GLuint count_buffer, GLintptr count_offset, GLsizei maxdrawcount) {
+    GLuint count = 0;
+    const GLuint* mirror = state_buffer_get_mirror(count_buffer, count_offset, sizeof(GLuint));
+    if (mirror) {
+        count = *mirror;
+    } else {
+        GLenum target = buffer_bind_scratch(count_buffer);
+        const GLuint* mapped = gles.core.glMapBufferRange(target, count_offset, sizeof(GLuint), GL_MAP_READ_BIT);
+        if (mapped) {
+            count = *mapped;
+            gles.core.glUnmapBuffer(target);
+        }
+    }
+    return count < (GLuint)maxdrawcount ? (GLsizei)count : maxdrawcount;
+}
+
+// Shared implementation of the multi-draw indirect entry points. type is 0 for
+// the arrays draws. count_buffer is 0 unless the draw count comes from
+// GL_PARAMETER_BUFFER, drawcount is then the maximum.
+static void multi_draw_indirect(GLenum mode, GLenum type, GLintptr indirect, GLsizei drawcount, GLsizei stride, GLuint count_buffer, GLintptr count_offset) {
+    GLuint command_words = indirect_command_words(type);
+    if (stride == 0) stride = command_words * sizeof(GLuint);
+    if (drawcount <= 0) return;
+
+    const struct state_program_info* info = current_program_info();
+    GLint base_instance_loc = info->base_instance_location;
+
+    if (!uses_draw_id(info) && base_instance_loc == -1 && !count_buffer) {
+        if (type && gles.ext.glMultiDrawElementsIndirectEXT) {
+            gles.ext.glMultiDrawElementsIndirectEXT(mode, type, (const void*)indirect, drawcount, stride);
+            return;
+        }
+        if (!type && gles.ext.glMultiDrawArraysIndirectEXT) {
+            gles.ext.glMultiDrawArraysIndirectEXT(mode, (const void*)indirect, drawcount, stride);
+            return;
+        }
+    }
+
+    GLuint indirect_buffer = state_buffer_get_binding(GL_DRAW_INDIRECT_BUFFER);
+    if (indirect_buffer == 0) return;
+
+    // Mirrored counts and commands need neither a GPU pass nor a readback.
+    if (count_buffer && state_buffer_get_mirror(count_buffer, count_offset, sizeof(GLuint))) {
+        drawcount = indirect_read_count(count_buffer, count_offset, drawcount);
+        count_buffer = 0;
+        if (drawcount == 0) return;
+    }
+    GLsizeiptr commands_size = (GLsizeiptr)(drawcount - 1) * stride + command_words * sizeof(GLuint);
+    const void* mirror = count_buffer ? NULL : state_buffer_get_mirror(indirect_buffer, indirect, commands_size);
+    if (mirror) {
+        draw_indirect_commands(mode, type, mirror, drawcount, stride, info);
+        return;
+    }
+
+    if (base_instance_loc == -1 && !count_buffer) {
+        draw_indirect_offsets(mode, type, indirect, drawcount, stride, info);
+        return;
+    }
+
+    // The translated shader indexes the per-draw base instances with glt_draw_id.
+    GLintptr commands_offset = (base_instance_loc == -1 || uses_draw_id(info))
+        ? indirect_rewrite_commands(type, indirect_buffer, indirect, drawcount, stride, count_buffer, count_offset) : -1;
+    if (commands_offset >= 0) {
+        if (base_instance_loc != -1) gles.core.glUniform1i(base_instance_loc, -1);
+        gles.core.glBindBuffer(GL_DRAW_INDIRECT_BUFFER, state_get_scratch_objects()->indirect_buffer);
+        draw_indirect_offsets(mode, type, commands_offset, drawcount, command_words * sizeof(GLuint), info);
+        gles.core.glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_buffer);
+        if (base_instance_loc != -1) gles.core.glUniform1i(base_instance_loc, 0);
+        return;
+    }
+
+    // No GPU path, read the count and commands back.
+    if (count_buffer) {
+        drawcount = indirect_read_count(count_buffer, count_offset, drawcount);
+        if (drawcount == 0) return;
+        commands_size = (GLsizeiptr)(drawcount - 1) * stride + command_words * sizeof(GLuint);
+    }
+    if (base_instance_loc == -1) {
+        draw_indirect_offsets(mode, type, indirect, drawcount, stride, info);
+        return;
+    }
+    void* mapped = gles.core.glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, indirect, commands_size, GL_MAP_READ_BIT);
+    if (!mapped) return;
+    draw_indirect_commands(mode, type, mapped, drawcount, stride, info);
+    gles.core.glUnmapBuffer(GL_DRAW_INDIRECT_BUFFER);
+}
+
+// --- gl_DrawID attribute ---
+
+// With LIBGL_DRAW_ID_ATTRIB, client multi-draws become one native indirect
+// multi-draw: draw i gets baseInstance i, and an instanced array of draw IDs on
+// the last vertex binding turns that into the glt_draw_id attribute value.
+
+static GLuint draw_id_binding(void) {
+    static GLint max_bindings = 0;
+    if (max_bindings == 0) gles.core.glGetIntegerv(GL_MAX_VERTEX_ATTRIB_BINDINGS, &max_bindings);
+    return max_bindings - 1;
+}
+
+// Rewriting baseInstance is only safe when nothing else reads it.
+static int draw_id_attribute_usable(const struct state_program_info* info, GLenum type) {
+    if (info->draw_id_attribute == -1 || info->base_instance_location != -1) return 0;
+    // Non-zero baseInstance in indirect commands needs EXT_base_instance.
+    if (!gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT) return 0;
+    if (type ? !gles.ext.glMultiDrawElementsIndirectEXT : !gles.ext.glMultiDrawArraysIndirectEXT) return 0;
+    GLuint array = state_vertex_array_get_binding();
+    if (array == 0 || state_vertex_array_is_instanced(array)) return 0;
+    return !type || state_buffer_get_binding(GL_ELEMENT_ARRAY_BUFFER) != 0;
+}
+
+// Returns the indirect commands of a client elements multi-draw, or NULL when
+// an offset is not a whole number of indices.
+static DrawElementsIndirectCommand* draw_id_element_commands(const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex) {
+    GLsizei index_size = index_type_size(type);
+    DrawElementsIndirectCommand* commands = malloc(drawcount * sizeof(*commands));
+    if (!commands) return NULL;
+    for (GLsizei i = 0; i < drawcount; ++i) {
+        uintptr_t offset = (uintptr_t)indices[i];
+        if (offset % index_size) {
+            free(commands);
+            return NULL;
+        }
+        commands[i] = (DrawElementsIndirectCommand){
+            .count = count[i] > 0 ? count[i] : 0,
+            .instanceCount = 1,
+            .firstIndex = offset / index_size,
+            .baseVertex = basevertex ? basevertex[i] : 0,
+            .baseInstance = i,
+        };
+    }
+    return commands;
+}
+
+static void draw_id_attribute_multi_draw(GLenum mode, GLenum type, const void* commands, GLsizei drawcount, const struct state_program_info* info) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+
+    GLsizeiptr size = drawcount * indirect_command_words(type) * sizeof(GLuint);
+    if (!scratch->draw_commands_buffer) gles.core.glGenBuffers(1, &scratch->draw_commands_buffer);
+    if (scratch->draw_commands_size < size) {
+        scratch->draw_commands_size = scratch->draw_commands_size * 2 > size ? scratch->draw_commands_size * 2 : size;
+    }
+    GLenum target = buffer_bind_scratch(scratch->draw_commands_buffer);
+    // Orphan the previous commands instead of waiting for the draws reading them.
+    gles.core.glBufferData(target, scratch->draw_commands_size, NULL, GL_STREAM_DRAW);
+    gles.core.glBufferSubData(target, 0, size, commands);
+
+    if (scratch->draw_id_count < drawcount) {
+        GLsizei id_count = scratch->draw_id_count * 2 > drawcount ? scratch->draw_id_count * 2 : drawcount;
+        GLint* ids = malloc(id_count * sizeof(GLint));
+        if (!ids) return;
+        for (GLsizei i = 0; i < id_count; ++i) ids[i] = i;
+        if (!scratch->draw_id_buffer) gles.core.glGenBuffers(1, &scratch->draw_id_buffer);
+        target = buffer_bind_scratch(scratch->draw_id_buffer);
+        gles.core.glBufferData(target, id_count * sizeof(GLint), ids, GL_STATIC_DRAW);
+        free(ids);
+        scratch->draw_id_count = id_count;
+    }
+
+    GLuint location = info->draw_id_attribute;
+    GLuint binding = draw_id_binding();
+    gles.core.glVertexAttribIFormat(location, 1, GL_INT, 0);
+    gles.core.glVertexAttribBinding(location, binding);
+    gles.core.glBindVertexBuffer(binding, scratch->draw_id_buffer, 0, sizeof(GLint));
+    gles.core.glVertexBindingDivisor(binding, 1);
+    gles.core.glEnableVertexAttribArray(location);
+
+    gles.core.glBindBuffer(GL_DRAW_INDIRECT_BUFFER, scratch->draw_commands_buffer);
+    if (type) gles.ext.glMultiDrawElementsIndirectEXT(mode, type, NULL, drawcount, 0);
+    else gles.ext.glMultiDrawArraysIndirectEXT(mode, NULL, drawcount, 0);
+    gles.core.glBindBuffer(GL_DRAW_INDIRECT_BUFFER, state_buffer_get_binding(GL_DRAW_INDIRECT_BUFFER));
+
+    gles.core.glDisableVertexAttribArray(location);
+}
+
+// --- Element buffer conversion ---
+
+// GLES only restarts at the all-ones index (GL_PRIMITIVE_RESTART_FIXED_INDEX),
+// which GL_PRIMITIVE_RESTART turns on in the driver. With any other restart
+// index, element draws read a copy of the element buffer in which the restart
+// index is rewritten to all ones.
+//
+// With LIBGL_NARROW_INDICES, uploads to element buffers are scanned for their
+// largest index, and 32-bit indices that all fit in 16 bits are drawn from a
+// 16-bit copy, halving index fetches. Draws with primitive restart enabled
+// are not narrowed.
+//
+// A copy is kept until the buffer or the conversion changes, so static meshes
+// are converted once. Client-side indices are drawn as they are.
+
+static void index_copy_convert(void* dst, const void* src, GLsizeiptr size, GLenum type, GLenum draw_type, GLuint restart_index) {
+    if (draw_type != type) {
+        index_narrow_u32_to_u16(dst, src, size / 4);
+        return;
+    }
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+            index_restart_to_fixed_u8(dst, src, size, restart_index);
+            break;
+        case GL_UNSIGNED_SHORT:
+            index_restart_to_fixed_u16(dst, src, size / 2, restart_index);
+            break;
+        default:
+            index_restart_to_fixed_u32(dst, src, size / 4, restart_index);
+            break;
+    }
+}
+
+// Returns the contents of a buffer with a known data store for reading on the
+// CPU, from its mirror when it has one and otherwise mapped through
+// GL_COPY_READ_BUFFER. NULL when it can't be read.
+static const void* buffer_read_begin(GLuint buffer, const struct state_buffer_info* info, GLboolean* mapped) {
+    *mapped = GL_FALSE;
+    const void* contents = state_buffer_get_mirror(buffer, 0, info->size);
+    if (contents) return contents;
+    // The driver can't map a buffer the application has mapped.
+    if (info->map_pointer) return NULL;
+    if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+    contents = gles.core.glMapBufferRange(GL_COPY_READ_BUFFER, 0, info->size, GL_MAP_READ_BIT);
+    *mapped = contents != NULL;
+    return contents;
+}
+
+static inline void buffer_read_end(GLboolean mapped) {
+    if (mapped) gles.core.glUnmapBuffer(GL_COPY_READ_BUFFER);
+}
+
+// Writes through a persistent mapping don't change the buffer's generation,
+// so nothing derived from a buffer mapped for writing may be cached.
+static inline int buffer_mapped_for_write(const struct state_buffer_info* info) {
+    return info && info->map_pointer && (info->map_access & GL_MAP_WRITE_BIT);
+}
+
+// Application mapping of a buffer at offset, with the number of mapped bytes
+// from there in available. NULL when offset is outside the mapping.
+static inline char* buffer_mapped_at(const struct state_buffer_info* info, GLintptr offset, GLsizeiptr* available) {
+    if (!info || !info->map_pointer || offset < info->map_offset || offset >= info->map_offset + info->map_length) return NULL;
+    *available = info->map_offset + info->map_length - offset;
+    return (char*)info->map_pointer + (offset - info->map_offset);
+}
+
+// Returns the converted copy of buffer, or 0 when it can't be read.
+static GLuint index_copy_get(GLuint buffer, GLenum type, GLenum draw_type, GLuint restart_index) {
+    struct state_index_copy* copy = state_buffer_get_index_copy(buffer);
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (!copy || !info || info->size <= 0 || buffer_mapped_for_write(info)) return 0;
+    GLuint generation = state_buffer_get_generation(buffer);
+    if (copy->buffer && copy->type == type && copy->draw_type == draw_type && copy->restart_index == restart_index &&
+        copy->generation == generation) {
+        return copy->buffer;
+    }
+    GLboolean mapped;
+    const void* source = buffer_read_begin(buffer, info, &mapped);
+    if (!source) return 0;
+
+    GLsizeiptr copy_size = draw_type != type ? info->size / 4 * 2 : info->size;
+    if (!copy->buffer) gles.core.glGenBuffers(1, &copy->buffer);
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, copy->buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, copy->buffer);
+    gles.core.glBufferData(GL_COPY_WRITE_BUFFER, copy_size, NULL, GL_STATIC_DRAW);
+    void* dest = copy_size > 0 ? gles.core.glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, copy_size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT) : NULL;
+    if (dest) {
+        index_copy_convert(dest, source, info->size, type, draw_type, restart_index);
+        gles.core.glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    }
+    buffer_read_end(mapped);
+    if (!dest) return 0;
+
+    copy->type = type;
+    copy->draw_type = draw_type;
+    copy->restart_index = restart_index;
+    copy->generation = generation;
+    stats_inc(STATS_INDEX_CONVERSIONS);
+    return copy->buffer;
+}
+
+static void index_copy_delete(GLuint buffer) {
+    struct state_index_copy* copy = state_buffer_get_index_copy(buffer);
+    if (!copy || !copy->buffer) return;
+    state_buffer_remove(copy->buffer);
+    gles.core.glDeleteBuffers(1, &copy->buffer);
+}
+
+// Records the largest index of an upload to buffer, or makes it unknown when
+// the data can't be scanned as 32-bit indices. element is false for uploads
+// through other targets, which are not scanned.
+static inline void index_track_data(GLuint buffer, GLboolean element, GLsizeiptr size, const void* data) {
+    if (!g_config.narrow_indices || !element || size % 4) return;
+    state_buffer_set_max_index(buffer, data ? index_max_u32(data, size / 4) : 0);
+}
+
+static inline void index_track_sub_data(GLuint buffer, GLboolean element, GLintptr offset, GLsizeiptr size, const void* data) {
+    if (!g_config.narrow_indices) return;
+    int scan = element && data && offset % 4 == 0 && size % 4 == 0;
+    state_buffer_raise_max_index(buffer, scan ? index_max_u32(data, size / 4) : UINT32_MAX);
+}
+
+// An element draw as issued to the driver.
+struct element_draw {
+    GLuint element_buffer; // Application's element buffer to put back, 0 when unchanged
+    GLenum type;
+    GLuint shift;          // Offsets into the copy are the application's >> shift
+};
+
+static void element_draw_convert(struct element_draw* draw, GLboolean restart, GLuint restart_index) {
+    GLuint element_buffer = state_buffer_get_binding(GL_ELEMENT_ARRAY_BUFFER);
+    if (element_buffer == 0) return;
+    GLuint copy;
+    if (restart) {
+        GLenum type = draw->type;
+        GLuint all_ones = type == GL_UNSIGNED_BYTE ? UINT8_MAX : type == GL_UNSIGNED_SHORT ? UINT16_MAX : UINT32_MAX;
+        if (restart_index >= all_ones) return;
+        copy = index_copy_get(element_buffer, type, type, restart_index);
+    } else {
+        // 0xffff stays clear of the fixed restart index.
+        if (state_buffer_get_max_index(element_buffer) >= UINT16_MAX) return;
+        copy = index_copy_get(element_buffer, GL_UNSIGNED_INT, GL_UNSIGNED_SHORT, 0);
+        if (copy) {
+            draw->type = GL_UNSIGNED_SHORT;
+            draw->shift = 1;
+        }
+    }
+    if (!copy) return;
+    gles.core.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, copy);
+    draw->element_buffer = element_buffer;
+}
+
+// Binds the converted element buffer an element draw of type needs, if any.
+// narrow is false for draws whose offsets can't be rewritten.
+static inline void element_draw_begin(struct element_draw* draw, GLenum type, GLboolean narrow) {
+    GLuint restart_index;
+    GLboolean restart = state_render_get_primitive_restart(&restart_index) ? GL_TRUE : GL_FALSE;
+    draw->element_buffer = 0;
+    draw->type = type;
+    draw->shift = 0;
+    if (restart || (narrow && g_config.narrow_indices && type == GL_UNSIGNED_INT)) {
+        element_draw_convert(draw, restart, restart_index);
+    }
+}
+
+static inline const void* element_draw_offset(const struct element_draw* draw, const void* indices) {
+    return (const void*)((uintptr_t)indices >> draw->shift);
+}
+
+static inline void element_draw_end(const struct element_draw* draw) {
+    if (draw->element_buffer) gles.core.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, draw->element_buffer);
+}
+
+// --- Persistent mapping emulation ---
+
+// Without EXT_buffer_storage GLES can't keep a buffer mapped while it is in
+// use, so persistent mappings get a layer-owned shadow of the mapped range.
+// Explicitly flushed ranges are uploaded as they are flushed. Other writes are
+// caught by page protection and uploaded before the next draw, dispatch,
+// fence or flush, which also means the kernel can't write to those shadows
+// (read() into them fails with EFAULT). Readable shadows are reloaded from
+// the buffer when glClientWaitSync sees a fence signaled and on glFinish, the
+// points where the application may expect GPU writes to be visible.
+
+static inline int persistent_map_emulated(GLbitfield access) {
+    return (access & GL_MAP_PERSISTENT_BIT_EXT) && !gles.ext.glBufferStorageEXT;
+}
+
+static void persistent_map_upload(void* user, size_t offset, size_t size) {
+    const struct state_persistent_map* map = user;
+    const char* data = (const char*)page_track_memory(map->shadow) + offset;
+    const GLenum target = buffer_bind_scratch(map->buffer);
+    state_buffer_modified(map->buffer);
+    index_track_sub_data(map->buffer, GL_FALSE, map->offset + offset, size, data);
+    gles.core.glBufferSubData(target, map->offset + offset, size, data);
+}
+
+// Copies the mapped range of the buffer into the shadow. Returns 0 when the
+// buffer can't be read.
+static int persistent_map_load(const struct state_persistent_map* map) {
+    const void* contents = state_buffer_get_mirror(map->buffer, map->offset, map->length);
+    if (contents) {
+        page_track_write(map->shadow, 0, contents, map->length);
+        return 1;
+    }
+    if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, map->buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, map->buffer);
+    contents = gles.core.glMapBufferRange(GL_COPY_READ_BUFFER, map->offset, map->length, GL_MAP_READ_BIT);
+    if (!contents) return 0;
+    page_track_write(map->shadow, 0, contents, map->length);
+    gles.core.glUnmapBuffer(GL_COPY_READ_BUFFER);
+    return 1;
+}
+
+// Returns the shadow of the mapped range, or NULL when the buffer's data store
+// is unknown and the mapping can't be emulated.
+static void* persistent_map_begin(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (!info || info->map_pointer || offset < 0 || length <= 0 || offset + length > info->size) return NULL;
+    struct state_persistent_map map = { buffer, offset, length, access, page_track_create(length) };
+    if (!map.shadow) return NULL;
+
+    // Writes are uploaded a page at a time, so the shadow needs the current
+    // contents even when the application never reads them.
+    if (!(access & (GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)) && !persistent_map_load(&map)) {
+        page_track_release(map.shadow);
+        return NULL;
+    }
+    void* pointer = page_track_memory(map.shadow);
+    if (!(access & GL_MAP_FLUSH_EXPLICIT_BIT)) page_track_start(map.shadow);
+    if (g_config.indirect_mirror && (access & GL_MAP_WRITE_BIT)) state_buffer_mirror_invalidate(buffer);
+    state_buffer_set_mapping(buffer, pointer, offset, length, access);
+    state_persistent_map_add(&map);
+    return pointer;
+}
+
+// Ends the emulated mapping of buffer, uploading the writes not uploaded yet
+// when upload is set. Returns 0 when buffer has none.
+static int persistent_map_end(GLuint buffer, GLboolean upload) {
+    struct state_persistent_map map;
+    if (!state_persistent_map_remove(buffer, &map)) return 0;
+    if (upload && !(map.access & GL_MAP_FLUSH_EXPLICIT_BIT)) page_track_collect(map.shadow, persistent_map_upload, &map);
+    page_track_release(map.shadow);
+    state_buffer_clear_mapping(buffer);
+    return 1;
+}
+
+// Uploads a range flushed with glFlushMappedBufferRange. Returns 0 when buffer
+// has no emulated mapping.
+static int persistent_map_flush(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    struct state_persistent_map map;
+    if (!state_persistent_map_get(buffer, &map)) return 0;
+    if (offset >= 0 && length > 0 && offset + length <= map.length) persistent_map_upload(&map, offset, length);
+    page_track_release(map.shadow);
+    return 1;
+}
+
+static __thread struct state_persistent_map* t_persistent_maps;
+
+// Uploads what was written through every tracked mapping since the last sync.
+// Works on copies of the mappings, other threads of the share group must not
+// wait for the uploads.
+static void persistent_maps_sync(void) {
+    size_t count = state_persistent_maps_get(&t_persistent_maps);
+    for (size_t i = 0; i < count; ++i) {
+        struct state_persistent_map* map = &t_persistent_maps[i];
+        if (!(map->access & GL_MAP_FLUSH_EXPLICIT_BIT)) page_track_collect(map->shadow, persistent_map_upload, map);
+        page_track_release(map->shadow);
+    }
+}
+
+// Reloads the shadows the application reads from, after uploading its pending
+// writes. Explicitly flushed shadows have no record of what is still to be
+// flushed, so only read-only ones are reloaded.
+static void persistent_maps_refresh(void) {
+    size_t count = state_persistent_maps_get(&t_persistent_maps);
+    for (size_t i = 0; i < count; ++i) {
+        struct state_persistent_map* map = &t_persistent_maps[i];
+        GLboolean explicit_flush = (map->access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0;
+        if ((map->access & GL_MAP_READ_BIT) && !(explicit_flush && (map->access & GL_MAP_WRITE_BIT))) {
+            if (!explicit_flush) page_track_collect(map->shadow, persistent_map_upload, map);
+            persistent_map_load(map);
+        }
+        page_track_release(map->shadow);
+    }
+}
+
+// --- Streaming uploads ---
+
+// With LIBGL_STREAM_UPLOADS, partial uploads to buffers that were uploaded to
+// in each of the last few frames are written to a staging ring and copied into
+// place on the GPU. The copy queues behind the draws still reading the buffer
+// where a plain glBufferSubData would wait for them. Uploads covering a whole
+// mutable buffer orphan its storage instead. Ring space is reclaimed through
+// one fence per frame, and a ring that fills up is orphaned and grown.
+
+#define STREAM_DETECT_FRAMES 3
+#define STREAM_RING_SIZE (4 * 1024 * 1024)
+#define STREAM_RING_MAX_SIZE (64 * 1024 * 1024)
+#define STREAM_ALIGNMENT 64
+
+static void stream_retire(struct state_scratch_objects* scratch) {
+    GLuint retired = 0;
+    while (retired < scratch->stream_fence_count) {
+        struct state_stream_fence* entry = &scratch->stream_fences[retired];
+        GLenum status = gles.core.glClientWaitSync(entry->fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) break;
+        gles.core.glDeleteSync(entry->fence);
+        scratch->stream_freed = entry->allocated;
+        ++retired;
+    }
+    scratch->stream_fence_count -= retired;
+    memmove(scratch->stream_fences, scratch->stream_fences + retired, scratch->stream_fence_count * sizeof(scratch->stream_fences[0]));
+}
+
+// Gives the ring new storage, leaving the old one to the driver along with
+// whatever the GPU still reads from it.
+static void stream_orphan(struct state_scratch_objects* scratch, GLsizeiptr size) {
+    for (GLuint i = 0; i < scratch->stream_fence_count; ++i) gles.core.glDeleteSync(scratch->stream_fences[i].fence);
+    scratch->stream_fence_count = 0;
+    scratch->stream_head = 0;
+    scratch->stream_allocated = 0;
+    scratch->stream_freed = 0;
+    if (!scratch->stream_buffer) gles.core.glGenBuffers(1, &scratch->stream_buffer);
+    if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, scratch->stream_buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, scratch->stream_buffer);
+    gles.core.glBufferData(GL_COPY_READ_BUFFER, size, NULL, GL_STREAM_DRAW);
+    scratch->stream_size = size;
+}
+
+// Returns the ring offset of size free bytes, without waiting for the GPU.
+static GLintptr stream_alloc(struct state_scratch_objects* scratch, GLsizeiptr size) {
+    size = (size + STREAM_ALIGNMENT - 1) & ~(GLsizeiptr)(STREAM_ALIGNMENT - 1);
+    stream_retire(scratch);
+    // An allocation that doesn't fit before the end skips the ring's tail.
+    GLsizeiptr skipped = scratch->stream_head + size > scratch->stream_size ? scratch->stream_size - scratch->stream_head : 0;
+    if (scratch->stream_allocated - scratch->stream_freed + skipped + size > (GLuint64)scratch->stream_size) {
+        GLsizeiptr grown = scratch->stream_size * 2 <= STREAM_RING_MAX_SIZE ? scratch->stream_size * 2 : scratch->stream_size;
+        stream_orphan(scratch, grown);
+        stats_inc(STATS_STREAM_RING_ORPHANS);
+        skipped = 0;
+    }
+    scratch->stream_allocated += skipped + size;
+    if (skipped) scratch->stream_head = 0;
+    GLintptr offset = scratch->stream_head;
+    scratch->stream_head += size;
+    return offset;
+}
+
+// Uploads to a buffer that is updated every frame without waiting for the
+// draws reading it. target is where buffer is bound in the driver. Returns 0
+// when the upload should reach the driver as is.
+static int stream_upload(GLuint buffer, GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    if (!g_config.stream_uploads || !data || size <= 0) return 0;
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    if (state_buffer_note_upload(buffer, scratch->frame) < STREAM_DETECT_FRAMES) return 0;
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (!info || info->map_pointer) return 0;
+
+    if (offset == 0 && size == info->size && !info->immutable) {
+        gles.core.glBufferData(target, size, data, info->usage);
+        stats_inc(STATS_STREAMED_UPLOADS);
+        return 1;
+    }
+
+    if (!scratch->stream_buffer) stream_orphan(scratch, STREAM_RING_SIZE);
+    if (size > scratch->stream_size / 4) return 0;
+    GLintptr source = stream_alloc(scratch, size);
+    if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, scratch->stream_buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, scratch->stream_buffer);
+    void* staging = gles.core.glMapBufferRange(GL_COPY_READ_BUFFER, source, size,
+                                               GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!staging) return 0;
+    memcpy(staging, data, size);
+    gles.core.glUnmapBuffer(GL_COPY_READ_BUFFER);
+    gles.core.glCopyBufferSubData(GL_COPY_READ_BUFFER, buffer_bind_scratch(buffer), source, offset, size);
+    stats_inc(STATS_STREAMED_UPLOADS);
+    return 1;
+}
+
+// For glXSwapBuffers. Fences what the frame allocated from the ring.
+void gl_end_frame(void) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    scratch->frame++;
+    if (!scratch->stream_buffer || scratch->stream_fence_count == STATE_STREAM_FENCES) return;
+    GLuint count = scratch->stream_fence_count;
+    GLuint64 fenced = count ? scratch->stream_fences[count - 1].allocated : scratch->stream_freed;
+    if (fenced == scratch->stream_allocated) return;
+    scratch->stream_fences[count].fence = gles.core.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    scratch->stream_fences[count].allocated = scratch->stream_allocated;
+    scratch->stream_fence_count = count + 1;
+}
+
+// --- Buffer readback ---
+
+// GLES has no glGetBufferSubData. Readbacks map the buffer, or a staging copy
+// of the range when the buffer can't be mapped for reading. With
+// LIBGL_ASYNC_READBACK, every call copies the range to a fenced staging buffer
+// and answers from the newest copy that has finished, so readbacks a frame
+// apart never wait for the GPU but see the contents as of an earlier call.
+
+static inline int readback_finished(GLsync fence, GLboolean wait) {
+    GLenum status = gles.core.glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GL_TIMEOUT_IGNORED : 0);
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+// Copies a range of buffer to the start of staging on the GPU.
+static void readback_copy(GLuint buffer, GLintptr offset, GLsizeiptr size, GLuint staging) {
+    if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, staging)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, staging);
+    gles.core.glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, size);
+}
+
+// Maps the first size bytes of staging and copies them to data.
+static int readback_map(GLuint staging, GLsizeiptr size, void* data) {
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, staging)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, staging);
+    const void* contents = gles.core.glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (!contents) return 0;
+    memcpy(data, contents, size);
+    gles.core.glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    return 1;
+}
+
+static void readback_free(struct state_readback* entry) {
+    for (int i = 0; i < STATE_READBACK_DEPTH; ++i) {
+        if (entry->fences[i]) gles.core.glDeleteSync(entry->fences[i]);
+    }
+    gles.core.glDeleteBuffers(STATE_READBACK_DEPTH, entry->staging);
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Drops the readbacks of a deleted buffer so a reused name doesn't see them.
+static void readback_forget(GLuint buffer) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    for (int i = 0; i < STATE_READBACK_CACHE_SIZE; ++i) {
+        if (scratch->readbacks[i].buffer == buffer && buffer != 0) readback_free(&scratch->readbacks[i]);
+    }
+}
+
+static void readback_start(struct state_readback* entry, int stage) {
+    readback_copy(entry->buffer, entry->offset, entry->size, entry->staging[stage]);
+    entry->fences[stage] = gles.core.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    entry->serials[stage] = ++entry->serial;
+}
+
+// Answers from an earlier copy of the range and starts the next one. Returns
+// 0 when the range has no copy yet and has to be read synchronously.
+static int readback_async(GLuint buffer, GLintptr offset, GLsizeiptr size, void* data) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    struct state_readback* entry = NULL;
+    struct state_readback* victim = &scratch->readbacks[0];
+    for (int i = 0; i < STATE_READBACK_CACHE_SIZE && !entry; ++i) {
+        struct state_readback* candidate = &scratch->readbacks[i];
+        if (candidate->buffer == buffer && candidate->offset == offset && candidate->size == size) entry = candidate;
+        else if (!candidate->buffer || (victim->buffer && candidate->last_use < victim->last_use)) victim = candidate;
+    }
+    if (!entry) {
+        if (victim->buffer) readback_free(victim);
+        entry = victim;
+        entry->buffer = buffer;
+        entry->offset = offset;
+        entry->size = size;
+        gles.core.glGenBuffers(STATE_READBACK_DEPTH, entry->staging);
+        for (int i = 0; i < STATE_READBACK_DEPTH; ++i) {
+            if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, entry->staging[i])) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, entry->staging[i]);
+            gles.core.glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_STREAM_READ);
+        }
+        entry->last_use = ++scratch->readback_clock;
+        readback_start(entry, 0);
+        return 0;
+    }
+    entry->last_use = ++scratch->readback_clock;
+
+    // Newest finished copy, or else the oldest one in flight to wait for.
+    int ready = -1, oldest = -1;
+    for (int i = 0; i < STATE_READBACK_DEPTH; ++i) {
+        if (!entry->fences[i]) continue;
+        if (readback_finished(entry->fences[i], GL_FALSE) && (ready < 0 || entry->serials[i] > entry->serials[ready])) ready = i;
+        if (oldest < 0 || entry->serials[i] < entry->serials[oldest]) oldest = i;
+    }
+    if (ready < 0) {
+        if (oldest < 0) return 0;
+        readback_finished(entry->fences[oldest], GL_TRUE);
+        ready = oldest;
+        stats_inc(STATS_READBACK_WAITS);
+    } else {
+        stats_inc(STATS_ASYNC_READBACKS);
+    }
+    if (!readback_map(entry->staging[ready], size, data)) return 0;
+
+    // Copies older than the one read are superseded.
+    GLuint read_serial = entry->serials[ready];
+    int free_stage = -1;
+    for (int i = 0; i < STATE_READBACK_DEPTH; ++i) {
+        if (entry->fences[i] && entry->serials[i] <= read_serial) {
+            gles.core.glDeleteSync(entry->fences[i]);
+            entry->fences[i] = NULL;
+        }
+        if (!entry->fences[i] && free_stage < 0) free_stage = i;
+    }
+    if (free_stage >= 0) readback_start(entry, free_stage);
+    return 1;
+}
+
+// Reads a range of buffer into data, waiting for the GPU if it still writes it.
+static void buffer_get_sub_data(GLuint buffer, GLintptr offset, GLsizeiptr size, void* data) {
+    if (buffer == 0 || size <= 0 || !data) return;
+    persistent_maps_sync();
+    const void* mirror = state_buffer_get_mirror(buffer, offset, size);
+    if (mirror) {
+        memcpy(data, mirror, size);
+        return;
+    }
+    if (g_config.async_readback && readback_async(buffer, offset, size, data)) return;
+
+    // Immutable storage can only be mapped with the access it was created for.
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (!info || (!info->map_pointer && (!info->immutable || (info->storage_flags & GL_MAP_READ_BIT)))) {
+        if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+        const void* contents = gles.core.glMapBufferRange(GL_COPY_READ_BUFFER, offset, size, GL_MAP_READ_BIT);
+        if (contents) {
+            memcpy(data, contents, size);
+            gles.core.glUnmapBuffer(GL_COPY_READ_BUFFER);
+            return;
+        }
+    }
+
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    if (!scratch->readback_buffer) gles.core.glGenBuffers(1, &scratch->readback_buffer);
+    if (scratch->readback_buffer_size < size) {
+        if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, scratch->readback_buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, scratch->readback_buffer);
+        gles.core.glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_STREAM_READ);
+        scratch->readback_buffer_size = size;
+    }
+    readback_copy(buffer, offset, size, scratch->readback_buffer);
+    readback_map(scratch->readback_buffer, size, data);
+}
+
+// --- Buffer clears ---
+
+// GLES has no glClearBufferData. The clear value is converted to the texel
+// of internalformat and repeated over the range by a compute pass, or on
+// GLES 3.0 by copies from a staging buffer filled with it. The compute pass
+// writes whole words, so the bytes before and after a word-aligned range are
+// copied too.
+
+enum clear_kind { CLEAR_UNORM, CLEAR_FLOAT, CLEAR_INT, CLEAR_UINT };
+
+struct clear_format {
+    GLenum internalformat;
+    GLubyte components;
+    GLubyte component_size;
+    GLubyte kind;
+};
+
+// The buffer texture formats, which are the ones buffers can be cleared with.
+static const struct clear_format clear_formats[] = {
+    { GL_R8, 1, 1, CLEAR_UNORM },     { GL_R16, 1, 2, CLEAR_UNORM },
+    { GL_R16F, 1, 2, CLEAR_FLOAT },   { GL_R32F, 1, 4, CLEAR_FLOAT },
+    { GL_R8I, 1, 1, CLEAR_INT },      { GL_R16I, 1, 2, CLEAR_INT },      { GL_R32I, 1, 4, CLEAR_INT },
+    { GL_R8UI, 1, 1, CLEAR_UINT },    { GL_R16UI, 1, 2, CLEAR_UINT },    { GL_R32UI, 1, 4, CLEAR_UINT },
+    { GL_RG8, 2, 1, CLEAR_UNORM },    { GL_RG16, 2, 2, CLEAR_UNORM },
+    { GL_RG16F, 2, 2, CLEAR_FLOAT },  { GL_RG32F, 2, 4, CLEAR_FLOAT },
+    { GL_RG8I, 2, 1, CLEAR_INT },     { GL_RG16I, 2, 2, CLEAR_INT },     { GL_RG32I, 2, 4, CLEAR_INT },
+    { GL_RG8UI, 2, 1, CLEAR_UINT },   { GL_RG16UI, 2, 2, CLEAR_UINT },   { GL_RG32UI, 2, 4, CLEAR_UINT },
+    { GL_RGB32F, 3, 4, CLEAR_FLOAT }, { GL_RGB32I, 3, 4, CLEAR_INT },    { GL_RGB32UI, 3, 4, CLEAR_UINT },
+    { GL_RGBA8, 4, 1, CLEAR_UNORM },  { GL_RGBA16, 4, 2, CLEAR_UNORM },
+    { GL_RGBA16F, 4, 2, CLEAR_FLOAT }, { GL_RGBA32F, 4, 4, CLEAR_FLOAT },
+    { GL_RGBA8I, 4, 1, CLEAR_INT },   { GL_RGBA16I, 4, 2, CLEAR_INT },   { GL_RGBA32I, 4, 4, CLEAR_INT },
+    { GL_RGBA8UI, 4, 1, CLEAR_UINT }, { GL_RGBA16UI, 4, 2, CLEAR_UINT }, { GL_RGBA32UI, 4, 4, CLEAR_UINT },
+};
+
+static const struct clear_format* clear_format_find(GLenum internalformat) {
+    for (size_t i = 0; i < sizeof(clear_formats) / sizeof(clear_formats[0]); ++i) {
+        if (clear_formats[i].internalformat == internalformat) return &clear_formats[i];
+    }
+    return NULL;
+}
+
+static float half_to_float(GLushort half) {
+    GLuint sign = (GLuint)(half & 0x8000) << 16;
+    GLuint exponent = (half >> 10) & 0x1f;
+    GLuint mantissa = half & 0x3ff;
+    GLuint bits;
+    if (exponent == 0x1f) {
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    } else if (exponent) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else {
+        // Subnormal, exactly representable as a float.
+        float value = mantissa / 16777216.0f;
+        return sign ? -value : value;
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Rounds to nearest even, like the GPU would.
+static GLushort float_to_half(float value) {
+    GLuint bits;
+    memcpy(&bits, &value, sizeof(bits));
+    GLushort sign = (bits >> 16) & 0x8000;
+    GLuint exponent = (bits >> 23) & 0xff;
+    GLuint mantissa = bits & 0x7fffff;
+    if (exponent == 0xff) return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+    int e = (int)exponent - 127 + 15;
+    if (e >= 31) return sign | 0x7c00;
+    GLuint shift = 13;
+    GLuint half;
+    if (e <= 0) {
+        if (e < -10) return sign;
+        mantissa |= 0x800000;
+        shift = 14 - e;
+        half = mantissa >> shift;
+    } else {
+        half = ((GLuint)e << 10) | (mantissa >> shift);
+    }
+    // A carry out of the mantissa correctly bumps the exponent, up to infinity.
+    GLuint rest = mantissa & ((1u << shift) - 1);
+    GLuint halfway = 1u << (shift - 1);
+    if (rest > halfway || (rest == halfway && (half & 1))) ++half;
+    return sign | half;
+}
+
+// Reads the clear value given in format and type as RGBA. Integer formats
+// keep their values, the others are normalized like pixel transfers. Returns
+// 0 for unsupported combinations.
+static int clear_value_read(GLenum format, GLenum type, const void* data, double rgba[4]) {
+    int components, integer = 0, bgr = 0;
+    switch (format) {
+        case GL_RED_INTEGER:  integer = 1; // fallthrough
+        case GL_RED:          components = 1; break;
+        case GL_RG_INTEGER:   integer = 1; // fallthrough
+        case GL_RG:           components = 2; break;
+        case GL_RGB_INTEGER:  integer = 1; // fallthrough
+        case GL_RGB:          components = 3; break;
+        case GL_BGR_INTEGER:  integer = 1; // fallthrough
+        case GL_BGR:          components = 3; bgr = 1; break;
+        case GL_RGBA_INTEGER: integer = 1; // fallthrough
+        case GL_RGBA:         components = 4; break;
+        case GL_BGRA_INTEGER: integer = 1; // fallthrough
+        case GL_BGRA:         components = 4; bgr = 1; break;
+        default:              return 0;
+    }
+
+    double value[4] = { 0.0, 0.0, 0.0, 1.0 };
+    for (int c = 0; c < components; ++c) {
+        double v, scale = 0.0;
+        switch (type) {
+            case GL_UNSIGNED_BYTE:  v = ((const GLubyte*)data)[c];  scale = UINT8_MAX; break;
+            case GL_BYTE:           v = ((const GLbyte*)data)[c];   scale = INT8_MAX; break;
+            case GL_UNSIGNED_SHORT: v = ((const GLushort*)data)[c]; scale = UINT16_MAX; break;
+            case GL_SHORT:          v = ((const GLshort*)data)[c];  scale = INT16_MAX; break;
+            case GL_UNSIGNED_INT:   v = ((const GLuint*)data)[c];   scale = UINT32_MAX; break;
+            case GL_INT:            v = ((const GLint*)data)[c];    scale = INT32_MAX; break;
+            case GL_HALF_FLOAT:     v = half_to_float(((const GLushort*)data)[c]); break;
+            case GL_FLOAT:          v = ((const GLfloat*)data)[c]; break;
+            default:                return 0;
+        }
+        if (scale != 0.0 && !integer) {
+            v /= scale;
+            if (v < -1.0) v = -1.0;
+        }
+        value[c] = v;
+    }
+    if (bgr) {
+        double red = value[0];
+        value[0] = value[2];
+        value[2] = red;
+    }
+    memcpy(rgba, value, sizeof(value));
+    return 1;
+}
+
+static inline double clear_clamp(double value, double low, double high) {
+    if (value != value) return 0.0;
+    return value < low ? low : value > high ? high : value;
+}
+
+// Writes the texel of format holding rgba to out.
+static void clear_value_pack(const struct clear_format* format, const double rgba[4], GLubyte* out) {
+    for (int c = 0; c < format->components; ++c) {
+        union { GLubyte u8; GLushort u16; GLuint u32; GLbyte i8; GLshort i16; GLint i32; GLfloat f32; } texel;
+        double v = rgba[c];
+        int wide = format->component_size == 4, narrow = format->component_size == 1;
+        switch (format->kind) {
+            case CLEAR_UNORM:
+                v = clear_clamp(v, 0.0, 1.0) * (narrow ? UINT8_MAX : UINT16_MAX) + 0.5;
+                if (narrow) texel.u8 = (GLubyte)v;
+                else texel.u16 = (GLushort)v;
+                break;
+            case CLEAR_FLOAT:
+                if (wide) texel.f32 = (GLfloat)v;
+                else texel.u16 = float_to_half((float)v);
+                break;
+            case CLEAR_INT:
+                if (narrow) texel.i8 = (GLbyte)clear_clamp(v, INT8_MIN, INT8_MAX);
+                else if (wide) texel.i32 = (GLint)clear_clamp(v, INT32_MIN, INT32_MAX);
+                else texel.i16 = (GLshort)clear_clamp(v, INT16_MIN, INT16_MAX);
+                break;
+            default:
+                if (narrow) texel.u8 = (GLubyte)clear_clamp(v, 0.0, UINT8_MAX);
+                else if (wide) texel.u32 = (GLuint)clear_clamp(v, 0.0, UINT32_MAX);
+                else texel.u16 = (GLushort)clear_clamp(v, 0.0, UINT16_MAX);
+                break;
+        }
+        memcpy(out + c * format->component_size, &texel, format->component_size);
+    }
+}
+
+static const char* clear_source =
+    "#version 310 es\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std430, binding = %d) writeonly buffer clear_out { uint dst[]; };\n"
+    "layout(location = 0) uniform uint first_word;\n"
+    "layout(location = 1) uniform uint words;\n"
+    "layout(location = 2) uniform uint period;\n"
+    "layout(location = 3) uniform uvec4 pattern;\n"
+    "void main() {\n"
+    "    uint stride = gl_NumWorkGroups.x * gl_WorkGroupSize.x;\n"
+    "    for (uint i = gl_GlobalInvocationID.x; i < words; i += stride) dst[first_word + i] = pattern[i %% period];\n"
+    "}\n";
+
+static GLuint buffer_clear_program(struct state_scratch_objects* scratch) {
+    if (scratch->clear_program || scratch->clear_program_failed) return scratch->clear_program;
+    GLint binding = shader_base_instance_binding();
+    GLuint program = 0;
+    GLint linked = GL_FALSE;
+    if (binding >= 0 && gles.core.glCreateShaderProgramv) {
+        char source[1024];
+        snprintf(source, sizeof(source), clear_source, binding);
+        const GLchar* sources[] = { source };
+        program = gles.core.glCreateShaderProgramv(GL_COMPUTE_SHADER, 1, sources);
+        if (program) gles.core.glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    }
+    if (!linked) {
+        fprintf(stderr, "Warning: GPU buffer clears are unavailable, buffers will be cleared by copies\n");
+        if (program) gles.core.glDeleteProgram(program);
+        scratch->clear_program_failed = GL_TRUE;
+        return 0;
+    }
+    GLint64 max_range = 0;
+    gles.core.glGetInteger64v(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &max_range);
+    gles.core.glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &scratch->clear_alignment);
+    if (scratch->clear_alignment < 4) scratch->clear_alignment = 4;
+    scratch->clear_max_range = max_range;
+    scratch->clear_program = program;
+    return program;
+}
+
+// Repeats the pattern of period words over a word-aligned range of buffer.
+// Returns 0 when the GPU path can't be used.
+static int buffer_clear_compute(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLuint pattern[4], GLuint period) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    GLuint program = buffer_clear_program(scratch);
+    if (!program) return 0;
+
+    // Ranges are bound from an aligned offset and hold a whole number of
+    // periods, so every range starts the pattern over.
+    GLsizeiptr max_words = (scratch->clear_max_range - scratch->clear_alignment) / 4 / 12 * 12;
+    if (max_words <= 0) return 0;
+    GLint binding = shader_base_instance_binding();
+    gles.core.glProgramUniform1ui(program, 2, period);
+    gles.core.glProgramUniform4ui(program, 3, pattern[0], pattern[1], pattern[2], pattern[3]);
+    gles.core.glUseProgram(program);
+    for (GLsizeiptr done = 0; done < size;) {
+        GLintptr start = offset + done;
+        GLintptr base = start - start % scratch->clear_alignment;
+        GLsizeiptr words = (size - done) / 4 < max_words ? (size - done) / 4 : max_words;
+        gles.core.glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, buffer, base, start - base + words * 4);
+        gles.core.glProgramUniform1ui(program, 0, (GLuint)((start - base) / 4));
+        gles.core.glProgramUniform1ui(program, 1, (GLuint)words);
+        GLsizeiptr groups = (words + 63) / 64;
+        gles.core.glDispatchCompute(groups < 65535 ? (GLuint)groups : 65535, 1, 1);
+        done += words * 4;
+    }
+    gles.core.glUseProgram(state_program_get_current());
+    // glBindBufferRange also replaces the generic binding.
+    gles.core.glBindBuffer(GL_SHADER_STORAGE_BUFFER, state_buffer_get_binding(GL_SHADER_STORAGE_BUFFER));
+    // The buffer may be read any way afterwards.
+    gles.core.glMemoryBarrier(GL_ALL_BARRIER_BITS);
+    stats_add(STATS_CLEAR_COMPUTE_BYTES, size);
+    return 1;
+}
+
+#define CLEAR_STAGING_SIZE (256 * 1024)
+
+// Fills a range of buffer with copies of a texel by copying from a staging
+// buffer that keeps the copies of the last texel it was filled with.
+static void buffer_clear_copy(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLubyte* texel, GLuint texel_size) {
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    GLsizeiptr span = CLEAR_STAGING_SIZE - CLEAR_STAGING_SIZE % texel_size;
+    if (size < span) span = size;
+    if (!scratch->clear_buffer) {
+        gles.core.glGenBuffers(1, &scratch->clear_buffer);
+        if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, scratch->clear_buffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, scratch->clear_buffer);
+        gles.core.glBufferData(GL_COPY_READ_BUFFER, CLEAR_STAGING_SIZE, NULL, GL_DYNAMIC_DRAW);
+    } else if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, scratch->clear_buffer)) {
+        gles.core.glBindBuffer(GL_COPY_READ_BUFFER, scratch->clear_buffer);
+    }
+    if (scratch->clear_element_size != texel_size || memcmp(scratch->clear_pattern, texel, texel_size) || scratch->clear_filled < span) {
+        void* copies = malloc(span);
+        if (!copies) return;
+        fill_pattern(copies, span, texel, texel_size);
+        gles.core.glBufferSubData(GL_COPY_READ_BUFFER, 0, span, copies);
+        free(copies);
+        memcpy(scratch->clear_pattern, texel, texel_size);
+        scratch->clear_element_size = texel_size;
+        scratch->clear_filled = span;
+    }
+
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    for (GLsizeiptr done = 0; done < size; done += span) {
+        GLsizeiptr length = size - done < span ? size - done : span;
+        gles.core.glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, offset + done, length);
+    }
+    stats_add(STATS_CLEAR_COPY_BYTES, size);
+}
+
+// Fills a range of buffer with the clear value given in format and type,
+// converted to internalformat. A NULL value clears to zero.
+static void buffer_clear(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data) {
+    const struct clear_format* clear_format = clear_format_find(internalformat);
+    const struct state_buffer_info* info = buffer ? state_buffer_get_info(buffer) : NULL;
+    if (!clear_format || !info) return;
+    GLuint texel_size = clear_format->components * clear_format->component_size;
+    if (offset < 0 || size <= 0 || offset % texel_size || size % texel_size || offset + size > info->size) return;
+    GLubyte texel[16] = { 0 };
+    if (data) {
+        double rgba[4];
+        if (!clear_value_read(format, type, data, rgba)) return;
+        clear_value_pack(clear_format, rgba, texel);
+    }
+
+    // Word view of the repeated texel, for the compute pass and index tracking.
+    GLuint words[12];
+    fill_pattern(words, sizeof(words), texel, texel_size);
+    GLuint period = texel_size < 4 ? 1 : texel_size / 4;
+
+    persistent_maps_sync();
+    state_buffer_modified(buffer);
+    state_buffer_raise_max_index(buffer, index_max_u32(words, 12));
+    if (g_config.indirect_mirror) state_buffer_mirror_invalidate(buffer);
+
+    // Texels smaller than a word may leave bytes at either end.
+    GLsizeiptr head = (4 - offset % 4) % 4;
+    if (head > size) head = size;
+    GLsizeiptr tail = (size - head) % 4;
+    GLsizeiptr middle = size - head - tail;
+    if (middle && buffer_clear_compute(buffer, offset + head, middle, words, period)) {
+        if (head) buffer_clear_copy(buffer, offset, head, texel, texel_size);
+        if (tail) buffer_clear_copy(buffer, offset + size - tail, tail, texel, texel_size);
+        return;
+    }
+    buffer_clear_copy(buffer, offset, size, texel, texel_size);
+}
+
+// --- Polygon mode emulation ---
+
+// Without NV_polygon_mode, GL_POINT draws triangles as points, and GL_LINE
+// draws them as GL_LINES over an edge list of their triangles. Edge lists are
+// built by a compute pass when one is available and on the CPU otherwise, and
+// cached per context by draw range and element buffer generation, so static
+// meshes are converted once. Multi-draws, indirect draws, primitive restart
+// and element buffers mapped for writing are drawn filled.
+
+static const char* edge_list_source =
+    "#version 310 es\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std430, binding = %d) readonly buffer indices_in { uint src[]; };\n"
+    "layout(std430, binding = %d) writeonly buffer edges_out { uint dst[]; };\n"
+    "layout(location = 0) uniform uint first;\n"
+    "layout(location = 1) uniform uint triangles;\n"
+    "layout(location = 2) uniform uint index_size;\n" // 0 for array draws
+    "layout(location = 3) uniform uint mode;\n"       // 0 list, 1 strip, 2 fan
+    "uint fetch(uint i) {\n"
+    "    if (index_size == 0u) return first + i;\n"
+    "    uint byte_offset = (first + i) * index_size;\n"
+    "    uint word = src[byte_offset >> 2];\n"
+    "    if (index_size == 4u) return word;\n"
+    "    return (word >> ((byte_offset & 3u) * 8u)) & (index_size == 2u ? 0xffffu : 0xffu);\n"
+    "}\n"
+    "void main() {\n"
+    "    uint t = gl_GlobalInvocationID.x;\n"
+    "    if (t >= triangles) return;\n"
+    "    uvec3 v = mode == 0u ? uvec3(3u * t, 3u * t + 1u, 3u * t + 2u)\n"
+    "            : mode == 1u ? uvec3(t, t + 1u, t + 2u) : uvec3(0u, t + 1u, t + 2u);\n"
+    "    uint a = fetch(v.x), b = fetch(v.y), c = fetch(v.z);\n"
+    "    uint d = t * 6u;\n"
+    "    dst[d] = a; dst[d + 1u] = b; dst[d + 2u] = b;\n"
+    "    dst[d + 3u] = c; dst[d + 4u] = c; dst[d + 5u] = a;\n"
+    "}\n";
+
+static GLuint edge_list_program(struct state_scratch_objects* scratch) {
+    if (scratch->edge_program || scratch->edge_program_failed) return scratch->edge_program;
+    GLint binding = shader_base_instance_binding();
+    GLuint program = 0;
+    GLint linked = GL_FALSE;
+    if (binding >= 0 && gles.core.glCreateShaderProgramv) {
+        char source[2048];
+        snprintf(source, sizeof(source), edge_list_source, binding - 1, binding);
+        const GLchar* sources[] = { source };
+        program = gles.core.glCreateShaderProgramv(GL_COMPUTE_SHADER, 1, sources);
+        if (program) gles.core.glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    }
+    if (!linked) {
+        fprintf(stderr, "Warning: GPU wireframe edge lists are unavailable, they will be built on the CPU\n");
+        if (program) gles.core.glDeleteProgram(program);
+        scratch->edge_program_failed = GL_TRUE;
+        return 0;
+    }
+    scratch->edge_program = program;
+    return program;
+}
+
+static inline GLsizei edge_list_triangles(GLenum mode, GLsizei count) {
+    if (mode == GL_TRIANGLES) return count / 3;
+    return count > 2 ? count - 2 : 0;
+}
+
+// Index i of a draw, source is NULL for array draws.
+static inline GLuint edge_list_fetch(const void* source, GLenum type, GLintptr first, GLsizei i) {
+    if (!source) return (GLuint)(first + i);
+    switch (type) {
+        case GL_UNSIGNED_BYTE:  return ((const GLubyte*)source)[first + i];
+        case GL_UNSIGNED_SHORT: return ((const GLushort*)source)[first + i];
+        default:                return ((const GLuint*)source)[first + i];
+    }
+}
+
+static void edge_list_build_cpu(void* dst, const void* source, GLenum type, GLenum edge_type, GLenum mode, GLintptr first, GLsizei triangles) {
+    if (edge_type == GL_UNSIGNED_SHORT) {
+        index_triangles_to_lines_u16(dst, (const GLushort*)source + first, triangles);
+        return;
+    }
+    if (source && type == GL_UNSIGNED_INT && mode == GL_TRIANGLES) {
+        index_triangles_to_lines_u32(dst, (const GLuint*)source + first, triangles);
+        return;
+    }
+    GLuint* edges = dst;
+    for (GLsizei t = 0; t < triangles; ++t) {
+        GLsizei v0 = mode == GL_TRIANGLES ? 3 * t : mode == GL_TRIANGLE_STRIP ? t : 0;
+        GLsizei v1 = mode == GL_TRIANGLES ? 3 * t + 1 : t + 1;
+        GLsizei v2 = mode == GL_TRIANGLES ? 3 * t + 2 : t + 2;
+        GLuint a = edge_list_fetch(source, type, first, v0);
+        GLuint b = edge_list_fetch(source, type, first, v1);
+        GLuint c = edge_list_fetch(source, type, first, v2);
+        GLuint* d = edges + (size_t)t * 6;
+        d[0] = a; d[1] = b; d[2] = b; d[3] = c; d[4] = c; d[5] = a;
+    }
+}
+
+// Fills entry->buffer with the edges of the draw. Returns 0 when the element
+// buffer can't be read.
+static int edge_list_build(struct state_scratch_objects* scratch, struct state_edge_buffer* entry, GLsizei triangles) {
+    GLuint program = edge_list_program(scratch);
+    GLenum index_size = entry->type ? index_type_size(entry->type) : 0;
+    GLsizeiptr size = (GLsizeiptr)triangles * 6 * sizeof(GLuint);
+    const struct state_buffer_info* info = entry->source ? state_buffer_get_info(entry->source) : NULL;
+    if (entry->source && (!info || (entry->first + entry->count) * index_size > info->size)) return 0;
+
+    if (!entry->buffer) gles.core.glGenBuffers(1, &entry->buffer);
+    if (program) {
+        if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, entry->buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, entry->buffer);
+        if (entry->size < size) {
+            gles.core.glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_DYNAMIC_COPY);
+            entry->size = size;
+        }
+        GLint binding = shader_base_instance_binding();
+        gles.core.glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding - 1, entry->source ? entry->source : entry->buffer);
+        gles.core.glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, entry->buffer);
+        gles.core.glBindBuffer(GL_SHADER_STORAGE_BUFFER, state_buffer_get_binding(GL_SHADER_STORAGE_BUFFER));
+
+        gles.core.glProgramUniform1ui(program, 0, entry->first);
+        gles.core.glProgramUniform1ui(program, 1, triangles);
+        gles.core.glProgramUniform1ui(program, 2, index_size);
+        gles.core.glProgramUniform1ui(program, 3, entry->mode == GL_TRIANGLES ? 0 : entry->mode == GL_TRIANGLE_STRIP ? 1 : 2);
+        gles.core.glUseProgram(program);
+        gles.core.glDispatchCompute((triangles + 63) / 64, 1, 1);
+        gles.core.glUseProgram(state_program_get_current());
+        gles.core.glMemoryBarrier(GL_ELEMENT_ARRAY_BARRIER_BIT);
+        entry->edge_type = GL_UNSIGNED_INT;
+        return 1;
+    }
+
+    GLboolean mapped = GL_FALSE;
+    const void* source = NULL;
+    if (info) {
+        source = buffer_read_begin(entry->source, info, &mapped);
+        if (!source) return 0;
+    }
+    entry->edge_type = source && entry->type == GL_UNSIGNED_SHORT && entry->mode == GL_TRIANGLES ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    size = (GLsizeiptr)triangles * 6 * index_type_size(entry->edge_type);
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, entry->buffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, entry->buffer);
+    if (entry->size < size) {
+        gles.core.glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+        entry->size = size;
+    }
+    void* dest = gles.core.glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    if (dest) {
+        edge_list_build_cpu(dest, source, entry->type, entry->edge_type, entry->mode, entry->first, triangles);
+        gles.core.glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    }
+    buffer_read_end(mapped);
+    return dest != NULL;
+}
+
+// Returns the cached edge list of a draw, building it on a miss. source is 0
+// and type is 0 for array draws. NULL when the draw can't be converted.
+static const struct state_edge_buffer* edge_list_get(GLuint source, GLenum mode, GLenum type, GLintptr first, GLsizei count) {
+    if (source && buffer_mapped_for_write(state_buffer_get_info(source))) return NULL;
+    struct state_scratch_objects* scratch = state_get_scratch_objects();
+    GLuint generation = source ? state_buffer_get_generation(source) : 0;
+    GLsizei triangles = edge_list_triangles(mode, count);
+    if (triangles == 0) return NULL;
+
+    struct state_edge_buffer* victim = &scratch->edge_buffers[0];
+    for (int i = 0; i < STATE_EDGE_BUFFER_CACHE_SIZE; ++i) {
+        struct state_edge_buffer* entry = &scratch->edge_buffers[i];
+        if (entry->edge_count && entry->source == source && entry->generation == generation && entry->mode == mode &&
+            entry->type == type && entry->first == first && entry->count == count) {
+            entry->last_use = ++scratch->edge_buffer_clock;
+            return entry;
+        }
+        if (entry->last_use < victim->last_use) victim = entry;
+    }
+
+    victim->source = source;
+    victim->generation = generation;
+    victim->mode = mode;
+    victim->type = type;
+    victim->first = first;
+    victim->count = count;
+    victim->edge_count = 0;
+    victim->last_use = ++scratch->edge_buffer_clock;
+    if (!edge_list_build(scratch, victim, triangles)) return NULL;
+    victim->edge_count = triangles * 6;
+    stats_inc(STATS_EDGE_LISTS_BUILT);
+    return victim;
+}
+
+// Edge lists don't know about restarts, element draws that may restart are
+// drawn filled.
+static inline int polygon_mode_emulated(GLenum mode, GLboolean elements) {
+    if (mode != GL_TRIANGLES && mode != GL_TRIANGLE_STRIP && mode != GL_TRIANGLE_FAN) return 0;
+    if (state_render_get_polygon_mode() == GL_FILL) return 0;
+    return !elements || (!state_render_get_primitive_restart_cap(GL_PRIMITIVE_RESTART) &&
+                         !state_render_get_primitive_restart_cap(GL_PRIMITIVE_RESTART_FIXED_INDEX));
+}
+
+static void polygon_mode_draw_elements(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex) {
+    if (basevertex) gles.core.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    else gles.core.glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+// Draws a triangle draw with the emulated polygon mode. type is 0 for array
+// draws, which use first instead of indices. Returns 0 when the draw has to be
+// drawn filled.
+static int polygon_mode_draw(GLenum mode, GLint first, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex) {
+    if (state_render_get_polygon_mode() == GL_POINT) {
+        if (type) polygon_mode_draw_elements(GL_POINTS, count, type, indices, instancecount, basevertex);
+        else gles.core.glDrawArraysInstanced(GL_POINTS, first, count, instancecount);
+        return 1;
+    }
+    GLuint element_buffer = state_buffer_get_binding(GL_ELEMENT_ARRAY_BUFFER);
+    if (type && element_buffer == 0) return 0;
+    GLintptr start = type ? (GLintptr)((uintptr_t)indices / index_type_size(type)) : first;
+    const struct state_edge_buffer* edges = edge_list_get(type ? element_buffer : 0, mode, type, start, count);
+    if (!edges) return 0;
+    gles.core.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, edges->buffer);
+    polygon_mode_draw_elements(GL_LINES, edges->edge_count, edges->edge_type, NULL, instancecount, basevertex);
+    gles.core.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer);
+    return 1;
+}
+
+// --- Transform feedback draw emulation ---
+
+// Without EXT_draw_transform_feedback every feedback pass is counted by a
+// GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN query the layer wraps around it,
+// and glDrawTransformFeedback draws the vertices of the newest pass whose
+// count is available, so it never stalls on a pass the GPU hasn't finished.
+// LIBGL_XFB_STRICT waits for the last pass instead.
+
+static int transform_feedback_emulated(void) {
+    return !gles.ext.glDrawTransformFeedbackEXT;
+}
+
+static GLuint primitive_vertices(GLenum mode) {
+    switch (mode) {
+        case GL_LINES:     return 2;
+        case GL_TRIANGLES: return 3;
+        default:           return 1;
+    }
+}
+
+static uint64_t elapsed_us(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - start->tv_sec) * 1000000 + (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+// Reads the count of slot, unless it isn't available yet and wait is false.
+static int transform_feedback_read(struct state_transform_feedback* counts, GLuint slot, GLboolean wait) {
+    GLuint query = counts->queries[slot];
+    GLuint available = 0;
+    gles.core.glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available && !wait) return 0;
+
+    struct timespec start;
+    if (!available) clock_gettime(CLOCK_MONOTONIC, &start);
+    GLuint primitives = 0;
+    gles.core.glGetQueryObjectuiv(query, GL_QUERY_RESULT, &primitives);
+    if (!available) stats_add(STATS_XFB_WAIT_US, elapsed_us(&start));
+
+    counts->pending &= ~(1u << slot);
+    if (counts->passes[slot] > counts->vertices_pass) {
+        counts->vertices = primitives * primitive_vertices(counts->modes[slot]);
+        counts->vertices_pass = counts->passes[slot];
+    }
+    return 1;
+}
+
+static void transform_feedback_begin_count(GLenum primitive_mode) {
+    if (!transform_feedback_emulated() || state_transform_feedback_get_app_query()) return;
+    struct state_transform_feedback* counts = state_transform_feedback_get(state_transform_feedback_get_binding());
+    if (!counts) return;
+
+    GLuint slot = counts->next;
+    // A full ring waits for its oldest pass, which has had the longest to finish.
+    if (counts->pending & (1u << slot)) transform_feedback_read(counts, slot, GL_TRUE);
+    if (!counts->queries[slot]) gles.core.glGenQueries(1, &counts->queries[slot]);
+    counts->modes[slot] = primitive_mode;
+    counts->passes[slot] = ++counts->pass_count;
+    gles.core.glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, counts->queries[slot]);
+    state_transform_feedback_set_counted(counts);
+}
+
+// complete is false when the pass is cut short, its partial count is dropped.
+static void transform_feedback_end_count(GLboolean complete) {
+    struct state_transform_feedback* counts = state_transform_feedback_get_counted();
+    if (!counts) return;
+    gles.core.glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+    if (complete) {
+        counts->pending |= 1u << counts->next;
+        counts->next = (counts->next + 1) % STATE_XFB_QUERY_RING;
+    }
+    state_transform_feedback_set_counted(NULL);
+}
+
+static GLsizei transform_feedback_vertices(GLuint id) {
+    struct state_transform_feedback* counts = state_transform_feedback_get(id);
+    if (!counts) return 0;
+
+    // Newest pass first. Reading one supersedes the older ones, newer ones
+    // that weren't available yet stay pending.
+    GLuint newer = 0;
+    for (GLuint i = 1; i <= STATE_XFB_QUERY_RING; ++i) {
+        GLuint slot = (counts->next + STATE_XFB_QUERY_RING - i) % STATE_XFB_QUERY_RING;
+        GLuint bit = 1u << slot;
+        if (!(counts->pending & bit)) continue;
+        if (transform_feedback_read(counts, slot, g_config.xfb_strict)) {
+            counts->pending &= newer;
+            break;
+        }
+        newer |= bit;
+    }
+    stats_inc(STATS_XFB_DRAWS);
+    stats_add(STATS_XFB_PASSES_BEHIND, counts->pass_count - counts->vertices_pass);
+    return counts->vertices;
+}
+
+static void transform_feedback_draw(GLenum mode, GLuint id, GLsizei instancecount) {
+    GLsizei count = transform_feedback_vertices(id);
+    if (count == 0 || instancecount == 0) return;
+    if (polygon_mode_emulated(mode, GL_FALSE) && polygon_mode_draw(mode, 0, count, 0, NULL, instancecount, 0)) return;
+    if (instancecount == 1) gles.core.glDrawArrays(mode, 0, count);
+    else gles.core.glDrawArraysInstanced(mode, 0, count, instancecount);
+}
+
+// --- Draw batching ---
+
+// With LIBGL_BATCH_DRAWS, consecutive glDrawElements calls with the same mode
+// and index type are held back and issued as one multi-draw, or as one draw
+// when their index ranges are contiguous. Every other entry point flushes the
+// pending draws first, so they see the state they were recorded with.
+
+#define DRAW_BATCH_MAX 128
+
+struct draw_batch {
+    GLsizei count;
+    GLenum mode;
+    GLenum type;
+    GLboolean has_base_vertex;
+    GLsizei counts[DRAW_BATCH_MAX];
+    const void* indices[DRAW_BATCH_MAX];
+    GLint base_vertices[DRAW_BATCH_MAX];
+};
+
+// Allocated by the first batched draw of a thread and freed when it exits.
+// Only the pointer is thread-local: a large initial-exec TLS block would make
+// dlopen of the library fail once the static TLS surplus is used up.
+static __thread struct draw_batch* t_draw_batch;
+static pthread_key_t g_draw_batch_key;
+static pthread_once_t g_draw_batch_once = PTHREAD_ONCE_INIT;
+
+static void draw_batch_key_create(void) {
+    pthread_key_create(&g_draw_batch_key, free);
+}
+
+static struct draw_batch* draw_batch_get(void) {
+    if (t_draw_batch) return t_draw_batch;
+    pthread_once(&g_draw_batch_once, draw_batch_key_create);
+    t_draw_batch = calloc(1, sizeof(*t_draw_batch));
+    if (t_draw_batch) pthread_setspecific(g_draw_batch_key, t_draw_batch);
+    return t_draw_batch;
+}
+
+// Restart and narrowing are decided from the current element buffer and
+// restart state, so this relies on the shadow still matching the recorded
+// draws: entry points flush before changing those bindings or caps.
+static void draw_batch_submit(void) {
+    struct draw_batch* batch = t_draw_batch;
+    GLsizei count = batch->count;
+    batch->count = 0;
+    stats_inc(STATS_BATCH_SUBMITS);
+    struct element_draw draw;
+    element_draw_begin(&draw, batch->type, GL_TRUE);
+    for (GLsizei i = 0; draw.shift && i < count; ++i) {
+        batch->indices[i] = element_draw_offset(&draw, batch->indices[i]);
+    }
+    if (count == 1 && !batch->has_base_vertex) {
+        gles.core.glDrawElements(batch->mode, batch->counts[0], draw.type, batch->indices[0]);
+    } else if (count == 1) {
+        gles.core.glDrawElementsBaseVertex(batch->mode, batch->counts[0], draw.type, batch->indices[0], batch->base_vertices[0]);
+    } else if (!batch->has_base_vertex && gles.ext.glMultiDrawElementsEXT) {
+        gles.ext.glMultiDrawElementsEXT(batch->mode, batch->counts, draw.type, batch->indices, count);
+    } else {
+        gles.ext.glMultiDrawElementsBaseVertexEXT(batch->mode, batch->counts, draw.type, batch->indices, count, batch->base_vertices);
+    }
+    element_draw_end(&draw);
+}
+
+static inline void draw_batch_flush(void) {
+    if (g_config.batch_draws && t_draw_batch && t_draw_batch->count) draw_batch_submit();
+}
+
+// For the window system entry points, which must not leave draws behind.
+void gl_flush_draw_batch(void) {
+    draw_batch_flush();
+}
+
+// For glXMakeContextCurrent and glXDestroyContext. Deletes the layer objects
+// that freed contexts of the current share group left behind.
+void gl_delete_orphaned_objects(void) {
+    struct state_orphaned_objects orphans;
+    if (!state_take_orphaned_objects(&orphans)) return;
+    if (arrlen(orphans.buffers)) gles.core.glDeleteBuffers((GLsizei)arrlen(orphans.buffers), orphans.buffers);
+    for (ptrdiff_t i = 0; i < arrlen(orphans.programs); ++i) gles.core.glDeleteProgram(orphans.programs[i]);
+    for (ptrdiff_t i = 0; i < arrlen(orphans.syncs); ++i) gles.core.glDeleteSync(orphans.syncs[i]);
+    arrfree(orphans.buffers);
+    arrfree(orphans.programs);
+    arrfree(orphans.syncs);
+}
+
+// Vertices per primitive of the modes whose draws can be concatenated, 0 for the others.
+static GLsizei draw_batch_list_size(GLenum mode) {
+    switch (mode) {
+        case GL_POINTS:    return 1;
+        case GL_LINES:     return 2;
+        case GL_TRIANGLES: return 3;
+        default:           return 0;
+    }
+}
+
+// Client-side index arrays may change after the call, only buffer offsets are batched.
+static inline int draw_batch_accepts(GLenum mode, GLsizei count) {
+    return g_config.batch_draws && count > 0 && state_buffer_get_binding(GL_ELEMENT_ARRAY_BUFFER) != 0 &&
+           !polygon_mode_emulated(mode, GL_TRUE) && draw_batch_get();
+}
+
+static void draw_batch_add(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex) {
+    struct draw_batch* batch = t_draw_batch;
+    stats_inc(STATS_BATCHED_DRAWS);
+    if (batch->count && (batch->mode != mode || batch->type != type)) draw_batch_submit();
+
+    if (batch->count) {
+        GLsizei last = batch->count - 1;
+        GLsizei list_size = draw_batch_list_size(mode);
+        uintptr_t end = (uintptr_t)batch->indices[last] + (uintptr_t)batch->counts[last] * index_type_size(type);
+        if (list_size && batch->counts[last] % list_size == 0 && batch->base_vertices[last] == basevertex && end == (uintptr_t)indices) {
+            batch->counts[last] += count;
+            stats_inc(STATS_BATCH_MERGED_DRAWS);
+            return;
+        }
+        int can_multi_draw = (basevertex || batch->has_base_vertex) ? gles.ext.glMultiDrawElementsBaseVertexEXT != NULL
+                                                                   : (gles.ext.glMultiDrawElementsEXT || gles.ext.glMultiDrawElementsBaseVertexEXT);
+        if (!can_multi_draw || batch->count == DRAW_BATCH_MAX) draw_batch_submit();
+    }
+
+    if (batch->count == 0) {
+        batch->mode = mode;
+        batch->type = type;
+        batch->has_base_vertex = GL_FALSE;
+    }
+    batch->counts[batch->count] = count;
+    batch->indices[batch->count] = indices;
+    batch->base_vertices[batch->count] = basevertex;
+    batch->has_base_vertex |= basevertex != 0;
+    batch->count++;
 }
 
 // GL API implementation
 void glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    draw_batch_flush();
     gles.core.glActiveShaderProgram(pipeline, program);
 }
 
 void glActiveTexture(GLenum texture) {
+    FILTER_UNCHANGED(state_texture_set_active_unit(texture), STATS_FILTERED_ACTIVE_TEXTURE);
+    draw_batch_flush();
     gles.core.glActiveTexture(texture);
 }
 
 void glAttachShader(GLuint program, GLuint shader) {
+    draw_batch_flush();
     gles.core.glAttachShader(program, shader);
 }
 
 void glBeginConditionalRender(GLuint id, GLenum mode) {
+    draw_batch_flush();
     if(gles.ext.glBeginConditionalRenderNV) gles.ext.glBeginConditionalRenderNV(id, mode);
     else UNIMPLEMENTED();
 }
 
 void glBeginQuery(GLenum target, GLuint id) {
+    draw_batch_flush();
+    if (target == GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN) {
+        transform_feedback_end_count(GL_FALSE);
+        state_transform_feedback_app_query(GL_TRUE);
+    }
     gles.core.glBeginQuery(target, id);
 }
 
@@ -64,32 +2010,56 @@ void glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
 }
 
 void glBeginTransformFeedback(GLenum primitiveMode) {
+    draw_batch_flush();
+    transform_feedback_begin_count(primitiveMode);
     gles.core.glBeginTransformFeedback(primitiveMode);
 }
 
 void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    draw_batch_flush();
     gles.core.glBindAttribLocation(program, index, name);
 }
 
 void glBindBuffer(GLenum target, GLuint buffer) {
+    // Pending draws are converted through the element and copy buffer
+    // bindings, so they are issued before the shadow of those changes.
+    if (target == GL_COPY_READ_BUFFER || target == GL_COPY_WRITE_BUFFER ||
+        (target == GL_ELEMENT_ARRAY_BUFFER && state_buffer_get_binding(target) != buffer)) {
+        draw_batch_flush();
+    }
+    buffer_track_binding(target, buffer);
+    FILTER_UNCHANGED(state_buffer_bind(target, buffer), STATS_FILTERED_BIND_BUFFER);
+    draw_batch_flush();
+    // GLES has no parameter buffer binding, the *IndirectCount draws read it from the shadow.
+    if (target == GL_PARAMETER_BUFFER) return;
     gles.core.glBindBuffer(target, buffer);
 }
 
 void glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    draw_batch_flush();
+    buffer_track_binding(target, buffer);
+    state_buffer_bind_indexed(target, index, buffer, 0, 0);
     gles.core.glBindBufferBase(target, index, buffer);
 }
 
 void glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    draw_batch_flush();
+    buffer_track_binding(target, buffer);
+    state_buffer_bind_indexed(target, index, buffer, offset, size);
     gles.core.glBindBufferRange(target, index, buffer, offset, size);
 }
 
 void glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+    draw_batch_flush();
     if(buffers == NULL) {
         for(GLsizei i = 0; i < count; ++i) {
+            state_buffer_bind_indexed(target, first + i, 0, 0, 0);
             gles.core.glBindBufferBase(target, first + i, 0);
         }
     } else {
         for(GLsizei i = 0; i < count; ++i) {
+            buffer_track_binding(target, buffers[i]);
+            state_buffer_bind_indexed(target, first + i, buffers[i], 0, 0);
             gles.core.glBindBufferBase(target, first + i, buffers[i]);
         }
     }
@@ -100,20 +2070,25 @@ void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint
 }
 
 void glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    draw_batch_flush();
     if(gles.ext.glBindFragDataLocationEXT) gles.ext.glBindFragDataLocationEXT(program, color, name);
     else UNIMPLEMENTED();
 }
 
 void glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    draw_batch_flush();
     if(gles.ext.glBindFragDataLocationIndexedEXT) gles.ext.glBindFragDataLocationIndexedEXT(program, colorNumber, index, name);
     else UNIMPLEMENTED();
 }
 
 void glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    FILTER_UNCHANGED(state_framebuffer_bind(target, framebuffer), STATS_FILTERED_BIND_FRAMEBUFFER);
+    draw_batch_flush();
     gles.core.glBindFramebuffer(target, framebuffer);
 }
 
 void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    draw_batch_flush();
     gles.core.glBindImageTexture(unit, texture, level, layered, layer, access, format);
 }
 
@@ -122,14 +2097,18 @@ void glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
 }
 
 void glBindProgramPipeline(GLuint pipeline) {
+    draw_batch_flush();
     gles.core.glBindProgramPipeline(pipeline);
 }
 
 void glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    draw_batch_flush();
     gles.core.glBindRenderbuffer(target, renderbuffer);
 }
 
 void glBindSampler(GLuint unit, GLuint sampler) {
+    FILTER_UNCHANGED(state_sampler_bind(unit, sampler), STATS_FILTERED_BIND_SAMPLER);
+    draw_batch_flush();
     gles.core.glBindSampler(unit, sampler);
 }
 
@@ -139,6 +2118,9 @@ void glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
 
 void glBindTexture(GLenum target, GLuint texture) {
     state_texture_set_target(texture, target);
+    FILTER_UNCHANGED(state_texture_bind(target, texture), STATS_FILTERED_BIND_TEXTURE);
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glBindTexture(target, texture);
 }
 
@@ -151,14 +2133,22 @@ void glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
 }
 
 void glBindTransformFeedback(GLenum target, GLuint id) {
+    draw_batch_flush();
+    state_transform_feedback_bind(id);
     gles.core.glBindTransformFeedback(target, id);
 }
 
 void glBindVertexArray(GLuint array) {
+    // The vertex array brings its own element buffer, see glBindBuffer.
+    if (state_vertex_array_get_binding() != array) draw_batch_flush();
+    FILTER_UNCHANGED(state_vertex_array_bind(array), STATS_FILTERED_BIND_VERTEX_ARRAY);
     gles.core.glBindVertexArray(array);
 }
 
 void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
+    state_vertex_array_set_buffer(state_vertex_array_get_binding(), bindingindex, buffer, offset, stride);
     gles.core.glBindVertexBuffer(bindingindex, buffer, offset, stride);
 }
 
@@ -167,49 +2157,68 @@ void glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, con
 }
 
 void glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    FILTER_UNCHANGED(state_render_blend_color(red, green, blue, alpha), STATS_FILTERED_BLEND);
+    draw_batch_flush();
     gles.core.glBlendColor(red, green, blue, alpha);
 }
 
 void glBlendEquation(GLenum mode) {
+    FILTER_UNCHANGED(state_render_blend_equation(mode, mode), STATS_FILTERED_BLEND);
+    draw_batch_flush();
     gles.core.glBlendEquation(mode);
 }
 
 void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    FILTER_UNCHANGED(state_render_blend_equation(modeRGB, modeAlpha), STATS_FILTERED_BLEND);
+    draw_batch_flush();
     gles.core.glBlendEquationSeparate(modeRGB, modeAlpha);
 }
 
 void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    draw_batch_flush();
+    state_render_blend_equation_indexed();
     gles.core.glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
 }
 
 void glBlendEquationi(GLuint buf, GLenum mode) {
+    draw_batch_flush();
+    state_render_blend_equation_indexed();
     gles.core.glBlendEquationi(buf, mode);
 }
 
 void glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    FILTER_UNCHANGED(state_render_blend_func(sfactor, dfactor, sfactor, dfactor), STATS_FILTERED_BLEND);
+    draw_batch_flush();
     gles.core.glBlendFunc(sfactor, dfactor);
 }
 
 void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    FILTER_UNCHANGED(state_render_blend_func(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), STATS_FILTERED_BLEND);
+    draw_batch_flush();
     gles.core.glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 
 void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    draw_batch_flush();
+    state_render_blend_func_indexed();
     gles.core.glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
 void glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    draw_batch_flush();
+    state_render_blend_func_indexed();
     gles.core.glBlendFunci(buf, src, dst);
 }
 
 void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    draw_batch_flush();
     gles.core.glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
 void glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
-    GLint old_read_fbo, old_draw_fbo;
-    gles.core.glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &old_read_fbo);
-    gles.core.glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &old_draw_fbo);
+    draw_batch_flush();
+    GLuint old_read_fbo = state_framebuffer_get_binding(GL_READ_FRAMEBUFFER);
+    GLuint old_draw_fbo = state_framebuffer_get_binding(GL_DRAW_FRAMEBUFFER);
 
     gles.core.glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
     gles.core.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
@@ -221,28 +2230,51 @@ void glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLin
 }
 
 void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    persistent_map_end(buffer, GL_FALSE);
+    state_buffer_set_data(buffer, size, usage);
+    index_track_data(buffer, target == GL_ELEMENT_ARRAY_BUFFER, size, data);
+    target = buffer_sync_target(target);
+    if (g_config.indirect_mirror) state_buffer_mirror_reset(buffer, data);
     gles.core.glBufferData(target, size, data, usage);
 }
 
 void glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    persistent_map_end(buffer, GL_FALSE);
+    state_buffer_set_storage(buffer, size, flags);
+    index_track_data(buffer, target == GL_ELEMENT_ARRAY_BUFFER, size, data);
+    target = buffer_sync_target(target);
+    if (g_config.indirect_mirror) state_buffer_mirror_reset(buffer, data);
     if(gles.ext.glBufferStorageEXT) gles.ext.glBufferStorageEXT(target, size, data, flags);
-    else gles.core.glBufferData(target, size, data, GL_STATIC_DRAW);
+    else gles.core.glBufferData(target, size, data, flags & (GL_MAP_PERSISTENT_BIT_EXT | GL_DYNAMIC_STORAGE_BIT_EXT) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 }
 
 void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    state_buffer_modified(buffer);
+    index_track_sub_data(buffer, target == GL_ELEMENT_ARRAY_BUFFER, offset, size, data);
+    if (g_config.indirect_mirror) state_buffer_mirror_write(buffer, offset, size, data);
+    target = buffer_sync_target(target);
+    if (stream_upload(buffer, target, offset, size, data)) return;
     gles.core.glBufferSubData(target, offset, size, data);
 }
 
 GLenum glCheckFramebufferStatus(GLenum target) {
+    draw_batch_flush();
     return gles.core.glCheckFramebufferStatus(target);
 }
 
 GLenum glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
-    const GLenum fbtarget = GL_FRAMEBUFFER;
-    GLint old_fbo;
-    gles.core.glGetIntegerv(GL_FRAMEBUFFER_BINDING, &old_fbo);
+    draw_batch_flush();
+    // Only touch the binding that is being checked, GL_FRAMEBUFFER would also clobber the read binding.
+    const GLenum fbtarget = target == GL_READ_FRAMEBUFFER ? GL_READ_FRAMEBUFFER : GL_DRAW_FRAMEBUFFER;
+    GLuint old_fbo = state_framebuffer_get_binding(fbtarget);
     gles.core.glBindFramebuffer(fbtarget, framebuffer);
-    GLenum status = gles.core.glCheckFramebufferStatus(target);
+    GLenum status = gles.core.glCheckFramebufferStatus(fbtarget);
     gles.core.glBindFramebuffer(fbtarget, old_fbo);
     return status;
 }
@@ -252,51 +2284,67 @@ void glClampColor(GLenum target, GLenum clamp) {
 }
 
 void glClear(GLbitfield mask) {
+    draw_batch_flush();
     gles.core.glClear(mask);
 }
 
 void glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (info) buffer_clear(buffer, internalformat, 0, info->size, format, type, data);
 }
 
 void glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    buffer_clear(state_buffer_get_binding(target), internalformat, offset, size, format, type, data);
 }
 
 void glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    draw_batch_flush();
     gles.core.glClearBufferfi(buffer, drawbuffer, depth, stencil);
 }
 
 void glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glClearBufferfv(buffer, drawbuffer, value);
 }
 
 void glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    draw_batch_flush();
     gles.core.glClearBufferiv(buffer, drawbuffer, value);
 }
 
 void glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glClearBufferuiv(buffer, drawbuffer, value);
 }
 
 void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    FILTER_UNCHANGED(state_render_clear_color(red, green, blue, alpha), STATS_FILTERED_CLEAR_COLOR);
+    draw_batch_flush();
     gles.core.glClearColor(red, green, blue, alpha);
 }
 
 void glClearDepth(GLdouble depth) {
+    draw_batch_flush();
     gles.core.glClearDepthf((GLfloat)depth);
 }
 
 void glClearDepthf(GLfloat d) {
+    draw_batch_flush();
     gles.core.glClearDepthf(d);
 }
 
 void glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    const struct state_buffer_info* info = state_buffer_get_info(buffer);
+    if (info) buffer_clear(buffer, internalformat, 0, info->size, format, type, data);
 }
 
 void glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    buffer_clear(buffer, internalformat, offset, size, format, type, data);
 }
 
 void glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
@@ -316,33 +2364,44 @@ void glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuf
 }
 
 void glClearStencil(GLint s) {
+    draw_batch_flush();
     gles.core.glClearStencil(s);
 }
 
 void glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+    draw_batch_flush();
     if(gles.ext.glClearTexImageEXT) gles.ext.glClearTexImageEXT(texture, level, format, type, data);
     else UNIMPLEMENTED();
 }
 
 void glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+    draw_batch_flush();
     if(gles.ext.glClearTexSubImageEXT) gles.ext.glClearTexSubImageEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
     else UNIMPLEMENTED();
 }
 
 GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
-    return gles.core.glClientWaitSync(sync, flags, timeout);
+    draw_batch_flush();
+    GLenum status = gles.core.glClientWaitSync(sync, flags, timeout);
+    if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) persistent_maps_refresh();
+    return status;
 }
 
 void glClipControl(GLenum origin, GLenum depth) {
+    draw_batch_flush();
     if(gles.ext.glClipControlEXT) gles.ext.glClipControlEXT(origin, depth);
     else UNIMPLEMENTED();
 }
 
 void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    FILTER_UNCHANGED(state_render_color_mask(red, green, blue, alpha), STATS_FILTERED_COLOR_MASK);
+    draw_batch_flush();
     gles.core.glColorMask(red, green, blue, alpha);
 }
 
 void glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    draw_batch_flush();
+    state_render_color_mask_indexed();
     gles.core.glColorMaski(index, r, g, b, a);
 }
 
@@ -363,6 +2422,7 @@ void glColorP4uiv(GLenum type, const GLuint *color) {
 }
 
 void glCompileShader(GLuint shader) {
+    draw_batch_flush();
     gles.core.glCompileShader(shader);
 }
 
@@ -371,10 +2431,16 @@ void glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, G
 }
 
 void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_compressed_image(state_texture_get_binding(target), level, internalformat, width, height, 1, imageSize);
     gles.core.glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
 }
 
 void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_compressed_image(state_texture_get_binding(target), level, internalformat, width, height, depth, imageSize);
     gles.core.glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -383,10 +2449,14 @@ void glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsize
 }
 
 void glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
 void glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -403,35 +2473,44 @@ void glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, G
 }
 
 void glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
-    GLint is_read_mapped = GL_FALSE;
-    gles.core.glGetBufferParameteriv(readTarget, GL_BUFFER_MAPPED, &is_read_mapped);
-
-    if (is_read_mapped) {
-        void* mapped_read_ptr = NULL;
-        gles.core.glGetBufferPointerv(readTarget, GL_BUFFER_MAP_POINTER, &mapped_read_ptr);
-        void* temp_buffer = malloc(size);
-        memcpy(temp_buffer, (char*)mapped_read_ptr + readOffset, size);
-        gles.core.glBufferSubData(writeTarget, writeOffset, size, temp_buffer);
-        free(temp_buffer);
+    draw_batch_flush();
+    state_buffer_modified(state_buffer_get_binding(writeTarget));
+    state_buffer_raise_max_index(state_buffer_get_binding(writeTarget), UINT32_MAX);
+    if (g_config.indirect_mirror) state_buffer_mirror_invalidate(state_buffer_get_binding(writeTarget));
+    const struct state_buffer_info* read_info = state_buffer_get_info(state_buffer_get_binding(readTarget));
+    readTarget = buffer_sync_target(readTarget);
+    writeTarget = buffer_sync_target(writeTarget);
+
+    // The driver can't copy from a buffer the application has mapped, upload
+    // straight from the mapping instead.
+    GLsizeiptr available = 0;
+    const char* source = buffer_mapped_at(read_info, readOffset, &available);
+    if (source && available >= size) {
+        gles.core.glBufferSubData(writeTarget, writeOffset, size, source);
     } else {
         gles.core.glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
     }
 }
 
 void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    draw_batch_flush();
     gles.core.glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
 void glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_readBuffer, old_writeBuffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_readBuffer);
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_writeBuffer);
-    gles.core.glBindBuffer(target, readBuffer);
-    gles.core.glBindBuffer(target, writeBuffer);
-    gles.core.glCopyBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
-    gles.core.glBindBuffer(target, old_readBuffer);
-    gles.core.glBindBuffer(target, old_writeBuffer);
+    draw_batch_flush();
+    state_buffer_modified(writeBuffer);
+    state_buffer_raise_max_index(writeBuffer, UINT32_MAX);
+    if (g_config.indirect_mirror) state_buffer_mirror_invalidate(writeBuffer);
+    if (state_buffer_bind_scratch(GL_COPY_WRITE_BUFFER, writeBuffer)) gles.core.glBindBuffer(GL_COPY_WRITE_BUFFER, writeBuffer);
+    GLsizeiptr available = 0;
+    const char* source = buffer_mapped_at(state_buffer_get_info(readBuffer), readOffset, &available);
+    if (source && available >= size) {
+        gles.core.glBufferSubData(GL_COPY_WRITE_BUFFER, writeOffset, size, source);
+        return;
+    }
+    if (state_buffer_bind_scratch(GL_COPY_READ_BUFFER, readBuffer)) gles.core.glBindBuffer(GL_COPY_READ_BUFFER, readBuffer);
+    gles.core.glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, readOffset, writeOffset, size);
 }
 
 void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
@@ -439,6 +2518,9 @@ void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x
 }
 
 void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_image(state_texture_get_binding(target), level, internalformat, width, height, 1);
     gles.core.glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
 }
 
@@ -447,10 +2529,14 @@ void glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLi
 }
 
 void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
 }
 
 void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -467,43 +2553,53 @@ void glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint y
 }
 
 void glCreateBuffers(GLsizei n, GLuint *buffers) {
+    draw_batch_flush();
     gles.core.glGenBuffers(n, buffers);
 }
 
 void glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+    draw_batch_flush();
     gles.core.glGenFramebuffers(n, framebuffers);
 }
 
 GLuint glCreateProgram(void) {
+    draw_batch_flush();
     return gles.core.glCreateProgram();
 }
 
 void glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+    draw_batch_flush();
     gles.core.glGenProgramPipelines(n, pipelines);
 }
 
 void glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+    draw_batch_flush();
     // GLES glGenQueries doesn't have a target
     gles.core.glGenQueries(n, ids);
 }
 
 void glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    draw_batch_flush();
     gles.core.glGenRenderbuffers(n, renderbuffers);
 }
 
 void glCreateSamplers(GLsizei n, GLuint *samplers) {
+    draw_batch_flush();
     gles.core.glGenSamplers(n, samplers);
 }
 
 GLuint glCreateShader(GLenum type) {
+    draw_batch_flush();
     return gles.core.glCreateShader(type);
 }
 
 GLuint glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const *strings) {
+    draw_batch_flush();
     return gles.core.glCreateShaderProgramv(type, count, strings);
 }
 
 void glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+    draw_batch_flush();
     gles.core.glGenTextures(n, textures);
     for (GLsizei i = 0; i < n; ++i) {
         state_texture_set_target(textures[i], target);
@@ -511,38 +2607,60 @@ void glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
 }
 
 void glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+    draw_batch_flush();
     gles.core.glGenTransformFeedbacks(n, ids);
 }
 
 void glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+    draw_batch_flush();
     gles.core.glGenVertexArrays(n, arrays);
 }
 
 void glCullFace(GLenum mode) {
+    FILTER_UNCHANGED(state_render_cull_face(mode), STATS_FILTERED_RASTER);
+    draw_batch_flush();
     gles.core.glCullFace(mode);
 }
 
 void glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    draw_batch_flush();
     gles.core.glDebugMessageCallback(callback, userParam);
 }
 
 void glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    draw_batch_flush();
     gles.core.glDebugMessageControl(source, type, severity, count, ids, enabled);
 }
 
 void glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    draw_batch_flush();
     gles.core.glDebugMessageInsert(source, type, id, severity, length, buf);
 }
 
 void glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    draw_batch_flush();
+    if (!buffers) return;
+    for (GLsizei i = 0; i < n; ++i) {
+        persistent_map_end(buffers[i], GL_FALSE);
+        readback_forget(buffers[i]);
+        index_copy_delete(buffers[i]);
+        state_buffer_remove(buffers[i]);
+    }
     gles.core.glDeleteBuffers(n, buffers);
 }
 
 void glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    draw_batch_flush();
+    if (!framebuffers) return;
+    for (GLsizei i = 0; i < n; ++i) {
+        state_framebuffer_remove(framebuffers[i]);
+    }
     gles.core.glDeleteFramebuffers(n, framebuffers);
 }
 
 void glDeleteProgram(GLuint program) {
+    draw_batch_flush();
+    state_program_remove(program);
     gles.core.glDeleteProgram(program);
 }
 
@@ -551,27 +2669,37 @@ void glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
 }
 
 void glDeleteQueries(GLsizei n, const GLuint *ids) {
+    draw_batch_flush();
     gles.core.glDeleteQueries(n, ids);
 }
 
 void glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    draw_batch_flush();
     gles.core.glDeleteRenderbuffers(n, renderbuffers);
 }
 
 void glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    draw_batch_flush();
+    if (!samplers) return;
+    for (GLsizei i = 0; i < count; ++i) {
+        state_sampler_remove(samplers[i]);
+    }
     gles.core.glDeleteSamplers(count, samplers);
 }
 
 void glDeleteShader(GLuint shader) {
+    draw_batch_flush();
     shader_cache_remove_program(shader);
     gles.core.glDeleteShader(shader);
 }
 
 void glDeleteSync(GLsync sync) {
+    draw_batch_flush();
     gles.core.glDeleteSync(sync);
 }
 
 void glDeleteTextures(GLsizei n, const GLuint *textures) {
+    draw_batch_flush();
     if (!textures) return;
     for (GLsizei i = 0; i < n; ++i) {
         state_texture_remove(textures[i]);
@@ -580,18 +2708,38 @@ void glDeleteTextures(GLsizei n, const GLuint *textures) {
 }
 
 void glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    draw_batch_flush();
+    for (GLsizei i = 0; ids && i < n; ++i) {
+        if (ids[i] == 0) continue;
+        struct state_transform_feedback* counts = state_transform_feedback_get(ids[i]);
+        if (counts) {
+            for (GLuint slot = 0; slot < STATE_XFB_QUERY_RING; ++slot) {
+                if (counts->queries[slot]) gles.core.glDeleteQueries(1, &counts->queries[slot]);
+            }
+        }
+        state_transform_feedback_remove(ids[i]);
+    }
     gles.core.glDeleteTransformFeedbacks(n, ids);
 }
 
 void glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    draw_batch_flush();
+    if (!arrays) return;
+    for (GLsizei i = 0; i < n; ++i) {
+        state_vertex_array_remove(arrays[i]);
+    }
     gles.core.glDeleteVertexArrays(n, arrays);
 }
 
 void glDepthFunc(GLenum func) {
+    FILTER_UNCHANGED(state_render_depth_func(func), STATS_FILTERED_DEPTH);
+    draw_batch_flush();
     gles.core.glDepthFunc(func);
 }
 
 void glDepthMask(GLboolean flag) {
+    FILTER_UNCHANGED(state_render_depth_mask(flag), STATS_FILTERED_DEPTH);
+    draw_batch_flush();
     gles.core.glDepthMask(flag);
 }
 
@@ -608,14 +2756,24 @@ void glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
 }
 
 void glDepthRangef(GLfloat n, GLfloat f) {
+    draw_batch_flush();
     gles.core.glDepthRangef(n, f);
 }
 
 void glDetachShader(GLuint program, GLuint shader) {
+    draw_batch_flush();
     gles.core.glDetachShader(program, shader);
 }
 
 void glDisable(GLenum cap) {
+    if (cap == GL_PRIMITIVE_RESTART || cap == GL_PRIMITIVE_RESTART_FIXED_INDEX) {
+        draw_batch_flush();
+        // The driver's cap stays on while the other one is.
+        if (state_render_primitive_restart(cap, GL_FALSE)) return;
+        cap = GL_PRIMITIVE_RESTART_FIXED_INDEX;
+    }
+    FILTER_UNCHANGED(state_render_enable(cap, GL_FALSE), STATS_FILTERED_ENABLE);
+    draw_batch_flush();
     gles.core.glDisable(cap);
 }
 
@@ -624,129 +2782,269 @@ void glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
 }
 
 void glDisableVertexAttribArray(GLuint index) {
+    draw_batch_flush();
     gles.core.glDisableVertexAttribArray(index);
 }
 
 void glDisablei(GLenum target, GLuint index) {
+    draw_batch_flush();
+    state_render_enable_indexed(target);
     gles.core.glDisablei(target, index);
 }
 
 void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    draw_batch_flush();
+    persistent_maps_sync();
     gles.core.glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
 }
 
 void glDispatchComputeIndirect(GLintptr indirect) {
+    draw_batch_flush();
+    persistent_maps_sync();
     gles.core.glDispatchComputeIndirect(indirect);
 }
 
 void glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (polygon_mode_emulated(mode, GL_FALSE) && polygon_mode_draw(mode, first, count, 0, NULL, 1, 0)) return;
     gles.core.glDrawArrays(mode, first, count);
 }
 
 void glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
     gles.core.glDrawArraysIndirect(mode, indirect);
 }
 
 void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (polygon_mode_emulated(mode, GL_FALSE) && polygon_mode_draw(mode, first, count, 0, NULL, instancecount, 0)) return;
     gles.core.glDrawArraysInstanced(mode, first, count, instancecount);
 }
 
 void glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
-    if(gles.ext.glDrawArraysInstancedBaseInstanceEXT) gles.ext.glDrawArraysInstancedBaseInstanceEXT(mode, first, count, instancecount, baseinstance);
-    else UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    const struct state_program_info* info = current_program_info();
+    set_base_instance(info, baseinstance);
+    if(gles.ext.glDrawArraysInstancedBaseInstanceEXT) {
+        gles.ext.glDrawArraysInstancedBaseInstanceEXT(mode, first, count, instancecount, baseinstance);
+    } else {
+        vertex_array_apply_base_instance(state_vertex_array_get_binding(), baseinstance);
+        gles.core.glDrawArraysInstanced(mode, first, count, instancecount);
+    }
+    set_base_instance(info, 0);
 }
 
 void glDrawBuffer(GLenum buf) {
+    draw_batch_flush();
     const GLenum bufs[] = { buf };
     gles.core.glDrawBuffers(1, bufs);
 }
 
 void glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    draw_batch_flush();
     gles.core.glDrawBuffers(n, bufs);
 }
 
 void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
-    gles.core.glDrawElements(mode, count, type, indices);
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (draw_batch_accepts(mode, count)) {
+        draw_batch_add(mode, count, type, indices, 0);
+        return;
+    }
+    draw_batch_flush();
+    if (polygon_mode_emulated(mode, GL_TRUE) && polygon_mode_draw(mode, 0, count, type, indices, 1, 0)) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawElements(mode, count, draw.type, element_draw_offset(&draw, indices));
+    element_draw_end(&draw);
 }
 
 void glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
-    gles.core.glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (draw_batch_accepts(mode, count)) {
+        draw_batch_add(mode, count, type, indices, basevertex);
+        return;
+    }
+    draw_batch_flush();
+    if (polygon_mode_emulated(mode, GL_TRUE) && polygon_mode_draw(mode, 0, count, type, indices, 1, basevertex)) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawElementsBaseVertex(mode, count, draw.type, element_draw_offset(&draw, indices), basevertex);
+    element_draw_end(&draw);
 }
 
 void glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
-    gles.core.glDrawElementsIndirect(mode, type, indirect);
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawElementsIndirect(mode, draw.type, indirect);
+    element_draw_end(&draw);
 }
 
 void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
-    gles.core.glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (polygon_mode_emulated(mode, GL_TRUE) && polygon_mode_draw(mode, 0, count, type, indices, instancecount, 0)) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawElementsInstanced(mode, count, draw.type, element_draw_offset(&draw, indices), instancecount);
+    element_draw_end(&draw);
 }
 
 void glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
-    if(gles.ext.glDrawElementsInstancedBaseInstanceEXT) gles.ext.glDrawElementsInstancedBaseInstanceEXT(mode, count, type, indices, instancecount, baseinstance);
-    else UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    const struct state_program_info* info = current_program_info();
+    set_base_instance(info, baseinstance);
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    if(gles.ext.glDrawElementsInstancedBaseInstanceEXT) {
+        gles.ext.glDrawElementsInstancedBaseInstanceEXT(mode, count, draw.type, element_draw_offset(&draw, indices), instancecount, baseinstance);
+    } else {
+        vertex_array_apply_base_instance(state_vertex_array_get_binding(), baseinstance);
+        gles.core.glDrawElementsInstanced(mode, count, draw.type, element_draw_offset(&draw, indices), instancecount);
+    }
+    element_draw_end(&draw);
+    set_base_instance(info, 0);
 }
 
 void glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
-    gles.core.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (polygon_mode_emulated(mode, GL_TRUE) && polygon_mode_draw(mode, 0, count, type, indices, instancecount, basevertex)) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawElementsInstancedBaseVertex(mode, count, draw.type, element_draw_offset(&draw, indices), instancecount, basevertex);
+    element_draw_end(&draw);
 }
 
 void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
-    if(gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT) gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT(mode, count, type, indices, instancecount, basevertex, baseinstance);
-    else UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    const struct state_program_info* info = current_program_info();
+    set_base_instance(info, baseinstance);
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    if(gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT) {
+        gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT(mode, count, draw.type, element_draw_offset(&draw, indices), instancecount, basevertex, baseinstance);
+    } else {
+        vertex_array_apply_base_instance(state_vertex_array_get_binding(), baseinstance);
+        gles.core.glDrawElementsInstancedBaseVertex(mode, count, draw.type, element_draw_offset(&draw, indices), instancecount, basevertex);
+    }
+    element_draw_end(&draw);
+    set_base_instance(info, 0);
 }
 
 void glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
-    gles.core.glDrawRangeElements(mode, start, end, count, type, indices);
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (polygon_mode_emulated(mode, GL_TRUE) && polygon_mode_draw(mode, 0, count, type, indices, 1, 0)) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawRangeElements(mode, start, end, count, draw.type, element_draw_offset(&draw, indices));
+    element_draw_end(&draw);
 }
 
 void glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
-    gles.core.glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    if (polygon_mode_emulated(mode, GL_TRUE) && polygon_mode_draw(mode, 0, count, type, indices, 1, basevertex)) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    gles.core.glDrawRangeElementsBaseVertex(mode, start, end, count, draw.type, element_draw_offset(&draw, indices), basevertex);
+    element_draw_end(&draw);
 }
 
 void glDrawTransformFeedback(GLenum mode, GLuint id) {
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
     if(gles.ext.glDrawTransformFeedbackEXT) gles.ext.glDrawTransformFeedbackEXT(mode, id);
-    else UNIMPLEMENTED();
+    else transform_feedback_draw(mode, id, 1);
 }
 
 void glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
     if(gles.ext.glDrawTransformFeedbackInstancedEXT) gles.ext.glDrawTransformFeedbackInstancedEXT(mode, id, instancecount);
-    else UNIMPLEMENTED();
+    else transform_feedback_draw(mode, id, instancecount);
 }
 
 void glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    // GLES captures a single stream, the others never have vertices.
+    if (stream != 0) return;
+    if(gles.ext.glDrawTransformFeedbackEXT) gles.ext.glDrawTransformFeedbackEXT(mode, id);
+    else transform_feedback_draw(mode, id, 1);
 }
 
 void glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    // GLES captures a single stream, the others never have vertices.
+    if (stream != 0) return;
+    if(gles.ext.glDrawTransformFeedbackInstancedEXT) gles.ext.glDrawTransformFeedbackInstancedEXT(mode, id, instancecount);
+    else transform_feedback_draw(mode, id, instancecount);
 }
 
 void glEnable(GLenum cap) {
+    if (cap == GL_PRIMITIVE_RESTART || cap == GL_PRIMITIVE_RESTART_FIXED_INDEX) {
+        draw_batch_flush();
+        state_render_primitive_restart(cap, GL_TRUE);
+        cap = GL_PRIMITIVE_RESTART_FIXED_INDEX;
+    }
+    FILTER_UNCHANGED(state_render_enable(cap, GL_TRUE), STATS_FILTERED_ENABLE);
+    draw_batch_flush();
     gles.core.glEnable(cap);
 }
 
 void glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
-    GLint old_vao;
-    gles.core.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &old_vao);
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
     gles.core.glBindVertexArray(vaobj);
     gles.core.glEnableVertexAttribArray(index);
     gles.core.glBindVertexArray(old_vao);
 }
 
 void glEnableVertexAttribArray(GLuint index) {
+    draw_batch_flush();
     gles.core.glEnableVertexAttribArray(index);
 }
 
 void glEnablei(GLenum target, GLuint index) {
+    draw_batch_flush();
+    state_render_enable_indexed(target);
     gles.core.glEnablei(target, index);
 }
 
 void glEndConditionalRender(void) {
+    draw_batch_flush();
     if(gles.ext.glEndConditionalRenderNV) gles.ext.glEndConditionalRenderNV();
     else UNIMPLEMENTED();
 }
 
 void glEndQuery(GLenum target) {
+    draw_batch_flush();
+    if (target == GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN) state_transform_feedback_app_query(GL_FALSE);
     gles.core.glEndQuery(target);
 }
 
@@ -755,43 +3053,58 @@ void glEndQueryIndexed(GLenum target, GLuint index) {
 }
 
 void glEndTransformFeedback(void) {
+    draw_batch_flush();
     gles.core.glEndTransformFeedback();
+    transform_feedback_end_count(GL_TRUE);
 }
 
 GLsync glFenceSync(GLenum condition, GLbitfield flags) {
+    draw_batch_flush();
+    persistent_maps_sync();
     return gles.core.glFenceSync(condition, flags);
 }
 
 void glFinish(void) {
+    draw_batch_flush();
+    persistent_maps_sync();
     gles.core.glFinish();
+    persistent_maps_refresh();
 }
 
 void glFlush(void) {
+    draw_batch_flush();
+    persistent_maps_sync();
     gles.core.glFlush();
 }
 
 void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    draw_batch_flush();
+    if (persistent_map_flush(state_buffer_get_binding(target), offset, length)) return;
+    buffer_mirror_flush(state_buffer_get_binding(target), offset, length);
+    target = buffer_sync_target(target);
     gles.core.glFlushMappedBufferRange(target, offset, length);
 }
 
 void glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
+    draw_batch_flush();
+    if (persistent_map_flush(buffer, offset, length)) return;
+    const GLenum target = buffer_bind_scratch(buffer);
+    buffer_mirror_flush(buffer, offset, length);
     gles.core.glFlushMappedBufferRange(target, offset, length);
-    gles.core.glBindBuffer(target, old_buffer);
 }
 
 void glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    draw_batch_flush();
     gles.core.glFramebufferParameteri(target, pname, param);
 }
 
 void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    draw_batch_flush();
     gles.core.glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
 }
 
 void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    draw_batch_flush();
     gles.core.glFramebufferTexture(target, attachment, texture, level);
 }
 
@@ -800,72 +3113,84 @@ void glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget,
 }
 
 void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    draw_batch_flush();
     gles.core.glFramebufferTexture2D(target, attachment, textarget, texture, level);
 }
 
 void glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    draw_batch_flush();
     if(gles.ext.glFramebufferTexture3DOES) gles.ext.glFramebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
     else UNIMPLEMENTED();
 }
 
 void glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    draw_batch_flush();
     gles.core.glFramebufferTextureLayer(target, attachment, texture, level, layer);
 }
 
 void glFrontFace(GLenum mode) {
+    FILTER_UNCHANGED(state_render_front_face(mode), STATS_FILTERED_RASTER);
+    draw_batch_flush();
     gles.core.glFrontFace(mode);
 }
 
 void glGenBuffers(GLsizei n, GLuint *buffers) {
+    draw_batch_flush();
     gles.core.glGenBuffers(n, buffers);
 }
 
 void glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    draw_batch_flush();
     gles.core.glGenFramebuffers(n, framebuffers);
 }
 
 void glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    draw_batch_flush();
     gles.core.glGenProgramPipelines(n, pipelines);
 }
 
 void glGenQueries(GLsizei n, GLuint *ids) {
+    draw_batch_flush();
     gles.core.glGenQueries(n, ids);
 }
 
 void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    draw_batch_flush();
     gles.core.glGenRenderbuffers(n, renderbuffers);
 }
 
 void glGenSamplers(GLsizei count, GLuint *samplers) {
+    draw_batch_flush();
     gles.core.glGenSamplers(count, samplers);
 }
 
 void glGenTextures(GLsizei n, GLuint *textures) {
+    draw_batch_flush();
     gles.core.glGenTextures(n, textures);
 }
 
 void glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    draw_batch_flush();
     gles.core.glGenTransformFeedbacks(n, ids);
 }
 
 void glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    draw_batch_flush();
     gles.core.glGenVertexArrays(n, arrays);
 }
 
 void glGenerateMipmap(GLenum target) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_generate_levels(state_texture_get_binding(target));
     gles.core.glGenerateMipmap(target);
 }
 
 void glGenerateTextureMipmap(GLuint texture) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
+    state_texture_generate_levels(texture);
     gles.core.glGenerateMipmap(target);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
@@ -873,6 +3198,7 @@ void glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum
 }
 
 void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    draw_batch_flush();
     gles.core.glGetActiveAttrib(program, index, bufSize, length, size, type, name);
 }
 
@@ -889,14 +3215,17 @@ void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint in
 }
 
 void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    draw_batch_flush();
     gles.core.glGetActiveUniform(program, index, bufSize, length, size, type, name);
 }
 
 void glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    draw_batch_flush();
     gles.core.glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
 void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
 }
 
@@ -905,39 +3234,52 @@ void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize
 }
 
 void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
 }
 
 void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    draw_batch_flush();
     gles.core.glGetAttachedShaders(program, maxCount, count, shaders);
 }
 
 GLint glGetAttribLocation(GLuint program, const GLchar *name) {
+    draw_batch_flush();
     return gles.core.glGetAttribLocation(program, name);
 }
 
 void glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    draw_batch_flush();
     gles.core.glGetBooleani_v(target, index, data);
 }
 
 void glGetBooleanv(GLenum pname, GLboolean *data) {
+    draw_batch_flush();
+    sync_scratch_bindings();
     gles.core.glGetBooleanv(pname, data);
 }
 
 void glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    draw_batch_flush();
+    target = buffer_sync_target(target);
     gles.core.glGetBufferParameteri64v(target, pname, params);
 }
 
 void glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    draw_batch_flush();
+    target = buffer_sync_target(target);
     gles.core.glGetBufferParameteriv(target, pname, params);
 }
 
 void glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    draw_batch_flush();
+    target = buffer_sync_target(target);
     gles.core.glGetBufferPointerv(target, pname, params);
 }
 
 void glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    buffer_get_sub_data(state_buffer_get_binding(target), offset, size, data);
 }
 
 void glGetCompressedTexImage(GLenum target, GLint level, void *img) {
@@ -953,6 +3295,7 @@ void glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset,
 }
 
 GLuint glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    draw_batch_flush();
     return gles.core.glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
 }
 
@@ -965,6 +3308,7 @@ void glGetDoublev(GLenum pname, GLdouble *data) {
 }
 
 GLenum glGetError(void) {
+    draw_batch_flush();
     return gles.core.glGetError();
 }
 
@@ -973,44 +3317,73 @@ void glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
 }
 
 void glGetFloatv(GLenum pname, GLfloat *data) {
+    draw_batch_flush();
+    sync_scratch_bindings();
     gles.core.glGetFloatv(pname, data);
 }
 
 GLint glGetFragDataIndex(GLuint program, const GLchar *name) {
+    draw_batch_flush();
     UNIMPLEMENTED();
     return 0; // FIXME: Add a proper return value!
 }
 
 GLint glGetFragDataLocation(GLuint program, const GLchar *name) {
+    draw_batch_flush();
     return gles.core.glGetFragDataLocation(program, name);
 }
 
 void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
 }
 
 void glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetFramebufferParameteriv(target, pname, params);
 }
 
 GLenum glGetGraphicsResetStatus(void) {
+    draw_batch_flush();
     return gles.core.glGetGraphicsResetStatus();
 }
 
 void glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetInteger64i_v(target, index, data);
 }
 
 void glGetInteger64v(GLenum pname, GLint64 *data) {
+    draw_batch_flush();
+    sync_scratch_bindings();
     gles.core.glGetInteger64v(pname, data);
+    *data = application_limit(pname, *data);
 }
 
 void glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetIntegeri_v(target, index, data);
 }
 
 void glGetIntegerv(GLenum pname, GLint *data) {
+    draw_batch_flush();
+    if (pname == GL_PARAMETER_BUFFER_BINDING) {
+        *data = state_buffer_get_binding(GL_PARAMETER_BUFFER);
+        return;
+    }
+    if (pname == GL_POLYGON_MODE && !gles.ext.glPolygonModeNV) {
+        data[0] = data[1] = state_render_get_polygon_mode();
+        return;
+    }
+    if (pname == GL_PRIMITIVE_RESTART_INDEX) {
+        *data = (GLint)state_render_get_primitive_restart_index();
+        return;
+    }
+    sync_scratch_bindings();
     gles.core.glGetIntegerv(pname, data);
+    *data = application_limit(pname, *data);
 }
 
 void glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
@@ -1018,42 +3391,36 @@ void glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname,
 }
 
 void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetInternalformativ(target, internalformat, pname, count, params);
 }
 
 void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    draw_batch_flush();
     gles.core.glGetMultisamplefv(pname, index, val);
 }
 
 void glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
-    gles.core.glGetBufferParameteri64v(buffer, pname, params);
-    gles.core.glBindBuffer(target, old_buffer);
+    draw_batch_flush();
+    const GLenum target = buffer_bind_scratch(buffer);
+    gles.core.glGetBufferParameteri64v(target, pname, params);
 }
 
 void glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
-    gles.core.glGetBufferParameteriv(buffer, pname, params);
-    gles.core.glBindBuffer(target, old_buffer);
+    draw_batch_flush();
+    const GLenum target = buffer_bind_scratch(buffer);
+    gles.core.glGetBufferParameteriv(target, pname, params);
 }
 
 void glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
-    gles.core.glGetBufferPointerv(buffer, pname, params);
-    gles.core.glBindBuffer(target, old_buffer);
+    draw_batch_flush();
+    const GLenum target = buffer_bind_scratch(buffer);
+    gles.core.glGetBufferPointerv(target, pname, params);
 }
 
 void glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    buffer_get_sub_data(buffer, offset, size, data);
 }
 
 void glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
@@ -1069,55 +3436,68 @@ void glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint
 }
 
 void glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    draw_batch_flush();
     gles.core.glGetObjectLabel(identifier, name, bufSize, length, label);
 }
 
 void glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    draw_batch_flush();
     gles.core.glGetObjectPtrLabel(ptr, bufSize, length, label);
 }
 
 void glGetPointerv(GLenum pname, void **params) {
+    draw_batch_flush();
     gles.core.glGetPointerv(pname, params);
 }
 
 void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    draw_batch_flush();
     gles.core.glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
 }
 
 void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    draw_batch_flush();
     gles.core.glGetProgramInfoLog(program, bufSize, length, infoLog);
 }
 
 void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetProgramInterfaceiv(program, programInterface, pname, params);
 }
 
 void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    draw_batch_flush();
     gles.core.glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
 }
 
 void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetProgramPipelineiv(pipeline, pname, params);
 }
 
 GLuint glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    draw_batch_flush();
     return gles.core.glGetProgramResourceIndex(program, programInterface, name);
 }
 
 GLint glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    draw_batch_flush();
     return gles.core.glGetProgramResourceLocation(program, programInterface, name);
 }
 
 GLint glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    draw_batch_flush();
     if(gles.ext.glGetProgramResourceLocationIndexEXT) return gles.ext.glGetProgramResourceLocationIndexEXT(program, programInterface, name);
     else { UNIMPLEMENTED(); return 0; }
 }
 
 void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    draw_batch_flush();
     gles.core.glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
 }
 
 void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
 }
 
@@ -1126,6 +3506,7 @@ void glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint
 }
 
 void glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetProgramiv(program, pname, params);
 }
 
@@ -1150,66 +3531,81 @@ void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *param
 }
 
 void glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    draw_batch_flush();
     if (gles.ext.glGetQueryObjecti64vEXT) gles.ext.glGetQueryObjecti64vEXT(id, pname, params);
     else UNIMPLEMENTED();
 }
 
 void glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    draw_batch_flush();
     if (gles.ext.glGetQueryObjectivEXT) gles.ext.glGetQueryObjectivEXT(id, pname, params);
     else UNIMPLEMENTED();
 }
 
 void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    draw_batch_flush();
     if (gles.ext.glGetQueryObjectui64vEXT) gles.ext.glGetQueryObjectui64vEXT(id, pname, params);
     else UNIMPLEMENTED();
 }
 
 void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    draw_batch_flush();
     if (gles.ext.glGetQueryObjectuivEXT) gles.ext.glGetQueryObjectuivEXT(id, pname, params);
     else UNIMPLEMENTED();
 }
 
 void glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetQueryiv(target, pname, params);
 }
 
 void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetRenderbufferParameteriv(target, pname, params);
 }
 
 void glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetSamplerParameterIiv(sampler, pname, params);
 }
 
 void glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    draw_batch_flush();
     gles.core.glGetSamplerParameterIuiv(sampler, pname, params);
 }
 
 void glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    draw_batch_flush();
     gles.core.glGetSamplerParameterfv(sampler, pname, params);
 }
 
 void glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetSamplerParameteriv(sampler, pname, params);
 }
 
 void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    draw_batch_flush();
     gles.core.glGetShaderInfoLog(shader, bufSize, length, infoLog);
 }
 
 void glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    draw_batch_flush();
     gles.core.glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
 }
 
 void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    draw_batch_flush();
     gles.core.glGetShaderSource(shader, bufSize, length, source);
 }
 
 void glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetShaderiv(shader, pname, params);
 }
 
 const GLubyte* glGetString(GLenum name) {
+    draw_batch_flush();
     static char version_str[512];
     static char renderer_str[512];
     static char vendor_str[512];
@@ -1247,20 +3643,24 @@ const GLubyte* glGetString(GLenum name) {
 }
 
 const GLubyte * glGetStringi(GLenum name, GLuint index) {
+    draw_batch_flush();
     return gles.core.glGetStringi(name, index);
 }
 
 GLuint glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    draw_batch_flush();
     UNIMPLEMENTED();
     return 0; // FIXME: Add a proper return value!
 }
 
 GLint glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    draw_batch_flush();
     UNIMPLEMENTED();
     return 0; // FIXME: Add a proper return value!
 }
 
 void glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    draw_batch_flush();
     gles.core.glGetSynciv(sync, pname, count, length, values);
 }
 
@@ -1269,26 +3669,44 @@ void glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void
 }
 
 void glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    draw_batch_flush();
+    GLint value;
+    if (texture_level_parameter(state_texture_get_binding(target), level, pname, &value)) {
+        *params = (GLfloat)value;
+        return;
+    }
+    texture_sync_active_unit();
     gles.core.glGetTexLevelParameterfv(target, level, pname, params);
 }
 
 void glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    draw_batch_flush();
+    if (texture_level_parameter(state_texture_get_binding(target), level, pname, params)) return;
+    texture_sync_active_unit();
     gles.core.glGetTexLevelParameteriv(target, level, pname, params);
 }
 
 void glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glGetTexParameterIiv(target, pname, params);
 }
 
 void glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glGetTexParameterIuiv(target, pname, params);
 }
 
 void glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glGetTexParameterfv(target, pname, params);
 }
 
 void glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glGetTexParameteriv(target, pname, params);
 }
 
@@ -1297,11 +3715,21 @@ void glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type,
 }
 
 void glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    GLint value;
+    if (texture_level_parameter(texture, level, pname, &value)) {
+        *params = (GLfloat)value;
+        return;
+    }
+    GLenum target = texture_bind_scratch(texture);
+    gles.core.glGetTexLevelParameterfv(target, level, pname, params);
 }
 
 void glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    if (texture_level_parameter(texture, level, pname, params)) return;
+    GLenum target = texture_bind_scratch(texture);
+    gles.core.glGetTexLevelParameteriv(target, level, pname, params);
 }
 
 void glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
@@ -1325,6 +3753,7 @@ void glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoff
 }
 
 void glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    draw_batch_flush();
     gles.core.glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
 }
 
@@ -1341,15 +3770,28 @@ void glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
 }
 
 GLuint glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    draw_batch_flush();
     return gles.core.glGetUniformBlockIndex(program, uniformBlockName);
 }
 
 void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const *uniformNames, GLuint *uniformIndices) {
+    draw_batch_flush();
     gles.core.glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
 }
 
 GLint glGetUniformLocation(GLuint program, const GLchar *name) {
-    return gles.core.glGetUniformLocation(program, name);
+    draw_batch_flush();
+    GLint location;
+    if (name && state_program_lookup_uniform(program, name, &location)) {
+        stats_inc(STATS_UNIFORM_LOCATION_HITS);
+        return location;
+    }
+    location = gles.core.glGetUniformLocation(program, name);
+    if (name) {
+        stats_inc(STATS_UNIFORM_LOCATION_MISSES);
+        state_program_cache_uniform(program, name, location);
+    }
+    return location;
 }
 
 void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
@@ -1361,14 +3803,17 @@ void glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
 }
 
 void glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    draw_batch_flush();
     gles.core.glGetUniformfv(program, location, params);
 }
 
 void glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetUniformiv(program, location, params);
 }
 
 void glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    draw_batch_flush();
     gles.core.glGetUniformuiv(program, location, params);
 }
 
@@ -1385,10 +3830,14 @@ void glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
 }
 
 void glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetVertexAttribIiv(index, pname, params);
 }
 
 void glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetVertexAttribIuiv(index, pname, params);
 }
 
@@ -1397,6 +3846,8 @@ void glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
 }
 
 void glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetVertexAttribPointerv(index, pname, pointer);
 }
 
@@ -1405,10 +3856,14 @@ void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
 }
 
 void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetVertexAttribfv(index, pname, params);
 }
 
 void glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glGetVertexAttribiv(index, pname, params);
 }
 
@@ -1473,18 +3928,22 @@ void glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *
 }
 
 void glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    draw_batch_flush();
     gles.core.glGetnUniformfv(program, location, bufSize, params);
 }
 
 void glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    draw_batch_flush();
     gles.core.glGetnUniformiv(program, location, bufSize, params);
 }
 
 void glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+    draw_batch_flush();
     gles.core.glGetnUniformuiv(program, location, bufSize, params);
 }
 
 void glHint(GLenum target, GLenum mode) {
+    draw_batch_flush();
     gles.core.glHint(target, mode);
 }
 
@@ -1497,6 +3956,7 @@ void glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length
 }
 
 void glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    draw_batch_flush();
     gles.core.glInvalidateFramebuffer(target, numAttachments, attachments);
 }
 
@@ -1509,6 +3969,7 @@ void glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachme
 }
 
 void glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    draw_batch_flush();
     gles.core.glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
 }
 
@@ -1521,73 +3982,92 @@ void glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint y
 }
 
 GLboolean glIsBuffer(GLuint buffer) {
+    draw_batch_flush();
     return gles.core.glIsBuffer(buffer);
 }
 
 GLboolean glIsEnabled(GLenum cap) {
+    draw_batch_flush();
+    if (cap == GL_PRIMITIVE_RESTART || cap == GL_PRIMITIVE_RESTART_FIXED_INDEX) {
+        return state_render_get_primitive_restart_cap(cap);
+    }
     return gles.core.glIsEnabled(cap);
 }
 
 GLboolean glIsEnabledi(GLenum target, GLuint index) {
+    draw_batch_flush();
     return gles.core.glIsEnabledi(target, index);
 }
 
 GLboolean glIsFramebuffer(GLuint framebuffer) {
+    draw_batch_flush();
     return gles.core.glIsFramebuffer(framebuffer);
 }
 
 GLboolean glIsProgram(GLuint program) {
+    draw_batch_flush();
     return gles.core.glIsProgram(program);
 }
 
 GLboolean glIsProgramPipeline(GLuint pipeline) {
+    draw_batch_flush();
     return gles.core.glIsProgramPipeline(pipeline);
 }
 
 GLboolean glIsQuery(GLuint id) {
+    draw_batch_flush();
     return gles.core.glIsQuery(id);
 }
 
 GLboolean glIsRenderbuffer(GLuint renderbuffer) {
+    draw_batch_flush();
     return gles.core.glIsRenderbuffer(renderbuffer);
 }
 
 GLboolean glIsSampler(GLuint sampler) {
+    draw_batch_flush();
     return gles.core.glIsSampler(sampler);
 }
 
 GLboolean glIsShader(GLuint shader) {
+    draw_batch_flush();
     return gles.core.glIsShader(shader);
 }
 
 GLboolean glIsSync(GLsync sync) {
+    draw_batch_flush();
     return gles.core.glIsSync(sync);
 }
 
 GLboolean glIsTexture(GLuint texture) {
+    draw_batch_flush();
     return gles.core.glIsTexture(texture);
 }
 
 GLboolean glIsTransformFeedback(GLuint id) {
+    draw_batch_flush();
     return gles.core.glIsTransformFeedback(id);
 }
 
 GLboolean glIsVertexArray(GLuint array) {
+    draw_batch_flush();
     return gles.core.glIsVertexArray(array);
 }
 
 void glLineWidth(GLfloat width) {
+    draw_batch_flush();
     gles.core.glLineWidth(width);
 }
 
 void glLinkProgram(GLuint program) {
+    draw_batch_flush();
     if (shader_cache_load_program(program)) {
+        program_update_link_status(program);
         return;
     }
     gles.core.glLinkProgram(program);
-    GLint status;
-    gles.core.glGetProgramiv(program, GL_LINK_STATUS, &status);
-    if (status == GL_TRUE) {
+    program_update_link_status(program);
+    if (state_program_get_info(program)) {
         shader_cache_save_program(program);
     }
 }
@@ -1597,78 +4077,157 @@ void glLogicOp(GLenum opcode) {
 }
 
 void * glMapBuffer(GLenum target, GLenum access) {
-    return glMapBuffer_internal(target, access);
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    return glMapBuffer_internal(buffer_sync_target(target), buffer, access);
 }
 
 void* glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
-    return glMapBufferRange_internal(target, offset, length, access);
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    if (persistent_map_emulated(access)) {
+        void* pointer = persistent_map_begin(buffer, offset, length, access);
+        if (pointer) return pointer;
+    }
+    return glMapBufferRange_internal(buffer_sync_target(target), buffer, offset, length, access);
 }
 
 void * glMapNamedBuffer(GLuint buffer, GLenum access) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    void* mapped_ptr = NULL;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
-    mapped_ptr = glMapBuffer_internal(target, access);
-    gles.core.glBindBuffer(target, old_buffer);
-    return mapped_ptr;
+    draw_batch_flush();
+    const GLenum target = buffer_bind_scratch(buffer);
+    return glMapBuffer_internal(target, buffer, access);
 }
 
 void * glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    void* mapped_ptr = NULL;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
-    mapped_ptr = glMapBufferRange_internal(target, offset, length, access);
-    gles.core.glBindBuffer(target, old_buffer);
-    return mapped_ptr;
+    draw_batch_flush();
+    if (persistent_map_emulated(access)) {
+        void* pointer = persistent_map_begin(buffer, offset, length, access);
+        if (pointer) return pointer;
+    }
+    const GLenum target = buffer_bind_scratch(buffer);
+    return glMapBufferRange_internal(target, buffer, offset, length, access);
 }
 
 void glMemoryBarrier(GLbitfield barriers) {
+    draw_batch_flush();
+    persistent_maps_sync();
     gles.core.glMemoryBarrier(barriers);
 }
 
 void glMemoryBarrierByRegion(GLbitfield barriers) {
+    draw_batch_flush();
+    persistent_maps_sync();
     gles.core.glMemoryBarrierByRegion(barriers);
 }
 
 void glMinSampleShading(GLfloat value) {
+    draw_batch_flush();
     gles.core.glMinSampleShading(value);
 }
 
 void glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
-    if(gles.ext.glMultiDrawArraysEXT) gles.ext.glMultiDrawArraysEXT(mode, first, count, drawcount);
-    else UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    const struct state_program_info* info = current_program_info();
+
+    if (!uses_draw_id(info) && gles.ext.glMultiDrawArraysEXT) {
+        gles.ext.glMultiDrawArraysEXT(mode, first, count, drawcount);
+        return;
+    }
+    if (drawcount > 0 && draw_id_attribute_usable(info, 0)) {
+        DrawArraysIndirectCommand* commands = malloc(drawcount * sizeof(*commands));
+        if (commands) {
+            for (GLsizei i = 0; i < drawcount; ++i) {
+                commands[i] = (DrawArraysIndirectCommand){ count[i] > 0 ? count[i] : 0, 1, first[i], i };
+            }
+            draw_id_attribute_multi_draw(mode, 0, commands, drawcount, info);
+            free(commands);
+            return;
+        }
+    }
+    for (GLsizei i = 0; i < drawcount; ++i) {
+        if (count[i] > 0) {
+            set_draw_id(info, i);
+            gles.core.glDrawArrays(mode, first[i], count[i]);
+        }
+    }
+    reset_draw_id(info);
 }
 
 void glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
-    if(gles.ext.glMultiDrawArraysIndirectEXT) gles.ext.glMultiDrawArraysIndirectEXT(mode, indirect, drawcount, stride);
-    else UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    multi_draw_indirect(mode, 0, (GLintptr)indirect, drawcount, stride, 0, 0);
 }
 
 void glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    GLuint count_buffer = state_buffer_get_binding(GL_PARAMETER_BUFFER);
+    if (count_buffer == 0) return;
+    multi_draw_indirect(mode, 0, (GLintptr)indirect, maxdrawcount, stride, count_buffer, drawcount);
 }
 
 void glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawcount) {
-    if(gles.ext.glMultiDrawElementsEXT) gles.ext.glMultiDrawElementsEXT(mode, count, type, indices, drawcount);
-    else UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    const struct state_program_info* info = current_program_info();
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_FALSE);
+
+    if (!uses_draw_id(info) && gles.ext.glMultiDrawElementsEXT) {
+        gles.ext.glMultiDrawElementsEXT(mode, count, type, indices, drawcount);
+        element_draw_end(&draw);
+        return;
+    }
+    if (drawcount > 0 && draw_id_attribute_usable(info, type)) {
+        DrawElementsIndirectCommand* commands = draw_id_element_commands(count, type, indices, drawcount, NULL);
+        if (commands) {
+            draw_id_attribute_multi_draw(mode, type, commands, drawcount, info);
+            free(commands);
+            element_draw_end(&draw);
+            return;
+        }
+    }
+    for (GLsizei i = 0; i < drawcount; ++i) {
+        if (count[i] > 0) {
+            set_draw_id(info, i);
+            gles.core.glDrawElements(mode, count[i], type, indices[i]);
+        }
+    }
+    reset_draw_id(info);
+    element_draw_end(&draw);
 }
 
 void glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawcount, const GLint *basevertex) {
-    GLint program;
-    gles.core.glGetIntegerv(GL_CURRENT_PROGRAM, &program);
-    GLint draw_id_loc = gles.core.glGetUniformLocation(program, "glt_draw_id");
-
-    if (draw_id_loc != -1) {
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    const struct state_program_info* info = current_program_info();
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_FALSE);
+
+    if (uses_draw_id(info)) {
+        if (drawcount > 0 && draw_id_attribute_usable(info, type)) {
+            DrawElementsIndirectCommand* commands = draw_id_element_commands(count, type, indices, drawcount, basevertex);
+            if (commands) {
+                draw_id_attribute_multi_draw(mode, type, commands, drawcount, info);
+                free(commands);
+                element_draw_end(&draw);
+                return;
+            }
+        }
         for (GLsizei i = 0; i < drawcount; ++i) {
             if (count[i] > 0) {
-                gles.core.glUniform1i(draw_id_loc, i);
+                set_draw_id(info, i);
                 gles.core.glDrawElementsBaseVertex(mode, count[i], type, indices[i], basevertex[i]);
             }
         }
+        reset_draw_id(info);
     } else {
         if(gles.ext.glMultiDrawElementsBaseVertexEXT) {
             gles.ext.glMultiDrawElementsBaseVertexEXT(mode, count, type, indices, drawcount, basevertex);
@@ -1680,68 +4239,29 @@ void glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum typ
             }
         }
     }
+    element_draw_end(&draw);
 }
 
 void glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
-    // If stride is 0, the commands are tightly packed.
-    if (stride == 0) {
-        stride = 20; // sizeof(count, instanceCount, firstIndex, baseVertex, baseInstance) -> 5 * sizeof(GLuint)
-    }
-
-    GLint program;
-    gles.core.glGetIntegerv(GL_CURRENT_PROGRAM, &program);
-
-    GLint draw_id_loc = gles.core.glGetUniformLocation(program, "glt_draw_id");
-    GLint base_instance_loc = gles.core.glGetUniformLocation(program, "glt_base_instance");
-
-    if (draw_id_loc == -1 && base_instance_loc == -1) {
-        if (gles.ext.glMultiDrawElementsIndirectEXT) {
-            gles.ext.glMultiDrawElementsIndirectEXT(mode, type, indirect, drawcount, stride);
-        } else {
-            UNIMPLEMENTED();
-        }
-        return;
-    }
-
-    if (base_instance_loc != -1) {
-        GLint indirect_buffer;
-        gles.core.glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &indirect_buffer);
-        if (indirect_buffer == 0) return;
-
-        typedef struct {
-            GLuint count;
-            GLuint instanceCount;
-            GLuint firstIndex;
-            GLuint baseVertex;
-            GLuint baseInstance;
-        } DrawElementsIndirectCommand;
-        void* mapped_ptr = gles.core.glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, (GLsizeiptr)indirect, drawcount * stride, GL_MAP_READ_BIT);
-        if (!mapped_ptr) return;
-
-        for (GLsizei i = 0; i < drawcount; ++i) {
-            DrawElementsIndirectCommand* cmd = (DrawElementsIndirectCommand*)((uint8_t*)mapped_ptr + i * stride);
-            if (cmd->instanceCount > 0) {
-                if (draw_id_loc != -1) gles.core.glUniform1i(draw_id_loc, i);
-                gles.core.glUniform1i(base_instance_loc, cmd->baseInstance); // Set base instance from struct
-                const void* indices_ptr = (const void*)(uintptr_t)(cmd->firstIndex * sizeof(GLuint));
-                gles.core.glDrawElementsInstancedBaseVertex(mode, cmd->count, type, indices_ptr, cmd->instanceCount, cmd->baseVertex);
-            }
-        }
-        gles.core.glUnmapBuffer(GL_DRAW_INDIRECT_BUFFER);
-
-    } else {
-        for (GLsizei i = 0; i < drawcount; ++i) {
-            if (draw_id_loc != -1) {
-                gles.core.glUniform1i(draw_id_loc, i);
-            }
-            const void* current_indirect_offset = (const void*)((uintptr_t)indirect + i * stride);
-            gles.core.glDrawElementsIndirect(mode, type, current_indirect_offset);
-        }
-    }
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    multi_draw_indirect(mode, draw.type, (GLintptr)indirect, drawcount, stride, 0, 0);
+    element_draw_end(&draw);
 }
 
 void glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    persistent_maps_sync();
+    vertex_array_restore_base_instance();
+    GLuint count_buffer = state_buffer_get_binding(GL_PARAMETER_BUFFER);
+    if (count_buffer == 0) return;
+    struct element_draw draw;
+    element_draw_begin(&draw, type, GL_TRUE);
+    multi_draw_indirect(mode, draw.type, (GLintptr)indirect, maxdrawcount, stride, count_buffer, drawcount);
+    element_draw_end(&draw);
 }
 
 void glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
@@ -1777,35 +4297,38 @@ void glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
 }
 
 void glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
+    draw_batch_flush();
+    persistent_map_end(buffer, GL_FALSE);
+    const GLenum target = buffer_bind_scratch(buffer);
+    state_buffer_set_data(buffer, size, usage);
+    index_track_data(buffer, GL_TRUE, size, data);
+    if (g_config.indirect_mirror) state_buffer_mirror_reset(buffer, data);
     gles.core.glBufferData(target, size, data, usage);
-    gles.core.glBindBuffer(target, old_buffer);
 }
 
 void glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
+    draw_batch_flush();
+    persistent_map_end(buffer, GL_FALSE);
+    const GLenum target = buffer_bind_scratch(buffer);
+    state_buffer_set_storage(buffer, size, flags);
+    index_track_data(buffer, GL_TRUE, size, data);
+    if (g_config.indirect_mirror) state_buffer_mirror_reset(buffer, data);
     if(gles.ext.glBufferStorageEXT) {
         gles.ext.glBufferStorageEXT(target, size, data, flags);
     }
     else {
-        gles.core.glBufferData(target, size, data, GL_STATIC_DRAW);
+        gles.core.glBufferData(target, size, data, flags & (GL_MAP_PERSISTENT_BIT_EXT | GL_DYNAMIC_STORAGE_BIT_EXT) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
     }
-    gles.core.glBindBuffer(target, old_buffer);
 }
 
 void glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
-    const GLenum target = GL_ARRAY_BUFFER;
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
+    draw_batch_flush();
+    const GLenum target = buffer_bind_scratch(buffer);
+    state_buffer_modified(buffer);
+    index_track_sub_data(buffer, GL_TRUE, offset, size, data);
+    if (g_config.indirect_mirror) state_buffer_mirror_write(buffer, offset, size, data);
+    if (stream_upload(buffer, target, offset, size, data)) return;
     gles.core.glBufferSubData(target, offset, size, data);
-    gles.core.glBindBuffer(target, old_buffer);
 }
 
 void glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
@@ -1825,18 +4348,18 @@ void glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
 }
 
 void glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
-    const GLenum target = GL_FRAMEBUFFER;
-    GLint old_fbo;
-    gles.core.glGetIntegerv(GL_FRAMEBUFFER_BINDING, &old_fbo);
+    draw_batch_flush();
+    const GLenum target = GL_DRAW_FRAMEBUFFER;
+    GLuint old_fbo = state_framebuffer_get_binding(target);
     gles.core.glBindFramebuffer(target, framebuffer);
-    gles.core.glFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+    gles.core.glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
     gles.core.glBindFramebuffer(target, old_fbo);
 }
 
 void glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
-    const GLenum target = GL_FRAMEBUFFER;
-    GLint old_fbo;
-    gles.core.glGetIntegerv(GL_FRAMEBUFFER_BINDING, &old_fbo);
+    draw_batch_flush();
+    const GLenum target = GL_DRAW_FRAMEBUFFER;
+    GLuint old_fbo = state_framebuffer_get_binding(target);
     gles.core.glBindFramebuffer(target, framebuffer);
     gles.core.glFramebufferTexture(target, attachment, texture, level);
     gles.core.glBindFramebuffer(target, old_fbo);
@@ -1863,10 +4386,12 @@ void glNormalP3uiv(GLenum type, const GLuint *coords) {
 }
 
 void glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    draw_batch_flush();
     gles.core.glObjectLabel(identifier, name, length, label);
 }
 
 void glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    draw_batch_flush();
     gles.core.glObjectPtrLabel(ptr, length, label);
 }
 
@@ -1875,10 +4400,12 @@ void glPatchParameterfv(GLenum pname, const GLfloat *values) {
 }
 
 void glPatchParameteri(GLenum pname, GLint value) {
+    draw_batch_flush();
     gles.core.glPatchParameteri(pname, value);
 }
 
 void glPauseTransformFeedback(void) {
+    draw_batch_flush();
     gles.core.glPauseTransformFeedback();
 }
 
@@ -1887,6 +4414,7 @@ void glPixelStoref(GLenum pname, GLfloat param) {
 }
 
 void glPixelStorei(GLenum pname, GLint param) {
+    draw_batch_flush();
     gles.core.glPixelStorei(pname, param);
 }
 
@@ -1911,32 +4439,43 @@ void glPointSize(GLfloat size) {
 }
 
 void glPolygonMode(GLenum face, GLenum mode) {
+    draw_batch_flush();
+    // Core profiles only accept GL_FRONT_AND_BACK.
     if(gles.ext.glPolygonModeNV) gles.ext.glPolygonModeNV(face, mode);
-    else UNIMPLEMENTED();
+    else state_render_polygon_mode(mode);
 }
 
 void glPolygonOffset(GLfloat factor, GLfloat units) {
+    FILTER_UNCHANGED(state_render_polygon_offset(factor, units), STATS_FILTERED_RASTER);
+    draw_batch_flush();
     gles.core.glPolygonOffset(factor, units);
 }
 
 void glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    draw_batch_flush();
+    state_render_polygon_offset_clamp();
     if(gles.ext.glPolygonOffsetClampEXT) gles.ext.glPolygonOffsetClampEXT(factor, units, clamp);
     else UNIMPLEMENTED();
 }
 
 void glPopDebugGroup(void) {
+    draw_batch_flush();
     gles.core.glPopDebugGroup();
 }
 
 void glPrimitiveRestartIndex(GLuint index) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    state_render_primitive_restart_index(index);
 }
 
 void glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    draw_batch_flush();
     gles.core.glProgramBinary(program, binaryFormat, binary, length);
+    program_update_link_status(program);
 }
 
 void glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    draw_batch_flush();
     gles.core.glProgramParameteri(program, pname, value);
 }
 
@@ -1949,26 +4488,32 @@ void glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GL
 }
 
 void glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    draw_batch_flush();
     gles.core.glProgramUniform1f(program, location, v0);
 }
 
 void glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform1fv(program, location, count, value);
 }
 
 void glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    draw_batch_flush();
     gles.core.glProgramUniform1i(program, location, v0);
 }
 
 void glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform1iv(program, location, count, value);
 }
 
 void glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    draw_batch_flush();
     gles.core.glProgramUniform1ui(program, location, v0);
 }
 
 void glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform1uiv(program, location, count, value);
 }
 
@@ -1981,26 +4526,32 @@ void glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GL
 }
 
 void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    draw_batch_flush();
     gles.core.glProgramUniform2f(program, location, v0, v1);
 }
 
 void glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform2fv(program, location, count, value);
 }
 
 void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    draw_batch_flush();
     gles.core.glProgramUniform2i(program, location, v0, v1);
 }
 
 void glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform2iv(program, location, count, value);
 }
 
 void glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    draw_batch_flush();
     gles.core.glProgramUniform2ui(program, location, v0, v1);
 }
 
 void glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform2uiv(program, location, count, value);
 }
 
@@ -2013,26 +4564,32 @@ void glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GL
 }
 
 void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    draw_batch_flush();
     gles.core.glProgramUniform3f(program, location, v0, v1, v2);
 }
 
 void glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform3fv(program, location, count, value);
 }
 
 void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    draw_batch_flush();
     gles.core.glProgramUniform3i(program, location, v0, v1, v2);
 }
 
 void glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform3iv(program, location, count, value);
 }
 
 void glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    draw_batch_flush();
     gles.core.glProgramUniform3ui(program, location, v0, v1, v2);
 }
 
 void glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform3uiv(program, location, count, value);
 }
 
@@ -2045,26 +4602,32 @@ void glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GL
 }
 
 void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    draw_batch_flush();
     gles.core.glProgramUniform4f(program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform4fv(program, location, count, value);
 }
 
 void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    draw_batch_flush();
     gles.core.glProgramUniform4i(program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform4iv(program, location, count, value);
 }
 
 void glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    draw_batch_flush();
     gles.core.glProgramUniform4ui(program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glProgramUniform4uiv(program, location, count, value);
 }
 
@@ -2073,6 +4636,7 @@ void glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GL
 }
 
 void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix2fv(program, location, count, transpose, value);
 }
 
@@ -2081,6 +4645,7 @@ void glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count,
 }
 
 void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
 }
 
@@ -2089,6 +4654,7 @@ void glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count,
 }
 
 void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2098,6 +4664,7 @@ void glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GL
 }
 
 void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix3fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2107,6 +4674,7 @@ void glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count,
 }
 
 void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2116,6 +4684,7 @@ void glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count,
 }
 
 void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2125,6 +4694,7 @@ void glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GL
 }
 
 void glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix4fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2134,6 +4704,7 @@ void glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count,
 }
 
 void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2143,6 +4714,7 @@ void glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count,
 }
 
 void glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
     UNIMPLEMENTED();
 }
@@ -2152,148 +4724,133 @@ void glProvokingVertex(GLenum mode) {
 }
 
 void glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    draw_batch_flush();
     gles.core.glPushDebugGroup(source, id, length, message);
 }
 
 void glQueryCounter(GLuint id, GLenum target) {
+    draw_batch_flush();
     if(gles.ext.glQueryCounterEXT) gles.ext.glQueryCounterEXT(id, target);
     else UNIMPLEMENTED();
 }
 
 void glReadBuffer(GLenum src) {
+    draw_batch_flush();
     gles.core.glReadBuffer(src);
 }
 
-void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
-    GLint pbo = 0;
-    gles.core.glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pbo);
-
-    if (pbo != 0) {
-        GLint is_mapped = GL_FALSE;
-        gles.core.glGetBufferParameteriv(GL_PIXEL_PACK_BUFFER, GL_BUFFER_MAPPED, &is_mapped);
-        if (is_mapped) {
-            void* mapped_ptr = NULL;
-            gles.core.glGetBufferPointerv(GL_PIXEL_PACK_BUFFER, GL_BUFFER_MAP_POINTER, &mapped_ptr);
-            GLint pbo_size = 0;
-            gles.core.glGetBufferParameteriv(GL_PIXEL_PACK_BUFFER, GL_BUFFER_SIZE, &pbo_size);
-            GLintptr offset = (GLintptr)pixels;
-            GLsizei max_read_size = pbo_size - offset;
-            void* temp_buffer = malloc(max_read_size);
-            gles.core.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
-            gles.core.glReadnPixels(x, y, width, height, format, type, max_read_size, temp_buffer);
-            gles.core.glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
-            memcpy((char*)mapped_ptr + offset, temp_buffer, max_read_size);
-            free(temp_buffer);
-            return;
-        }
-    }
+// Reads pixels into a mapped pack buffer. The driver rejects reads into a
+// mapped buffer, so they go to the mapping directly with the buffer unbound.
+// Returns 0 when the buffer isn't mapped at the destination.
+static int read_pixels_to_mapping(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, const void* offset) {
+    GLuint pbo = state_buffer_get_binding(GL_PIXEL_PACK_BUFFER);
+    if (pbo == 0) return 0;
+    GLsizeiptr available = 0;
+    char* dest = buffer_mapped_at(state_buffer_get_info(pbo), (GLintptr)offset, &available);
+    if (!dest) return 0;
+    // Clipped to the mapping, a read that doesn't fit fails without writing.
+    if (available < bufSize) bufSize = available > INT32_MAX ? INT32_MAX : (GLsizei)available;
+    gles.core.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    gles.core.glReadnPixels(x, y, width, height, format, type, bufSize, dest);
+    gles.core.glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+    return 1;
+}
 
-    // Default case: No PBO is bound, or it's not mapped.
+void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    draw_batch_flush();
+    if (read_pixels_to_mapping(x, y, width, height, format, type, INT32_MAX, pixels)) return;
     gles.core.glReadPixels(x, y, width, height, format, type, pixels);
 }
 
 void glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
-    GLint pbo = 0;
-    gles.core.glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pbo);
-
-    if (pbo != 0) {
-        GLint is_mapped = GL_FALSE;
-        gles.core.glGetBufferParameteriv(GL_PIXEL_PACK_BUFFER, GL_BUFFER_MAPPED, &is_mapped);
-
-        if (is_mapped) {
-            void* mapped_ptr = NULL;
-            gles.core.glGetBufferPointerv(GL_PIXEL_PACK_BUFFER, GL_BUFFER_MAP_POINTER, &mapped_ptr);
-            if (!mapped_ptr) {
-                gles.core.glReadnPixels(x, y, width, height, format, type, bufSize, data);
-                return;
-            }
-
-            // This implementation was already correct, as it has bufSize.
-            void* temp_buffer = malloc(bufSize);
-            if (!temp_buffer) {
-                fprintf(stderr, "glReadnPixels workaround failed: could not allocate temporary buffer.\n");
-                gles.core.glReadnPixels(x, y, width, height, format, type, bufSize, data);
-                return;
-            }
-
-            gles.core.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
-            gles.core.glReadnPixels(x, y, width, height, format, type, bufSize, temp_buffer);
-            gles.core.glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
-
-            GLintptr offset = (GLintptr)data;
-            memcpy((char*)mapped_ptr + offset, temp_buffer, bufSize);
-
-            free(temp_buffer);
-            return;
-        }
-    }
-
+    draw_batch_flush();
+    if (read_pixels_to_mapping(x, y, width, height, format, type, bufSize, data)) return;
     gles.core.glReadnPixels(x, y, width, height, format, type, bufSize, data);
 }
 
 void glReleaseShaderCompiler(void) {
+    draw_batch_flush();
     gles.core.glReleaseShaderCompiler();
 }
 
 void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    draw_batch_flush();
     gles.core.glRenderbufferStorage(target, internalformat, width, height);
 }
 
 void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    draw_batch_flush();
     gles.core.glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
 }
 
 void glResumeTransformFeedback(void) {
+    draw_batch_flush();
     gles.core.glResumeTransformFeedback();
 }
 
 void glSampleCoverage(GLfloat value, GLboolean invert) {
+    draw_batch_flush();
     gles.core.glSampleCoverage(value, invert);
 }
 
 void glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    draw_batch_flush();
     gles.core.glSampleMaski(maskNumber, mask);
 }
 
 void glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    draw_batch_flush();
     gles.core.glSamplerParameterIiv(sampler, pname, param);
 }
 
 void glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    draw_batch_flush();
     gles.core.glSamplerParameterIuiv(sampler, pname, param);
 }
 
 void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    draw_batch_flush();
     gles.core.glSamplerParameterf(sampler, pname, param);
 }
 
 void glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    draw_batch_flush();
     gles.core.glSamplerParameterfv(sampler, pname, param);
 }
 
 void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    draw_batch_flush();
     gles.core.glSamplerParameteri(sampler, pname, param);
 }
 
 void glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    draw_batch_flush();
     gles.core.glSamplerParameteriv(sampler, pname, param);
 }
 
 void glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    FILTER_UNCHANGED(state_render_scissor(x, y, width, height), STATS_FILTERED_SCISSOR);
+    draw_batch_flush();
     gles.core.glScissor(x, y, width, height);
 }
 
 void glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    draw_batch_flush();
+    state_render_scissor_indexed(first);
     if(gles.ext.glScissorArrayvOES) gles.ext.glScissorArrayvOES(first, count, v);
     else UNIMPLEMENTED();
 }
 
 void glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    draw_batch_flush();
+    state_render_scissor_indexed(index);
     if(gles.ext.glScissorIndexedOES) gles.ext.glScissorIndexedOES(index, left, bottom, width, height);
     else UNIMPLEMENTED();
 }
 
 void glScissorIndexedv(GLuint index, const GLint *v) {
+    draw_batch_flush();
+    state_render_scissor_indexed(index);
     if(gles.ext.glScissorIndexedvOES) gles.ext.glScissorIndexedvOES(index, v);
     else UNIMPLEMENTED();
 }
@@ -2307,10 +4864,12 @@ void glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
 }
 
 void glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    draw_batch_flush();
     gles.core.glShaderBinary(count, shaders, binaryFormat, binary, length);
 }
 
 void glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) {
+    draw_batch_flush();
     if (count <= 0 || !string) {
         gles.core.glShaderSource(shader, count, string, length);
         return;
@@ -2375,34 +4934,44 @@ void glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpec
 }
 
 void glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    draw_batch_flush();
     gles.core.glStencilFunc(func, ref, mask);
 }
 
 void glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    draw_batch_flush();
     gles.core.glStencilFuncSeparate(face, func, ref, mask);
 }
 
 void glStencilMask(GLuint mask) {
+    draw_batch_flush();
     gles.core.glStencilMask(mask);
 }
 
 void glStencilMaskSeparate(GLenum face, GLuint mask) {
+    draw_batch_flush();
     gles.core.glStencilMaskSeparate(face, mask);
 }
 
 void glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    draw_batch_flush();
     gles.core.glStencilOp(fail, zfail, zpass);
 }
 
 void glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    draw_batch_flush();
     gles.core.glStencilOpSeparate(face, sfail, dpfail, dppass);
 }
 
 void glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexBuffer(target, internalformat, buffer);
 }
 
 void glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexBufferRange(target, internalformat, buffer, offset, size);
 }
 
@@ -2443,6 +5012,9 @@ void glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei widt
 }
 
 void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_image(state_texture_get_binding(target), level, internalformat, width, height, 1);
     gles.core.glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -2451,6 +5023,9 @@ void glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalform
 }
 
 void glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_image(state_texture_get_binding(target), level, internalformat, width, height, depth);
     gles.core.glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -2459,26 +5034,38 @@ void glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalform
 }
 
 void glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexParameterIiv(target, pname, params);
 }
 
 void glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexParameterIuiv(target, pname, params);
 }
 
 void glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexParameterf(target, pname, param);
 }
 
 void glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexParameterfv(target, pname, params);
 }
 
 void glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexParameteri(target, pname, param);
 }
 
 void glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexParameteriv(target, pname, params);
 }
 
@@ -2487,18 +5074,30 @@ void glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 }
 
 void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_storage(state_texture_get_binding(target), levels, internalformat, width, height, 1, 0);
     gles.core.glTexStorage2D(target, levels, internalformat, width, height);
 }
 
 void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_storage(state_texture_get_binding(target), 1, internalformat, width, height, 1, samples);
     gles.core.glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
 void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_storage(state_texture_get_binding(target), levels, internalformat, width, height, depth, 0);
     gles.core.glTexStorage3D(target, levels, internalformat, width, height, depth);
 }
 
 void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    draw_batch_flush();
+    texture_sync_active_unit();
+    state_texture_set_storage(state_texture_get_binding(target), 1, internalformat, width, height, depth, samples);
     gles.core.glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -2507,10 +5106,14 @@ void glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, G
 }
 
 void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
 void glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    draw_batch_flush();
+    texture_sync_active_unit();
     gles.core.glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -2527,75 +5130,39 @@ void glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer,
 }
 
 void glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexParameterIiv(target, pname, params);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexParameterIuiv(target, pname, params);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexParameterf(target, pname, param);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexParameterfv(target, pname, param);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexParameteri(target, pname, param);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexParameteriv(target, pname, param);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
@@ -2603,15 +5170,10 @@ void glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, G
 }
 
 void glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
+    state_texture_set_storage(texture, levels, internalformat, width, height, 1, 0);
     gles.core.glTexStorage2D(target, levels, internalformat, width, height);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
@@ -2619,15 +5181,10 @@ void glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum inter
 }
 
 void glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
+    state_texture_set_storage(texture, levels, internalformat, width, height, depth, 0);
     gles.core.glTexStorage3D(target, levels, internalformat, width, height, depth);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
@@ -2639,15 +5196,9 @@ void glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei wid
 }
 
 void glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
-    GLenum target = state_texture_get_target(texture);
-
-    GLenum binding_target = get_texture_binding_from_target(target);
-    GLint old_texture;
-    gles.core.glGetIntegerv(binding_target, &old_texture);
-
-    gles.core.glBindTexture(target, texture);
+    draw_batch_flush();
+    GLenum target = texture_bind_scratch(texture);
     gles.core.glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
-    gles.core.glBindTexture(target, old_texture);
 }
 
 void glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
@@ -2655,6 +5206,7 @@ void glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffs
 }
 
 void glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    draw_batch_flush();
     if(gles.ext.glTextureViewEXT) gles.ext.glTextureViewEXT(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
     else UNIMPLEMENTED();
 }
@@ -2668,6 +5220,7 @@ void glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLi
 }
 
 void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const *varyings, GLenum bufferMode) {
+    draw_batch_flush();
     gles.core.glTransformFeedbackVaryings(program, count, varyings, bufferMode);
 }
 
@@ -2680,26 +5233,32 @@ void glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
 }
 
 void glUniform1f(GLint location, GLfloat v0) {
+    draw_batch_flush();
     gles.core.glUniform1f(location, v0);
 }
 
 void glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniform1fv(location, count, value);
 }
 
 void glUniform1i(GLint location, GLint v0) {
+    draw_batch_flush();
     gles.core.glUniform1i(location, v0);
 }
 
 void glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glUniform1iv(location, count, value);
 }
 
 void glUniform1ui(GLint location, GLuint v0) {
+    draw_batch_flush();
     gles.core.glUniform1ui(location, v0);
 }
 
 void glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glUniform1uiv(location, count, value);
 }
 
@@ -2712,26 +5271,32 @@ void glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
 }
 
 void glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    draw_batch_flush();
     gles.core.glUniform2f(location, v0, v1);
 }
 
 void glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniform2fv(location, count, value);
 }
 
 void glUniform2i(GLint location, GLint v0, GLint v1) {
+    draw_batch_flush();
     gles.core.glUniform2i(location, v0, v1);
 }
 
 void glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glUniform2iv(location, count, value);
 }
 
 void glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    draw_batch_flush();
     gles.core.glUniform2ui(location, v0, v1);
 }
 
 void glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glUniform2uiv(location, count, value);
 }
 
@@ -2744,26 +5309,32 @@ void glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
 }
 
 void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    draw_batch_flush();
     gles.core.glUniform3f(location, v0, v1, v2);
 }
 
 void glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniform3fv(location, count, value);
 }
 
 void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    draw_batch_flush();
     gles.core.glUniform3i(location, v0, v1, v2);
 }
 
 void glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glUniform3iv(location, count, value);
 }
 
 void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    draw_batch_flush();
     gles.core.glUniform3ui(location, v0, v1, v2);
 }
 
 void glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glUniform3uiv(location, count, value);
 }
 
@@ -2776,30 +5347,37 @@ void glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
 }
 
 void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    draw_batch_flush();
     gles.core.glUniform4f(location, v0, v1, v2, v3);
 }
 
 void glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniform4fv(location, count, value);
 }
 
 void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    draw_batch_flush();
     gles.core.glUniform4i(location, v0, v1, v2, v3);
 }
 
 void glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    draw_batch_flush();
     gles.core.glUniform4iv(location, count, value);
 }
 
 void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    draw_batch_flush();
     gles.core.glUniform4ui(location, v0, v1, v2, v3);
 }
 
 void glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    draw_batch_flush();
     gles.core.glUniform4uiv(location, count, value);
 }
 
 void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    draw_batch_flush();
     gles.core.glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
 }
 
@@ -2808,6 +5386,7 @@ void glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, cons
 }
 
 void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix2fv(location, count, transpose, value);
 }
 
@@ -2816,6 +5395,7 @@ void glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, co
 }
 
 void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix2x3fv(location, count, transpose, value);
 }
 
@@ -2824,6 +5404,7 @@ void glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, co
 }
 
 void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix2x4fv(location, count, transpose, value);
 }
 
@@ -2832,6 +5413,7 @@ void glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, cons
 }
 
 void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix3fv(location, count, transpose, value);
 }
 
@@ -2840,6 +5422,7 @@ void glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, co
 }
 
 void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix3x2fv(location, count, transpose, value);
 }
 
@@ -2848,6 +5431,7 @@ void glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, co
 }
 
 void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix3x4fv(location, count, transpose, value);
 }
 
@@ -2856,6 +5440,7 @@ void glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, cons
 }
 
 void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix4fv(location, count, transpose, value);
 }
 
@@ -2864,6 +5449,7 @@ void glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, co
 }
 
 void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix4x2fv(location, count, transpose, value);
 }
 
@@ -2872,6 +5458,7 @@ void glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, co
 }
 
 void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    draw_batch_flush();
     gles.core.glUniformMatrix4x3fv(location, count, transpose, value);
 }
 
@@ -2880,57 +5467,68 @@ void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *ind
 }
 
 GLboolean glUnmapBuffer(GLenum target) {
+    draw_batch_flush();
+    GLuint buffer = state_buffer_get_binding(target);
+    if (persistent_map_end(buffer, GL_TRUE)) return GL_TRUE;
+    target = buffer_sync_target(target);
+    buffer_mirror_unmap(buffer);
+    state_buffer_clear_mapping(buffer);
     return gles.core.glUnmapBuffer(target);
 }
 
 GLboolean glUnmapNamedBuffer(GLuint buffer) {
-    const GLenum target = GL_ARRAY_BUFFER;
+    draw_batch_flush();
+    if (persistent_map_end(buffer, GL_TRUE)) return GL_TRUE;
+    const GLenum target = buffer_bind_scratch(buffer);
     GLboolean result;
 
-    GLint old_buffer;
-    gles.core.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &old_buffer);
-    gles.core.glBindBuffer(target, buffer);
+    buffer_mirror_unmap(buffer);
+    state_buffer_clear_mapping(buffer);
     result = gles.core.glUnmapBuffer(target);
-    gles.core.glBindBuffer(target, old_buffer);
 
     return result;
 }
 
 void glUseProgram(GLuint program) {
+    FILTER_UNCHANGED(state_program_use(program), STATS_FILTERED_USE_PROGRAM);
+    draw_batch_flush();
     gles.core.glUseProgram(program);
 }
 
 void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    draw_batch_flush();
     gles.core.glUseProgramStages(pipeline, stages, program);
 }
 
 void glValidateProgram(GLuint program) {
+    draw_batch_flush();
     gles.core.glValidateProgram(program);
 }
 
 void glValidateProgramPipeline(GLuint pipeline) {
+    draw_batch_flush();
     gles.core.glValidateProgramPipeline(pipeline);
 }
 
 void glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
-    GLint old_vao;
-    gles.core.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &old_vao);
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
     gles.core.glBindVertexArray(vaobj);
     gles.core.glVertexAttribBinding(attribindex, bindingindex);
     gles.core.glBindVertexArray(old_vao);
 }
 
 void glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
-    GLint old_vao;
-    gles.core.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &old_vao);
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
     gles.core.glBindVertexArray(vaobj);
     gles.core.glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
     gles.core.glBindVertexArray(old_vao);
 }
 
 void glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
-    GLint old_vao;
-    gles.core.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &old_vao);
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
     gles.core.glBindVertexArray(vaobj);
     gles.core.glVertexAttribIFormat(attribindex, size, type, relativeoffset);
     gles.core.glBindVertexArray(old_vao);
@@ -2941,21 +5539,30 @@ void glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GL
 }
 
 void glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
-    UNIMPLEMENTED();
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
+    gles.core.glBindVertexArray(vaobj);
+    vertex_array_apply_base_instance(vaobj, 0);
+    gles.core.glVertexBindingDivisor(bindingindex, divisor);
+    gles.core.glBindVertexArray(old_vao);
+    state_vertex_array_set_divisor(vaobj, bindingindex, divisor);
 }
 
 void glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
-    GLint old_vao;
-    gles.core.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &old_vao);
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
     gles.core.glBindVertexArray(vaobj);
     gles.core.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
     gles.core.glBindVertexArray(old_vao);
+    state_vertex_array_set_element_buffer(vaobj, buffer);
 }
 
 void glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
-    GLint old_vao;
-    gles.core.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &old_vao);
+    draw_batch_flush();
+    GLuint old_vao = state_vertex_array_get_binding();
     gles.core.glBindVertexArray(vaobj);
+    vertex_array_apply_base_instance(vaobj, 0);
+    state_vertex_array_set_buffer(vaobj, bindingindex, buffer, offset, stride);
     gles.core.glBindVertexBuffer(bindingindex, buffer, offset, stride);
     gles.core.glBindVertexArray(old_vao);
 }
@@ -2973,10 +5580,12 @@ void glVertexAttrib1dv(GLuint index, const GLdouble *v) {
 }
 
 void glVertexAttrib1f(GLuint index, GLfloat x) {
+    draw_batch_flush();
     gles.core.glVertexAttrib1f(index, x);
 }
 
 void glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    draw_batch_flush();
     gles.core.glVertexAttrib1fv(index, v);
 }
 
@@ -2997,10 +5606,12 @@ void glVertexAttrib2dv(GLuint index, const GLdouble *v) {
 }
 
 void glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    draw_batch_flush();
     gles.core.glVertexAttrib2f(index, x, y);
 }
 
 void glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    draw_batch_flush();
     gles.core.glVertexAttrib2fv(index, v);
 }
 
@@ -3021,10 +5632,12 @@ void glVertexAttrib3dv(GLuint index, const GLdouble *v) {
 }
 
 void glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    draw_batch_flush();
     gles.core.glVertexAttrib3f(index, x, y, z);
 }
 
 void glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    draw_batch_flush();
     gles.core.glVertexAttrib3fv(index, v);
 }
 
@@ -3077,10 +5690,12 @@ void glVertexAttrib4dv(GLuint index, const GLdouble *v) {
 }
 
 void glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    draw_batch_flush();
     gles.core.glVertexAttrib4f(index, x, y, z, w);
 }
 
 void glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    draw_batch_flush();
     gles.core.glVertexAttrib4fv(index, v);
 }
 
@@ -3109,14 +5724,19 @@ void glVertexAttrib4usv(GLuint index, const GLushort *v) {
 }
 
 void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    draw_batch_flush();
     gles.core.glVertexAttribBinding(attribindex, bindingindex);
 }
 
 void glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glVertexAttribDivisor(index, divisor);
+    state_vertex_array_set_divisor(state_vertex_array_get_binding(), index, divisor);
 }
 
 void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    draw_batch_flush();
     gles.core.glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -3173,10 +5793,12 @@ void glVertexAttribI4bv(GLuint index, const GLbyte *v) {
 }
 
 void glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    draw_batch_flush();
     gles.core.glVertexAttribI4i(index, x, y, z, w);
 }
 
 void glVertexAttribI4iv(GLuint index, const GLint *v) {
+    draw_batch_flush();
     gles.core.glVertexAttribI4iv(index, v);
 }
 
@@ -3189,10 +5811,12 @@ void glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
 }
 
 void glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    draw_batch_flush();
     gles.core.glVertexAttribI4ui(index, x, y, z, w);
 }
 
 void glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    draw_batch_flush();
     gles.core.glVertexAttribI4uiv(index, v);
 }
 
@@ -3201,10 +5825,15 @@ void glVertexAttribI4usv(GLuint index, const GLushort *v) {
 }
 
 void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    draw_batch_flush();
     gles.core.glVertexAttribIFormat(attribindex, size, type, relativeoffset);
 }
 
 void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
+    state_vertex_array_set_buffer(state_vertex_array_get_binding(), index, state_buffer_get_binding(GL_ARRAY_BUFFER),
+                                  (GLintptr)pointer, stride ? stride : vertex_attrib_size(size, type));
     gles.core.glVertexAttribIPointer(index, size, type, stride, pointer);
 }
 
@@ -3281,11 +5910,18 @@ void glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const
 }
 
 void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
+    state_vertex_array_set_buffer(state_vertex_array_get_binding(), index, state_buffer_get_binding(GL_ARRAY_BUFFER),
+                                  (GLintptr)pointer, stride ? stride : vertex_attrib_size(size, type));
     gles.core.glVertexAttribPointer(index, size, type, normalized, stride, pointer);
 }
 
 void glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    draw_batch_flush();
+    vertex_array_restore_base_instance();
     gles.core.glVertexBindingDivisor(bindingindex, divisor);
+    state_vertex_array_set_divisor(state_vertex_array_get_binding(), bindingindex, divisor);
 }
 
 void glVertexP2ui(GLenum type, GLuint value) {
@@ -3313,6 +5949,8 @@ void glVertexP4uiv(GLenum type, const GLuint *value) {
 }
 
 void glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    FILTER_UNCHANGED(state_render_viewport(x, y, width, height), STATS_FILTERED_VIEWPORT);
+    draw_batch_flush();
     gles.core.glViewport(x, y, width, height);
 }
 
@@ -3329,6 +5967,7 @@ void glViewportIndexedfv(GLuint index, const GLfloat *v) {
 }
 
 void glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    draw_batch_flush();
     gles.core.glWaitSync(sync, flags, timeout);
 }
 
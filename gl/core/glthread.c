@@ -0,0 +1,220 @@
+#include "glthread.h"
+#include "config.h"
+#include "stats.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GLTHREAD_RING_SIZE (8u << 20)
+#define GLTHREAD_SPIN_COUNT 4096
+#define GLTHREAD_UNKNOWN_BUFFER ((GLuint)-1)
+
+struct glthread_command {
+    glthread_exec_fn exec; // NULL pads the ring up to its end
+    size_t size;           // Including this header, a multiple of 16
+};
+
+// One per application thread that made a context current. Single producer
+// (the application thread), single consumer (the GL thread).
+struct glthread {
+    unsigned char* ring;
+    _Atomic size_t head;       // Bytes published by the application thread
+    _Atomic size_t tail;       // Bytes run by the GL thread
+    size_t pending;            // Size of the command being recorded
+    _Atomic int worker_idle;
+    _Atomic int app_waiting;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    pthread_t thread;
+    GLuint pack_buffer;        // Driver bindings as recorded, GLTHREAD_UNKNOWN_BUFFER after a context switch
+    GLuint unpack_buffer;
+};
+
+struct gles_t gles_driver;
+__thread struct glthread* t_glthread __attribute__((tls_model("initial-exec"))) = NULL;
+
+static void* glthread_main(void* arg) {
+    struct glthread* thread = arg;
+    size_t tail = 0;
+    for (;;) {
+        if (tail == atomic_load_explicit(&thread->head, memory_order_acquire)) {
+            pthread_mutex_lock(&thread->lock);
+            atomic_store(&thread->worker_idle, 1);
+            while (tail == atomic_load(&thread->head)) pthread_cond_wait(&thread->work, &thread->lock);
+            atomic_store(&thread->worker_idle, 0);
+            pthread_mutex_unlock(&thread->lock);
+            continue;
+        }
+        struct glthread_command* command = (struct glthread_command*)(thread->ring + tail % GLTHREAD_RING_SIZE);
+        if (command->exec) command->exec(command + 1);
+        tail += command->size;
+        atomic_store(&thread->tail, tail);
+        if (atomic_load(&thread->app_waiting)) {
+            pthread_mutex_lock(&thread->lock);
+            pthread_cond_broadcast(&thread->done);
+            pthread_mutex_unlock(&thread->lock);
+        }
+    }
+    return NULL;
+}
+
+static struct glthread* glthread_create(void) {
+    struct glthread* thread = calloc(1, sizeof(*thread));
+    if (!thread) return NULL;
+    thread->ring = malloc(GLTHREAD_RING_SIZE);
+    pthread_mutex_init(&thread->lock, NULL);
+    pthread_cond_init(&thread->work, NULL);
+    pthread_cond_init(&thread->done, NULL);
+    if (!thread->ring || pthread_create(&thread->thread, NULL, glthread_main, thread) != 0) {
+        free(thread->ring);
+        free(thread);
+        return NULL;
+    }
+    pthread_detach(thread->thread);
+    return thread;
+}
+
+static void glthread_publish(struct glthread* thread, size_t head) {
+    atomic_store(&thread->head, head);
+    if (atomic_load(&thread->worker_idle)) {
+        pthread_mutex_lock(&thread->lock);
+        pthread_cond_signal(&thread->work);
+        pthread_mutex_unlock(&thread->lock);
+    }
+}
+
+// Waits until the GL thread has run every command before position.
+static void glthread_wait(struct glthread* thread, size_t position) {
+    for (int i = 0; i < GLTHREAD_SPIN_COUNT; ++i) {
+        if (atomic_load_explicit(&thread->tail, memory_order_acquire) >= position) return;
+    }
+    atomic_store(&thread->app_waiting, 1);
+    pthread_mutex_lock(&thread->lock);
+    while (atomic_load(&thread->tail) < position) pthread_cond_wait(&thread->done, &thread->lock);
+    pthread_mutex_unlock(&thread->lock);
+    atomic_store(&thread->app_waiting, 0);
+}
+
+void* glthread_alloc(glthread_exec_fn exec, size_t size) {
+    struct glthread* thread = t_glthread;
+    size_t total = GLTHREAD_ALIGN(sizeof(struct glthread_command) + size);
+    size_t head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+    size_t offset = head % GLTHREAD_RING_SIZE;
+    if (offset + total > GLTHREAD_RING_SIZE) {
+        // Commands are contiguous, skip the end of the ring.
+        size_t padding = GLTHREAD_RING_SIZE - offset;
+        glthread_wait(thread, head + padding + total - GLTHREAD_RING_SIZE);
+        struct glthread_command* pad = (struct glthread_command*)(thread->ring + offset);
+        pad->exec = NULL;
+        pad->size = padding;
+        head += padding;
+        glthread_publish(thread, head);
+        offset = 0;
+    } else if (head + total > GLTHREAD_RING_SIZE) {
+        glthread_wait(thread, head + total - GLTHREAD_RING_SIZE);
+    }
+    struct glthread_command* command = (struct glthread_command*)(thread->ring + offset);
+    command->exec = exec;
+    command->size = total;
+    thread->pending = total;
+    return command + 1;
+}
+
+void glthread_submit(void) {
+    struct glthread* thread = t_glthread;
+    glthread_publish(thread, atomic_load_explicit(&thread->head, memory_order_relaxed) + thread->pending);
+}
+
+void glthread_sync(void) {
+    struct glthread* thread = t_glthread;
+    size_t head = atomic_load_explicit(&thread->head, memory_order_relaxed) + thread->pending;
+    glthread_publish(thread, head);
+    glthread_wait(thread, head);
+    stats_inc(STATS_GLTHREAD_SYNCS);
+}
+
+// --- Pixel buffer tracking ---
+
+void glthread_track_bind_buffer(GLenum target, GLuint buffer) {
+    if (target == GL_PIXEL_PACK_BUFFER) t_glthread->pack_buffer = buffer;
+    else if (target == GL_PIXEL_UNPACK_BUFFER) t_glthread->unpack_buffer = buffer;
+}
+
+void glthread_track_delete_buffers(GLsizei n, const GLuint* buffers) {
+    struct glthread* thread = t_glthread;
+    for (GLsizei i = 0; i < n; ++i) {
+        if (buffers[i] == 0) continue;
+        if (buffers[i] == thread->pack_buffer) thread->pack_buffer = 0;
+        if (buffers[i] == thread->unpack_buffer) thread->unpack_buffer = 0;
+    }
+}
+
+int glthread_pixel_buffer_bound(GLenum target) {
+    GLuint buffer = target == GL_PIXEL_PACK_BUFFER ? t_glthread->pack_buffer : t_glthread->unpack_buffer;
+    if (buffer == GLTHREAD_UNKNOWN_BUFFER) return -1;
+    return buffer != 0;
+}
+
+// --- EGL ---
+
+struct glthread_make_current_args {
+    EGLDisplay display;
+    EGLSurface draw;
+    EGLSurface read;
+    EGLContext context;
+    EGLBoolean* result;
+};
+
+static void glthread_exec_make_current(const void* args) {
+    const struct glthread_make_current_args* cmd = args;
+    *cmd->result = egl.eglMakeCurrent(cmd->display, cmd->draw, cmd->read, cmd->context);
+}
+
+EGLBoolean glthread_make_current(EGLDisplay display, EGLSurface draw, EGLSurface read, EGLContext context) {
+    if (!g_config.glthread) return egl.eglMakeCurrent(display, draw, read, context);
+    if (!t_glthread) {
+        if (context == EGL_NO_CONTEXT) return egl.eglMakeCurrent(display, draw, read, context);
+        // Without a GL thread, this thread keeps calling the driver directly.
+        t_glthread = glthread_create();
+        if (!t_glthread) return egl.eglMakeCurrent(display, draw, read, context);
+    }
+
+    EGLBoolean result = EGL_FALSE;
+    struct glthread_make_current_args* cmd = glthread_alloc(glthread_exec_make_current, sizeof(*cmd));
+    cmd->display = display;
+    cmd->draw = draw;
+    cmd->read = read;
+    cmd->context = context;
+    cmd->result = &result;
+    glthread_sync();
+    t_glthread->pack_buffer = GLTHREAD_UNKNOWN_BUFFER;
+    t_glthread->unpack_buffer = GLTHREAD_UNKNOWN_BUFFER;
+    return result;
+}
+
+struct glthread_swap_buffers_args {
+    EGLDisplay display;
+    EGLSurface surface;
+};
+
+static void glthread_exec_swap_buffers(const void* args) {
+    const struct glthread_swap_buffers_args* cmd = args;
+    egl.eglSwapBuffers(cmd->display, cmd->surface);
+}
+
+EGLBoolean glthread_swap_buffers(EGLDisplay display, EGLSurface surface) {
+    if (!t_glthread) return egl.eglSwapBuffers(display, surface);
+    struct glthread_swap_buffers_args* cmd = glthread_alloc(glthread_exec_swap_buffers, sizeof(*cmd));
+    cmd->display = display;
+    cmd->surface = surface;
+    glthread_submit();
+    return EGL_TRUE;
+}
+
+void glthread_init(void) {
+    if (!g_config.glthread) return;
+    gles_driver = gles;
+    glthread_install_marshallers();
+}
@@ -0,0 +1,65 @@
+#ifndef GLTHREAD_H
+#define GLTHREAD_H
+
+#include "gles.h"
+#include <stddef.h>
+#include <string.h>
+
+// Threaded dispatch (LIBGL_GLTHREAD). The gles tables are replaced with
+// marshallers that record driver calls into a per-thread command ring, and a
+// layer-owned GL thread holding the EGL context replays them against the
+// driver. Calls that return values or read client memory of unknown size
+// wait for the GL thread to catch up.
+
+#define GLTHREAD_ALIGN(size) (((size) + 15) & ~(size_t)15)
+// Larger client arrays are read in place by a synchronous call instead.
+#define GLTHREAD_MAX_COPY (1u << 20)
+
+struct glthread;
+
+typedef void (*glthread_exec_fn)(const void* args);
+
+// The driver's own tables, called by the GL thread.
+extern struct gles_t gles_driver;
+
+extern __thread struct glthread* t_glthread __attribute__((tls_model("initial-exec")));
+
+// Installs the marshallers when LIBGL_GLTHREAD is set. Call once the gles
+// tables are loaded.
+void glthread_init(void);
+
+// EGL calls that must run where the context is current.
+EGLBoolean glthread_make_current(EGLDisplay display, EGLSurface draw, EGLSurface read, EGLContext context);
+EGLBoolean glthread_swap_buffers(EGLDisplay display, EGLSurface surface);
+
+// Recording, for the generated marshallers. Calls from threads without a GL
+// thread go straight to the driver.
+static inline int glthread_active(void) {
+    return t_glthread != NULL;
+}
+
+// Reserves a command of size bytes of arguments, run by exec on the GL thread.
+void* glthread_alloc(glthread_exec_fn exec, size_t size);
+// Publishes the reserved command.
+void glthread_submit(void);
+// Publishes the reserved command and waits until it has run.
+void glthread_sync(void);
+
+// Copies size bytes of src to *tail and advances it, NULL stays NULL.
+static inline void* glthread_copy(char** tail, const void* src, size_t size) {
+    if (!src) return NULL;
+    void* dst = *tail;
+    memcpy(dst, src, size);
+    *tail += GLTHREAD_ALIGN(size);
+    return dst;
+}
+
+// Pixel buffer bindings decide whether pixel pointers are offsets. Returns 1
+// when a buffer is bound to target, 0 when none is and -1 when unknown.
+void glthread_track_bind_buffer(GLenum target, GLuint buffer);
+void glthread_track_delete_buffers(GLsizei n, const GLuint* buffers);
+int glthread_pixel_buffer_bound(GLenum target);
+
+void glthread_install_marshallers(void);
+
+#endif // GLTHREAD_H
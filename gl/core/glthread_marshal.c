@@ -0,0 +1,22915 @@
+/*
+ * Threaded dispatch marshallers for the GLES tables
+ * Generated by scripts/glthread.py
+ * DO NOT EDIT THIS FILE DIRECTLY.
+ */
+
+#include "glthread.h"
+#include <string.h>
+
+struct marshal_glActiveShaderProgram {
+    GLuint pipeline;
+    GLuint program;
+};
+
+static void exec_glActiveShaderProgram(const void* args) {
+    const struct marshal_glActiveShaderProgram* cmd = args;
+    gles_driver.core.glActiveShaderProgram(cmd->pipeline, cmd->program);
+}
+
+static void GL_APIENTRY marshal_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.core.glActiveShaderProgram(pipeline, program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glActiveShaderProgram* cmd = glthread_alloc(exec_glActiveShaderProgram, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glActiveTexture {
+    GLenum texture;
+};
+
+static void exec_glActiveTexture(const void* args) {
+    const struct marshal_glActiveTexture* cmd = args;
+    gles_driver.core.glActiveTexture(cmd->texture);
+}
+
+static void GL_APIENTRY marshal_glActiveTexture(GLenum texture) {
+    if (!glthread_active()) {
+        gles_driver.core.glActiveTexture(texture);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glActiveTexture* cmd = glthread_alloc(exec_glActiveTexture, sizeof(*cmd));
+    cmd->texture = texture;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glAttachShader {
+    GLuint program;
+    GLuint shader;
+};
+
+static void exec_glAttachShader(const void* args) {
+    const struct marshal_glAttachShader* cmd = args;
+    gles_driver.core.glAttachShader(cmd->program, cmd->shader);
+}
+
+static void GL_APIENTRY marshal_glAttachShader(GLuint program, GLuint shader) {
+    if (!glthread_active()) {
+        gles_driver.core.glAttachShader(program, shader);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glAttachShader* cmd = glthread_alloc(exec_glAttachShader, sizeof(*cmd));
+    cmd->program = program;
+    cmd->shader = shader;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBeginQuery {
+    GLenum target;
+    GLuint id;
+};
+
+static void exec_glBeginQuery(const void* args) {
+    const struct marshal_glBeginQuery* cmd = args;
+    gles_driver.core.glBeginQuery(cmd->target, cmd->id);
+}
+
+static void GL_APIENTRY marshal_glBeginQuery(GLenum target, GLuint id) {
+    if (!glthread_active()) {
+        gles_driver.core.glBeginQuery(target, id);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBeginQuery* cmd = glthread_alloc(exec_glBeginQuery, sizeof(*cmd));
+    cmd->target = target;
+    cmd->id = id;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBeginTransformFeedback {
+    GLenum primitiveMode;
+};
+
+static void exec_glBeginTransformFeedback(const void* args) {
+    const struct marshal_glBeginTransformFeedback* cmd = args;
+    gles_driver.core.glBeginTransformFeedback(cmd->primitiveMode);
+}
+
+static void GL_APIENTRY marshal_glBeginTransformFeedback(GLenum primitiveMode) {
+    if (!glthread_active()) {
+        gles_driver.core.glBeginTransformFeedback(primitiveMode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBeginTransformFeedback* cmd = glthread_alloc(exec_glBeginTransformFeedback, sizeof(*cmd));
+    cmd->primitiveMode = primitiveMode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindAttribLocation {
+    GLuint program;
+    GLuint index;
+    const GLchar *name;
+};
+
+static void exec_glBindAttribLocation(const void* args) {
+    const struct marshal_glBindAttribLocation* cmd = args;
+    gles_driver.core.glBindAttribLocation(cmd->program, cmd->index, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindAttribLocation(program, index, name);
+        return;
+    }
+    struct marshal_glBindAttribLocation* cmd = glthread_alloc(exec_glBindAttribLocation, sizeof(*cmd));
+    cmd->program = program;
+    cmd->index = index;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glBindBuffer {
+    GLenum target;
+    GLuint buffer;
+};
+
+static void exec_glBindBuffer(const void* args) {
+    const struct marshal_glBindBuffer* cmd = args;
+    gles_driver.core.glBindBuffer(cmd->target, cmd->buffer);
+}
+
+static void GL_APIENTRY marshal_glBindBuffer(GLenum target, GLuint buffer) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindBuffer(target, buffer);
+        return;
+    }
+    glthread_track_bind_buffer(target, buffer);
+    int glt_sync = 0;
+    struct marshal_glBindBuffer* cmd = glthread_alloc(exec_glBindBuffer, sizeof(*cmd));
+    cmd->target = target;
+    cmd->buffer = buffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindBufferBase {
+    GLenum target;
+    GLuint index;
+    GLuint buffer;
+};
+
+static void exec_glBindBufferBase(const void* args) {
+    const struct marshal_glBindBufferBase* cmd = args;
+    gles_driver.core.glBindBufferBase(cmd->target, cmd->index, cmd->buffer);
+}
+
+static void GL_APIENTRY marshal_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindBufferBase(target, index, buffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindBufferBase* cmd = glthread_alloc(exec_glBindBufferBase, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->buffer = buffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindBufferRange {
+    GLenum target;
+    GLuint index;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+static void exec_glBindBufferRange(const void* args) {
+    const struct marshal_glBindBufferRange* cmd = args;
+    gles_driver.core.glBindBufferRange(cmd->target, cmd->index, cmd->buffer, cmd->offset, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindBufferRange(target, index, buffer, offset, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindBufferRange* cmd = glthread_alloc(exec_glBindBufferRange, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindFramebuffer {
+    GLenum target;
+    GLuint framebuffer;
+};
+
+static void exec_glBindFramebuffer(const void* args) {
+    const struct marshal_glBindFramebuffer* cmd = args;
+    gles_driver.core.glBindFramebuffer(cmd->target, cmd->framebuffer);
+}
+
+static void GL_APIENTRY marshal_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindFramebuffer(target, framebuffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindFramebuffer* cmd = glthread_alloc(exec_glBindFramebuffer, sizeof(*cmd));
+    cmd->target = target;
+    cmd->framebuffer = framebuffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindImageTexture {
+    GLuint unit;
+    GLuint texture;
+    GLint level;
+    GLboolean layered;
+    GLint layer;
+    GLenum access;
+    GLenum format;
+};
+
+static void exec_glBindImageTexture(const void* args) {
+    const struct marshal_glBindImageTexture* cmd = args;
+    gles_driver.core.glBindImageTexture(cmd->unit, cmd->texture, cmd->level, cmd->layered, cmd->layer, cmd->access, cmd->format);
+}
+
+static void GL_APIENTRY marshal_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindImageTexture(unit, texture, level, layered, layer, access, format);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindImageTexture* cmd = glthread_alloc(exec_glBindImageTexture, sizeof(*cmd));
+    cmd->unit = unit;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->layered = layered;
+    cmd->layer = layer;
+    cmd->access = access;
+    cmd->format = format;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindProgramPipeline {
+    GLuint pipeline;
+};
+
+static void exec_glBindProgramPipeline(const void* args) {
+    const struct marshal_glBindProgramPipeline* cmd = args;
+    gles_driver.core.glBindProgramPipeline(cmd->pipeline);
+}
+
+static void GL_APIENTRY marshal_glBindProgramPipeline(GLuint pipeline) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindProgramPipeline(pipeline);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindProgramPipeline* cmd = glthread_alloc(exec_glBindProgramPipeline, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindRenderbuffer {
+    GLenum target;
+    GLuint renderbuffer;
+};
+
+static void exec_glBindRenderbuffer(const void* args) {
+    const struct marshal_glBindRenderbuffer* cmd = args;
+    gles_driver.core.glBindRenderbuffer(cmd->target, cmd->renderbuffer);
+}
+
+static void GL_APIENTRY marshal_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindRenderbuffer(target, renderbuffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindRenderbuffer* cmd = glthread_alloc(exec_glBindRenderbuffer, sizeof(*cmd));
+    cmd->target = target;
+    cmd->renderbuffer = renderbuffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindSampler {
+    GLuint unit;
+    GLuint sampler;
+};
+
+static void exec_glBindSampler(const void* args) {
+    const struct marshal_glBindSampler* cmd = args;
+    gles_driver.core.glBindSampler(cmd->unit, cmd->sampler);
+}
+
+static void GL_APIENTRY marshal_glBindSampler(GLuint unit, GLuint sampler) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindSampler(unit, sampler);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindSampler* cmd = glthread_alloc(exec_glBindSampler, sizeof(*cmd));
+    cmd->unit = unit;
+    cmd->sampler = sampler;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindTexture {
+    GLenum target;
+    GLuint texture;
+};
+
+static void exec_glBindTexture(const void* args) {
+    const struct marshal_glBindTexture* cmd = args;
+    gles_driver.core.glBindTexture(cmd->target, cmd->texture);
+}
+
+static void GL_APIENTRY marshal_glBindTexture(GLenum target, GLuint texture) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindTexture(target, texture);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindTexture* cmd = glthread_alloc(exec_glBindTexture, sizeof(*cmd));
+    cmd->target = target;
+    cmd->texture = texture;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindTransformFeedback {
+    GLenum target;
+    GLuint id;
+};
+
+static void exec_glBindTransformFeedback(const void* args) {
+    const struct marshal_glBindTransformFeedback* cmd = args;
+    gles_driver.core.glBindTransformFeedback(cmd->target, cmd->id);
+}
+
+static void GL_APIENTRY marshal_glBindTransformFeedback(GLenum target, GLuint id) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindTransformFeedback(target, id);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindTransformFeedback* cmd = glthread_alloc(exec_glBindTransformFeedback, sizeof(*cmd));
+    cmd->target = target;
+    cmd->id = id;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindVertexArray {
+    GLuint array;
+};
+
+static void exec_glBindVertexArray(const void* args) {
+    const struct marshal_glBindVertexArray* cmd = args;
+    gles_driver.core.glBindVertexArray(cmd->array);
+}
+
+static void GL_APIENTRY marshal_glBindVertexArray(GLuint array) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindVertexArray(array);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindVertexArray* cmd = glthread_alloc(exec_glBindVertexArray, sizeof(*cmd));
+    cmd->array = array;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindVertexBuffer {
+    GLuint bindingindex;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizei stride;
+};
+
+static void exec_glBindVertexBuffer(const void* args) {
+    const struct marshal_glBindVertexBuffer* cmd = args;
+    gles_driver.core.glBindVertexBuffer(cmd->bindingindex, cmd->buffer, cmd->offset, cmd->stride);
+}
+
+static void GL_APIENTRY marshal_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    if (!glthread_active()) {
+        gles_driver.core.glBindVertexBuffer(bindingindex, buffer, offset, stride);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindVertexBuffer* cmd = glthread_alloc(exec_glBindVertexBuffer, sizeof(*cmd));
+    cmd->bindingindex = bindingindex;
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->stride = stride;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendBarrier {
+    char unused;
+};
+
+static void exec_glBlendBarrier(const void* args) {
+    (void)args;
+    gles_driver.core.glBlendBarrier();
+}
+
+static void GL_APIENTRY marshal_glBlendBarrier(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendBarrier();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendBarrier* cmd = glthread_alloc(exec_glBlendBarrier, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendColor {
+    GLfloat red;
+    GLfloat green;
+    GLfloat blue;
+    GLfloat alpha;
+};
+
+static void exec_glBlendColor(const void* args) {
+    const struct marshal_glBlendColor* cmd = args;
+    gles_driver.core.glBlendColor(cmd->red, cmd->green, cmd->blue, cmd->alpha);
+}
+
+static void GL_APIENTRY marshal_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendColor(red, green, blue, alpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendColor* cmd = glthread_alloc(exec_glBlendColor, sizeof(*cmd));
+    cmd->red = red;
+    cmd->green = green;
+    cmd->blue = blue;
+    cmd->alpha = alpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquation {
+    GLenum mode;
+};
+
+static void exec_glBlendEquation(const void* args) {
+    const struct marshal_glBlendEquation* cmd = args;
+    gles_driver.core.glBlendEquation(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glBlendEquation(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendEquation(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquation* cmd = glthread_alloc(exec_glBlendEquation, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationSeparate {
+    GLenum modeRGB;
+    GLenum modeAlpha;
+};
+
+static void exec_glBlendEquationSeparate(const void* args) {
+    const struct marshal_glBlendEquationSeparate* cmd = args;
+    gles_driver.core.glBlendEquationSeparate(cmd->modeRGB, cmd->modeAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendEquationSeparate(modeRGB, modeAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationSeparate* cmd = glthread_alloc(exec_glBlendEquationSeparate, sizeof(*cmd));
+    cmd->modeRGB = modeRGB;
+    cmd->modeAlpha = modeAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationSeparatei {
+    GLuint buf;
+    GLenum modeRGB;
+    GLenum modeAlpha;
+};
+
+static void exec_glBlendEquationSeparatei(const void* args) {
+    const struct marshal_glBlendEquationSeparatei* cmd = args;
+    gles_driver.core.glBlendEquationSeparatei(cmd->buf, cmd->modeRGB, cmd->modeAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationSeparatei* cmd = glthread_alloc(exec_glBlendEquationSeparatei, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->modeRGB = modeRGB;
+    cmd->modeAlpha = modeAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationi {
+    GLuint buf;
+    GLenum mode;
+};
+
+static void exec_glBlendEquationi(const void* args) {
+    const struct marshal_glBlendEquationi* cmd = args;
+    gles_driver.core.glBlendEquationi(cmd->buf, cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationi(GLuint buf, GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendEquationi(buf, mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationi* cmd = glthread_alloc(exec_glBlendEquationi, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFunc {
+    GLenum sfactor;
+    GLenum dfactor;
+};
+
+static void exec_glBlendFunc(const void* args) {
+    const struct marshal_glBlendFunc* cmd = args;
+    gles_driver.core.glBlendFunc(cmd->sfactor, cmd->dfactor);
+}
+
+static void GL_APIENTRY marshal_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendFunc(sfactor, dfactor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFunc* cmd = glthread_alloc(exec_glBlendFunc, sizeof(*cmd));
+    cmd->sfactor = sfactor;
+    cmd->dfactor = dfactor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFuncSeparate {
+    GLenum sfactorRGB;
+    GLenum dfactorRGB;
+    GLenum sfactorAlpha;
+    GLenum dfactorAlpha;
+};
+
+static void exec_glBlendFuncSeparate(const void* args) {
+    const struct marshal_glBlendFuncSeparate* cmd = args;
+    gles_driver.core.glBlendFuncSeparate(cmd->sfactorRGB, cmd->dfactorRGB, cmd->sfactorAlpha, cmd->dfactorAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFuncSeparate* cmd = glthread_alloc(exec_glBlendFuncSeparate, sizeof(*cmd));
+    cmd->sfactorRGB = sfactorRGB;
+    cmd->dfactorRGB = dfactorRGB;
+    cmd->sfactorAlpha = sfactorAlpha;
+    cmd->dfactorAlpha = dfactorAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFuncSeparatei {
+    GLuint buf;
+    GLenum srcRGB;
+    GLenum dstRGB;
+    GLenum srcAlpha;
+    GLenum dstAlpha;
+};
+
+static void exec_glBlendFuncSeparatei(const void* args) {
+    const struct marshal_glBlendFuncSeparatei* cmd = args;
+    gles_driver.core.glBlendFuncSeparatei(cmd->buf, cmd->srcRGB, cmd->dstRGB, cmd->srcAlpha, cmd->dstAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFuncSeparatei* cmd = glthread_alloc(exec_glBlendFuncSeparatei, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->srcRGB = srcRGB;
+    cmd->dstRGB = dstRGB;
+    cmd->srcAlpha = srcAlpha;
+    cmd->dstAlpha = dstAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFunci {
+    GLuint buf;
+    GLenum src;
+    GLenum dst;
+};
+
+static void exec_glBlendFunci(const void* args) {
+    const struct marshal_glBlendFunci* cmd = args;
+    gles_driver.core.glBlendFunci(cmd->buf, cmd->src, cmd->dst);
+}
+
+static void GL_APIENTRY marshal_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlendFunci(buf, src, dst);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFunci* cmd = glthread_alloc(exec_glBlendFunci, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->src = src;
+    cmd->dst = dst;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlitFramebuffer {
+    GLint srcX0;
+    GLint srcY0;
+    GLint srcX1;
+    GLint srcY1;
+    GLint dstX0;
+    GLint dstY0;
+    GLint dstX1;
+    GLint dstY1;
+    GLbitfield mask;
+    GLenum filter;
+};
+
+static void exec_glBlitFramebuffer(const void* args) {
+    const struct marshal_glBlitFramebuffer* cmd = args;
+    gles_driver.core.glBlitFramebuffer(cmd->srcX0, cmd->srcY0, cmd->srcX1, cmd->srcY1, cmd->dstX0, cmd->dstY0, cmd->dstX1, cmd->dstY1, cmd->mask, cmd->filter);
+}
+
+static void GL_APIENTRY marshal_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (!glthread_active()) {
+        gles_driver.core.glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlitFramebuffer* cmd = glthread_alloc(exec_glBlitFramebuffer, sizeof(*cmd));
+    cmd->srcX0 = srcX0;
+    cmd->srcY0 = srcY0;
+    cmd->srcX1 = srcX1;
+    cmd->srcY1 = srcY1;
+    cmd->dstX0 = dstX0;
+    cmd->dstY0 = dstY0;
+    cmd->dstX1 = dstX1;
+    cmd->dstY1 = dstY1;
+    cmd->mask = mask;
+    cmd->filter = filter;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBufferData {
+    GLenum target;
+    GLsizeiptr size;
+    const void *data;
+    GLenum usage;
+};
+
+static void exec_glBufferData(const void* args) {
+    const struct marshal_glBufferData* cmd = args;
+    gles_driver.core.glBufferData(cmd->target, cmd->size, cmd->data, cmd->usage);
+}
+
+static void GL_APIENTRY marshal_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    if (!glthread_active()) {
+        gles_driver.core.glBufferData(target, size, data, usage);
+        return;
+    }
+    int glt_sync = 0;
+    size_t data_size = data ? (size_t)(size) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glBufferData* cmd = glthread_alloc(exec_glBufferData, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->size = size;
+    cmd->data = glt_sync ? data : glthread_copy(&glt_tail, data, data_size);
+    cmd->usage = usage;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBufferSubData {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr size;
+    const void *data;
+};
+
+static void exec_glBufferSubData(const void* args) {
+    const struct marshal_glBufferSubData* cmd = args;
+    gles_driver.core.glBufferSubData(cmd->target, cmd->offset, cmd->size, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glBufferSubData(target, offset, size, data);
+        return;
+    }
+    int glt_sync = 0;
+    size_t data_size = data ? (size_t)(size) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glBufferSubData* cmd = glthread_alloc(exec_glBufferSubData, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->size = size;
+    cmd->data = glt_sync ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCheckFramebufferStatus {
+    GLenum target;
+    GLenum *result;
+};
+
+static void exec_glCheckFramebufferStatus(const void* args) {
+    const struct marshal_glCheckFramebufferStatus* cmd = args;
+    *cmd->result = gles_driver.core.glCheckFramebufferStatus(cmd->target);
+}
+
+static GLenum GL_APIENTRY marshal_glCheckFramebufferStatus(GLenum target) {
+    if (!glthread_active()) return gles_driver.core.glCheckFramebufferStatus(target);
+    struct marshal_glCheckFramebufferStatus* cmd = glthread_alloc(exec_glCheckFramebufferStatus, sizeof(*cmd));
+    cmd->target = target;
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glClear {
+    GLbitfield mask;
+};
+
+static void exec_glClear(const void* args) {
+    const struct marshal_glClear* cmd = args;
+    gles_driver.core.glClear(cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glClear(GLbitfield mask) {
+    if (!glthread_active()) {
+        gles_driver.core.glClear(mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glClear* cmd = glthread_alloc(exec_glClear, sizeof(*cmd));
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearBufferfi {
+    GLenum buffer;
+    GLint drawbuffer;
+    GLfloat depth;
+    GLint stencil;
+};
+
+static void exec_glClearBufferfi(const void* args) {
+    const struct marshal_glClearBufferfi* cmd = args;
+    gles_driver.core.glClearBufferfi(cmd->buffer, cmd->drawbuffer, cmd->depth, cmd->stencil);
+}
+
+static void GL_APIENTRY marshal_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearBufferfi(buffer, drawbuffer, depth, stencil);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glClearBufferfi* cmd = glthread_alloc(exec_glClearBufferfi, sizeof(*cmd));
+    cmd->buffer = buffer;
+    cmd->drawbuffer = drawbuffer;
+    cmd->depth = depth;
+    cmd->stencil = stencil;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearBufferfv {
+    GLenum buffer;
+    GLint drawbuffer;
+    const GLfloat *value;
+};
+
+static void exec_glClearBufferfv(const void* args) {
+    const struct marshal_glClearBufferfv* cmd = args;
+    gles_driver.core.glClearBufferfv(cmd->buffer, cmd->drawbuffer, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearBufferfv(buffer, drawbuffer, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glClearBufferfv* cmd = glthread_alloc(exec_glClearBufferfv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->buffer = buffer;
+    cmd->drawbuffer = drawbuffer;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearBufferiv {
+    GLenum buffer;
+    GLint drawbuffer;
+    const GLint *value;
+};
+
+static void exec_glClearBufferiv(const void* args) {
+    const struct marshal_glClearBufferiv* cmd = args;
+    gles_driver.core.glClearBufferiv(cmd->buffer, cmd->drawbuffer, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearBufferiv(buffer, drawbuffer, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glClearBufferiv* cmd = glthread_alloc(exec_glClearBufferiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->buffer = buffer;
+    cmd->drawbuffer = drawbuffer;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearBufferuiv {
+    GLenum buffer;
+    GLint drawbuffer;
+    const GLuint *value;
+};
+
+static void exec_glClearBufferuiv(const void* args) {
+    const struct marshal_glClearBufferuiv* cmd = args;
+    gles_driver.core.glClearBufferuiv(cmd->buffer, cmd->drawbuffer, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearBufferuiv(buffer, drawbuffer, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glClearBufferuiv* cmd = glthread_alloc(exec_glClearBufferuiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->buffer = buffer;
+    cmd->drawbuffer = drawbuffer;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearColor {
+    GLfloat red;
+    GLfloat green;
+    GLfloat blue;
+    GLfloat alpha;
+};
+
+static void exec_glClearColor(const void* args) {
+    const struct marshal_glClearColor* cmd = args;
+    gles_driver.core.glClearColor(cmd->red, cmd->green, cmd->blue, cmd->alpha);
+}
+
+static void GL_APIENTRY marshal_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearColor(red, green, blue, alpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glClearColor* cmd = glthread_alloc(exec_glClearColor, sizeof(*cmd));
+    cmd->red = red;
+    cmd->green = green;
+    cmd->blue = blue;
+    cmd->alpha = alpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearDepthf {
+    GLfloat d;
+};
+
+static void exec_glClearDepthf(const void* args) {
+    const struct marshal_glClearDepthf* cmd = args;
+    gles_driver.core.glClearDepthf(cmd->d);
+}
+
+static void GL_APIENTRY marshal_glClearDepthf(GLfloat d) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearDepthf(d);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glClearDepthf* cmd = glthread_alloc(exec_glClearDepthf, sizeof(*cmd));
+    cmd->d = d;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearStencil {
+    GLint s;
+};
+
+static void exec_glClearStencil(const void* args) {
+    const struct marshal_glClearStencil* cmd = args;
+    gles_driver.core.glClearStencil(cmd->s);
+}
+
+static void GL_APIENTRY marshal_glClearStencil(GLint s) {
+    if (!glthread_active()) {
+        gles_driver.core.glClearStencil(s);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glClearStencil* cmd = glthread_alloc(exec_glClearStencil, sizeof(*cmd));
+    cmd->s = s;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClientWaitSync {
+    GLsync sync;
+    GLbitfield flags;
+    GLuint64 timeout;
+    GLenum *result;
+};
+
+static void exec_glClientWaitSync(const void* args) {
+    const struct marshal_glClientWaitSync* cmd = args;
+    *cmd->result = gles_driver.core.glClientWaitSync(cmd->sync, cmd->flags, cmd->timeout);
+}
+
+static GLenum GL_APIENTRY marshal_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (!glthread_active()) return gles_driver.core.glClientWaitSync(sync, flags, timeout);
+    struct marshal_glClientWaitSync* cmd = glthread_alloc(exec_glClientWaitSync, sizeof(*cmd));
+    cmd->sync = sync;
+    cmd->flags = flags;
+    cmd->timeout = timeout;
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glColorMask {
+    GLboolean red;
+    GLboolean green;
+    GLboolean blue;
+    GLboolean alpha;
+};
+
+static void exec_glColorMask(const void* args) {
+    const struct marshal_glColorMask* cmd = args;
+    gles_driver.core.glColorMask(cmd->red, cmd->green, cmd->blue, cmd->alpha);
+}
+
+static void GL_APIENTRY marshal_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    if (!glthread_active()) {
+        gles_driver.core.glColorMask(red, green, blue, alpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glColorMask* cmd = glthread_alloc(exec_glColorMask, sizeof(*cmd));
+    cmd->red = red;
+    cmd->green = green;
+    cmd->blue = blue;
+    cmd->alpha = alpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glColorMaski {
+    GLuint index;
+    GLboolean r;
+    GLboolean g;
+    GLboolean b;
+    GLboolean a;
+};
+
+static void exec_glColorMaski(const void* args) {
+    const struct marshal_glColorMaski* cmd = args;
+    gles_driver.core.glColorMaski(cmd->index, cmd->r, cmd->g, cmd->b, cmd->a);
+}
+
+static void GL_APIENTRY marshal_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    if (!glthread_active()) {
+        gles_driver.core.glColorMaski(index, r, g, b, a);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glColorMaski* cmd = glthread_alloc(exec_glColorMaski, sizeof(*cmd));
+    cmd->index = index;
+    cmd->r = r;
+    cmd->g = g;
+    cmd->b = b;
+    cmd->a = a;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompileShader {
+    GLuint shader;
+};
+
+static void exec_glCompileShader(const void* args) {
+    const struct marshal_glCompileShader* cmd = args;
+    gles_driver.core.glCompileShader(cmd->shader);
+}
+
+static void GL_APIENTRY marshal_glCompileShader(GLuint shader) {
+    if (!glthread_active()) {
+        gles_driver.core.glCompileShader(shader);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCompileShader* cmd = glthread_alloc(exec_glCompileShader, sizeof(*cmd));
+    cmd->shader = shader;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompressedTexImage2D {
+    GLenum target;
+    GLint level;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLint border;
+    GLsizei imageSize;
+    const void *data;
+};
+
+static void exec_glCompressedTexImage2D(const void* args) {
+    const struct marshal_glCompressedTexImage2D* cmd = args;
+    gles_driver.core.glCompressedTexImage2D(cmd->target, cmd->level, cmd->internalformat, cmd->width, cmd->height, cmd->border, cmd->imageSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+        return;
+    }
+    int glt_sync = 0;
+    int data_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= data_bound < 0;
+    size_t data_size = data_bound || !data ? 0 : (size_t)(imageSize);
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glCompressedTexImage2D* cmd = glthread_alloc(exec_glCompressedTexImage2D, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->border = border;
+    cmd->imageSize = imageSize;
+    cmd->data = glt_sync || data_bound ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompressedTexImage3D {
+    GLenum target;
+    GLint level;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLint border;
+    GLsizei imageSize;
+    const void *data;
+};
+
+static void exec_glCompressedTexImage3D(const void* args) {
+    const struct marshal_glCompressedTexImage3D* cmd = args;
+    gles_driver.core.glCompressedTexImage3D(cmd->target, cmd->level, cmd->internalformat, cmd->width, cmd->height, cmd->depth, cmd->border, cmd->imageSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+        return;
+    }
+    int glt_sync = 0;
+    int data_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= data_bound < 0;
+    size_t data_size = data_bound || !data ? 0 : (size_t)(imageSize);
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glCompressedTexImage3D* cmd = glthread_alloc(exec_glCompressedTexImage3D, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->border = border;
+    cmd->imageSize = imageSize;
+    cmd->data = glt_sync || data_bound ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompressedTexSubImage2D {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    GLsizei imageSize;
+    const void *data;
+};
+
+static void exec_glCompressedTexSubImage2D(const void* args) {
+    const struct marshal_glCompressedTexSubImage2D* cmd = args;
+    gles_driver.core.glCompressedTexSubImage2D(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->width, cmd->height, cmd->format, cmd->imageSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+        return;
+    }
+    int glt_sync = 0;
+    int data_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= data_bound < 0;
+    size_t data_size = data_bound || !data ? 0 : (size_t)(imageSize);
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glCompressedTexSubImage2D* cmd = glthread_alloc(exec_glCompressedTexSubImage2D, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->format = format;
+    cmd->imageSize = imageSize;
+    cmd->data = glt_sync || data_bound ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompressedTexSubImage3D {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLenum format;
+    GLsizei imageSize;
+    const void *data;
+};
+
+static void exec_glCompressedTexSubImage3D(const void* args) {
+    const struct marshal_glCompressedTexSubImage3D* cmd = args;
+    gles_driver.core.glCompressedTexSubImage3D(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->format, cmd->imageSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+        return;
+    }
+    int glt_sync = 0;
+    int data_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= data_bound < 0;
+    size_t data_size = data_bound || !data ? 0 : (size_t)(imageSize);
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glCompressedTexSubImage3D* cmd = glthread_alloc(exec_glCompressedTexSubImage3D, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->format = format;
+    cmd->imageSize = imageSize;
+    cmd->data = glt_sync || data_bound ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyBufferSubData {
+    GLenum readTarget;
+    GLenum writeTarget;
+    GLintptr readOffset;
+    GLintptr writeOffset;
+    GLsizeiptr size;
+};
+
+static void exec_glCopyBufferSubData(const void* args) {
+    const struct marshal_glCopyBufferSubData* cmd = args;
+    gles_driver.core.glCopyBufferSubData(cmd->readTarget, cmd->writeTarget, cmd->readOffset, cmd->writeOffset, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if (!glthread_active()) {
+        gles_driver.core.glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyBufferSubData* cmd = glthread_alloc(exec_glCopyBufferSubData, sizeof(*cmd));
+    cmd->readTarget = readTarget;
+    cmd->writeTarget = writeTarget;
+    cmd->readOffset = readOffset;
+    cmd->writeOffset = writeOffset;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyImageSubData {
+    GLuint srcName;
+    GLenum srcTarget;
+    GLint srcLevel;
+    GLint srcX;
+    GLint srcY;
+    GLint srcZ;
+    GLuint dstName;
+    GLenum dstTarget;
+    GLint dstLevel;
+    GLint dstX;
+    GLint dstY;
+    GLint dstZ;
+    GLsizei srcWidth;
+    GLsizei srcHeight;
+    GLsizei srcDepth;
+};
+
+static void exec_glCopyImageSubData(const void* args) {
+    const struct marshal_glCopyImageSubData* cmd = args;
+    gles_driver.core.glCopyImageSubData(cmd->srcName, cmd->srcTarget, cmd->srcLevel, cmd->srcX, cmd->srcY, cmd->srcZ, cmd->dstName, cmd->dstTarget, cmd->dstLevel, cmd->dstX, cmd->dstY, cmd->dstZ, cmd->srcWidth, cmd->srcHeight, cmd->srcDepth);
+}
+
+static void GL_APIENTRY marshal_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    if (!glthread_active()) {
+        gles_driver.core.glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyImageSubData* cmd = glthread_alloc(exec_glCopyImageSubData, sizeof(*cmd));
+    cmd->srcName = srcName;
+    cmd->srcTarget = srcTarget;
+    cmd->srcLevel = srcLevel;
+    cmd->srcX = srcX;
+    cmd->srcY = srcY;
+    cmd->srcZ = srcZ;
+    cmd->dstName = dstName;
+    cmd->dstTarget = dstTarget;
+    cmd->dstLevel = dstLevel;
+    cmd->dstX = dstX;
+    cmd->dstY = dstY;
+    cmd->dstZ = dstZ;
+    cmd->srcWidth = srcWidth;
+    cmd->srcHeight = srcHeight;
+    cmd->srcDepth = srcDepth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyTexImage2D {
+    GLenum target;
+    GLint level;
+    GLenum internalformat;
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+    GLint border;
+};
+
+static void exec_glCopyTexImage2D(const void* args) {
+    const struct marshal_glCopyTexImage2D* cmd = args;
+    gles_driver.core.glCopyTexImage2D(cmd->target, cmd->level, cmd->internalformat, cmd->x, cmd->y, cmd->width, cmd->height, cmd->border);
+}
+
+static void GL_APIENTRY marshal_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    if (!glthread_active()) {
+        gles_driver.core.glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyTexImage2D* cmd = glthread_alloc(exec_glCopyTexImage2D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->border = border;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyTexSubImage2D {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glCopyTexSubImage2D(const void* args) {
+    const struct marshal_glCopyTexSubImage2D* cmd = args;
+    gles_driver.core.glCopyTexSubImage2D(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyTexSubImage2D* cmd = glthread_alloc(exec_glCopyTexSubImage2D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyTexSubImage3D {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glCopyTexSubImage3D(const void* args) {
+    const struct marshal_glCopyTexSubImage3D* cmd = args;
+    gles_driver.core.glCopyTexSubImage3D(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyTexSubImage3D* cmd = glthread_alloc(exec_glCopyTexSubImage3D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCreateProgram {
+    GLuint *result;
+};
+
+static void exec_glCreateProgram(const void* args) {
+    const struct marshal_glCreateProgram* cmd = args;
+    *cmd->result = gles_driver.core.glCreateProgram();
+}
+
+static GLuint GL_APIENTRY marshal_glCreateProgram(void) {
+    if (!glthread_active()) return gles_driver.core.glCreateProgram();
+    struct marshal_glCreateProgram* cmd = glthread_alloc(exec_glCreateProgram, sizeof(*cmd));
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glCreateShader {
+    GLenum type;
+    GLuint *result;
+};
+
+static void exec_glCreateShader(const void* args) {
+    const struct marshal_glCreateShader* cmd = args;
+    *cmd->result = gles_driver.core.glCreateShader(cmd->type);
+}
+
+static GLuint GL_APIENTRY marshal_glCreateShader(GLenum type) {
+    if (!glthread_active()) return gles_driver.core.glCreateShader(type);
+    struct marshal_glCreateShader* cmd = glthread_alloc(exec_glCreateShader, sizeof(*cmd));
+    cmd->type = type;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glCreateShaderProgramv {
+    GLenum type;
+    GLsizei count;
+    const GLchar *const*strings;
+    GLuint *result;
+};
+
+static void exec_glCreateShaderProgramv(const void* args) {
+    const struct marshal_glCreateShaderProgramv* cmd = args;
+    *cmd->result = gles_driver.core.glCreateShaderProgramv(cmd->type, cmd->count, cmd->strings);
+}
+
+static GLuint GL_APIENTRY marshal_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    if (!glthread_active()) return gles_driver.core.glCreateShaderProgramv(type, count, strings);
+    struct marshal_glCreateShaderProgramv* cmd = glthread_alloc(exec_glCreateShaderProgramv, sizeof(*cmd));
+    cmd->type = type;
+    cmd->count = count;
+    cmd->strings = strings;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glCullFace {
+    GLenum mode;
+};
+
+static void exec_glCullFace(const void* args) {
+    const struct marshal_glCullFace* cmd = args;
+    gles_driver.core.glCullFace(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glCullFace(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.core.glCullFace(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCullFace* cmd = glthread_alloc(exec_glCullFace, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDebugMessageCallback {
+    GLDEBUGPROC callback;
+    const void *userParam;
+};
+
+static void exec_glDebugMessageCallback(const void* args) {
+    const struct marshal_glDebugMessageCallback* cmd = args;
+    gles_driver.core.glDebugMessageCallback(cmd->callback, cmd->userParam);
+}
+
+static void GL_APIENTRY marshal_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    if (!glthread_active()) {
+        gles_driver.core.glDebugMessageCallback(callback, userParam);
+        return;
+    }
+    struct marshal_glDebugMessageCallback* cmd = glthread_alloc(exec_glDebugMessageCallback, sizeof(*cmd));
+    cmd->callback = callback;
+    cmd->userParam = userParam;
+    glthread_sync();
+}
+
+struct marshal_glDebugMessageControl {
+    GLenum source;
+    GLenum type;
+    GLenum severity;
+    GLsizei count;
+    const GLuint *ids;
+    GLboolean enabled;
+};
+
+static void exec_glDebugMessageControl(const void* args) {
+    const struct marshal_glDebugMessageControl* cmd = args;
+    gles_driver.core.glDebugMessageControl(cmd->source, cmd->type, cmd->severity, cmd->count, cmd->ids, cmd->enabled);
+}
+
+static void GL_APIENTRY marshal_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    if (!glthread_active()) {
+        gles_driver.core.glDebugMessageControl(source, type, severity, count, ids, enabled);
+        return;
+    }
+    struct marshal_glDebugMessageControl* cmd = glthread_alloc(exec_glDebugMessageControl, sizeof(*cmd));
+    cmd->source = source;
+    cmd->type = type;
+    cmd->severity = severity;
+    cmd->count = count;
+    cmd->ids = ids;
+    cmd->enabled = enabled;
+    glthread_sync();
+}
+
+struct marshal_glDebugMessageInsert {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    GLsizei length;
+    const GLchar *buf;
+};
+
+static void exec_glDebugMessageInsert(const void* args) {
+    const struct marshal_glDebugMessageInsert* cmd = args;
+    gles_driver.core.glDebugMessageInsert(cmd->source, cmd->type, cmd->id, cmd->severity, cmd->length, cmd->buf);
+}
+
+static void GL_APIENTRY marshal_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    if (!glthread_active()) {
+        gles_driver.core.glDebugMessageInsert(source, type, id, severity, length, buf);
+        return;
+    }
+    struct marshal_glDebugMessageInsert* cmd = glthread_alloc(exec_glDebugMessageInsert, sizeof(*cmd));
+    cmd->source = source;
+    cmd->type = type;
+    cmd->id = id;
+    cmd->severity = severity;
+    cmd->length = length;
+    cmd->buf = buf;
+    glthread_sync();
+}
+
+struct marshal_glDeleteBuffers {
+    GLsizei n;
+    const GLuint *buffers;
+};
+
+static void exec_glDeleteBuffers(const void* args) {
+    const struct marshal_glDeleteBuffers* cmd = args;
+    gles_driver.core.glDeleteBuffers(cmd->n, cmd->buffers);
+}
+
+static void GL_APIENTRY marshal_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteBuffers(n, buffers);
+        return;
+    }
+    glthread_track_delete_buffers(n, buffers);
+    int glt_sync = 0;
+    size_t buffers_size = buffers ? (size_t)(n * sizeof(*buffers)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(buffers_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteBuffers* cmd = glthread_alloc(exec_glDeleteBuffers, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->buffers = glt_sync ? buffers : glthread_copy(&glt_tail, buffers, buffers_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteFramebuffers {
+    GLsizei n;
+    const GLuint *framebuffers;
+};
+
+static void exec_glDeleteFramebuffers(const void* args) {
+    const struct marshal_glDeleteFramebuffers* cmd = args;
+    gles_driver.core.glDeleteFramebuffers(cmd->n, cmd->framebuffers);
+}
+
+static void GL_APIENTRY marshal_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteFramebuffers(n, framebuffers);
+        return;
+    }
+    int glt_sync = 0;
+    size_t framebuffers_size = framebuffers ? (size_t)(n * sizeof(*framebuffers)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(framebuffers_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteFramebuffers* cmd = glthread_alloc(exec_glDeleteFramebuffers, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->framebuffers = glt_sync ? framebuffers : glthread_copy(&glt_tail, framebuffers, framebuffers_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteProgram {
+    GLuint program;
+};
+
+static void exec_glDeleteProgram(const void* args) {
+    const struct marshal_glDeleteProgram* cmd = args;
+    gles_driver.core.glDeleteProgram(cmd->program);
+}
+
+static void GL_APIENTRY marshal_glDeleteProgram(GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteProgram(program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDeleteProgram* cmd = glthread_alloc(exec_glDeleteProgram, sizeof(*cmd));
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteProgramPipelines {
+    GLsizei n;
+    const GLuint *pipelines;
+};
+
+static void exec_glDeleteProgramPipelines(const void* args) {
+    const struct marshal_glDeleteProgramPipelines* cmd = args;
+    gles_driver.core.glDeleteProgramPipelines(cmd->n, cmd->pipelines);
+}
+
+static void GL_APIENTRY marshal_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteProgramPipelines(n, pipelines);
+        return;
+    }
+    int glt_sync = 0;
+    size_t pipelines_size = pipelines ? (size_t)(n * sizeof(*pipelines)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(pipelines_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteProgramPipelines* cmd = glthread_alloc(exec_glDeleteProgramPipelines, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->pipelines = glt_sync ? pipelines : glthread_copy(&glt_tail, pipelines, pipelines_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteQueries {
+    GLsizei n;
+    const GLuint *ids;
+};
+
+static void exec_glDeleteQueries(const void* args) {
+    const struct marshal_glDeleteQueries* cmd = args;
+    gles_driver.core.glDeleteQueries(cmd->n, cmd->ids);
+}
+
+static void GL_APIENTRY marshal_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteQueries(n, ids);
+        return;
+    }
+    int glt_sync = 0;
+    size_t ids_size = ids ? (size_t)(n * sizeof(*ids)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(ids_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteQueries* cmd = glthread_alloc(exec_glDeleteQueries, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->ids = glt_sync ? ids : glthread_copy(&glt_tail, ids, ids_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteRenderbuffers {
+    GLsizei n;
+    const GLuint *renderbuffers;
+};
+
+static void exec_glDeleteRenderbuffers(const void* args) {
+    const struct marshal_glDeleteRenderbuffers* cmd = args;
+    gles_driver.core.glDeleteRenderbuffers(cmd->n, cmd->renderbuffers);
+}
+
+static void GL_APIENTRY marshal_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteRenderbuffers(n, renderbuffers);
+        return;
+    }
+    int glt_sync = 0;
+    size_t renderbuffers_size = renderbuffers ? (size_t)(n * sizeof(*renderbuffers)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(renderbuffers_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteRenderbuffers* cmd = glthread_alloc(exec_glDeleteRenderbuffers, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->renderbuffers = glt_sync ? renderbuffers : glthread_copy(&glt_tail, renderbuffers, renderbuffers_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteSamplers {
+    GLsizei count;
+    const GLuint *samplers;
+};
+
+static void exec_glDeleteSamplers(const void* args) {
+    const struct marshal_glDeleteSamplers* cmd = args;
+    gles_driver.core.glDeleteSamplers(cmd->count, cmd->samplers);
+}
+
+static void GL_APIENTRY marshal_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteSamplers(count, samplers);
+        return;
+    }
+    int glt_sync = 0;
+    size_t samplers_size = samplers ? (size_t)(count * sizeof(*samplers)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(samplers_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteSamplers* cmd = glthread_alloc(exec_glDeleteSamplers, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->count = count;
+    cmd->samplers = glt_sync ? samplers : glthread_copy(&glt_tail, samplers, samplers_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteShader {
+    GLuint shader;
+};
+
+static void exec_glDeleteShader(const void* args) {
+    const struct marshal_glDeleteShader* cmd = args;
+    gles_driver.core.glDeleteShader(cmd->shader);
+}
+
+static void GL_APIENTRY marshal_glDeleteShader(GLuint shader) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteShader(shader);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDeleteShader* cmd = glthread_alloc(exec_glDeleteShader, sizeof(*cmd));
+    cmd->shader = shader;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteSync {
+    GLsync sync;
+};
+
+static void exec_glDeleteSync(const void* args) {
+    const struct marshal_glDeleteSync* cmd = args;
+    gles_driver.core.glDeleteSync(cmd->sync);
+}
+
+static void GL_APIENTRY marshal_glDeleteSync(GLsync sync) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteSync(sync);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDeleteSync* cmd = glthread_alloc(exec_glDeleteSync, sizeof(*cmd));
+    cmd->sync = sync;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteTextures {
+    GLsizei n;
+    const GLuint *textures;
+};
+
+static void exec_glDeleteTextures(const void* args) {
+    const struct marshal_glDeleteTextures* cmd = args;
+    gles_driver.core.glDeleteTextures(cmd->n, cmd->textures);
+}
+
+static void GL_APIENTRY marshal_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteTextures(n, textures);
+        return;
+    }
+    int glt_sync = 0;
+    size_t textures_size = textures ? (size_t)(n * sizeof(*textures)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(textures_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteTextures* cmd = glthread_alloc(exec_glDeleteTextures, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->textures = glt_sync ? textures : glthread_copy(&glt_tail, textures, textures_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteTransformFeedbacks {
+    GLsizei n;
+    const GLuint *ids;
+};
+
+static void exec_glDeleteTransformFeedbacks(const void* args) {
+    const struct marshal_glDeleteTransformFeedbacks* cmd = args;
+    gles_driver.core.glDeleteTransformFeedbacks(cmd->n, cmd->ids);
+}
+
+static void GL_APIENTRY marshal_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteTransformFeedbacks(n, ids);
+        return;
+    }
+    int glt_sync = 0;
+    size_t ids_size = ids ? (size_t)(n * sizeof(*ids)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(ids_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteTransformFeedbacks* cmd = glthread_alloc(exec_glDeleteTransformFeedbacks, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->ids = glt_sync ? ids : glthread_copy(&glt_tail, ids, ids_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteVertexArrays {
+    GLsizei n;
+    const GLuint *arrays;
+};
+
+static void exec_glDeleteVertexArrays(const void* args) {
+    const struct marshal_glDeleteVertexArrays* cmd = args;
+    gles_driver.core.glDeleteVertexArrays(cmd->n, cmd->arrays);
+}
+
+static void GL_APIENTRY marshal_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    if (!glthread_active()) {
+        gles_driver.core.glDeleteVertexArrays(n, arrays);
+        return;
+    }
+    int glt_sync = 0;
+    size_t arrays_size = arrays ? (size_t)(n * sizeof(*arrays)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(arrays_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteVertexArrays* cmd = glthread_alloc(exec_glDeleteVertexArrays, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->arrays = glt_sync ? arrays : glthread_copy(&glt_tail, arrays, arrays_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDepthFunc {
+    GLenum func;
+};
+
+static void exec_glDepthFunc(const void* args) {
+    const struct marshal_glDepthFunc* cmd = args;
+    gles_driver.core.glDepthFunc(cmd->func);
+}
+
+static void GL_APIENTRY marshal_glDepthFunc(GLenum func) {
+    if (!glthread_active()) {
+        gles_driver.core.glDepthFunc(func);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDepthFunc* cmd = glthread_alloc(exec_glDepthFunc, sizeof(*cmd));
+    cmd->func = func;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDepthMask {
+    GLboolean flag;
+};
+
+static void exec_glDepthMask(const void* args) {
+    const struct marshal_glDepthMask* cmd = args;
+    gles_driver.core.glDepthMask(cmd->flag);
+}
+
+static void GL_APIENTRY marshal_glDepthMask(GLboolean flag) {
+    if (!glthread_active()) {
+        gles_driver.core.glDepthMask(flag);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDepthMask* cmd = glthread_alloc(exec_glDepthMask, sizeof(*cmd));
+    cmd->flag = flag;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDepthRangef {
+    GLfloat n;
+    GLfloat f;
+};
+
+static void exec_glDepthRangef(const void* args) {
+    const struct marshal_glDepthRangef* cmd = args;
+    gles_driver.core.glDepthRangef(cmd->n, cmd->f);
+}
+
+static void GL_APIENTRY marshal_glDepthRangef(GLfloat n, GLfloat f) {
+    if (!glthread_active()) {
+        gles_driver.core.glDepthRangef(n, f);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDepthRangef* cmd = glthread_alloc(exec_glDepthRangef, sizeof(*cmd));
+    cmd->n = n;
+    cmd->f = f;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDetachShader {
+    GLuint program;
+    GLuint shader;
+};
+
+static void exec_glDetachShader(const void* args) {
+    const struct marshal_glDetachShader* cmd = args;
+    gles_driver.core.glDetachShader(cmd->program, cmd->shader);
+}
+
+static void GL_APIENTRY marshal_glDetachShader(GLuint program, GLuint shader) {
+    if (!glthread_active()) {
+        gles_driver.core.glDetachShader(program, shader);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDetachShader* cmd = glthread_alloc(exec_glDetachShader, sizeof(*cmd));
+    cmd->program = program;
+    cmd->shader = shader;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisable {
+    GLenum cap;
+};
+
+static void exec_glDisable(const void* args) {
+    const struct marshal_glDisable* cmd = args;
+    gles_driver.core.glDisable(cmd->cap);
+}
+
+static void GL_APIENTRY marshal_glDisable(GLenum cap) {
+    if (!glthread_active()) {
+        gles_driver.core.glDisable(cap);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisable* cmd = glthread_alloc(exec_glDisable, sizeof(*cmd));
+    cmd->cap = cap;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisableVertexAttribArray {
+    GLuint index;
+};
+
+static void exec_glDisableVertexAttribArray(const void* args) {
+    const struct marshal_glDisableVertexAttribArray* cmd = args;
+    gles_driver.core.glDisableVertexAttribArray(cmd->index);
+}
+
+static void GL_APIENTRY marshal_glDisableVertexAttribArray(GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.core.glDisableVertexAttribArray(index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisableVertexAttribArray* cmd = glthread_alloc(exec_glDisableVertexAttribArray, sizeof(*cmd));
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisablei {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glDisablei(const void* args) {
+    const struct marshal_glDisablei* cmd = args;
+    gles_driver.core.glDisablei(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glDisablei(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.core.glDisablei(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisablei* cmd = glthread_alloc(exec_glDisablei, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDispatchCompute {
+    GLuint num_groups_x;
+    GLuint num_groups_y;
+    GLuint num_groups_z;
+};
+
+static void exec_glDispatchCompute(const void* args) {
+    const struct marshal_glDispatchCompute* cmd = args;
+    gles_driver.core.glDispatchCompute(cmd->num_groups_x, cmd->num_groups_y, cmd->num_groups_z);
+}
+
+static void GL_APIENTRY marshal_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    if (!glthread_active()) {
+        gles_driver.core.glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDispatchCompute* cmd = glthread_alloc(exec_glDispatchCompute, sizeof(*cmd));
+    cmd->num_groups_x = num_groups_x;
+    cmd->num_groups_y = num_groups_y;
+    cmd->num_groups_z = num_groups_z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDispatchComputeIndirect {
+    GLintptr indirect;
+};
+
+static void exec_glDispatchComputeIndirect(const void* args) {
+    const struct marshal_glDispatchComputeIndirect* cmd = args;
+    gles_driver.core.glDispatchComputeIndirect(cmd->indirect);
+}
+
+static void GL_APIENTRY marshal_glDispatchComputeIndirect(GLintptr indirect) {
+    if (!glthread_active()) {
+        gles_driver.core.glDispatchComputeIndirect(indirect);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDispatchComputeIndirect* cmd = glthread_alloc(exec_glDispatchComputeIndirect, sizeof(*cmd));
+    cmd->indirect = indirect;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArrays {
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+};
+
+static void exec_glDrawArrays(const void* args) {
+    const struct marshal_glDrawArrays* cmd = args;
+    gles_driver.core.glDrawArrays(cmd->mode, cmd->first, cmd->count);
+}
+
+static void GL_APIENTRY marshal_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawArrays(mode, first, count);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArrays* cmd = glthread_alloc(exec_glDrawArrays, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->first = first;
+    cmd->count = count;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArraysIndirect {
+    GLenum mode;
+    const void *indirect;
+};
+
+static void exec_glDrawArraysIndirect(const void* args) {
+    const struct marshal_glDrawArraysIndirect* cmd = args;
+    gles_driver.core.glDrawArraysIndirect(cmd->mode, cmd->indirect);
+}
+
+static void GL_APIENTRY marshal_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawArraysIndirect(mode, indirect);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArraysIndirect* cmd = glthread_alloc(exec_glDrawArraysIndirect, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->indirect = indirect;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArraysInstanced {
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei instancecount;
+};
+
+static void exec_glDrawArraysInstanced(const void* args) {
+    const struct marshal_glDrawArraysInstanced* cmd = args;
+    gles_driver.core.glDrawArraysInstanced(cmd->mode, cmd->first, cmd->count, cmd->instancecount);
+}
+
+static void GL_APIENTRY marshal_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawArraysInstanced(mode, first, count, instancecount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArraysInstanced* cmd = glthread_alloc(exec_glDrawArraysInstanced, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->first = first;
+    cmd->count = count;
+    cmd->instancecount = instancecount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawBuffers {
+    GLsizei n;
+    const GLenum *bufs;
+};
+
+static void exec_glDrawBuffers(const void* args) {
+    const struct marshal_glDrawBuffers* cmd = args;
+    gles_driver.core.glDrawBuffers(cmd->n, cmd->bufs);
+}
+
+static void GL_APIENTRY marshal_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawBuffers(n, bufs);
+        return;
+    }
+    int glt_sync = 0;
+    size_t bufs_size = bufs ? (size_t)(n * sizeof(*bufs)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(bufs_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDrawBuffers* cmd = glthread_alloc(exec_glDrawBuffers, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->bufs = glt_sync ? bufs : glthread_copy(&glt_tail, bufs, bufs_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElements {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+};
+
+static void exec_glDrawElements(const void* args) {
+    const struct marshal_glDrawElements* cmd = args;
+    gles_driver.core.glDrawElements(cmd->mode, cmd->count, cmd->type, cmd->indices);
+}
+
+static void GL_APIENTRY marshal_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawElements(mode, count, type, indices);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElements* cmd = glthread_alloc(exec_glDrawElements, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsBaseVertex {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLint basevertex;
+};
+
+static void exec_glDrawElementsBaseVertex(const void* args) {
+    const struct marshal_glDrawElementsBaseVertex* cmd = args;
+    gles_driver.core.glDrawElementsBaseVertex(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsBaseVertex* cmd = glthread_alloc(exec_glDrawElementsBaseVertex, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsIndirect {
+    GLenum mode;
+    GLenum type;
+    const void *indirect;
+};
+
+static void exec_glDrawElementsIndirect(const void* args) {
+    const struct marshal_glDrawElementsIndirect* cmd = args;
+    gles_driver.core.glDrawElementsIndirect(cmd->mode, cmd->type, cmd->indirect);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawElementsIndirect(mode, type, indirect);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsIndirect* cmd = glthread_alloc(exec_glDrawElementsIndirect, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->type = type;
+    cmd->indirect = indirect;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstanced {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+};
+
+static void exec_glDrawElementsInstanced(const void* args) {
+    const struct marshal_glDrawElementsInstanced* cmd = args;
+    gles_driver.core.glDrawElementsInstanced(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawElementsInstanced(mode, count, type, indices, instancecount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstanced* cmd = glthread_alloc(exec_glDrawElementsInstanced, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->instancecount = instancecount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedBaseVertex {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+    GLint basevertex;
+};
+
+static void exec_glDrawElementsInstancedBaseVertex(const void* args) {
+    const struct marshal_glDrawElementsInstancedBaseVertex* cmd = args;
+    gles_driver.core.glDrawElementsInstancedBaseVertex(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedBaseVertex* cmd = glthread_alloc(exec_glDrawElementsInstancedBaseVertex, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->instancecount = instancecount;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawRangeElements {
+    GLenum mode;
+    GLuint start;
+    GLuint end;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+};
+
+static void exec_glDrawRangeElements(const void* args) {
+    const struct marshal_glDrawRangeElements* cmd = args;
+    gles_driver.core.glDrawRangeElements(cmd->mode, cmd->start, cmd->end, cmd->count, cmd->type, cmd->indices);
+}
+
+static void GL_APIENTRY marshal_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawRangeElements(mode, start, end, count, type, indices);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawRangeElements* cmd = glthread_alloc(exec_glDrawRangeElements, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->start = start;
+    cmd->end = end;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawRangeElementsBaseVertex {
+    GLenum mode;
+    GLuint start;
+    GLuint end;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLint basevertex;
+};
+
+static void exec_glDrawRangeElementsBaseVertex(const void* args) {
+    const struct marshal_glDrawRangeElementsBaseVertex* cmd = args;
+    gles_driver.core.glDrawRangeElementsBaseVertex(cmd->mode, cmd->start, cmd->end, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.core.glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawRangeElementsBaseVertex* cmd = glthread_alloc(exec_glDrawRangeElementsBaseVertex, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->start = start;
+    cmd->end = end;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEnable {
+    GLenum cap;
+};
+
+static void exec_glEnable(const void* args) {
+    const struct marshal_glEnable* cmd = args;
+    gles_driver.core.glEnable(cmd->cap);
+}
+
+static void GL_APIENTRY marshal_glEnable(GLenum cap) {
+    if (!glthread_active()) {
+        gles_driver.core.glEnable(cap);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnable* cmd = glthread_alloc(exec_glEnable, sizeof(*cmd));
+    cmd->cap = cap;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEnableVertexAttribArray {
+    GLuint index;
+};
+
+static void exec_glEnableVertexAttribArray(const void* args) {
+    const struct marshal_glEnableVertexAttribArray* cmd = args;
+    gles_driver.core.glEnableVertexAttribArray(cmd->index);
+}
+
+static void GL_APIENTRY marshal_glEnableVertexAttribArray(GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.core.glEnableVertexAttribArray(index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnableVertexAttribArray* cmd = glthread_alloc(exec_glEnableVertexAttribArray, sizeof(*cmd));
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEnablei {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glEnablei(const void* args) {
+    const struct marshal_glEnablei* cmd = args;
+    gles_driver.core.glEnablei(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glEnablei(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.core.glEnablei(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnablei* cmd = glthread_alloc(exec_glEnablei, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndQuery {
+    GLenum target;
+};
+
+static void exec_glEndQuery(const void* args) {
+    const struct marshal_glEndQuery* cmd = args;
+    gles_driver.core.glEndQuery(cmd->target);
+}
+
+static void GL_APIENTRY marshal_glEndQuery(GLenum target) {
+    if (!glthread_active()) {
+        gles_driver.core.glEndQuery(target);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndQuery* cmd = glthread_alloc(exec_glEndQuery, sizeof(*cmd));
+    cmd->target = target;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndTransformFeedback {
+    char unused;
+};
+
+static void exec_glEndTransformFeedback(const void* args) {
+    (void)args;
+    gles_driver.core.glEndTransformFeedback();
+}
+
+static void GL_APIENTRY marshal_glEndTransformFeedback(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glEndTransformFeedback();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndTransformFeedback* cmd = glthread_alloc(exec_glEndTransformFeedback, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFenceSync {
+    GLenum condition;
+    GLbitfield flags;
+    GLsync *result;
+};
+
+static void exec_glFenceSync(const void* args) {
+    const struct marshal_glFenceSync* cmd = args;
+    *cmd->result = gles_driver.core.glFenceSync(cmd->condition, cmd->flags);
+}
+
+static GLsync GL_APIENTRY marshal_glFenceSync(GLenum condition, GLbitfield flags) {
+    if (!glthread_active()) return gles_driver.core.glFenceSync(condition, flags);
+    struct marshal_glFenceSync* cmd = glthread_alloc(exec_glFenceSync, sizeof(*cmd));
+    cmd->condition = condition;
+    cmd->flags = flags;
+    GLsync glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glFinish {
+    char unused;
+};
+
+static void exec_glFinish(const void* args) {
+    (void)args;
+    gles_driver.core.glFinish();
+}
+
+static void GL_APIENTRY marshal_glFinish(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glFinish();
+        return;
+    }
+    struct marshal_glFinish* cmd = glthread_alloc(exec_glFinish, sizeof(*cmd));
+    glthread_sync();
+}
+
+struct marshal_glFlush {
+    char unused;
+};
+
+static void exec_glFlush(const void* args) {
+    (void)args;
+    gles_driver.core.glFlush();
+}
+
+static void GL_APIENTRY marshal_glFlush(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glFlush();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFlush* cmd = glthread_alloc(exec_glFlush, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFlushMappedBufferRange {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr length;
+};
+
+static void exec_glFlushMappedBufferRange(const void* args) {
+    const struct marshal_glFlushMappedBufferRange* cmd = args;
+    gles_driver.core.glFlushMappedBufferRange(cmd->target, cmd->offset, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    if (!glthread_active()) {
+        gles_driver.core.glFlushMappedBufferRange(target, offset, length);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFlushMappedBufferRange* cmd = glthread_alloc(exec_glFlushMappedBufferRange, sizeof(*cmd));
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->length = length;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferParameteri {
+    GLenum target;
+    GLenum pname;
+    GLint param;
+};
+
+static void exec_glFramebufferParameteri(const void* args) {
+    const struct marshal_glFramebufferParameteri* cmd = args;
+    gles_driver.core.glFramebufferParameteri(cmd->target, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    if (!glthread_active()) {
+        gles_driver.core.glFramebufferParameteri(target, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferParameteri* cmd = glthread_alloc(exec_glFramebufferParameteri, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferRenderbuffer {
+    GLenum target;
+    GLenum attachment;
+    GLenum renderbuffertarget;
+    GLuint renderbuffer;
+};
+
+static void exec_glFramebufferRenderbuffer(const void* args) {
+    const struct marshal_glFramebufferRenderbuffer* cmd = args;
+    gles_driver.core.glFramebufferRenderbuffer(cmd->target, cmd->attachment, cmd->renderbuffertarget, cmd->renderbuffer);
+}
+
+static void GL_APIENTRY marshal_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    if (!glthread_active()) {
+        gles_driver.core.glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferRenderbuffer* cmd = glthread_alloc(exec_glFramebufferRenderbuffer, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->renderbuffertarget = renderbuffertarget;
+    cmd->renderbuffer = renderbuffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTexture {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+};
+
+static void exec_glFramebufferTexture(const void* args) {
+    const struct marshal_glFramebufferTexture* cmd = args;
+    gles_driver.core.glFramebufferTexture(cmd->target, cmd->attachment, cmd->texture, cmd->level);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    if (!glthread_active()) {
+        gles_driver.core.glFramebufferTexture(target, attachment, texture, level);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTexture* cmd = glthread_alloc(exec_glFramebufferTexture, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTexture2D {
+    GLenum target;
+    GLenum attachment;
+    GLenum textarget;
+    GLuint texture;
+    GLint level;
+};
+
+static void exec_glFramebufferTexture2D(const void* args) {
+    const struct marshal_glFramebufferTexture2D* cmd = args;
+    gles_driver.core.glFramebufferTexture2D(cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if (!glthread_active()) {
+        gles_driver.core.glFramebufferTexture2D(target, attachment, textarget, texture, level);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTexture2D* cmd = glthread_alloc(exec_glFramebufferTexture2D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->textarget = textarget;
+    cmd->texture = texture;
+    cmd->level = level;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTextureLayer {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+    GLint layer;
+};
+
+static void exec_glFramebufferTextureLayer(const void* args) {
+    const struct marshal_glFramebufferTextureLayer* cmd = args;
+    gles_driver.core.glFramebufferTextureLayer(cmd->target, cmd->attachment, cmd->texture, cmd->level, cmd->layer);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    if (!glthread_active()) {
+        gles_driver.core.glFramebufferTextureLayer(target, attachment, texture, level, layer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTextureLayer* cmd = glthread_alloc(exec_glFramebufferTextureLayer, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->layer = layer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFrontFace {
+    GLenum mode;
+};
+
+static void exec_glFrontFace(const void* args) {
+    const struct marshal_glFrontFace* cmd = args;
+    gles_driver.core.glFrontFace(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glFrontFace(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.core.glFrontFace(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFrontFace* cmd = glthread_alloc(exec_glFrontFace, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glGenBuffers {
+    GLsizei n;
+    GLuint *buffers;
+};
+
+static void exec_glGenBuffers(const void* args) {
+    const struct marshal_glGenBuffers* cmd = args;
+    gles_driver.core.glGenBuffers(cmd->n, cmd->buffers);
+}
+
+static void GL_APIENTRY marshal_glGenBuffers(GLsizei n, GLuint *buffers) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenBuffers(n, buffers);
+        return;
+    }
+    struct marshal_glGenBuffers* cmd = glthread_alloc(exec_glGenBuffers, sizeof(*cmd));
+    cmd->n = n;
+    cmd->buffers = buffers;
+    glthread_sync();
+}
+
+struct marshal_glGenFramebuffers {
+    GLsizei n;
+    GLuint *framebuffers;
+};
+
+static void exec_glGenFramebuffers(const void* args) {
+    const struct marshal_glGenFramebuffers* cmd = args;
+    gles_driver.core.glGenFramebuffers(cmd->n, cmd->framebuffers);
+}
+
+static void GL_APIENTRY marshal_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenFramebuffers(n, framebuffers);
+        return;
+    }
+    struct marshal_glGenFramebuffers* cmd = glthread_alloc(exec_glGenFramebuffers, sizeof(*cmd));
+    cmd->n = n;
+    cmd->framebuffers = framebuffers;
+    glthread_sync();
+}
+
+struct marshal_glGenProgramPipelines {
+    GLsizei n;
+    GLuint *pipelines;
+};
+
+static void exec_glGenProgramPipelines(const void* args) {
+    const struct marshal_glGenProgramPipelines* cmd = args;
+    gles_driver.core.glGenProgramPipelines(cmd->n, cmd->pipelines);
+}
+
+static void GL_APIENTRY marshal_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenProgramPipelines(n, pipelines);
+        return;
+    }
+    struct marshal_glGenProgramPipelines* cmd = glthread_alloc(exec_glGenProgramPipelines, sizeof(*cmd));
+    cmd->n = n;
+    cmd->pipelines = pipelines;
+    glthread_sync();
+}
+
+struct marshal_glGenQueries {
+    GLsizei n;
+    GLuint *ids;
+};
+
+static void exec_glGenQueries(const void* args) {
+    const struct marshal_glGenQueries* cmd = args;
+    gles_driver.core.glGenQueries(cmd->n, cmd->ids);
+}
+
+static void GL_APIENTRY marshal_glGenQueries(GLsizei n, GLuint *ids) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenQueries(n, ids);
+        return;
+    }
+    struct marshal_glGenQueries* cmd = glthread_alloc(exec_glGenQueries, sizeof(*cmd));
+    cmd->n = n;
+    cmd->ids = ids;
+    glthread_sync();
+}
+
+struct marshal_glGenRenderbuffers {
+    GLsizei n;
+    GLuint *renderbuffers;
+};
+
+static void exec_glGenRenderbuffers(const void* args) {
+    const struct marshal_glGenRenderbuffers* cmd = args;
+    gles_driver.core.glGenRenderbuffers(cmd->n, cmd->renderbuffers);
+}
+
+static void GL_APIENTRY marshal_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenRenderbuffers(n, renderbuffers);
+        return;
+    }
+    struct marshal_glGenRenderbuffers* cmd = glthread_alloc(exec_glGenRenderbuffers, sizeof(*cmd));
+    cmd->n = n;
+    cmd->renderbuffers = renderbuffers;
+    glthread_sync();
+}
+
+struct marshal_glGenSamplers {
+    GLsizei count;
+    GLuint *samplers;
+};
+
+static void exec_glGenSamplers(const void* args) {
+    const struct marshal_glGenSamplers* cmd = args;
+    gles_driver.core.glGenSamplers(cmd->count, cmd->samplers);
+}
+
+static void GL_APIENTRY marshal_glGenSamplers(GLsizei count, GLuint *samplers) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenSamplers(count, samplers);
+        return;
+    }
+    struct marshal_glGenSamplers* cmd = glthread_alloc(exec_glGenSamplers, sizeof(*cmd));
+    cmd->count = count;
+    cmd->samplers = samplers;
+    glthread_sync();
+}
+
+struct marshal_glGenTextures {
+    GLsizei n;
+    GLuint *textures;
+};
+
+static void exec_glGenTextures(const void* args) {
+    const struct marshal_glGenTextures* cmd = args;
+    gles_driver.core.glGenTextures(cmd->n, cmd->textures);
+}
+
+static void GL_APIENTRY marshal_glGenTextures(GLsizei n, GLuint *textures) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenTextures(n, textures);
+        return;
+    }
+    struct marshal_glGenTextures* cmd = glthread_alloc(exec_glGenTextures, sizeof(*cmd));
+    cmd->n = n;
+    cmd->textures = textures;
+    glthread_sync();
+}
+
+struct marshal_glGenTransformFeedbacks {
+    GLsizei n;
+    GLuint *ids;
+};
+
+static void exec_glGenTransformFeedbacks(const void* args) {
+    const struct marshal_glGenTransformFeedbacks* cmd = args;
+    gles_driver.core.glGenTransformFeedbacks(cmd->n, cmd->ids);
+}
+
+static void GL_APIENTRY marshal_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenTransformFeedbacks(n, ids);
+        return;
+    }
+    struct marshal_glGenTransformFeedbacks* cmd = glthread_alloc(exec_glGenTransformFeedbacks, sizeof(*cmd));
+    cmd->n = n;
+    cmd->ids = ids;
+    glthread_sync();
+}
+
+struct marshal_glGenVertexArrays {
+    GLsizei n;
+    GLuint *arrays;
+};
+
+static void exec_glGenVertexArrays(const void* args) {
+    const struct marshal_glGenVertexArrays* cmd = args;
+    gles_driver.core.glGenVertexArrays(cmd->n, cmd->arrays);
+}
+
+static void GL_APIENTRY marshal_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenVertexArrays(n, arrays);
+        return;
+    }
+    struct marshal_glGenVertexArrays* cmd = glthread_alloc(exec_glGenVertexArrays, sizeof(*cmd));
+    cmd->n = n;
+    cmd->arrays = arrays;
+    glthread_sync();
+}
+
+struct marshal_glGenerateMipmap {
+    GLenum target;
+};
+
+static void exec_glGenerateMipmap(const void* args) {
+    const struct marshal_glGenerateMipmap* cmd = args;
+    gles_driver.core.glGenerateMipmap(cmd->target);
+}
+
+static void GL_APIENTRY marshal_glGenerateMipmap(GLenum target) {
+    if (!glthread_active()) {
+        gles_driver.core.glGenerateMipmap(target);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glGenerateMipmap* cmd = glthread_alloc(exec_glGenerateMipmap, sizeof(*cmd));
+    cmd->target = target;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glGetActiveAttrib {
+    GLuint program;
+    GLuint index;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLint *size;
+    GLenum *type;
+    GLchar *name;
+};
+
+static void exec_glGetActiveAttrib(const void* args) {
+    const struct marshal_glGetActiveAttrib* cmd = args;
+    gles_driver.core.glGetActiveAttrib(cmd->program, cmd->index, cmd->bufSize, cmd->length, cmd->size, cmd->type, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+        return;
+    }
+    struct marshal_glGetActiveAttrib* cmd = glthread_alloc(exec_glGetActiveAttrib, sizeof(*cmd));
+    cmd->program = program;
+    cmd->index = index;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glGetActiveUniform {
+    GLuint program;
+    GLuint index;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLint *size;
+    GLenum *type;
+    GLchar *name;
+};
+
+static void exec_glGetActiveUniform(const void* args) {
+    const struct marshal_glGetActiveUniform* cmd = args;
+    gles_driver.core.glGetActiveUniform(cmd->program, cmd->index, cmd->bufSize, cmd->length, cmd->size, cmd->type, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetActiveUniform(program, index, bufSize, length, size, type, name);
+        return;
+    }
+    struct marshal_glGetActiveUniform* cmd = glthread_alloc(exec_glGetActiveUniform, sizeof(*cmd));
+    cmd->program = program;
+    cmd->index = index;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glGetActiveUniformBlockName {
+    GLuint program;
+    GLuint uniformBlockIndex;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *uniformBlockName;
+};
+
+static void exec_glGetActiveUniformBlockName(const void* args) {
+    const struct marshal_glGetActiveUniformBlockName* cmd = args;
+    gles_driver.core.glGetActiveUniformBlockName(cmd->program, cmd->uniformBlockIndex, cmd->bufSize, cmd->length, cmd->uniformBlockName);
+}
+
+static void GL_APIENTRY marshal_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+        return;
+    }
+    struct marshal_glGetActiveUniformBlockName* cmd = glthread_alloc(exec_glGetActiveUniformBlockName, sizeof(*cmd));
+    cmd->program = program;
+    cmd->uniformBlockIndex = uniformBlockIndex;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->uniformBlockName = uniformBlockName;
+    glthread_sync();
+}
+
+struct marshal_glGetActiveUniformBlockiv {
+    GLuint program;
+    GLuint uniformBlockIndex;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetActiveUniformBlockiv(const void* args) {
+    const struct marshal_glGetActiveUniformBlockiv* cmd = args;
+    gles_driver.core.glGetActiveUniformBlockiv(cmd->program, cmd->uniformBlockIndex, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+        return;
+    }
+    struct marshal_glGetActiveUniformBlockiv* cmd = glthread_alloc(exec_glGetActiveUniformBlockiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->uniformBlockIndex = uniformBlockIndex;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetActiveUniformsiv {
+    GLuint program;
+    GLsizei uniformCount;
+    const GLuint *uniformIndices;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetActiveUniformsiv(const void* args) {
+    const struct marshal_glGetActiveUniformsiv* cmd = args;
+    gles_driver.core.glGetActiveUniformsiv(cmd->program, cmd->uniformCount, cmd->uniformIndices, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+        return;
+    }
+    struct marshal_glGetActiveUniformsiv* cmd = glthread_alloc(exec_glGetActiveUniformsiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->uniformCount = uniformCount;
+    cmd->uniformIndices = uniformIndices;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetAttachedShaders {
+    GLuint program;
+    GLsizei maxCount;
+    GLsizei *count;
+    GLuint *shaders;
+};
+
+static void exec_glGetAttachedShaders(const void* args) {
+    const struct marshal_glGetAttachedShaders* cmd = args;
+    gles_driver.core.glGetAttachedShaders(cmd->program, cmd->maxCount, cmd->count, cmd->shaders);
+}
+
+static void GL_APIENTRY marshal_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetAttachedShaders(program, maxCount, count, shaders);
+        return;
+    }
+    struct marshal_glGetAttachedShaders* cmd = glthread_alloc(exec_glGetAttachedShaders, sizeof(*cmd));
+    cmd->program = program;
+    cmd->maxCount = maxCount;
+    cmd->count = count;
+    cmd->shaders = shaders;
+    glthread_sync();
+}
+
+struct marshal_glGetAttribLocation {
+    GLuint program;
+    const GLchar *name;
+    GLint *result;
+};
+
+static void exec_glGetAttribLocation(const void* args) {
+    const struct marshal_glGetAttribLocation* cmd = args;
+    *cmd->result = gles_driver.core.glGetAttribLocation(cmd->program, cmd->name);
+}
+
+static GLint GL_APIENTRY marshal_glGetAttribLocation(GLuint program, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.core.glGetAttribLocation(program, name);
+    struct marshal_glGetAttribLocation* cmd = glthread_alloc(exec_glGetAttribLocation, sizeof(*cmd));
+    cmd->program = program;
+    cmd->name = name;
+    GLint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetBooleani_v {
+    GLenum target;
+    GLuint index;
+    GLboolean *data;
+};
+
+static void exec_glGetBooleani_v(const void* args) {
+    const struct marshal_glGetBooleani_v* cmd = args;
+    gles_driver.core.glGetBooleani_v(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetBooleani_v(target, index, data);
+        return;
+    }
+    struct marshal_glGetBooleani_v* cmd = glthread_alloc(exec_glGetBooleani_v, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetBooleanv {
+    GLenum pname;
+    GLboolean *data;
+};
+
+static void exec_glGetBooleanv(const void* args) {
+    const struct marshal_glGetBooleanv* cmd = args;
+    gles_driver.core.glGetBooleanv(cmd->pname, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetBooleanv(GLenum pname, GLboolean *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetBooleanv(pname, data);
+        return;
+    }
+    struct marshal_glGetBooleanv* cmd = glthread_alloc(exec_glGetBooleanv, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetBufferParameteri64v {
+    GLenum target;
+    GLenum pname;
+    GLint64 *params;
+};
+
+static void exec_glGetBufferParameteri64v(const void* args) {
+    const struct marshal_glGetBufferParameteri64v* cmd = args;
+    gles_driver.core.glGetBufferParameteri64v(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetBufferParameteri64v(target, pname, params);
+        return;
+    }
+    struct marshal_glGetBufferParameteri64v* cmd = glthread_alloc(exec_glGetBufferParameteri64v, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetBufferParameteriv {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetBufferParameteriv(const void* args) {
+    const struct marshal_glGetBufferParameteriv* cmd = args;
+    gles_driver.core.glGetBufferParameteriv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetBufferParameteriv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetBufferParameteriv* cmd = glthread_alloc(exec_glGetBufferParameteriv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetBufferPointerv {
+    GLenum target;
+    GLenum pname;
+    void **params;
+};
+
+static void exec_glGetBufferPointerv(const void* args) {
+    const struct marshal_glGetBufferPointerv* cmd = args;
+    gles_driver.core.glGetBufferPointerv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetBufferPointerv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetBufferPointerv* cmd = glthread_alloc(exec_glGetBufferPointerv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetDebugMessageLog {
+    GLuint count;
+    GLsizei bufSize;
+    GLenum *sources;
+    GLenum *types;
+    GLuint *ids;
+    GLenum *severities;
+    GLsizei *lengths;
+    GLchar *messageLog;
+    GLuint *result;
+};
+
+static void exec_glGetDebugMessageLog(const void* args) {
+    const struct marshal_glGetDebugMessageLog* cmd = args;
+    *cmd->result = gles_driver.core.glGetDebugMessageLog(cmd->count, cmd->bufSize, cmd->sources, cmd->types, cmd->ids, cmd->severities, cmd->lengths, cmd->messageLog);
+}
+
+static GLuint GL_APIENTRY marshal_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    if (!glthread_active()) return gles_driver.core.glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    struct marshal_glGetDebugMessageLog* cmd = glthread_alloc(exec_glGetDebugMessageLog, sizeof(*cmd));
+    cmd->count = count;
+    cmd->bufSize = bufSize;
+    cmd->sources = sources;
+    cmd->types = types;
+    cmd->ids = ids;
+    cmd->severities = severities;
+    cmd->lengths = lengths;
+    cmd->messageLog = messageLog;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetError {
+    GLenum *result;
+};
+
+static void exec_glGetError(const void* args) {
+    const struct marshal_glGetError* cmd = args;
+    *cmd->result = gles_driver.core.glGetError();
+}
+
+static GLenum GL_APIENTRY marshal_glGetError(void) {
+    if (!glthread_active()) return gles_driver.core.glGetError();
+    struct marshal_glGetError* cmd = glthread_alloc(exec_glGetError, sizeof(*cmd));
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetFloatv {
+    GLenum pname;
+    GLfloat *data;
+};
+
+static void exec_glGetFloatv(const void* args) {
+    const struct marshal_glGetFloatv* cmd = args;
+    gles_driver.core.glGetFloatv(cmd->pname, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetFloatv(GLenum pname, GLfloat *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetFloatv(pname, data);
+        return;
+    }
+    struct marshal_glGetFloatv* cmd = glthread_alloc(exec_glGetFloatv, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetFragDataLocation {
+    GLuint program;
+    const GLchar *name;
+    GLint *result;
+};
+
+static void exec_glGetFragDataLocation(const void* args) {
+    const struct marshal_glGetFragDataLocation* cmd = args;
+    *cmd->result = gles_driver.core.glGetFragDataLocation(cmd->program, cmd->name);
+}
+
+static GLint GL_APIENTRY marshal_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.core.glGetFragDataLocation(program, name);
+    struct marshal_glGetFragDataLocation* cmd = glthread_alloc(exec_glGetFragDataLocation, sizeof(*cmd));
+    cmd->program = program;
+    cmd->name = name;
+    GLint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetFramebufferAttachmentParameteriv {
+    GLenum target;
+    GLenum attachment;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetFramebufferAttachmentParameteriv(const void* args) {
+    const struct marshal_glGetFramebufferAttachmentParameteriv* cmd = args;
+    gles_driver.core.glGetFramebufferAttachmentParameteriv(cmd->target, cmd->attachment, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+        return;
+    }
+    struct marshal_glGetFramebufferAttachmentParameteriv* cmd = glthread_alloc(exec_glGetFramebufferAttachmentParameteriv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetFramebufferParameteriv {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetFramebufferParameteriv(const void* args) {
+    const struct marshal_glGetFramebufferParameteriv* cmd = args;
+    gles_driver.core.glGetFramebufferParameteriv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetFramebufferParameteriv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetFramebufferParameteriv* cmd = glthread_alloc(exec_glGetFramebufferParameteriv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetGraphicsResetStatus {
+    GLenum *result;
+};
+
+static void exec_glGetGraphicsResetStatus(const void* args) {
+    const struct marshal_glGetGraphicsResetStatus* cmd = args;
+    *cmd->result = gles_driver.core.glGetGraphicsResetStatus();
+}
+
+static GLenum GL_APIENTRY marshal_glGetGraphicsResetStatus(void) {
+    if (!glthread_active()) return gles_driver.core.glGetGraphicsResetStatus();
+    struct marshal_glGetGraphicsResetStatus* cmd = glthread_alloc(exec_glGetGraphicsResetStatus, sizeof(*cmd));
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetInteger64i_v {
+    GLenum target;
+    GLuint index;
+    GLint64 *data;
+};
+
+static void exec_glGetInteger64i_v(const void* args) {
+    const struct marshal_glGetInteger64i_v* cmd = args;
+    gles_driver.core.glGetInteger64i_v(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetInteger64i_v(target, index, data);
+        return;
+    }
+    struct marshal_glGetInteger64i_v* cmd = glthread_alloc(exec_glGetInteger64i_v, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetInteger64v {
+    GLenum pname;
+    GLint64 *data;
+};
+
+static void exec_glGetInteger64v(const void* args) {
+    const struct marshal_glGetInteger64v* cmd = args;
+    gles_driver.core.glGetInteger64v(cmd->pname, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetInteger64v(GLenum pname, GLint64 *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetInteger64v(pname, data);
+        return;
+    }
+    struct marshal_glGetInteger64v* cmd = glthread_alloc(exec_glGetInteger64v, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetIntegeri_v {
+    GLenum target;
+    GLuint index;
+    GLint *data;
+};
+
+static void exec_glGetIntegeri_v(const void* args) {
+    const struct marshal_glGetIntegeri_v* cmd = args;
+    gles_driver.core.glGetIntegeri_v(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetIntegeri_v(target, index, data);
+        return;
+    }
+    struct marshal_glGetIntegeri_v* cmd = glthread_alloc(exec_glGetIntegeri_v, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetIntegerv {
+    GLenum pname;
+    GLint *data;
+};
+
+static void exec_glGetIntegerv(const void* args) {
+    const struct marshal_glGetIntegerv* cmd = args;
+    gles_driver.core.glGetIntegerv(cmd->pname, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetIntegerv(GLenum pname, GLint *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetIntegerv(pname, data);
+        return;
+    }
+    struct marshal_glGetIntegerv* cmd = glthread_alloc(exec_glGetIntegerv, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetInternalformativ {
+    GLenum target;
+    GLenum internalformat;
+    GLenum pname;
+    GLsizei count;
+    GLint *params;
+};
+
+static void exec_glGetInternalformativ(const void* args) {
+    const struct marshal_glGetInternalformativ* cmd = args;
+    gles_driver.core.glGetInternalformativ(cmd->target, cmd->internalformat, cmd->pname, cmd->count, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetInternalformativ(target, internalformat, pname, count, params);
+        return;
+    }
+    struct marshal_glGetInternalformativ* cmd = glthread_alloc(exec_glGetInternalformativ, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->pname = pname;
+    cmd->count = count;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetMultisamplefv {
+    GLenum pname;
+    GLuint index;
+    GLfloat *val;
+};
+
+static void exec_glGetMultisamplefv(const void* args) {
+    const struct marshal_glGetMultisamplefv* cmd = args;
+    gles_driver.core.glGetMultisamplefv(cmd->pname, cmd->index, cmd->val);
+}
+
+static void GL_APIENTRY marshal_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetMultisamplefv(pname, index, val);
+        return;
+    }
+    struct marshal_glGetMultisamplefv* cmd = glthread_alloc(exec_glGetMultisamplefv, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->index = index;
+    cmd->val = val;
+    glthread_sync();
+}
+
+struct marshal_glGetObjectLabel {
+    GLenum identifier;
+    GLuint name;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *label;
+};
+
+static void exec_glGetObjectLabel(const void* args) {
+    const struct marshal_glGetObjectLabel* cmd = args;
+    gles_driver.core.glGetObjectLabel(cmd->identifier, cmd->name, cmd->bufSize, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetObjectLabel(identifier, name, bufSize, length, label);
+        return;
+    }
+    struct marshal_glGetObjectLabel* cmd = glthread_alloc(exec_glGetObjectLabel, sizeof(*cmd));
+    cmd->identifier = identifier;
+    cmd->name = name;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glGetObjectPtrLabel {
+    const void *ptr;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *label;
+};
+
+static void exec_glGetObjectPtrLabel(const void* args) {
+    const struct marshal_glGetObjectPtrLabel* cmd = args;
+    gles_driver.core.glGetObjectPtrLabel(cmd->ptr, cmd->bufSize, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetObjectPtrLabel(ptr, bufSize, length, label);
+        return;
+    }
+    struct marshal_glGetObjectPtrLabel* cmd = glthread_alloc(exec_glGetObjectPtrLabel, sizeof(*cmd));
+    cmd->ptr = ptr;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glGetPointerv {
+    GLenum pname;
+    void **params;
+};
+
+static void exec_glGetPointerv(const void* args) {
+    const struct marshal_glGetPointerv* cmd = args;
+    gles_driver.core.glGetPointerv(cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetPointerv(GLenum pname, void **params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetPointerv(pname, params);
+        return;
+    }
+    struct marshal_glGetPointerv* cmd = glthread_alloc(exec_glGetPointerv, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramBinary {
+    GLuint program;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLenum *binaryFormat;
+    void *binary;
+};
+
+static void exec_glGetProgramBinary(const void* args) {
+    const struct marshal_glGetProgramBinary* cmd = args;
+    gles_driver.core.glGetProgramBinary(cmd->program, cmd->bufSize, cmd->length, cmd->binaryFormat, cmd->binary);
+}
+
+static void GL_APIENTRY marshal_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+        return;
+    }
+    struct marshal_glGetProgramBinary* cmd = glthread_alloc(exec_glGetProgramBinary, sizeof(*cmd));
+    cmd->program = program;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->binaryFormat = binaryFormat;
+    cmd->binary = binary;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramInfoLog {
+    GLuint program;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *infoLog;
+};
+
+static void exec_glGetProgramInfoLog(const void* args) {
+    const struct marshal_glGetProgramInfoLog* cmd = args;
+    gles_driver.core.glGetProgramInfoLog(cmd->program, cmd->bufSize, cmd->length, cmd->infoLog);
+}
+
+static void GL_APIENTRY marshal_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramInfoLog(program, bufSize, length, infoLog);
+        return;
+    }
+    struct marshal_glGetProgramInfoLog* cmd = glthread_alloc(exec_glGetProgramInfoLog, sizeof(*cmd));
+    cmd->program = program;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->infoLog = infoLog;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramInterfaceiv {
+    GLuint program;
+    GLenum programInterface;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetProgramInterfaceiv(const void* args) {
+    const struct marshal_glGetProgramInterfaceiv* cmd = args;
+    gles_driver.core.glGetProgramInterfaceiv(cmd->program, cmd->programInterface, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramInterfaceiv(program, programInterface, pname, params);
+        return;
+    }
+    struct marshal_glGetProgramInterfaceiv* cmd = glthread_alloc(exec_glGetProgramInterfaceiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramPipelineInfoLog {
+    GLuint pipeline;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *infoLog;
+};
+
+static void exec_glGetProgramPipelineInfoLog(const void* args) {
+    const struct marshal_glGetProgramPipelineInfoLog* cmd = args;
+    gles_driver.core.glGetProgramPipelineInfoLog(cmd->pipeline, cmd->bufSize, cmd->length, cmd->infoLog);
+}
+
+static void GL_APIENTRY marshal_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+        return;
+    }
+    struct marshal_glGetProgramPipelineInfoLog* cmd = glthread_alloc(exec_glGetProgramPipelineInfoLog, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->infoLog = infoLog;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramPipelineiv {
+    GLuint pipeline;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetProgramPipelineiv(const void* args) {
+    const struct marshal_glGetProgramPipelineiv* cmd = args;
+    gles_driver.core.glGetProgramPipelineiv(cmd->pipeline, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramPipelineiv(pipeline, pname, params);
+        return;
+    }
+    struct marshal_glGetProgramPipelineiv* cmd = glthread_alloc(exec_glGetProgramPipelineiv, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramResourceIndex {
+    GLuint program;
+    GLenum programInterface;
+    const GLchar *name;
+    GLuint *result;
+};
+
+static void exec_glGetProgramResourceIndex(const void* args) {
+    const struct marshal_glGetProgramResourceIndex* cmd = args;
+    *cmd->result = gles_driver.core.glGetProgramResourceIndex(cmd->program, cmd->programInterface, cmd->name);
+}
+
+static GLuint GL_APIENTRY marshal_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.core.glGetProgramResourceIndex(program, programInterface, name);
+    struct marshal_glGetProgramResourceIndex* cmd = glthread_alloc(exec_glGetProgramResourceIndex, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->name = name;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetProgramResourceLocation {
+    GLuint program;
+    GLenum programInterface;
+    const GLchar *name;
+    GLint *result;
+};
+
+static void exec_glGetProgramResourceLocation(const void* args) {
+    const struct marshal_glGetProgramResourceLocation* cmd = args;
+    *cmd->result = gles_driver.core.glGetProgramResourceLocation(cmd->program, cmd->programInterface, cmd->name);
+}
+
+static GLint GL_APIENTRY marshal_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.core.glGetProgramResourceLocation(program, programInterface, name);
+    struct marshal_glGetProgramResourceLocation* cmd = glthread_alloc(exec_glGetProgramResourceLocation, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->name = name;
+    GLint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetProgramResourceName {
+    GLuint program;
+    GLenum programInterface;
+    GLuint index;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *name;
+};
+
+static void exec_glGetProgramResourceName(const void* args) {
+    const struct marshal_glGetProgramResourceName* cmd = args;
+    gles_driver.core.glGetProgramResourceName(cmd->program, cmd->programInterface, cmd->index, cmd->bufSize, cmd->length, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+        return;
+    }
+    struct marshal_glGetProgramResourceName* cmd = glthread_alloc(exec_glGetProgramResourceName, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->index = index;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramResourceiv {
+    GLuint program;
+    GLenum programInterface;
+    GLuint index;
+    GLsizei propCount;
+    const GLenum *props;
+    GLsizei count;
+    GLsizei *length;
+    GLint *params;
+};
+
+static void exec_glGetProgramResourceiv(const void* args) {
+    const struct marshal_glGetProgramResourceiv* cmd = args;
+    gles_driver.core.glGetProgramResourceiv(cmd->program, cmd->programInterface, cmd->index, cmd->propCount, cmd->props, cmd->count, cmd->length, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+        return;
+    }
+    struct marshal_glGetProgramResourceiv* cmd = glthread_alloc(exec_glGetProgramResourceiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->index = index;
+    cmd->propCount = propCount;
+    cmd->props = props;
+    cmd->count = count;
+    cmd->length = length;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramiv {
+    GLuint program;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetProgramiv(const void* args) {
+    const struct marshal_glGetProgramiv* cmd = args;
+    gles_driver.core.glGetProgramiv(cmd->program, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetProgramiv(program, pname, params);
+        return;
+    }
+    struct marshal_glGetProgramiv* cmd = glthread_alloc(exec_glGetProgramiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryObjectuiv {
+    GLuint id;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetQueryObjectuiv(const void* args) {
+    const struct marshal_glGetQueryObjectuiv* cmd = args;
+    gles_driver.core.glGetQueryObjectuiv(cmd->id, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetQueryObjectuiv(id, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryObjectuiv* cmd = glthread_alloc(exec_glGetQueryObjectuiv, sizeof(*cmd));
+    cmd->id = id;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryiv {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetQueryiv(const void* args) {
+    const struct marshal_glGetQueryiv* cmd = args;
+    gles_driver.core.glGetQueryiv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetQueryiv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryiv* cmd = glthread_alloc(exec_glGetQueryiv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetRenderbufferParameteriv {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetRenderbufferParameteriv(const void* args) {
+    const struct marshal_glGetRenderbufferParameteriv* cmd = args;
+    gles_driver.core.glGetRenderbufferParameteriv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetRenderbufferParameteriv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetRenderbufferParameteriv* cmd = glthread_alloc(exec_glGetRenderbufferParameteriv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterIiv {
+    GLuint sampler;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetSamplerParameterIiv(const void* args) {
+    const struct marshal_glGetSamplerParameterIiv* cmd = args;
+    gles_driver.core.glGetSamplerParameterIiv(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetSamplerParameterIiv(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterIiv* cmd = glthread_alloc(exec_glGetSamplerParameterIiv, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterIuiv {
+    GLuint sampler;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetSamplerParameterIuiv(const void* args) {
+    const struct marshal_glGetSamplerParameterIuiv* cmd = args;
+    gles_driver.core.glGetSamplerParameterIuiv(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetSamplerParameterIuiv(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterIuiv* cmd = glthread_alloc(exec_glGetSamplerParameterIuiv, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterfv {
+    GLuint sampler;
+    GLenum pname;
+    GLfloat *params;
+};
+
+static void exec_glGetSamplerParameterfv(const void* args) {
+    const struct marshal_glGetSamplerParameterfv* cmd = args;
+    gles_driver.core.glGetSamplerParameterfv(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetSamplerParameterfv(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterfv* cmd = glthread_alloc(exec_glGetSamplerParameterfv, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameteriv {
+    GLuint sampler;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetSamplerParameteriv(const void* args) {
+    const struct marshal_glGetSamplerParameteriv* cmd = args;
+    gles_driver.core.glGetSamplerParameteriv(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetSamplerParameteriv(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameteriv* cmd = glthread_alloc(exec_glGetSamplerParameteriv, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetShaderInfoLog {
+    GLuint shader;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *infoLog;
+};
+
+static void exec_glGetShaderInfoLog(const void* args) {
+    const struct marshal_glGetShaderInfoLog* cmd = args;
+    gles_driver.core.glGetShaderInfoLog(cmd->shader, cmd->bufSize, cmd->length, cmd->infoLog);
+}
+
+static void GL_APIENTRY marshal_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetShaderInfoLog(shader, bufSize, length, infoLog);
+        return;
+    }
+    struct marshal_glGetShaderInfoLog* cmd = glthread_alloc(exec_glGetShaderInfoLog, sizeof(*cmd));
+    cmd->shader = shader;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->infoLog = infoLog;
+    glthread_sync();
+}
+
+struct marshal_glGetShaderPrecisionFormat {
+    GLenum shadertype;
+    GLenum precisiontype;
+    GLint *range;
+    GLint *precision;
+};
+
+static void exec_glGetShaderPrecisionFormat(const void* args) {
+    const struct marshal_glGetShaderPrecisionFormat* cmd = args;
+    gles_driver.core.glGetShaderPrecisionFormat(cmd->shadertype, cmd->precisiontype, cmd->range, cmd->precision);
+}
+
+static void GL_APIENTRY marshal_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+        return;
+    }
+    struct marshal_glGetShaderPrecisionFormat* cmd = glthread_alloc(exec_glGetShaderPrecisionFormat, sizeof(*cmd));
+    cmd->shadertype = shadertype;
+    cmd->precisiontype = precisiontype;
+    cmd->range = range;
+    cmd->precision = precision;
+    glthread_sync();
+}
+
+struct marshal_glGetShaderSource {
+    GLuint shader;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *source;
+};
+
+static void exec_glGetShaderSource(const void* args) {
+    const struct marshal_glGetShaderSource* cmd = args;
+    gles_driver.core.glGetShaderSource(cmd->shader, cmd->bufSize, cmd->length, cmd->source);
+}
+
+static void GL_APIENTRY marshal_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetShaderSource(shader, bufSize, length, source);
+        return;
+    }
+    struct marshal_glGetShaderSource* cmd = glthread_alloc(exec_glGetShaderSource, sizeof(*cmd));
+    cmd->shader = shader;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->source = source;
+    glthread_sync();
+}
+
+struct marshal_glGetShaderiv {
+    GLuint shader;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetShaderiv(const void* args) {
+    const struct marshal_glGetShaderiv* cmd = args;
+    gles_driver.core.glGetShaderiv(cmd->shader, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetShaderiv(shader, pname, params);
+        return;
+    }
+    struct marshal_glGetShaderiv* cmd = glthread_alloc(exec_glGetShaderiv, sizeof(*cmd));
+    cmd->shader = shader;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetString {
+    GLenum name;
+    const GLubyte * *result;
+};
+
+static void exec_glGetString(const void* args) {
+    const struct marshal_glGetString* cmd = args;
+    *cmd->result = gles_driver.core.glGetString(cmd->name);
+}
+
+static const GLubyte * GL_APIENTRY marshal_glGetString(GLenum name) {
+    if (!glthread_active()) return gles_driver.core.glGetString(name);
+    struct marshal_glGetString* cmd = glthread_alloc(exec_glGetString, sizeof(*cmd));
+    cmd->name = name;
+    const GLubyte *glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetStringi {
+    GLenum name;
+    GLuint index;
+    const GLubyte * *result;
+};
+
+static void exec_glGetStringi(const void* args) {
+    const struct marshal_glGetStringi* cmd = args;
+    *cmd->result = gles_driver.core.glGetStringi(cmd->name, cmd->index);
+}
+
+static const GLubyte * GL_APIENTRY marshal_glGetStringi(GLenum name, GLuint index) {
+    if (!glthread_active()) return gles_driver.core.glGetStringi(name, index);
+    struct marshal_glGetStringi* cmd = glthread_alloc(exec_glGetStringi, sizeof(*cmd));
+    cmd->name = name;
+    cmd->index = index;
+    const GLubyte *glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetSynciv {
+    GLsync sync;
+    GLenum pname;
+    GLsizei count;
+    GLsizei *length;
+    GLint *values;
+};
+
+static void exec_glGetSynciv(const void* args) {
+    const struct marshal_glGetSynciv* cmd = args;
+    gles_driver.core.glGetSynciv(cmd->sync, cmd->pname, cmd->count, cmd->length, cmd->values);
+}
+
+static void GL_APIENTRY marshal_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetSynciv(sync, pname, count, length, values);
+        return;
+    }
+    struct marshal_glGetSynciv* cmd = glthread_alloc(exec_glGetSynciv, sizeof(*cmd));
+    cmd->sync = sync;
+    cmd->pname = pname;
+    cmd->count = count;
+    cmd->length = length;
+    cmd->values = values;
+    glthread_sync();
+}
+
+struct marshal_glGetTexLevelParameterfv {
+    GLenum target;
+    GLint level;
+    GLenum pname;
+    GLfloat *params;
+};
+
+static void exec_glGetTexLevelParameterfv(const void* args) {
+    const struct marshal_glGetTexLevelParameterfv* cmd = args;
+    gles_driver.core.glGetTexLevelParameterfv(cmd->target, cmd->level, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTexLevelParameterfv(target, level, pname, params);
+        return;
+    }
+    struct marshal_glGetTexLevelParameterfv* cmd = glthread_alloc(exec_glGetTexLevelParameterfv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexLevelParameteriv {
+    GLenum target;
+    GLint level;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetTexLevelParameteriv(const void* args) {
+    const struct marshal_glGetTexLevelParameteriv* cmd = args;
+    gles_driver.core.glGetTexLevelParameteriv(cmd->target, cmd->level, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTexLevelParameteriv(target, level, pname, params);
+        return;
+    }
+    struct marshal_glGetTexLevelParameteriv* cmd = glthread_alloc(exec_glGetTexLevelParameteriv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterIiv {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetTexParameterIiv(const void* args) {
+    const struct marshal_glGetTexParameterIiv* cmd = args;
+    gles_driver.core.glGetTexParameterIiv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTexParameterIiv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterIiv* cmd = glthread_alloc(exec_glGetTexParameterIiv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterIuiv {
+    GLenum target;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetTexParameterIuiv(const void* args) {
+    const struct marshal_glGetTexParameterIuiv* cmd = args;
+    gles_driver.core.glGetTexParameterIuiv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTexParameterIuiv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterIuiv* cmd = glthread_alloc(exec_glGetTexParameterIuiv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterfv {
+    GLenum target;
+    GLenum pname;
+    GLfloat *params;
+};
+
+static void exec_glGetTexParameterfv(const void* args) {
+    const struct marshal_glGetTexParameterfv* cmd = args;
+    gles_driver.core.glGetTexParameterfv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTexParameterfv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterfv* cmd = glthread_alloc(exec_glGetTexParameterfv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameteriv {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetTexParameteriv(const void* args) {
+    const struct marshal_glGetTexParameteriv* cmd = args;
+    gles_driver.core.glGetTexParameteriv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTexParameteriv(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameteriv* cmd = glthread_alloc(exec_glGetTexParameteriv, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTransformFeedbackVarying {
+    GLuint program;
+    GLuint index;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLsizei *size;
+    GLenum *type;
+    GLchar *name;
+};
+
+static void exec_glGetTransformFeedbackVarying(const void* args) {
+    const struct marshal_glGetTransformFeedbackVarying* cmd = args;
+    gles_driver.core.glGetTransformFeedbackVarying(cmd->program, cmd->index, cmd->bufSize, cmd->length, cmd->size, cmd->type, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+        return;
+    }
+    struct marshal_glGetTransformFeedbackVarying* cmd = glthread_alloc(exec_glGetTransformFeedbackVarying, sizeof(*cmd));
+    cmd->program = program;
+    cmd->index = index;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glGetUniformBlockIndex {
+    GLuint program;
+    const GLchar *uniformBlockName;
+    GLuint *result;
+};
+
+static void exec_glGetUniformBlockIndex(const void* args) {
+    const struct marshal_glGetUniformBlockIndex* cmd = args;
+    *cmd->result = gles_driver.core.glGetUniformBlockIndex(cmd->program, cmd->uniformBlockName);
+}
+
+static GLuint GL_APIENTRY marshal_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    if (!glthread_active()) return gles_driver.core.glGetUniformBlockIndex(program, uniformBlockName);
+    struct marshal_glGetUniformBlockIndex* cmd = glthread_alloc(exec_glGetUniformBlockIndex, sizeof(*cmd));
+    cmd->program = program;
+    cmd->uniformBlockName = uniformBlockName;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetUniformIndices {
+    GLuint program;
+    GLsizei uniformCount;
+    const GLchar *const*uniformNames;
+    GLuint *uniformIndices;
+};
+
+static void exec_glGetUniformIndices(const void* args) {
+    const struct marshal_glGetUniformIndices* cmd = args;
+    gles_driver.core.glGetUniformIndices(cmd->program, cmd->uniformCount, cmd->uniformNames, cmd->uniformIndices);
+}
+
+static void GL_APIENTRY marshal_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+        return;
+    }
+    struct marshal_glGetUniformIndices* cmd = glthread_alloc(exec_glGetUniformIndices, sizeof(*cmd));
+    cmd->program = program;
+    cmd->uniformCount = uniformCount;
+    cmd->uniformNames = uniformNames;
+    cmd->uniformIndices = uniformIndices;
+    glthread_sync();
+}
+
+struct marshal_glGetUniformLocation {
+    GLuint program;
+    const GLchar *name;
+    GLint *result;
+};
+
+static void exec_glGetUniformLocation(const void* args) {
+    const struct marshal_glGetUniformLocation* cmd = args;
+    *cmd->result = gles_driver.core.glGetUniformLocation(cmd->program, cmd->name);
+}
+
+static GLint GL_APIENTRY marshal_glGetUniformLocation(GLuint program, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.core.glGetUniformLocation(program, name);
+    struct marshal_glGetUniformLocation* cmd = glthread_alloc(exec_glGetUniformLocation, sizeof(*cmd));
+    cmd->program = program;
+    cmd->name = name;
+    GLint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetUniformfv {
+    GLuint program;
+    GLint location;
+    GLfloat *params;
+};
+
+static void exec_glGetUniformfv(const void* args) {
+    const struct marshal_glGetUniformfv* cmd = args;
+    gles_driver.core.glGetUniformfv(cmd->program, cmd->location, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetUniformfv(program, location, params);
+        return;
+    }
+    struct marshal_glGetUniformfv* cmd = glthread_alloc(exec_glGetUniformfv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetUniformiv {
+    GLuint program;
+    GLint location;
+    GLint *params;
+};
+
+static void exec_glGetUniformiv(const void* args) {
+    const struct marshal_glGetUniformiv* cmd = args;
+    gles_driver.core.glGetUniformiv(cmd->program, cmd->location, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetUniformiv(program, location, params);
+        return;
+    }
+    struct marshal_glGetUniformiv* cmd = glthread_alloc(exec_glGetUniformiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetUniformuiv {
+    GLuint program;
+    GLint location;
+    GLuint *params;
+};
+
+static void exec_glGetUniformuiv(const void* args) {
+    const struct marshal_glGetUniformuiv* cmd = args;
+    gles_driver.core.glGetUniformuiv(cmd->program, cmd->location, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetUniformuiv(program, location, params);
+        return;
+    }
+    struct marshal_glGetUniformuiv* cmd = glthread_alloc(exec_glGetUniformuiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetVertexAttribIiv {
+    GLuint index;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetVertexAttribIiv(const void* args) {
+    const struct marshal_glGetVertexAttribIiv* cmd = args;
+    gles_driver.core.glGetVertexAttribIiv(cmd->index, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetVertexAttribIiv(index, pname, params);
+        return;
+    }
+    struct marshal_glGetVertexAttribIiv* cmd = glthread_alloc(exec_glGetVertexAttribIiv, sizeof(*cmd));
+    cmd->index = index;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetVertexAttribIuiv {
+    GLuint index;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetVertexAttribIuiv(const void* args) {
+    const struct marshal_glGetVertexAttribIuiv* cmd = args;
+    gles_driver.core.glGetVertexAttribIuiv(cmd->index, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetVertexAttribIuiv(index, pname, params);
+        return;
+    }
+    struct marshal_glGetVertexAttribIuiv* cmd = glthread_alloc(exec_glGetVertexAttribIuiv, sizeof(*cmd));
+    cmd->index = index;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetVertexAttribPointerv {
+    GLuint index;
+    GLenum pname;
+    void **pointer;
+};
+
+static void exec_glGetVertexAttribPointerv(const void* args) {
+    const struct marshal_glGetVertexAttribPointerv* cmd = args;
+    gles_driver.core.glGetVertexAttribPointerv(cmd->index, cmd->pname, cmd->pointer);
+}
+
+static void GL_APIENTRY marshal_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetVertexAttribPointerv(index, pname, pointer);
+        return;
+    }
+    struct marshal_glGetVertexAttribPointerv* cmd = glthread_alloc(exec_glGetVertexAttribPointerv, sizeof(*cmd));
+    cmd->index = index;
+    cmd->pname = pname;
+    cmd->pointer = pointer;
+    glthread_sync();
+}
+
+struct marshal_glGetVertexAttribfv {
+    GLuint index;
+    GLenum pname;
+    GLfloat *params;
+};
+
+static void exec_glGetVertexAttribfv(const void* args) {
+    const struct marshal_glGetVertexAttribfv* cmd = args;
+    gles_driver.core.glGetVertexAttribfv(cmd->index, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetVertexAttribfv(index, pname, params);
+        return;
+    }
+    struct marshal_glGetVertexAttribfv* cmd = glthread_alloc(exec_glGetVertexAttribfv, sizeof(*cmd));
+    cmd->index = index;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetVertexAttribiv {
+    GLuint index;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetVertexAttribiv(const void* args) {
+    const struct marshal_glGetVertexAttribiv* cmd = args;
+    gles_driver.core.glGetVertexAttribiv(cmd->index, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetVertexAttribiv(index, pname, params);
+        return;
+    }
+    struct marshal_glGetVertexAttribiv* cmd = glthread_alloc(exec_glGetVertexAttribiv, sizeof(*cmd));
+    cmd->index = index;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformfv {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLfloat *params;
+};
+
+static void exec_glGetnUniformfv(const void* args) {
+    const struct marshal_glGetnUniformfv* cmd = args;
+    gles_driver.core.glGetnUniformfv(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetnUniformfv(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformfv* cmd = glthread_alloc(exec_glGetnUniformfv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformiv {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLint *params;
+};
+
+static void exec_glGetnUniformiv(const void* args) {
+    const struct marshal_glGetnUniformiv* cmd = args;
+    gles_driver.core.glGetnUniformiv(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetnUniformiv(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformiv* cmd = glthread_alloc(exec_glGetnUniformiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformuiv {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLuint *params;
+};
+
+static void exec_glGetnUniformuiv(const void* args) {
+    const struct marshal_glGetnUniformuiv* cmd = args;
+    gles_driver.core.glGetnUniformuiv(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glGetnUniformuiv(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformuiv* cmd = glthread_alloc(exec_glGetnUniformuiv, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glHint {
+    GLenum target;
+    GLenum mode;
+};
+
+static void exec_glHint(const void* args) {
+    const struct marshal_glHint* cmd = args;
+    gles_driver.core.glHint(cmd->target, cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glHint(GLenum target, GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.core.glHint(target, mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glHint* cmd = glthread_alloc(exec_glHint, sizeof(*cmd));
+    cmd->target = target;
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glInvalidateFramebuffer {
+    GLenum target;
+    GLsizei numAttachments;
+    const GLenum *attachments;
+};
+
+static void exec_glInvalidateFramebuffer(const void* args) {
+    const struct marshal_glInvalidateFramebuffer* cmd = args;
+    gles_driver.core.glInvalidateFramebuffer(cmd->target, cmd->numAttachments, cmd->attachments);
+}
+
+static void GL_APIENTRY marshal_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    if (!glthread_active()) {
+        gles_driver.core.glInvalidateFramebuffer(target, numAttachments, attachments);
+        return;
+    }
+    int glt_sync = 0;
+    size_t attachments_size = attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(attachments_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glInvalidateFramebuffer* cmd = glthread_alloc(exec_glInvalidateFramebuffer, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->numAttachments = numAttachments;
+    cmd->attachments = glt_sync ? attachments : glthread_copy(&glt_tail, attachments, attachments_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glInvalidateSubFramebuffer {
+    GLenum target;
+    GLsizei numAttachments;
+    const GLenum *attachments;
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glInvalidateSubFramebuffer(const void* args) {
+    const struct marshal_glInvalidateSubFramebuffer* cmd = args;
+    gles_driver.core.glInvalidateSubFramebuffer(cmd->target, cmd->numAttachments, cmd->attachments, cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    size_t attachments_size = attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(attachments_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glInvalidateSubFramebuffer* cmd = glthread_alloc(exec_glInvalidateSubFramebuffer, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->numAttachments = numAttachments;
+    cmd->attachments = glt_sync ? attachments : glthread_copy(&glt_tail, attachments, attachments_size);
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glIsBuffer {
+    GLuint buffer;
+    GLboolean *result;
+};
+
+static void exec_glIsBuffer(const void* args) {
+    const struct marshal_glIsBuffer* cmd = args;
+    *cmd->result = gles_driver.core.glIsBuffer(cmd->buffer);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsBuffer(GLuint buffer) {
+    if (!glthread_active()) return gles_driver.core.glIsBuffer(buffer);
+    struct marshal_glIsBuffer* cmd = glthread_alloc(exec_glIsBuffer, sizeof(*cmd));
+    cmd->buffer = buffer;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsEnabled {
+    GLenum cap;
+    GLboolean *result;
+};
+
+static void exec_glIsEnabled(const void* args) {
+    const struct marshal_glIsEnabled* cmd = args;
+    *cmd->result = gles_driver.core.glIsEnabled(cmd->cap);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsEnabled(GLenum cap) {
+    if (!glthread_active()) return gles_driver.core.glIsEnabled(cap);
+    struct marshal_glIsEnabled* cmd = glthread_alloc(exec_glIsEnabled, sizeof(*cmd));
+    cmd->cap = cap;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsEnabledi {
+    GLenum target;
+    GLuint index;
+    GLboolean *result;
+};
+
+static void exec_glIsEnabledi(const void* args) {
+    const struct marshal_glIsEnabledi* cmd = args;
+    *cmd->result = gles_driver.core.glIsEnabledi(cmd->target, cmd->index);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsEnabledi(GLenum target, GLuint index) {
+    if (!glthread_active()) return gles_driver.core.glIsEnabledi(target, index);
+    struct marshal_glIsEnabledi* cmd = glthread_alloc(exec_glIsEnabledi, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsFramebuffer {
+    GLuint framebuffer;
+    GLboolean *result;
+};
+
+static void exec_glIsFramebuffer(const void* args) {
+    const struct marshal_glIsFramebuffer* cmd = args;
+    *cmd->result = gles_driver.core.glIsFramebuffer(cmd->framebuffer);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsFramebuffer(GLuint framebuffer) {
+    if (!glthread_active()) return gles_driver.core.glIsFramebuffer(framebuffer);
+    struct marshal_glIsFramebuffer* cmd = glthread_alloc(exec_glIsFramebuffer, sizeof(*cmd));
+    cmd->framebuffer = framebuffer;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsProgram {
+    GLuint program;
+    GLboolean *result;
+};
+
+static void exec_glIsProgram(const void* args) {
+    const struct marshal_glIsProgram* cmd = args;
+    *cmd->result = gles_driver.core.glIsProgram(cmd->program);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsProgram(GLuint program) {
+    if (!glthread_active()) return gles_driver.core.glIsProgram(program);
+    struct marshal_glIsProgram* cmd = glthread_alloc(exec_glIsProgram, sizeof(*cmd));
+    cmd->program = program;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsProgramPipeline {
+    GLuint pipeline;
+    GLboolean *result;
+};
+
+static void exec_glIsProgramPipeline(const void* args) {
+    const struct marshal_glIsProgramPipeline* cmd = args;
+    *cmd->result = gles_driver.core.glIsProgramPipeline(cmd->pipeline);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsProgramPipeline(GLuint pipeline) {
+    if (!glthread_active()) return gles_driver.core.glIsProgramPipeline(pipeline);
+    struct marshal_glIsProgramPipeline* cmd = glthread_alloc(exec_glIsProgramPipeline, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsQuery {
+    GLuint id;
+    GLboolean *result;
+};
+
+static void exec_glIsQuery(const void* args) {
+    const struct marshal_glIsQuery* cmd = args;
+    *cmd->result = gles_driver.core.glIsQuery(cmd->id);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsQuery(GLuint id) {
+    if (!glthread_active()) return gles_driver.core.glIsQuery(id);
+    struct marshal_glIsQuery* cmd = glthread_alloc(exec_glIsQuery, sizeof(*cmd));
+    cmd->id = id;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsRenderbuffer {
+    GLuint renderbuffer;
+    GLboolean *result;
+};
+
+static void exec_glIsRenderbuffer(const void* args) {
+    const struct marshal_glIsRenderbuffer* cmd = args;
+    *cmd->result = gles_driver.core.glIsRenderbuffer(cmd->renderbuffer);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsRenderbuffer(GLuint renderbuffer) {
+    if (!glthread_active()) return gles_driver.core.glIsRenderbuffer(renderbuffer);
+    struct marshal_glIsRenderbuffer* cmd = glthread_alloc(exec_glIsRenderbuffer, sizeof(*cmd));
+    cmd->renderbuffer = renderbuffer;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsSampler {
+    GLuint sampler;
+    GLboolean *result;
+};
+
+static void exec_glIsSampler(const void* args) {
+    const struct marshal_glIsSampler* cmd = args;
+    *cmd->result = gles_driver.core.glIsSampler(cmd->sampler);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsSampler(GLuint sampler) {
+    if (!glthread_active()) return gles_driver.core.glIsSampler(sampler);
+    struct marshal_glIsSampler* cmd = glthread_alloc(exec_glIsSampler, sizeof(*cmd));
+    cmd->sampler = sampler;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsShader {
+    GLuint shader;
+    GLboolean *result;
+};
+
+static void exec_glIsShader(const void* args) {
+    const struct marshal_glIsShader* cmd = args;
+    *cmd->result = gles_driver.core.glIsShader(cmd->shader);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsShader(GLuint shader) {
+    if (!glthread_active()) return gles_driver.core.glIsShader(shader);
+    struct marshal_glIsShader* cmd = glthread_alloc(exec_glIsShader, sizeof(*cmd));
+    cmd->shader = shader;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsSync {
+    GLsync sync;
+    GLboolean *result;
+};
+
+static void exec_glIsSync(const void* args) {
+    const struct marshal_glIsSync* cmd = args;
+    *cmd->result = gles_driver.core.glIsSync(cmd->sync);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsSync(GLsync sync) {
+    if (!glthread_active()) return gles_driver.core.glIsSync(sync);
+    struct marshal_glIsSync* cmd = glthread_alloc(exec_glIsSync, sizeof(*cmd));
+    cmd->sync = sync;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsTexture {
+    GLuint texture;
+    GLboolean *result;
+};
+
+static void exec_glIsTexture(const void* args) {
+    const struct marshal_glIsTexture* cmd = args;
+    *cmd->result = gles_driver.core.glIsTexture(cmd->texture);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsTexture(GLuint texture) {
+    if (!glthread_active()) return gles_driver.core.glIsTexture(texture);
+    struct marshal_glIsTexture* cmd = glthread_alloc(exec_glIsTexture, sizeof(*cmd));
+    cmd->texture = texture;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsTransformFeedback {
+    GLuint id;
+    GLboolean *result;
+};
+
+static void exec_glIsTransformFeedback(const void* args) {
+    const struct marshal_glIsTransformFeedback* cmd = args;
+    *cmd->result = gles_driver.core.glIsTransformFeedback(cmd->id);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsTransformFeedback(GLuint id) {
+    if (!glthread_active()) return gles_driver.core.glIsTransformFeedback(id);
+    struct marshal_glIsTransformFeedback* cmd = glthread_alloc(exec_glIsTransformFeedback, sizeof(*cmd));
+    cmd->id = id;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsVertexArray {
+    GLuint array;
+    GLboolean *result;
+};
+
+static void exec_glIsVertexArray(const void* args) {
+    const struct marshal_glIsVertexArray* cmd = args;
+    *cmd->result = gles_driver.core.glIsVertexArray(cmd->array);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsVertexArray(GLuint array) {
+    if (!glthread_active()) return gles_driver.core.glIsVertexArray(array);
+    struct marshal_glIsVertexArray* cmd = glthread_alloc(exec_glIsVertexArray, sizeof(*cmd));
+    cmd->array = array;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glLineWidth {
+    GLfloat width;
+};
+
+static void exec_glLineWidth(const void* args) {
+    const struct marshal_glLineWidth* cmd = args;
+    gles_driver.core.glLineWidth(cmd->width);
+}
+
+static void GL_APIENTRY marshal_glLineWidth(GLfloat width) {
+    if (!glthread_active()) {
+        gles_driver.core.glLineWidth(width);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glLineWidth* cmd = glthread_alloc(exec_glLineWidth, sizeof(*cmd));
+    cmd->width = width;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glLinkProgram {
+    GLuint program;
+};
+
+static void exec_glLinkProgram(const void* args) {
+    const struct marshal_glLinkProgram* cmd = args;
+    gles_driver.core.glLinkProgram(cmd->program);
+}
+
+static void GL_APIENTRY marshal_glLinkProgram(GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.core.glLinkProgram(program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glLinkProgram* cmd = glthread_alloc(exec_glLinkProgram, sizeof(*cmd));
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMapBufferRange {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr length;
+    GLbitfield access;
+    void * *result;
+};
+
+static void exec_glMapBufferRange(const void* args) {
+    const struct marshal_glMapBufferRange* cmd = args;
+    *cmd->result = gles_driver.core.glMapBufferRange(cmd->target, cmd->offset, cmd->length, cmd->access);
+}
+
+static void * GL_APIENTRY marshal_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if (!glthread_active()) return gles_driver.core.glMapBufferRange(target, offset, length, access);
+    struct marshal_glMapBufferRange* cmd = glthread_alloc(exec_glMapBufferRange, sizeof(*cmd));
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->length = length;
+    cmd->access = access;
+    void *glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glMemoryBarrier {
+    GLbitfield barriers;
+};
+
+static void exec_glMemoryBarrier(const void* args) {
+    const struct marshal_glMemoryBarrier* cmd = args;
+    gles_driver.core.glMemoryBarrier(cmd->barriers);
+}
+
+static void GL_APIENTRY marshal_glMemoryBarrier(GLbitfield barriers) {
+    if (!glthread_active()) {
+        gles_driver.core.glMemoryBarrier(barriers);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMemoryBarrier* cmd = glthread_alloc(exec_glMemoryBarrier, sizeof(*cmd));
+    cmd->barriers = barriers;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMemoryBarrierByRegion {
+    GLbitfield barriers;
+};
+
+static void exec_glMemoryBarrierByRegion(const void* args) {
+    const struct marshal_glMemoryBarrierByRegion* cmd = args;
+    gles_driver.core.glMemoryBarrierByRegion(cmd->barriers);
+}
+
+static void GL_APIENTRY marshal_glMemoryBarrierByRegion(GLbitfield barriers) {
+    if (!glthread_active()) {
+        gles_driver.core.glMemoryBarrierByRegion(barriers);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMemoryBarrierByRegion* cmd = glthread_alloc(exec_glMemoryBarrierByRegion, sizeof(*cmd));
+    cmd->barriers = barriers;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMinSampleShading {
+    GLfloat value;
+};
+
+static void exec_glMinSampleShading(const void* args) {
+    const struct marshal_glMinSampleShading* cmd = args;
+    gles_driver.core.glMinSampleShading(cmd->value);
+}
+
+static void GL_APIENTRY marshal_glMinSampleShading(GLfloat value) {
+    if (!glthread_active()) {
+        gles_driver.core.glMinSampleShading(value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMinSampleShading* cmd = glthread_alloc(exec_glMinSampleShading, sizeof(*cmd));
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glObjectLabel {
+    GLenum identifier;
+    GLuint name;
+    GLsizei length;
+    const GLchar *label;
+};
+
+static void exec_glObjectLabel(const void* args) {
+    const struct marshal_glObjectLabel* cmd = args;
+    gles_driver.core.glObjectLabel(cmd->identifier, cmd->name, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.core.glObjectLabel(identifier, name, length, label);
+        return;
+    }
+    struct marshal_glObjectLabel* cmd = glthread_alloc(exec_glObjectLabel, sizeof(*cmd));
+    cmd->identifier = identifier;
+    cmd->name = name;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glObjectPtrLabel {
+    const void *ptr;
+    GLsizei length;
+    const GLchar *label;
+};
+
+static void exec_glObjectPtrLabel(const void* args) {
+    const struct marshal_glObjectPtrLabel* cmd = args;
+    gles_driver.core.glObjectPtrLabel(cmd->ptr, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.core.glObjectPtrLabel(ptr, length, label);
+        return;
+    }
+    struct marshal_glObjectPtrLabel* cmd = glthread_alloc(exec_glObjectPtrLabel, sizeof(*cmd));
+    cmd->ptr = ptr;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glPatchParameteri {
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glPatchParameteri(const void* args) {
+    const struct marshal_glPatchParameteri* cmd = args;
+    gles_driver.core.glPatchParameteri(cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPatchParameteri(GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.core.glPatchParameteri(pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPatchParameteri* cmd = glthread_alloc(exec_glPatchParameteri, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPauseTransformFeedback {
+    char unused;
+};
+
+static void exec_glPauseTransformFeedback(const void* args) {
+    (void)args;
+    gles_driver.core.glPauseTransformFeedback();
+}
+
+static void GL_APIENTRY marshal_glPauseTransformFeedback(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glPauseTransformFeedback();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPauseTransformFeedback* cmd = glthread_alloc(exec_glPauseTransformFeedback, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPixelStorei {
+    GLenum pname;
+    GLint param;
+};
+
+static void exec_glPixelStorei(const void* args) {
+    const struct marshal_glPixelStorei* cmd = args;
+    gles_driver.core.glPixelStorei(cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glPixelStorei(GLenum pname, GLint param) {
+    if (!glthread_active()) {
+        gles_driver.core.glPixelStorei(pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPixelStorei* cmd = glthread_alloc(exec_glPixelStorei, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPolygonOffset {
+    GLfloat factor;
+    GLfloat units;
+};
+
+static void exec_glPolygonOffset(const void* args) {
+    const struct marshal_glPolygonOffset* cmd = args;
+    gles_driver.core.glPolygonOffset(cmd->factor, cmd->units);
+}
+
+static void GL_APIENTRY marshal_glPolygonOffset(GLfloat factor, GLfloat units) {
+    if (!glthread_active()) {
+        gles_driver.core.glPolygonOffset(factor, units);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPolygonOffset* cmd = glthread_alloc(exec_glPolygonOffset, sizeof(*cmd));
+    cmd->factor = factor;
+    cmd->units = units;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPopDebugGroup {
+    char unused;
+};
+
+static void exec_glPopDebugGroup(const void* args) {
+    (void)args;
+    gles_driver.core.glPopDebugGroup();
+}
+
+static void GL_APIENTRY marshal_glPopDebugGroup(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glPopDebugGroup();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPopDebugGroup* cmd = glthread_alloc(exec_glPopDebugGroup, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPrimitiveBoundingBox {
+    GLfloat minX;
+    GLfloat minY;
+    GLfloat minZ;
+    GLfloat minW;
+    GLfloat maxX;
+    GLfloat maxY;
+    GLfloat maxZ;
+    GLfloat maxW;
+};
+
+static void exec_glPrimitiveBoundingBox(const void* args) {
+    const struct marshal_glPrimitiveBoundingBox* cmd = args;
+    gles_driver.core.glPrimitiveBoundingBox(cmd->minX, cmd->minY, cmd->minZ, cmd->minW, cmd->maxX, cmd->maxY, cmd->maxZ, cmd->maxW);
+}
+
+static void GL_APIENTRY marshal_glPrimitiveBoundingBox(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW) {
+    if (!glthread_active()) {
+        gles_driver.core.glPrimitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPrimitiveBoundingBox* cmd = glthread_alloc(exec_glPrimitiveBoundingBox, sizeof(*cmd));
+    cmd->minX = minX;
+    cmd->minY = minY;
+    cmd->minZ = minZ;
+    cmd->minW = minW;
+    cmd->maxX = maxX;
+    cmd->maxY = maxY;
+    cmd->maxZ = maxZ;
+    cmd->maxW = maxW;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramBinary {
+    GLuint program;
+    GLenum binaryFormat;
+    const void *binary;
+    GLsizei length;
+};
+
+static void exec_glProgramBinary(const void* args) {
+    const struct marshal_glProgramBinary* cmd = args;
+    gles_driver.core.glProgramBinary(cmd->program, cmd->binaryFormat, cmd->binary, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramBinary(program, binaryFormat, binary, length);
+        return;
+    }
+    struct marshal_glProgramBinary* cmd = glthread_alloc(exec_glProgramBinary, sizeof(*cmd));
+    cmd->program = program;
+    cmd->binaryFormat = binaryFormat;
+    cmd->binary = binary;
+    cmd->length = length;
+    glthread_sync();
+}
+
+struct marshal_glProgramParameteri {
+    GLuint program;
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glProgramParameteri(const void* args) {
+    const struct marshal_glProgramParameteri* cmd = args;
+    gles_driver.core.glProgramParameteri(cmd->program, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramParameteri(program, pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramParameteri* cmd = glthread_alloc(exec_glProgramParameteri, sizeof(*cmd));
+    cmd->program = program;
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1f {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+};
+
+static void exec_glProgramUniform1f(const void* args) {
+    const struct marshal_glProgramUniform1f* cmd = args;
+    gles_driver.core.glProgramUniform1f(cmd->program, cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform1f(program, location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1f* cmd = glthread_alloc(exec_glProgramUniform1f, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform1fv(const void* args) {
+    const struct marshal_glProgramUniform1fv* cmd = args;
+    gles_driver.core.glProgramUniform1fv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform1fv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform1fv* cmd = glthread_alloc(exec_glProgramUniform1fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1i {
+    GLuint program;
+    GLint location;
+    GLint v0;
+};
+
+static void exec_glProgramUniform1i(const void* args) {
+    const struct marshal_glProgramUniform1i* cmd = args;
+    gles_driver.core.glProgramUniform1i(cmd->program, cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform1i(program, location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1i* cmd = glthread_alloc(exec_glProgramUniform1i, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1iv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform1iv(const void* args) {
+    const struct marshal_glProgramUniform1iv* cmd = args;
+    gles_driver.core.glProgramUniform1iv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform1iv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform1iv* cmd = glthread_alloc(exec_glProgramUniform1iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1ui {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+};
+
+static void exec_glProgramUniform1ui(const void* args) {
+    const struct marshal_glProgramUniform1ui* cmd = args;
+    gles_driver.core.glProgramUniform1ui(cmd->program, cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform1ui(program, location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1ui* cmd = glthread_alloc(exec_glProgramUniform1ui, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1uiv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform1uiv(const void* args) {
+    const struct marshal_glProgramUniform1uiv* cmd = args;
+    gles_driver.core.glProgramUniform1uiv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform1uiv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform1uiv* cmd = glthread_alloc(exec_glProgramUniform1uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2f {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+};
+
+static void exec_glProgramUniform2f(const void* args) {
+    const struct marshal_glProgramUniform2f* cmd = args;
+    gles_driver.core.glProgramUniform2f(cmd->program, cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform2f(program, location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2f* cmd = glthread_alloc(exec_glProgramUniform2f, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform2fv(const void* args) {
+    const struct marshal_glProgramUniform2fv* cmd = args;
+    gles_driver.core.glProgramUniform2fv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform2fv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform2fv* cmd = glthread_alloc(exec_glProgramUniform2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2i {
+    GLuint program;
+    GLint location;
+    GLint v0;
+    GLint v1;
+};
+
+static void exec_glProgramUniform2i(const void* args) {
+    const struct marshal_glProgramUniform2i* cmd = args;
+    gles_driver.core.glProgramUniform2i(cmd->program, cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform2i(program, location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2i* cmd = glthread_alloc(exec_glProgramUniform2i, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2iv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform2iv(const void* args) {
+    const struct marshal_glProgramUniform2iv* cmd = args;
+    gles_driver.core.glProgramUniform2iv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform2iv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform2iv* cmd = glthread_alloc(exec_glProgramUniform2iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2ui {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+};
+
+static void exec_glProgramUniform2ui(const void* args) {
+    const struct marshal_glProgramUniform2ui* cmd = args;
+    gles_driver.core.glProgramUniform2ui(cmd->program, cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform2ui(program, location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2ui* cmd = glthread_alloc(exec_glProgramUniform2ui, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2uiv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform2uiv(const void* args) {
+    const struct marshal_glProgramUniform2uiv* cmd = args;
+    gles_driver.core.glProgramUniform2uiv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform2uiv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform2uiv* cmd = glthread_alloc(exec_glProgramUniform2uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3f {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+};
+
+static void exec_glProgramUniform3f(const void* args) {
+    const struct marshal_glProgramUniform3f* cmd = args;
+    gles_driver.core.glProgramUniform3f(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform3f(program, location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3f* cmd = glthread_alloc(exec_glProgramUniform3f, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform3fv(const void* args) {
+    const struct marshal_glProgramUniform3fv* cmd = args;
+    gles_driver.core.glProgramUniform3fv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform3fv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform3fv* cmd = glthread_alloc(exec_glProgramUniform3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3i {
+    GLuint program;
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+};
+
+static void exec_glProgramUniform3i(const void* args) {
+    const struct marshal_glProgramUniform3i* cmd = args;
+    gles_driver.core.glProgramUniform3i(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform3i(program, location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3i* cmd = glthread_alloc(exec_glProgramUniform3i, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3iv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform3iv(const void* args) {
+    const struct marshal_glProgramUniform3iv* cmd = args;
+    gles_driver.core.glProgramUniform3iv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform3iv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform3iv* cmd = glthread_alloc(exec_glProgramUniform3iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3ui {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+    GLuint v2;
+};
+
+static void exec_glProgramUniform3ui(const void* args) {
+    const struct marshal_glProgramUniform3ui* cmd = args;
+    gles_driver.core.glProgramUniform3ui(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform3ui(program, location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3ui* cmd = glthread_alloc(exec_glProgramUniform3ui, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3uiv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform3uiv(const void* args) {
+    const struct marshal_glProgramUniform3uiv* cmd = args;
+    gles_driver.core.glProgramUniform3uiv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform3uiv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform3uiv* cmd = glthread_alloc(exec_glProgramUniform3uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4f {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+    GLfloat v3;
+};
+
+static void exec_glProgramUniform4f(const void* args) {
+    const struct marshal_glProgramUniform4f* cmd = args;
+    gles_driver.core.glProgramUniform4f(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform4f(program, location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4f* cmd = glthread_alloc(exec_glProgramUniform4f, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform4fv(const void* args) {
+    const struct marshal_glProgramUniform4fv* cmd = args;
+    gles_driver.core.glProgramUniform4fv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform4fv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform4fv* cmd = glthread_alloc(exec_glProgramUniform4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4i {
+    GLuint program;
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+    GLint v3;
+};
+
+static void exec_glProgramUniform4i(const void* args) {
+    const struct marshal_glProgramUniform4i* cmd = args;
+    gles_driver.core.glProgramUniform4i(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform4i(program, location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4i* cmd = glthread_alloc(exec_glProgramUniform4i, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4iv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform4iv(const void* args) {
+    const struct marshal_glProgramUniform4iv* cmd = args;
+    gles_driver.core.glProgramUniform4iv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform4iv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform4iv* cmd = glthread_alloc(exec_glProgramUniform4iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4ui {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+    GLuint v2;
+    GLuint v3;
+};
+
+static void exec_glProgramUniform4ui(const void* args) {
+    const struct marshal_glProgramUniform4ui* cmd = args;
+    gles_driver.core.glProgramUniform4ui(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform4ui(program, location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4ui* cmd = glthread_alloc(exec_glProgramUniform4ui, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4uiv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform4uiv(const void* args) {
+    const struct marshal_glProgramUniform4uiv* cmd = args;
+    gles_driver.core.glProgramUniform4uiv(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniform4uiv(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform4uiv* cmd = glthread_alloc(exec_glProgramUniform4uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix2fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix2fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix2fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix2fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix2fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix2fv* cmd = glthread_alloc(exec_glProgramUniformMatrix2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix2x3fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix2x3fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix2x3fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix2x3fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix2x3fv* cmd = glthread_alloc(exec_glProgramUniformMatrix2x3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix2x4fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix2x4fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix2x4fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix2x4fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix2x4fv* cmd = glthread_alloc(exec_glProgramUniformMatrix2x4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix3fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix3fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix3fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix3fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix3fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 9 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix3fv* cmd = glthread_alloc(exec_glProgramUniformMatrix3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix3x2fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix3x2fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix3x2fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix3x2fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix3x2fv* cmd = glthread_alloc(exec_glProgramUniformMatrix3x2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix3x4fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix3x4fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix3x4fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix3x4fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix3x4fv* cmd = glthread_alloc(exec_glProgramUniformMatrix3x4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix4fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix4fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix4fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix4fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix4fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 16 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix4fv* cmd = glthread_alloc(exec_glProgramUniformMatrix4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix4x2fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix4x2fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix4x2fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix4x2fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix4x2fv* cmd = glthread_alloc(exec_glProgramUniformMatrix4x2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix4x3fv {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix4x3fv(const void* args) {
+    const struct marshal_glProgramUniformMatrix4x3fv* cmd = args;
+    gles_driver.core.glProgramUniformMatrix4x3fv(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix4x3fv* cmd = glthread_alloc(exec_glProgramUniformMatrix4x3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPushDebugGroup {
+    GLenum source;
+    GLuint id;
+    GLsizei length;
+    const GLchar *message;
+};
+
+static void exec_glPushDebugGroup(const void* args) {
+    const struct marshal_glPushDebugGroup* cmd = args;
+    gles_driver.core.glPushDebugGroup(cmd->source, cmd->id, cmd->length, cmd->message);
+}
+
+static void GL_APIENTRY marshal_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    if (!glthread_active()) {
+        gles_driver.core.glPushDebugGroup(source, id, length, message);
+        return;
+    }
+    struct marshal_glPushDebugGroup* cmd = glthread_alloc(exec_glPushDebugGroup, sizeof(*cmd));
+    cmd->source = source;
+    cmd->id = id;
+    cmd->length = length;
+    cmd->message = message;
+    glthread_sync();
+}
+
+struct marshal_glReadBuffer {
+    GLenum src;
+};
+
+static void exec_glReadBuffer(const void* args) {
+    const struct marshal_glReadBuffer* cmd = args;
+    gles_driver.core.glReadBuffer(cmd->src);
+}
+
+static void GL_APIENTRY marshal_glReadBuffer(GLenum src) {
+    if (!glthread_active()) {
+        gles_driver.core.glReadBuffer(src);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glReadBuffer* cmd = glthread_alloc(exec_glReadBuffer, sizeof(*cmd));
+    cmd->src = src;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glReadPixels {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    GLenum type;
+    void *pixels;
+};
+
+static void exec_glReadPixels(const void* args) {
+    const struct marshal_glReadPixels* cmd = args;
+    gles_driver.core.glReadPixels(cmd->x, cmd->y, cmd->width, cmd->height, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.core.glReadPixels(x, y, width, height, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_PACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glReadPixels* cmd = glthread_alloc(exec_glReadPixels, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glReadnPixels {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    GLenum type;
+    GLsizei bufSize;
+    void *data;
+};
+
+static void exec_glReadnPixels(const void* args) {
+    const struct marshal_glReadnPixels* cmd = args;
+    gles_driver.core.glReadnPixels(cmd->x, cmd->y, cmd->width, cmd->height, cmd->format, cmd->type, cmd->bufSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    if (!glthread_active()) {
+        gles_driver.core.glReadnPixels(x, y, width, height, format, type, bufSize, data);
+        return;
+    }
+    struct marshal_glReadnPixels* cmd = glthread_alloc(exec_glReadnPixels, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->bufSize = bufSize;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glReleaseShaderCompiler {
+    char unused;
+};
+
+static void exec_glReleaseShaderCompiler(const void* args) {
+    (void)args;
+    gles_driver.core.glReleaseShaderCompiler();
+}
+
+static void GL_APIENTRY marshal_glReleaseShaderCompiler(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glReleaseShaderCompiler();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glReleaseShaderCompiler* cmd = glthread_alloc(exec_glReleaseShaderCompiler, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRenderbufferStorage {
+    GLenum target;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorage(const void* args) {
+    const struct marshal_glRenderbufferStorage* cmd = args;
+    gles_driver.core.glRenderbufferStorage(cmd->target, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glRenderbufferStorage(target, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorage* cmd = glthread_alloc(exec_glRenderbufferStorage, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRenderbufferStorageMultisample {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorageMultisample(const void* args) {
+    const struct marshal_glRenderbufferStorageMultisample* cmd = args;
+    gles_driver.core.glRenderbufferStorageMultisample(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorageMultisample* cmd = glthread_alloc(exec_glRenderbufferStorageMultisample, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glResumeTransformFeedback {
+    char unused;
+};
+
+static void exec_glResumeTransformFeedback(const void* args) {
+    (void)args;
+    gles_driver.core.glResumeTransformFeedback();
+}
+
+static void GL_APIENTRY marshal_glResumeTransformFeedback(void) {
+    if (!glthread_active()) {
+        gles_driver.core.glResumeTransformFeedback();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glResumeTransformFeedback* cmd = glthread_alloc(exec_glResumeTransformFeedback, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSampleCoverage {
+    GLfloat value;
+    GLboolean invert;
+};
+
+static void exec_glSampleCoverage(const void* args) {
+    const struct marshal_glSampleCoverage* cmd = args;
+    gles_driver.core.glSampleCoverage(cmd->value, cmd->invert);
+}
+
+static void GL_APIENTRY marshal_glSampleCoverage(GLfloat value, GLboolean invert) {
+    if (!glthread_active()) {
+        gles_driver.core.glSampleCoverage(value, invert);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSampleCoverage* cmd = glthread_alloc(exec_glSampleCoverage, sizeof(*cmd));
+    cmd->value = value;
+    cmd->invert = invert;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSampleMaski {
+    GLuint maskNumber;
+    GLbitfield mask;
+};
+
+static void exec_glSampleMaski(const void* args) {
+    const struct marshal_glSampleMaski* cmd = args;
+    gles_driver.core.glSampleMaski(cmd->maskNumber, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    if (!glthread_active()) {
+        gles_driver.core.glSampleMaski(maskNumber, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSampleMaski* cmd = glthread_alloc(exec_glSampleMaski, sizeof(*cmd));
+    cmd->maskNumber = maskNumber;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterIiv {
+    GLuint sampler;
+    GLenum pname;
+    const GLint *param;
+};
+
+static void exec_glSamplerParameterIiv(const void* args) {
+    const struct marshal_glSamplerParameterIiv* cmd = args;
+    gles_driver.core.glSamplerParameterIiv(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    if (!glthread_active()) {
+        gles_driver.core.glSamplerParameterIiv(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterIiv* cmd = glthread_alloc(exec_glSamplerParameterIiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterIuiv {
+    GLuint sampler;
+    GLenum pname;
+    const GLuint *param;
+};
+
+static void exec_glSamplerParameterIuiv(const void* args) {
+    const struct marshal_glSamplerParameterIuiv* cmd = args;
+    gles_driver.core.glSamplerParameterIuiv(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    if (!glthread_active()) {
+        gles_driver.core.glSamplerParameterIuiv(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterIuiv* cmd = glthread_alloc(exec_glSamplerParameterIuiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterf {
+    GLuint sampler;
+    GLenum pname;
+    GLfloat param;
+};
+
+static void exec_glSamplerParameterf(const void* args) {
+    const struct marshal_glSamplerParameterf* cmd = args;
+    gles_driver.core.glSamplerParameterf(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    if (!glthread_active()) {
+        gles_driver.core.glSamplerParameterf(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSamplerParameterf* cmd = glthread_alloc(exec_glSamplerParameterf, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterfv {
+    GLuint sampler;
+    GLenum pname;
+    const GLfloat *param;
+};
+
+static void exec_glSamplerParameterfv(const void* args) {
+    const struct marshal_glSamplerParameterfv* cmd = args;
+    gles_driver.core.glSamplerParameterfv(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    if (!glthread_active()) {
+        gles_driver.core.glSamplerParameterfv(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterfv* cmd = glthread_alloc(exec_glSamplerParameterfv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameteri {
+    GLuint sampler;
+    GLenum pname;
+    GLint param;
+};
+
+static void exec_glSamplerParameteri(const void* args) {
+    const struct marshal_glSamplerParameteri* cmd = args;
+    gles_driver.core.glSamplerParameteri(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    if (!glthread_active()) {
+        gles_driver.core.glSamplerParameteri(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSamplerParameteri* cmd = glthread_alloc(exec_glSamplerParameteri, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameteriv {
+    GLuint sampler;
+    GLenum pname;
+    const GLint *param;
+};
+
+static void exec_glSamplerParameteriv(const void* args) {
+    const struct marshal_glSamplerParameteriv* cmd = args;
+    gles_driver.core.glSamplerParameteriv(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    if (!glthread_active()) {
+        gles_driver.core.glSamplerParameteriv(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameteriv* cmd = glthread_alloc(exec_glSamplerParameteriv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glScissor {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glScissor(const void* args) {
+    const struct marshal_glScissor* cmd = args;
+    gles_driver.core.glScissor(cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glScissor(x, y, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glScissor* cmd = glthread_alloc(exec_glScissor, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glShaderBinary {
+    GLsizei count;
+    const GLuint *shaders;
+    GLenum binaryFormat;
+    const void *binary;
+    GLsizei length;
+};
+
+static void exec_glShaderBinary(const void* args) {
+    const struct marshal_glShaderBinary* cmd = args;
+    gles_driver.core.glShaderBinary(cmd->count, cmd->shaders, cmd->binaryFormat, cmd->binary, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    if (!glthread_active()) {
+        gles_driver.core.glShaderBinary(count, shaders, binaryFormat, binary, length);
+        return;
+    }
+    struct marshal_glShaderBinary* cmd = glthread_alloc(exec_glShaderBinary, sizeof(*cmd));
+    cmd->count = count;
+    cmd->shaders = shaders;
+    cmd->binaryFormat = binaryFormat;
+    cmd->binary = binary;
+    cmd->length = length;
+    glthread_sync();
+}
+
+struct marshal_glShaderSource {
+    GLuint shader;
+    GLsizei count;
+    const GLchar *const*string;
+    const GLint *length;
+};
+
+static void exec_glShaderSource(const void* args) {
+    const struct marshal_glShaderSource* cmd = args;
+    gles_driver.core.glShaderSource(cmd->shader, cmd->count, cmd->string, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    if (!glthread_active()) {
+        gles_driver.core.glShaderSource(shader, count, string, length);
+        return;
+    }
+    struct marshal_glShaderSource* cmd = glthread_alloc(exec_glShaderSource, sizeof(*cmd));
+    cmd->shader = shader;
+    cmd->count = count;
+    cmd->string = string;
+    cmd->length = length;
+    glthread_sync();
+}
+
+struct marshal_glStencilFunc {
+    GLenum func;
+    GLint ref;
+    GLuint mask;
+};
+
+static void exec_glStencilFunc(const void* args) {
+    const struct marshal_glStencilFunc* cmd = args;
+    gles_driver.core.glStencilFunc(cmd->func, cmd->ref, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.core.glStencilFunc(func, ref, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilFunc* cmd = glthread_alloc(exec_glStencilFunc, sizeof(*cmd));
+    cmd->func = func;
+    cmd->ref = ref;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilFuncSeparate {
+    GLenum face;
+    GLenum func;
+    GLint ref;
+    GLuint mask;
+};
+
+static void exec_glStencilFuncSeparate(const void* args) {
+    const struct marshal_glStencilFuncSeparate* cmd = args;
+    gles_driver.core.glStencilFuncSeparate(cmd->face, cmd->func, cmd->ref, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.core.glStencilFuncSeparate(face, func, ref, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilFuncSeparate* cmd = glthread_alloc(exec_glStencilFuncSeparate, sizeof(*cmd));
+    cmd->face = face;
+    cmd->func = func;
+    cmd->ref = ref;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilMask {
+    GLuint mask;
+};
+
+static void exec_glStencilMask(const void* args) {
+    const struct marshal_glStencilMask* cmd = args;
+    gles_driver.core.glStencilMask(cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glStencilMask(GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.core.glStencilMask(mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilMask* cmd = glthread_alloc(exec_glStencilMask, sizeof(*cmd));
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilMaskSeparate {
+    GLenum face;
+    GLuint mask;
+};
+
+static void exec_glStencilMaskSeparate(const void* args) {
+    const struct marshal_glStencilMaskSeparate* cmd = args;
+    gles_driver.core.glStencilMaskSeparate(cmd->face, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.core.glStencilMaskSeparate(face, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilMaskSeparate* cmd = glthread_alloc(exec_glStencilMaskSeparate, sizeof(*cmd));
+    cmd->face = face;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilOp {
+    GLenum fail;
+    GLenum zfail;
+    GLenum zpass;
+};
+
+static void exec_glStencilOp(const void* args) {
+    const struct marshal_glStencilOp* cmd = args;
+    gles_driver.core.glStencilOp(cmd->fail, cmd->zfail, cmd->zpass);
+}
+
+static void GL_APIENTRY marshal_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    if (!glthread_active()) {
+        gles_driver.core.glStencilOp(fail, zfail, zpass);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilOp* cmd = glthread_alloc(exec_glStencilOp, sizeof(*cmd));
+    cmd->fail = fail;
+    cmd->zfail = zfail;
+    cmd->zpass = zpass;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilOpSeparate {
+    GLenum face;
+    GLenum sfail;
+    GLenum dpfail;
+    GLenum dppass;
+};
+
+static void exec_glStencilOpSeparate(const void* args) {
+    const struct marshal_glStencilOpSeparate* cmd = args;
+    gles_driver.core.glStencilOpSeparate(cmd->face, cmd->sfail, cmd->dpfail, cmd->dppass);
+}
+
+static void GL_APIENTRY marshal_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    if (!glthread_active()) {
+        gles_driver.core.glStencilOpSeparate(face, sfail, dpfail, dppass);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilOpSeparate* cmd = glthread_alloc(exec_glStencilOpSeparate, sizeof(*cmd));
+    cmd->face = face;
+    cmd->sfail = sfail;
+    cmd->dpfail = dpfail;
+    cmd->dppass = dppass;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexBuffer {
+    GLenum target;
+    GLenum internalformat;
+    GLuint buffer;
+};
+
+static void exec_glTexBuffer(const void* args) {
+    const struct marshal_glTexBuffer* cmd = args;
+    gles_driver.core.glTexBuffer(cmd->target, cmd->internalformat, cmd->buffer);
+}
+
+static void GL_APIENTRY marshal_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexBuffer(target, internalformat, buffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexBuffer* cmd = glthread_alloc(exec_glTexBuffer, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->buffer = buffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexBufferRange {
+    GLenum target;
+    GLenum internalformat;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+static void exec_glTexBufferRange(const void* args) {
+    const struct marshal_glTexBufferRange* cmd = args;
+    gles_driver.core.glTexBufferRange(cmd->target, cmd->internalformat, cmd->buffer, cmd->offset, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexBufferRange(target, internalformat, buffer, offset, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexBufferRange* cmd = glthread_alloc(exec_glTexBufferRange, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexImage2D {
+    GLenum target;
+    GLint level;
+    GLint internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLint border;
+    GLenum format;
+    GLenum type;
+    const void *pixels;
+};
+
+static void exec_glTexImage2D(const void* args) {
+    const struct marshal_glTexImage2D* cmd = args;
+    gles_driver.core.glTexImage2D(cmd->target, cmd->level, cmd->internalformat, cmd->width, cmd->height, cmd->border, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glTexImage2D* cmd = glthread_alloc(exec_glTexImage2D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->border = border;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexImage3D {
+    GLenum target;
+    GLint level;
+    GLint internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLint border;
+    GLenum format;
+    GLenum type;
+    const void *pixels;
+};
+
+static void exec_glTexImage3D(const void* args) {
+    const struct marshal_glTexImage3D* cmd = args;
+    gles_driver.core.glTexImage3D(cmd->target, cmd->level, cmd->internalformat, cmd->width, cmd->height, cmd->depth, cmd->border, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glTexImage3D* cmd = glthread_alloc(exec_glTexImage3D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->border = border;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterIiv {
+    GLenum target;
+    GLenum pname;
+    const GLint *params;
+};
+
+static void exec_glTexParameterIiv(const void* args) {
+    const struct marshal_glTexParameterIiv* cmd = args;
+    gles_driver.core.glTexParameterIiv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexParameterIiv(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterIiv* cmd = glthread_alloc(exec_glTexParameterIiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterIuiv {
+    GLenum target;
+    GLenum pname;
+    const GLuint *params;
+};
+
+static void exec_glTexParameterIuiv(const void* args) {
+    const struct marshal_glTexParameterIuiv* cmd = args;
+    gles_driver.core.glTexParameterIuiv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexParameterIuiv(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterIuiv* cmd = glthread_alloc(exec_glTexParameterIuiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterf {
+    GLenum target;
+    GLenum pname;
+    GLfloat param;
+};
+
+static void exec_glTexParameterf(const void* args) {
+    const struct marshal_glTexParameterf* cmd = args;
+    gles_driver.core.glTexParameterf(cmd->target, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexParameterf(target, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexParameterf* cmd = glthread_alloc(exec_glTexParameterf, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterfv {
+    GLenum target;
+    GLenum pname;
+    const GLfloat *params;
+};
+
+static void exec_glTexParameterfv(const void* args) {
+    const struct marshal_glTexParameterfv* cmd = args;
+    gles_driver.core.glTexParameterfv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexParameterfv(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterfv* cmd = glthread_alloc(exec_glTexParameterfv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameteri {
+    GLenum target;
+    GLenum pname;
+    GLint param;
+};
+
+static void exec_glTexParameteri(const void* args) {
+    const struct marshal_glTexParameteri* cmd = args;
+    gles_driver.core.glTexParameteri(cmd->target, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexParameteri(target, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexParameteri* cmd = glthread_alloc(exec_glTexParameteri, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameteriv {
+    GLenum target;
+    GLenum pname;
+    const GLint *params;
+};
+
+static void exec_glTexParameteriv(const void* args) {
+    const struct marshal_glTexParameteriv* cmd = args;
+    gles_driver.core.glTexParameteriv(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexParameteriv(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameteriv* cmd = glthread_alloc(exec_glTexParameteriv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage2D {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glTexStorage2D(const void* args) {
+    const struct marshal_glTexStorage2D* cmd = args;
+    gles_driver.core.glTexStorage2D(cmd->target, cmd->levels, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexStorage2D(target, levels, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage2D* cmd = glthread_alloc(exec_glTexStorage2D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage2DMultisample {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLboolean fixedsamplelocations;
+};
+
+static void exec_glTexStorage2DMultisample(const void* args) {
+    const struct marshal_glTexStorage2DMultisample* cmd = args;
+    gles_driver.core.glTexStorage2DMultisample(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height, cmd->fixedsamplelocations);
+}
+
+static void GL_APIENTRY marshal_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage2DMultisample* cmd = glthread_alloc(exec_glTexStorage2DMultisample, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->fixedsamplelocations = fixedsamplelocations;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage3D {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+};
+
+static void exec_glTexStorage3D(const void* args) {
+    const struct marshal_glTexStorage3D* cmd = args;
+    gles_driver.core.glTexStorage3D(cmd->target, cmd->levels, cmd->internalformat, cmd->width, cmd->height, cmd->depth);
+}
+
+static void GL_APIENTRY marshal_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexStorage3D(target, levels, internalformat, width, height, depth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage3D* cmd = glthread_alloc(exec_glTexStorage3D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage3DMultisample {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLboolean fixedsamplelocations;
+};
+
+static void exec_glTexStorage3DMultisample(const void* args) {
+    const struct marshal_glTexStorage3DMultisample* cmd = args;
+    gles_driver.core.glTexStorage3DMultisample(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height, cmd->depth, cmd->fixedsamplelocations);
+}
+
+static void GL_APIENTRY marshal_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage3DMultisample* cmd = glthread_alloc(exec_glTexStorage3DMultisample, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->fixedsamplelocations = fixedsamplelocations;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexSubImage2D {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    GLenum type;
+    const void *pixels;
+};
+
+static void exec_glTexSubImage2D(const void* args) {
+    const struct marshal_glTexSubImage2D* cmd = args;
+    gles_driver.core.glTexSubImage2D(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->width, cmd->height, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glTexSubImage2D* cmd = glthread_alloc(exec_glTexSubImage2D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexSubImage3D {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLenum format;
+    GLenum type;
+    const void *pixels;
+};
+
+static void exec_glTexSubImage3D(const void* args) {
+    const struct marshal_glTexSubImage3D* cmd = args;
+    gles_driver.core.glTexSubImage3D(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.core.glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glTexSubImage3D* cmd = glthread_alloc(exec_glTexSubImage3D, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTransformFeedbackVaryings {
+    GLuint program;
+    GLsizei count;
+    const GLchar *const*varyings;
+    GLenum bufferMode;
+};
+
+static void exec_glTransformFeedbackVaryings(const void* args) {
+    const struct marshal_glTransformFeedbackVaryings* cmd = args;
+    gles_driver.core.glTransformFeedbackVaryings(cmd->program, cmd->count, cmd->varyings, cmd->bufferMode);
+}
+
+static void GL_APIENTRY marshal_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    if (!glthread_active()) {
+        gles_driver.core.glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+        return;
+    }
+    struct marshal_glTransformFeedbackVaryings* cmd = glthread_alloc(exec_glTransformFeedbackVaryings, sizeof(*cmd));
+    cmd->program = program;
+    cmd->count = count;
+    cmd->varyings = varyings;
+    cmd->bufferMode = bufferMode;
+    glthread_sync();
+}
+
+struct marshal_glUniform1f {
+    GLint location;
+    GLfloat v0;
+};
+
+static void exec_glUniform1f(const void* args) {
+    const struct marshal_glUniform1f* cmd = args;
+    gles_driver.core.glUniform1f(cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glUniform1f(GLint location, GLfloat v0) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform1f(location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform1f* cmd = glthread_alloc(exec_glUniform1f, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1fv {
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glUniform1fv(const void* args) {
+    const struct marshal_glUniform1fv* cmd = args;
+    gles_driver.core.glUniform1fv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform1fv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform1fv* cmd = glthread_alloc(exec_glUniform1fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1i {
+    GLint location;
+    GLint v0;
+};
+
+static void exec_glUniform1i(const void* args) {
+    const struct marshal_glUniform1i* cmd = args;
+    gles_driver.core.glUniform1i(cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glUniform1i(GLint location, GLint v0) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform1i(location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform1i* cmd = glthread_alloc(exec_glUniform1i, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1iv {
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glUniform1iv(const void* args) {
+    const struct marshal_glUniform1iv* cmd = args;
+    gles_driver.core.glUniform1iv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform1iv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform1iv* cmd = glthread_alloc(exec_glUniform1iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1ui {
+    GLint location;
+    GLuint v0;
+};
+
+static void exec_glUniform1ui(const void* args) {
+    const struct marshal_glUniform1ui* cmd = args;
+    gles_driver.core.glUniform1ui(cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glUniform1ui(GLint location, GLuint v0) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform1ui(location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform1ui* cmd = glthread_alloc(exec_glUniform1ui, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1uiv {
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glUniform1uiv(const void* args) {
+    const struct marshal_glUniform1uiv* cmd = args;
+    gles_driver.core.glUniform1uiv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform1uiv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform1uiv* cmd = glthread_alloc(exec_glUniform1uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2f {
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+};
+
+static void exec_glUniform2f(const void* args) {
+    const struct marshal_glUniform2f* cmd = args;
+    gles_driver.core.glUniform2f(cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform2f(location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform2f* cmd = glthread_alloc(exec_glUniform2f, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2fv {
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glUniform2fv(const void* args) {
+    const struct marshal_glUniform2fv* cmd = args;
+    gles_driver.core.glUniform2fv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform2fv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform2fv* cmd = glthread_alloc(exec_glUniform2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2i {
+    GLint location;
+    GLint v0;
+    GLint v1;
+};
+
+static void exec_glUniform2i(const void* args) {
+    const struct marshal_glUniform2i* cmd = args;
+    gles_driver.core.glUniform2i(cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glUniform2i(GLint location, GLint v0, GLint v1) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform2i(location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform2i* cmd = glthread_alloc(exec_glUniform2i, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2iv {
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glUniform2iv(const void* args) {
+    const struct marshal_glUniform2iv* cmd = args;
+    gles_driver.core.glUniform2iv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform2iv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform2iv* cmd = glthread_alloc(exec_glUniform2iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2ui {
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+};
+
+static void exec_glUniform2ui(const void* args) {
+    const struct marshal_glUniform2ui* cmd = args;
+    gles_driver.core.glUniform2ui(cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform2ui(location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform2ui* cmd = glthread_alloc(exec_glUniform2ui, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2uiv {
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glUniform2uiv(const void* args) {
+    const struct marshal_glUniform2uiv* cmd = args;
+    gles_driver.core.glUniform2uiv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform2uiv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform2uiv* cmd = glthread_alloc(exec_glUniform2uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3f {
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+};
+
+static void exec_glUniform3f(const void* args) {
+    const struct marshal_glUniform3f* cmd = args;
+    gles_driver.core.glUniform3f(cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform3f(location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform3f* cmd = glthread_alloc(exec_glUniform3f, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3fv {
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glUniform3fv(const void* args) {
+    const struct marshal_glUniform3fv* cmd = args;
+    gles_driver.core.glUniform3fv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform3fv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform3fv* cmd = glthread_alloc(exec_glUniform3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3i {
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+};
+
+static void exec_glUniform3i(const void* args) {
+    const struct marshal_glUniform3i* cmd = args;
+    gles_driver.core.glUniform3i(cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform3i(location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform3i* cmd = glthread_alloc(exec_glUniform3i, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3iv {
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glUniform3iv(const void* args) {
+    const struct marshal_glUniform3iv* cmd = args;
+    gles_driver.core.glUniform3iv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform3iv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform3iv* cmd = glthread_alloc(exec_glUniform3iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3ui {
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+    GLuint v2;
+};
+
+static void exec_glUniform3ui(const void* args) {
+    const struct marshal_glUniform3ui* cmd = args;
+    gles_driver.core.glUniform3ui(cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform3ui(location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform3ui* cmd = glthread_alloc(exec_glUniform3ui, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3uiv {
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glUniform3uiv(const void* args) {
+    const struct marshal_glUniform3uiv* cmd = args;
+    gles_driver.core.glUniform3uiv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform3uiv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform3uiv* cmd = glthread_alloc(exec_glUniform3uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4f {
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+    GLfloat v3;
+};
+
+static void exec_glUniform4f(const void* args) {
+    const struct marshal_glUniform4f* cmd = args;
+    gles_driver.core.glUniform4f(cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform4f(location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform4f* cmd = glthread_alloc(exec_glUniform4f, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4fv {
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glUniform4fv(const void* args) {
+    const struct marshal_glUniform4fv* cmd = args;
+    gles_driver.core.glUniform4fv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform4fv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform4fv* cmd = glthread_alloc(exec_glUniform4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4i {
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+    GLint v3;
+};
+
+static void exec_glUniform4i(const void* args) {
+    const struct marshal_glUniform4i* cmd = args;
+    gles_driver.core.glUniform4i(cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform4i(location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform4i* cmd = glthread_alloc(exec_glUniform4i, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4iv {
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glUniform4iv(const void* args) {
+    const struct marshal_glUniform4iv* cmd = args;
+    gles_driver.core.glUniform4iv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform4iv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform4iv* cmd = glthread_alloc(exec_glUniform4iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4ui {
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+    GLuint v2;
+    GLuint v3;
+};
+
+static void exec_glUniform4ui(const void* args) {
+    const struct marshal_glUniform4ui* cmd = args;
+    gles_driver.core.glUniform4ui(cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform4ui(location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform4ui* cmd = glthread_alloc(exec_glUniform4ui, sizeof(*cmd));
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4uiv {
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glUniform4uiv(const void* args) {
+    const struct marshal_glUniform4uiv* cmd = args;
+    gles_driver.core.glUniform4uiv(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniform4uiv(location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniform4uiv* cmd = glthread_alloc(exec_glUniform4uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformBlockBinding {
+    GLuint program;
+    GLuint uniformBlockIndex;
+    GLuint uniformBlockBinding;
+};
+
+static void exec_glUniformBlockBinding(const void* args) {
+    const struct marshal_glUniformBlockBinding* cmd = args;
+    gles_driver.core.glUniformBlockBinding(cmd->program, cmd->uniformBlockIndex, cmd->uniformBlockBinding);
+}
+
+static void GL_APIENTRY marshal_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniformBlockBinding* cmd = glthread_alloc(exec_glUniformBlockBinding, sizeof(*cmd));
+    cmd->program = program;
+    cmd->uniformBlockIndex = uniformBlockIndex;
+    cmd->uniformBlockBinding = uniformBlockBinding;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix2fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix2fv(const void* args) {
+    const struct marshal_glUniformMatrix2fv* cmd = args;
+    gles_driver.core.glUniformMatrix2fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix2fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix2fv* cmd = glthread_alloc(exec_glUniformMatrix2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix2x3fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix2x3fv(const void* args) {
+    const struct marshal_glUniformMatrix2x3fv* cmd = args;
+    gles_driver.core.glUniformMatrix2x3fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix2x3fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix2x3fv* cmd = glthread_alloc(exec_glUniformMatrix2x3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix2x4fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix2x4fv(const void* args) {
+    const struct marshal_glUniformMatrix2x4fv* cmd = args;
+    gles_driver.core.glUniformMatrix2x4fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix2x4fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix2x4fv* cmd = glthread_alloc(exec_glUniformMatrix2x4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix3fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix3fv(const void* args) {
+    const struct marshal_glUniformMatrix3fv* cmd = args;
+    gles_driver.core.glUniformMatrix3fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix3fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 9 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix3fv* cmd = glthread_alloc(exec_glUniformMatrix3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix3x2fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix3x2fv(const void* args) {
+    const struct marshal_glUniformMatrix3x2fv* cmd = args;
+    gles_driver.core.glUniformMatrix3x2fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix3x2fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix3x2fv* cmd = glthread_alloc(exec_glUniformMatrix3x2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix3x4fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix3x4fv(const void* args) {
+    const struct marshal_glUniformMatrix3x4fv* cmd = args;
+    gles_driver.core.glUniformMatrix3x4fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix3x4fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix3x4fv* cmd = glthread_alloc(exec_glUniformMatrix3x4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix4fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix4fv(const void* args) {
+    const struct marshal_glUniformMatrix4fv* cmd = args;
+    gles_driver.core.glUniformMatrix4fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix4fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 16 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix4fv* cmd = glthread_alloc(exec_glUniformMatrix4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix4x2fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix4x2fv(const void* args) {
+    const struct marshal_glUniformMatrix4x2fv* cmd = args;
+    gles_driver.core.glUniformMatrix4x2fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix4x2fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix4x2fv* cmd = glthread_alloc(exec_glUniformMatrix4x2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix4x3fv {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix4x3fv(const void* args) {
+    const struct marshal_glUniformMatrix4x3fv* cmd = args;
+    gles_driver.core.glUniformMatrix4x3fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.core.glUniformMatrix4x3fv(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix4x3fv* cmd = glthread_alloc(exec_glUniformMatrix4x3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUnmapBuffer {
+    GLenum target;
+    GLboolean *result;
+};
+
+static void exec_glUnmapBuffer(const void* args) {
+    const struct marshal_glUnmapBuffer* cmd = args;
+    *cmd->result = gles_driver.core.glUnmapBuffer(cmd->target);
+}
+
+static GLboolean GL_APIENTRY marshal_glUnmapBuffer(GLenum target) {
+    if (!glthread_active()) return gles_driver.core.glUnmapBuffer(target);
+    struct marshal_glUnmapBuffer* cmd = glthread_alloc(exec_glUnmapBuffer, sizeof(*cmd));
+    cmd->target = target;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glUseProgram {
+    GLuint program;
+};
+
+static void exec_glUseProgram(const void* args) {
+    const struct marshal_glUseProgram* cmd = args;
+    gles_driver.core.glUseProgram(cmd->program);
+}
+
+static void GL_APIENTRY marshal_glUseProgram(GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.core.glUseProgram(program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUseProgram* cmd = glthread_alloc(exec_glUseProgram, sizeof(*cmd));
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUseProgramStages {
+    GLuint pipeline;
+    GLbitfield stages;
+    GLuint program;
+};
+
+static void exec_glUseProgramStages(const void* args) {
+    const struct marshal_glUseProgramStages* cmd = args;
+    gles_driver.core.glUseProgramStages(cmd->pipeline, cmd->stages, cmd->program);
+}
+
+static void GL_APIENTRY marshal_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.core.glUseProgramStages(pipeline, stages, program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUseProgramStages* cmd = glthread_alloc(exec_glUseProgramStages, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->stages = stages;
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glValidateProgram {
+    GLuint program;
+};
+
+static void exec_glValidateProgram(const void* args) {
+    const struct marshal_glValidateProgram* cmd = args;
+    gles_driver.core.glValidateProgram(cmd->program);
+}
+
+static void GL_APIENTRY marshal_glValidateProgram(GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.core.glValidateProgram(program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glValidateProgram* cmd = glthread_alloc(exec_glValidateProgram, sizeof(*cmd));
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glValidateProgramPipeline {
+    GLuint pipeline;
+};
+
+static void exec_glValidateProgramPipeline(const void* args) {
+    const struct marshal_glValidateProgramPipeline* cmd = args;
+    gles_driver.core.glValidateProgramPipeline(cmd->pipeline);
+}
+
+static void GL_APIENTRY marshal_glValidateProgramPipeline(GLuint pipeline) {
+    if (!glthread_active()) {
+        gles_driver.core.glValidateProgramPipeline(pipeline);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glValidateProgramPipeline* cmd = glthread_alloc(exec_glValidateProgramPipeline, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib1f {
+    GLuint index;
+    GLfloat x;
+};
+
+static void exec_glVertexAttrib1f(const void* args) {
+    const struct marshal_glVertexAttrib1f* cmd = args;
+    gles_driver.core.glVertexAttrib1f(cmd->index, cmd->x);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib1f(GLuint index, GLfloat x) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib1f(index, x);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttrib1f* cmd = glthread_alloc(exec_glVertexAttrib1f, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib1fv {
+    GLuint index;
+    const GLfloat *v;
+};
+
+static void exec_glVertexAttrib1fv(const void* args) {
+    const struct marshal_glVertexAttrib1fv* cmd = args;
+    gles_driver.core.glVertexAttrib1fv(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib1fv(index, v);
+        return;
+    }
+    int glt_sync = 0;
+    size_t v_size = v ? (size_t)(1 * sizeof(*v)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(v_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glVertexAttrib1fv* cmd = glthread_alloc(exec_glVertexAttrib1fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->index = index;
+    cmd->v = glt_sync ? v : glthread_copy(&glt_tail, v, v_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib2f {
+    GLuint index;
+    GLfloat x;
+    GLfloat y;
+};
+
+static void exec_glVertexAttrib2f(const void* args) {
+    const struct marshal_glVertexAttrib2f* cmd = args;
+    gles_driver.core.glVertexAttrib2f(cmd->index, cmd->x, cmd->y);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib2f(index, x, y);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttrib2f* cmd = glthread_alloc(exec_glVertexAttrib2f, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib2fv {
+    GLuint index;
+    const GLfloat *v;
+};
+
+static void exec_glVertexAttrib2fv(const void* args) {
+    const struct marshal_glVertexAttrib2fv* cmd = args;
+    gles_driver.core.glVertexAttrib2fv(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib2fv(index, v);
+        return;
+    }
+    int glt_sync = 0;
+    size_t v_size = v ? (size_t)(2 * sizeof(*v)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(v_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glVertexAttrib2fv* cmd = glthread_alloc(exec_glVertexAttrib2fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->index = index;
+    cmd->v = glt_sync ? v : glthread_copy(&glt_tail, v, v_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib3f {
+    GLuint index;
+    GLfloat x;
+    GLfloat y;
+    GLfloat z;
+};
+
+static void exec_glVertexAttrib3f(const void* args) {
+    const struct marshal_glVertexAttrib3f* cmd = args;
+    gles_driver.core.glVertexAttrib3f(cmd->index, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib3f(index, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttrib3f* cmd = glthread_alloc(exec_glVertexAttrib3f, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib3fv {
+    GLuint index;
+    const GLfloat *v;
+};
+
+static void exec_glVertexAttrib3fv(const void* args) {
+    const struct marshal_glVertexAttrib3fv* cmd = args;
+    gles_driver.core.glVertexAttrib3fv(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib3fv(index, v);
+        return;
+    }
+    int glt_sync = 0;
+    size_t v_size = v ? (size_t)(3 * sizeof(*v)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(v_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glVertexAttrib3fv* cmd = glthread_alloc(exec_glVertexAttrib3fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->index = index;
+    cmd->v = glt_sync ? v : glthread_copy(&glt_tail, v, v_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib4f {
+    GLuint index;
+    GLfloat x;
+    GLfloat y;
+    GLfloat z;
+    GLfloat w;
+};
+
+static void exec_glVertexAttrib4f(const void* args) {
+    const struct marshal_glVertexAttrib4f* cmd = args;
+    gles_driver.core.glVertexAttrib4f(cmd->index, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib4f(index, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttrib4f* cmd = glthread_alloc(exec_glVertexAttrib4f, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttrib4fv {
+    GLuint index;
+    const GLfloat *v;
+};
+
+static void exec_glVertexAttrib4fv(const void* args) {
+    const struct marshal_glVertexAttrib4fv* cmd = args;
+    gles_driver.core.glVertexAttrib4fv(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttrib4fv(index, v);
+        return;
+    }
+    int glt_sync = 0;
+    size_t v_size = v ? (size_t)(4 * sizeof(*v)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(v_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glVertexAttrib4fv* cmd = glthread_alloc(exec_glVertexAttrib4fv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->index = index;
+    cmd->v = glt_sync ? v : glthread_copy(&glt_tail, v, v_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribBinding {
+    GLuint attribindex;
+    GLuint bindingindex;
+};
+
+static void exec_glVertexAttribBinding(const void* args) {
+    const struct marshal_glVertexAttribBinding* cmd = args;
+    gles_driver.core.glVertexAttribBinding(cmd->attribindex, cmd->bindingindex);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribBinding(attribindex, bindingindex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribBinding* cmd = glthread_alloc(exec_glVertexAttribBinding, sizeof(*cmd));
+    cmd->attribindex = attribindex;
+    cmd->bindingindex = bindingindex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribDivisor {
+    GLuint index;
+    GLuint divisor;
+};
+
+static void exec_glVertexAttribDivisor(const void* args) {
+    const struct marshal_glVertexAttribDivisor* cmd = args;
+    gles_driver.core.glVertexAttribDivisor(cmd->index, cmd->divisor);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribDivisor(index, divisor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribDivisor* cmd = glthread_alloc(exec_glVertexAttribDivisor, sizeof(*cmd));
+    cmd->index = index;
+    cmd->divisor = divisor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribFormat {
+    GLuint attribindex;
+    GLint size;
+    GLenum type;
+    GLboolean normalized;
+    GLuint relativeoffset;
+};
+
+static void exec_glVertexAttribFormat(const void* args) {
+    const struct marshal_glVertexAttribFormat* cmd = args;
+    gles_driver.core.glVertexAttribFormat(cmd->attribindex, cmd->size, cmd->type, cmd->normalized, cmd->relativeoffset);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribFormat* cmd = glthread_alloc(exec_glVertexAttribFormat, sizeof(*cmd));
+    cmd->attribindex = attribindex;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->normalized = normalized;
+    cmd->relativeoffset = relativeoffset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribI4i {
+    GLuint index;
+    GLint x;
+    GLint y;
+    GLint z;
+    GLint w;
+};
+
+static void exec_glVertexAttribI4i(const void* args) {
+    const struct marshal_glVertexAttribI4i* cmd = args;
+    gles_driver.core.glVertexAttribI4i(cmd->index, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribI4i(index, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribI4i* cmd = glthread_alloc(exec_glVertexAttribI4i, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribI4iv {
+    GLuint index;
+    const GLint *v;
+};
+
+static void exec_glVertexAttribI4iv(const void* args) {
+    const struct marshal_glVertexAttribI4iv* cmd = args;
+    gles_driver.core.glVertexAttribI4iv(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribI4iv(index, v);
+        return;
+    }
+    int glt_sync = 0;
+    size_t v_size = v ? (size_t)(4 * sizeof(*v)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(v_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glVertexAttribI4iv* cmd = glthread_alloc(exec_glVertexAttribI4iv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->index = index;
+    cmd->v = glt_sync ? v : glthread_copy(&glt_tail, v, v_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribI4ui {
+    GLuint index;
+    GLuint x;
+    GLuint y;
+    GLuint z;
+    GLuint w;
+};
+
+static void exec_glVertexAttribI4ui(const void* args) {
+    const struct marshal_glVertexAttribI4ui* cmd = args;
+    gles_driver.core.glVertexAttribI4ui(cmd->index, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribI4ui(index, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribI4ui* cmd = glthread_alloc(exec_glVertexAttribI4ui, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribI4uiv {
+    GLuint index;
+    const GLuint *v;
+};
+
+static void exec_glVertexAttribI4uiv(const void* args) {
+    const struct marshal_glVertexAttribI4uiv* cmd = args;
+    gles_driver.core.glVertexAttribI4uiv(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribI4uiv(index, v);
+        return;
+    }
+    int glt_sync = 0;
+    size_t v_size = v ? (size_t)(4 * sizeof(*v)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(v_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glVertexAttribI4uiv* cmd = glthread_alloc(exec_glVertexAttribI4uiv, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->index = index;
+    cmd->v = glt_sync ? v : glthread_copy(&glt_tail, v, v_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribIFormat {
+    GLuint attribindex;
+    GLint size;
+    GLenum type;
+    GLuint relativeoffset;
+};
+
+static void exec_glVertexAttribIFormat(const void* args) {
+    const struct marshal_glVertexAttribIFormat* cmd = args;
+    gles_driver.core.glVertexAttribIFormat(cmd->attribindex, cmd->size, cmd->type, cmd->relativeoffset);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribIFormat* cmd = glthread_alloc(exec_glVertexAttribIFormat, sizeof(*cmd));
+    cmd->attribindex = attribindex;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->relativeoffset = relativeoffset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribIPointer {
+    GLuint index;
+    GLint size;
+    GLenum type;
+    GLsizei stride;
+    const void *pointer;
+};
+
+static void exec_glVertexAttribIPointer(const void* args) {
+    const struct marshal_glVertexAttribIPointer* cmd = args;
+    gles_driver.core.glVertexAttribIPointer(cmd->index, cmd->size, cmd->type, cmd->stride, cmd->pointer);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribIPointer(index, size, type, stride, pointer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribIPointer* cmd = glthread_alloc(exec_glVertexAttribIPointer, sizeof(*cmd));
+    cmd->index = index;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->stride = stride;
+    cmd->pointer = pointer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribPointer {
+    GLuint index;
+    GLint size;
+    GLenum type;
+    GLboolean normalized;
+    GLsizei stride;
+    const void *pointer;
+};
+
+static void exec_glVertexAttribPointer(const void* args) {
+    const struct marshal_glVertexAttribPointer* cmd = args;
+    gles_driver.core.glVertexAttribPointer(cmd->index, cmd->size, cmd->type, cmd->normalized, cmd->stride, cmd->pointer);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribPointer* cmd = glthread_alloc(exec_glVertexAttribPointer, sizeof(*cmd));
+    cmd->index = index;
+    cmd->size = size;
+    cmd->type = type;
+    cmd->normalized = normalized;
+    cmd->stride = stride;
+    cmd->pointer = pointer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexBindingDivisor {
+    GLuint bindingindex;
+    GLuint divisor;
+};
+
+static void exec_glVertexBindingDivisor(const void* args) {
+    const struct marshal_glVertexBindingDivisor* cmd = args;
+    gles_driver.core.glVertexBindingDivisor(cmd->bindingindex, cmd->divisor);
+}
+
+static void GL_APIENTRY marshal_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    if (!glthread_active()) {
+        gles_driver.core.glVertexBindingDivisor(bindingindex, divisor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexBindingDivisor* cmd = glthread_alloc(exec_glVertexBindingDivisor, sizeof(*cmd));
+    cmd->bindingindex = bindingindex;
+    cmd->divisor = divisor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glViewport {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glViewport(const void* args) {
+    const struct marshal_glViewport* cmd = args;
+    gles_driver.core.glViewport(cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.core.glViewport(x, y, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glViewport* cmd = glthread_alloc(exec_glViewport, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glWaitSync {
+    GLsync sync;
+    GLbitfield flags;
+    GLuint64 timeout;
+};
+
+static void exec_glWaitSync(const void* args) {
+    const struct marshal_glWaitSync* cmd = args;
+    gles_driver.core.glWaitSync(cmd->sync, cmd->flags, cmd->timeout);
+}
+
+static void GL_APIENTRY marshal_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (!glthread_active()) {
+        gles_driver.core.glWaitSync(sync, flags, timeout);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glWaitSync* cmd = glthread_alloc(exec_glWaitSync, sizeof(*cmd));
+    cmd->sync = sync;
+    cmd->flags = flags;
+    cmd->timeout = timeout;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glActiveShaderProgramEXT {
+    GLuint pipeline;
+    GLuint program;
+};
+
+static void exec_glActiveShaderProgramEXT(const void* args) {
+    const struct marshal_glActiveShaderProgramEXT* cmd = args;
+    gles_driver.ext.glActiveShaderProgramEXT(cmd->pipeline, cmd->program);
+}
+
+static void GL_APIENTRY marshal_glActiveShaderProgramEXT(GLuint pipeline, GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.ext.glActiveShaderProgramEXT(pipeline, program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glActiveShaderProgramEXT* cmd = glthread_alloc(exec_glActiveShaderProgramEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glAlphaFuncQCOM {
+    GLenum func;
+    GLclampf ref;
+};
+
+static void exec_glAlphaFuncQCOM(const void* args) {
+    const struct marshal_glAlphaFuncQCOM* cmd = args;
+    gles_driver.ext.glAlphaFuncQCOM(cmd->func, cmd->ref);
+}
+
+static void GL_APIENTRY marshal_glAlphaFuncQCOM(GLenum func, GLclampf ref) {
+    if (!glthread_active()) {
+        gles_driver.ext.glAlphaFuncQCOM(func, ref);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glAlphaFuncQCOM* cmd = glthread_alloc(exec_glAlphaFuncQCOM, sizeof(*cmd));
+    cmd->func = func;
+    cmd->ref = ref;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glApplyFramebufferAttachmentCMAAINTEL {
+    char unused;
+};
+
+static void exec_glApplyFramebufferAttachmentCMAAINTEL(const void* args) {
+    (void)args;
+    gles_driver.ext.glApplyFramebufferAttachmentCMAAINTEL();
+}
+
+static void GL_APIENTRY marshal_glApplyFramebufferAttachmentCMAAINTEL(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glApplyFramebufferAttachmentCMAAINTEL();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glApplyFramebufferAttachmentCMAAINTEL* cmd = glthread_alloc(exec_glApplyFramebufferAttachmentCMAAINTEL, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBeginConditionalRenderNV {
+    GLuint id;
+    GLenum mode;
+};
+
+static void exec_glBeginConditionalRenderNV(const void* args) {
+    const struct marshal_glBeginConditionalRenderNV* cmd = args;
+    gles_driver.ext.glBeginConditionalRenderNV(cmd->id, cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glBeginConditionalRenderNV(GLuint id, GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBeginConditionalRenderNV(id, mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBeginConditionalRenderNV* cmd = glthread_alloc(exec_glBeginConditionalRenderNV, sizeof(*cmd));
+    cmd->id = id;
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBeginPerfMonitorAMD {
+    GLuint monitor;
+};
+
+static void exec_glBeginPerfMonitorAMD(const void* args) {
+    const struct marshal_glBeginPerfMonitorAMD* cmd = args;
+    gles_driver.ext.glBeginPerfMonitorAMD(cmd->monitor);
+}
+
+static void GL_APIENTRY marshal_glBeginPerfMonitorAMD(GLuint monitor) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBeginPerfMonitorAMD(monitor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBeginPerfMonitorAMD* cmd = glthread_alloc(exec_glBeginPerfMonitorAMD, sizeof(*cmd));
+    cmd->monitor = monitor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBeginPerfQueryINTEL {
+    GLuint queryHandle;
+};
+
+static void exec_glBeginPerfQueryINTEL(const void* args) {
+    const struct marshal_glBeginPerfQueryINTEL* cmd = args;
+    gles_driver.ext.glBeginPerfQueryINTEL(cmd->queryHandle);
+}
+
+static void GL_APIENTRY marshal_glBeginPerfQueryINTEL(GLuint queryHandle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBeginPerfQueryINTEL(queryHandle);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBeginPerfQueryINTEL* cmd = glthread_alloc(exec_glBeginPerfQueryINTEL, sizeof(*cmd));
+    cmd->queryHandle = queryHandle;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBeginQueryEXT {
+    GLenum target;
+    GLuint id;
+};
+
+static void exec_glBeginQueryEXT(const void* args) {
+    const struct marshal_glBeginQueryEXT* cmd = args;
+    gles_driver.ext.glBeginQueryEXT(cmd->target, cmd->id);
+}
+
+static void GL_APIENTRY marshal_glBeginQueryEXT(GLenum target, GLuint id) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBeginQueryEXT(target, id);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBeginQueryEXT* cmd = glthread_alloc(exec_glBeginQueryEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->id = id;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindFragDataLocationEXT {
+    GLuint program;
+    GLuint color;
+    const GLchar *name;
+};
+
+static void exec_glBindFragDataLocationEXT(const void* args) {
+    const struct marshal_glBindFragDataLocationEXT* cmd = args;
+    gles_driver.ext.glBindFragDataLocationEXT(cmd->program, cmd->color, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glBindFragDataLocationEXT(GLuint program, GLuint color, const GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBindFragDataLocationEXT(program, color, name);
+        return;
+    }
+    struct marshal_glBindFragDataLocationEXT* cmd = glthread_alloc(exec_glBindFragDataLocationEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->color = color;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glBindFragDataLocationIndexedEXT {
+    GLuint program;
+    GLuint colorNumber;
+    GLuint index;
+    const GLchar *name;
+};
+
+static void exec_glBindFragDataLocationIndexedEXT(const void* args) {
+    const struct marshal_glBindFragDataLocationIndexedEXT* cmd = args;
+    gles_driver.ext.glBindFragDataLocationIndexedEXT(cmd->program, cmd->colorNumber, cmd->index, cmd->name);
+}
+
+static void GL_APIENTRY marshal_glBindFragDataLocationIndexedEXT(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBindFragDataLocationIndexedEXT(program, colorNumber, index, name);
+        return;
+    }
+    struct marshal_glBindFragDataLocationIndexedEXT* cmd = glthread_alloc(exec_glBindFragDataLocationIndexedEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->colorNumber = colorNumber;
+    cmd->index = index;
+    cmd->name = name;
+    glthread_sync();
+}
+
+struct marshal_glBindProgramPipelineEXT {
+    GLuint pipeline;
+};
+
+static void exec_glBindProgramPipelineEXT(const void* args) {
+    const struct marshal_glBindProgramPipelineEXT* cmd = args;
+    gles_driver.ext.glBindProgramPipelineEXT(cmd->pipeline);
+}
+
+static void GL_APIENTRY marshal_glBindProgramPipelineEXT(GLuint pipeline) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBindProgramPipelineEXT(pipeline);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindProgramPipelineEXT* cmd = glthread_alloc(exec_glBindProgramPipelineEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBindVertexArrayOES {
+    GLuint array;
+};
+
+static void exec_glBindVertexArrayOES(const void* args) {
+    const struct marshal_glBindVertexArrayOES* cmd = args;
+    gles_driver.ext.glBindVertexArrayOES(cmd->array);
+}
+
+static void GL_APIENTRY marshal_glBindVertexArrayOES(GLuint array) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBindVertexArrayOES(array);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBindVertexArrayOES* cmd = glthread_alloc(exec_glBindVertexArrayOES, sizeof(*cmd));
+    cmd->array = array;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendBarrierKHR {
+    char unused;
+};
+
+static void exec_glBlendBarrierKHR(const void* args) {
+    (void)args;
+    gles_driver.ext.glBlendBarrierKHR();
+}
+
+static void GL_APIENTRY marshal_glBlendBarrierKHR(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendBarrierKHR();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendBarrierKHR* cmd = glthread_alloc(exec_glBlendBarrierKHR, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendBarrierNV {
+    char unused;
+};
+
+static void exec_glBlendBarrierNV(const void* args) {
+    (void)args;
+    gles_driver.ext.glBlendBarrierNV();
+}
+
+static void GL_APIENTRY marshal_glBlendBarrierNV(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendBarrierNV();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendBarrierNV* cmd = glthread_alloc(exec_glBlendBarrierNV, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationSeparateiEXT {
+    GLuint buf;
+    GLenum modeRGB;
+    GLenum modeAlpha;
+};
+
+static void exec_glBlendEquationSeparateiEXT(const void* args) {
+    const struct marshal_glBlendEquationSeparateiEXT* cmd = args;
+    gles_driver.ext.glBlendEquationSeparateiEXT(cmd->buf, cmd->modeRGB, cmd->modeAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationSeparateiEXT(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendEquationSeparateiEXT(buf, modeRGB, modeAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationSeparateiEXT* cmd = glthread_alloc(exec_glBlendEquationSeparateiEXT, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->modeRGB = modeRGB;
+    cmd->modeAlpha = modeAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationSeparateiOES {
+    GLuint buf;
+    GLenum modeRGB;
+    GLenum modeAlpha;
+};
+
+static void exec_glBlendEquationSeparateiOES(const void* args) {
+    const struct marshal_glBlendEquationSeparateiOES* cmd = args;
+    gles_driver.ext.glBlendEquationSeparateiOES(cmd->buf, cmd->modeRGB, cmd->modeAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationSeparateiOES(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendEquationSeparateiOES(buf, modeRGB, modeAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationSeparateiOES* cmd = glthread_alloc(exec_glBlendEquationSeparateiOES, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->modeRGB = modeRGB;
+    cmd->modeAlpha = modeAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationiEXT {
+    GLuint buf;
+    GLenum mode;
+};
+
+static void exec_glBlendEquationiEXT(const void* args) {
+    const struct marshal_glBlendEquationiEXT* cmd = args;
+    gles_driver.ext.glBlendEquationiEXT(cmd->buf, cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationiEXT(GLuint buf, GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendEquationiEXT(buf, mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationiEXT* cmd = glthread_alloc(exec_glBlendEquationiEXT, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendEquationiOES {
+    GLuint buf;
+    GLenum mode;
+};
+
+static void exec_glBlendEquationiOES(const void* args) {
+    const struct marshal_glBlendEquationiOES* cmd = args;
+    gles_driver.ext.glBlendEquationiOES(cmd->buf, cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glBlendEquationiOES(GLuint buf, GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendEquationiOES(buf, mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendEquationiOES* cmd = glthread_alloc(exec_glBlendEquationiOES, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFuncSeparateiEXT {
+    GLuint buf;
+    GLenum srcRGB;
+    GLenum dstRGB;
+    GLenum srcAlpha;
+    GLenum dstAlpha;
+};
+
+static void exec_glBlendFuncSeparateiEXT(const void* args) {
+    const struct marshal_glBlendFuncSeparateiEXT* cmd = args;
+    gles_driver.ext.glBlendFuncSeparateiEXT(cmd->buf, cmd->srcRGB, cmd->dstRGB, cmd->srcAlpha, cmd->dstAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendFuncSeparateiEXT(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendFuncSeparateiEXT(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFuncSeparateiEXT* cmd = glthread_alloc(exec_glBlendFuncSeparateiEXT, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->srcRGB = srcRGB;
+    cmd->dstRGB = dstRGB;
+    cmd->srcAlpha = srcAlpha;
+    cmd->dstAlpha = dstAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFuncSeparateiOES {
+    GLuint buf;
+    GLenum srcRGB;
+    GLenum dstRGB;
+    GLenum srcAlpha;
+    GLenum dstAlpha;
+};
+
+static void exec_glBlendFuncSeparateiOES(const void* args) {
+    const struct marshal_glBlendFuncSeparateiOES* cmd = args;
+    gles_driver.ext.glBlendFuncSeparateiOES(cmd->buf, cmd->srcRGB, cmd->dstRGB, cmd->srcAlpha, cmd->dstAlpha);
+}
+
+static void GL_APIENTRY marshal_glBlendFuncSeparateiOES(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendFuncSeparateiOES(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFuncSeparateiOES* cmd = glthread_alloc(exec_glBlendFuncSeparateiOES, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->srcRGB = srcRGB;
+    cmd->dstRGB = dstRGB;
+    cmd->srcAlpha = srcAlpha;
+    cmd->dstAlpha = dstAlpha;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFunciEXT {
+    GLuint buf;
+    GLenum src;
+    GLenum dst;
+};
+
+static void exec_glBlendFunciEXT(const void* args) {
+    const struct marshal_glBlendFunciEXT* cmd = args;
+    gles_driver.ext.glBlendFunciEXT(cmd->buf, cmd->src, cmd->dst);
+}
+
+static void GL_APIENTRY marshal_glBlendFunciEXT(GLuint buf, GLenum src, GLenum dst) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendFunciEXT(buf, src, dst);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFunciEXT* cmd = glthread_alloc(exec_glBlendFunciEXT, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->src = src;
+    cmd->dst = dst;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendFunciOES {
+    GLuint buf;
+    GLenum src;
+    GLenum dst;
+};
+
+static void exec_glBlendFunciOES(const void* args) {
+    const struct marshal_glBlendFunciOES* cmd = args;
+    gles_driver.ext.glBlendFunciOES(cmd->buf, cmd->src, cmd->dst);
+}
+
+static void GL_APIENTRY marshal_glBlendFunciOES(GLuint buf, GLenum src, GLenum dst) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendFunciOES(buf, src, dst);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendFunciOES* cmd = glthread_alloc(exec_glBlendFunciOES, sizeof(*cmd));
+    cmd->buf = buf;
+    cmd->src = src;
+    cmd->dst = dst;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlendParameteriNV {
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glBlendParameteriNV(const void* args) {
+    const struct marshal_glBlendParameteriNV* cmd = args;
+    gles_driver.ext.glBlendParameteriNV(cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glBlendParameteriNV(GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlendParameteriNV(pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlendParameteriNV* cmd = glthread_alloc(exec_glBlendParameteriNV, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlitFramebufferANGLE {
+    GLint srcX0;
+    GLint srcY0;
+    GLint srcX1;
+    GLint srcY1;
+    GLint dstX0;
+    GLint dstY0;
+    GLint dstX1;
+    GLint dstY1;
+    GLbitfield mask;
+    GLenum filter;
+};
+
+static void exec_glBlitFramebufferANGLE(const void* args) {
+    const struct marshal_glBlitFramebufferANGLE* cmd = args;
+    gles_driver.ext.glBlitFramebufferANGLE(cmd->srcX0, cmd->srcY0, cmd->srcX1, cmd->srcY1, cmd->dstX0, cmd->dstY0, cmd->dstX1, cmd->dstY1, cmd->mask, cmd->filter);
+}
+
+static void GL_APIENTRY marshal_glBlitFramebufferANGLE(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlitFramebufferANGLE(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlitFramebufferANGLE* cmd = glthread_alloc(exec_glBlitFramebufferANGLE, sizeof(*cmd));
+    cmd->srcX0 = srcX0;
+    cmd->srcY0 = srcY0;
+    cmd->srcX1 = srcX1;
+    cmd->srcY1 = srcY1;
+    cmd->dstX0 = dstX0;
+    cmd->dstY0 = dstY0;
+    cmd->dstX1 = dstX1;
+    cmd->dstY1 = dstY1;
+    cmd->mask = mask;
+    cmd->filter = filter;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBlitFramebufferNV {
+    GLint srcX0;
+    GLint srcY0;
+    GLint srcX1;
+    GLint srcY1;
+    GLint dstX0;
+    GLint dstY0;
+    GLint dstX1;
+    GLint dstY1;
+    GLbitfield mask;
+    GLenum filter;
+};
+
+static void exec_glBlitFramebufferNV(const void* args) {
+    const struct marshal_glBlitFramebufferNV* cmd = args;
+    gles_driver.ext.glBlitFramebufferNV(cmd->srcX0, cmd->srcY0, cmd->srcX1, cmd->srcY1, cmd->dstX0, cmd->dstY0, cmd->dstX1, cmd->dstY1, cmd->mask, cmd->filter);
+}
+
+static void GL_APIENTRY marshal_glBlitFramebufferNV(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBlitFramebufferNV(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBlitFramebufferNV* cmd = glthread_alloc(exec_glBlitFramebufferNV, sizeof(*cmd));
+    cmd->srcX0 = srcX0;
+    cmd->srcY0 = srcY0;
+    cmd->srcX1 = srcX1;
+    cmd->srcY1 = srcY1;
+    cmd->dstX0 = dstX0;
+    cmd->dstY0 = dstY0;
+    cmd->dstX1 = dstX1;
+    cmd->dstY1 = dstY1;
+    cmd->mask = mask;
+    cmd->filter = filter;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBufferStorageEXT {
+    GLenum target;
+    GLsizeiptr size;
+    const void *data;
+    GLbitfield flags;
+};
+
+static void exec_glBufferStorageEXT(const void* args) {
+    const struct marshal_glBufferStorageEXT* cmd = args;
+    gles_driver.ext.glBufferStorageEXT(cmd->target, cmd->size, cmd->data, cmd->flags);
+}
+
+static void GL_APIENTRY marshal_glBufferStorageEXT(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBufferStorageEXT(target, size, data, flags);
+        return;
+    }
+    struct marshal_glBufferStorageEXT* cmd = glthread_alloc(exec_glBufferStorageEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->size = size;
+    cmd->data = data;
+    cmd->flags = flags;
+    glthread_sync();
+}
+
+struct marshal_glBufferStorageExternalEXT {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr size;
+    GLeglClientBufferEXT clientBuffer;
+    GLbitfield flags;
+};
+
+static void exec_glBufferStorageExternalEXT(const void* args) {
+    const struct marshal_glBufferStorageExternalEXT* cmd = args;
+    gles_driver.ext.glBufferStorageExternalEXT(cmd->target, cmd->offset, cmd->size, cmd->clientBuffer, cmd->flags);
+}
+
+static void GL_APIENTRY marshal_glBufferStorageExternalEXT(GLenum target, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBufferStorageExternalEXT(target, offset, size, clientBuffer, flags);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBufferStorageExternalEXT* cmd = glthread_alloc(exec_glBufferStorageExternalEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->size = size;
+    cmd->clientBuffer = clientBuffer;
+    cmd->flags = flags;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glBufferStorageMemEXT {
+    GLenum target;
+    GLsizeiptr size;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glBufferStorageMemEXT(const void* args) {
+    const struct marshal_glBufferStorageMemEXT* cmd = args;
+    gles_driver.ext.glBufferStorageMemEXT(cmd->target, cmd->size, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glBufferStorageMemEXT(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glBufferStorageMemEXT(target, size, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glBufferStorageMemEXT* cmd = glthread_alloc(exec_glBufferStorageMemEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->size = size;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glClearPixelLocalStorageuiEXT {
+    GLsizei offset;
+    GLsizei n;
+    const GLuint *values;
+};
+
+static void exec_glClearPixelLocalStorageuiEXT(const void* args) {
+    const struct marshal_glClearPixelLocalStorageuiEXT* cmd = args;
+    gles_driver.ext.glClearPixelLocalStorageuiEXT(cmd->offset, cmd->n, cmd->values);
+}
+
+static void GL_APIENTRY marshal_glClearPixelLocalStorageuiEXT(GLsizei offset, GLsizei n, const GLuint *values) {
+    if (!glthread_active()) {
+        gles_driver.ext.glClearPixelLocalStorageuiEXT(offset, n, values);
+        return;
+    }
+    struct marshal_glClearPixelLocalStorageuiEXT* cmd = glthread_alloc(exec_glClearPixelLocalStorageuiEXT, sizeof(*cmd));
+    cmd->offset = offset;
+    cmd->n = n;
+    cmd->values = values;
+    glthread_sync();
+}
+
+struct marshal_glClearTexImageEXT {
+    GLuint texture;
+    GLint level;
+    GLenum format;
+    GLenum type;
+    const void *data;
+};
+
+static void exec_glClearTexImageEXT(const void* args) {
+    const struct marshal_glClearTexImageEXT* cmd = args;
+    gles_driver.ext.glClearTexImageEXT(cmd->texture, cmd->level, cmd->format, cmd->type, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glClearTexImageEXT(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glClearTexImageEXT(texture, level, format, type, data);
+        return;
+    }
+    struct marshal_glClearTexImageEXT* cmd = glthread_alloc(exec_glClearTexImageEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glClearTexSubImageEXT {
+    GLuint texture;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLenum format;
+    GLenum type;
+    const void *data;
+};
+
+static void exec_glClearTexSubImageEXT(const void* args) {
+    const struct marshal_glClearTexSubImageEXT* cmd = args;
+    gles_driver.ext.glClearTexSubImageEXT(cmd->texture, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->format, cmd->type, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glClearTexSubImageEXT(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glClearTexSubImageEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+        return;
+    }
+    struct marshal_glClearTexSubImageEXT* cmd = glthread_alloc(exec_glClearTexSubImageEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glClientWaitSyncAPPLE {
+    GLsync sync;
+    GLbitfield flags;
+    GLuint64 timeout;
+    GLenum *result;
+};
+
+static void exec_glClientWaitSyncAPPLE(const void* args) {
+    const struct marshal_glClientWaitSyncAPPLE* cmd = args;
+    *cmd->result = gles_driver.ext.glClientWaitSyncAPPLE(cmd->sync, cmd->flags, cmd->timeout);
+}
+
+static GLenum GL_APIENTRY marshal_glClientWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (!glthread_active()) return gles_driver.ext.glClientWaitSyncAPPLE(sync, flags, timeout);
+    struct marshal_glClientWaitSyncAPPLE* cmd = glthread_alloc(exec_glClientWaitSyncAPPLE, sizeof(*cmd));
+    cmd->sync = sync;
+    cmd->flags = flags;
+    cmd->timeout = timeout;
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glClipControlEXT {
+    GLenum origin;
+    GLenum depth;
+};
+
+static void exec_glClipControlEXT(const void* args) {
+    const struct marshal_glClipControlEXT* cmd = args;
+    gles_driver.ext.glClipControlEXT(cmd->origin, cmd->depth);
+}
+
+static void GL_APIENTRY marshal_glClipControlEXT(GLenum origin, GLenum depth) {
+    if (!glthread_active()) {
+        gles_driver.ext.glClipControlEXT(origin, depth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glClipControlEXT* cmd = glthread_alloc(exec_glClipControlEXT, sizeof(*cmd));
+    cmd->origin = origin;
+    cmd->depth = depth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glColorMaskiEXT {
+    GLuint index;
+    GLboolean r;
+    GLboolean g;
+    GLboolean b;
+    GLboolean a;
+};
+
+static void exec_glColorMaskiEXT(const void* args) {
+    const struct marshal_glColorMaskiEXT* cmd = args;
+    gles_driver.ext.glColorMaskiEXT(cmd->index, cmd->r, cmd->g, cmd->b, cmd->a);
+}
+
+static void GL_APIENTRY marshal_glColorMaskiEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    if (!glthread_active()) {
+        gles_driver.ext.glColorMaskiEXT(index, r, g, b, a);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glColorMaskiEXT* cmd = glthread_alloc(exec_glColorMaskiEXT, sizeof(*cmd));
+    cmd->index = index;
+    cmd->r = r;
+    cmd->g = g;
+    cmd->b = b;
+    cmd->a = a;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glColorMaskiOES {
+    GLuint index;
+    GLboolean r;
+    GLboolean g;
+    GLboolean b;
+    GLboolean a;
+};
+
+static void exec_glColorMaskiOES(const void* args) {
+    const struct marshal_glColorMaskiOES* cmd = args;
+    gles_driver.ext.glColorMaskiOES(cmd->index, cmd->r, cmd->g, cmd->b, cmd->a);
+}
+
+static void GL_APIENTRY marshal_glColorMaskiOES(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    if (!glthread_active()) {
+        gles_driver.ext.glColorMaskiOES(index, r, g, b, a);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glColorMaskiOES* cmd = glthread_alloc(exec_glColorMaskiOES, sizeof(*cmd));
+    cmd->index = index;
+    cmd->r = r;
+    cmd->g = g;
+    cmd->b = b;
+    cmd->a = a;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompressedTexImage3DOES {
+    GLenum target;
+    GLint level;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLint border;
+    GLsizei imageSize;
+    const void *data;
+};
+
+static void exec_glCompressedTexImage3DOES(const void* args) {
+    const struct marshal_glCompressedTexImage3DOES* cmd = args;
+    gles_driver.ext.glCompressedTexImage3DOES(cmd->target, cmd->level, cmd->internalformat, cmd->width, cmd->height, cmd->depth, cmd->border, cmd->imageSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glCompressedTexImage3DOES(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCompressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
+        return;
+    }
+    int glt_sync = 0;
+    int data_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= data_bound < 0;
+    size_t data_size = data_bound || !data ? 0 : (size_t)(imageSize);
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glCompressedTexImage3DOES* cmd = glthread_alloc(exec_glCompressedTexImage3DOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->border = border;
+    cmd->imageSize = imageSize;
+    cmd->data = glt_sync || data_bound ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCompressedTexSubImage3DOES {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLenum format;
+    GLsizei imageSize;
+    const void *data;
+};
+
+static void exec_glCompressedTexSubImage3DOES(const void* args) {
+    const struct marshal_glCompressedTexSubImage3DOES* cmd = args;
+    gles_driver.ext.glCompressedTexSubImage3DOES(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->format, cmd->imageSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glCompressedTexSubImage3DOES(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCompressedTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+        return;
+    }
+    int glt_sync = 0;
+    int data_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= data_bound < 0;
+    size_t data_size = data_bound || !data ? 0 : (size_t)(imageSize);
+    size_t glt_copy_size = GLTHREAD_ALIGN(data_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glCompressedTexSubImage3DOES* cmd = glthread_alloc(exec_glCompressedTexSubImage3DOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->format = format;
+    cmd->imageSize = imageSize;
+    cmd->data = glt_sync || data_bound ? data : glthread_copy(&glt_tail, data, data_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glConservativeRasterParameteriNV {
+    GLenum pname;
+    GLint param;
+};
+
+static void exec_glConservativeRasterParameteriNV(const void* args) {
+    const struct marshal_glConservativeRasterParameteriNV* cmd = args;
+    gles_driver.ext.glConservativeRasterParameteriNV(cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glConservativeRasterParameteriNV(GLenum pname, GLint param) {
+    if (!glthread_active()) {
+        gles_driver.ext.glConservativeRasterParameteriNV(pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glConservativeRasterParameteriNV* cmd = glthread_alloc(exec_glConservativeRasterParameteriNV, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyBufferSubDataNV {
+    GLenum readTarget;
+    GLenum writeTarget;
+    GLintptr readOffset;
+    GLintptr writeOffset;
+    GLsizeiptr size;
+};
+
+static void exec_glCopyBufferSubDataNV(const void* args) {
+    const struct marshal_glCopyBufferSubDataNV* cmd = args;
+    gles_driver.ext.glCopyBufferSubDataNV(cmd->readTarget, cmd->writeTarget, cmd->readOffset, cmd->writeOffset, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glCopyBufferSubDataNV(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCopyBufferSubDataNV(readTarget, writeTarget, readOffset, writeOffset, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyBufferSubDataNV* cmd = glthread_alloc(exec_glCopyBufferSubDataNV, sizeof(*cmd));
+    cmd->readTarget = readTarget;
+    cmd->writeTarget = writeTarget;
+    cmd->readOffset = readOffset;
+    cmd->writeOffset = writeOffset;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyImageSubDataEXT {
+    GLuint srcName;
+    GLenum srcTarget;
+    GLint srcLevel;
+    GLint srcX;
+    GLint srcY;
+    GLint srcZ;
+    GLuint dstName;
+    GLenum dstTarget;
+    GLint dstLevel;
+    GLint dstX;
+    GLint dstY;
+    GLint dstZ;
+    GLsizei srcWidth;
+    GLsizei srcHeight;
+    GLsizei srcDepth;
+};
+
+static void exec_glCopyImageSubDataEXT(const void* args) {
+    const struct marshal_glCopyImageSubDataEXT* cmd = args;
+    gles_driver.ext.glCopyImageSubDataEXT(cmd->srcName, cmd->srcTarget, cmd->srcLevel, cmd->srcX, cmd->srcY, cmd->srcZ, cmd->dstName, cmd->dstTarget, cmd->dstLevel, cmd->dstX, cmd->dstY, cmd->dstZ, cmd->srcWidth, cmd->srcHeight, cmd->srcDepth);
+}
+
+static void GL_APIENTRY marshal_glCopyImageSubDataEXT(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCopyImageSubDataEXT(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyImageSubDataEXT* cmd = glthread_alloc(exec_glCopyImageSubDataEXT, sizeof(*cmd));
+    cmd->srcName = srcName;
+    cmd->srcTarget = srcTarget;
+    cmd->srcLevel = srcLevel;
+    cmd->srcX = srcX;
+    cmd->srcY = srcY;
+    cmd->srcZ = srcZ;
+    cmd->dstName = dstName;
+    cmd->dstTarget = dstTarget;
+    cmd->dstLevel = dstLevel;
+    cmd->dstX = dstX;
+    cmd->dstY = dstY;
+    cmd->dstZ = dstZ;
+    cmd->srcWidth = srcWidth;
+    cmd->srcHeight = srcHeight;
+    cmd->srcDepth = srcDepth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyImageSubDataOES {
+    GLuint srcName;
+    GLenum srcTarget;
+    GLint srcLevel;
+    GLint srcX;
+    GLint srcY;
+    GLint srcZ;
+    GLuint dstName;
+    GLenum dstTarget;
+    GLint dstLevel;
+    GLint dstX;
+    GLint dstY;
+    GLint dstZ;
+    GLsizei srcWidth;
+    GLsizei srcHeight;
+    GLsizei srcDepth;
+};
+
+static void exec_glCopyImageSubDataOES(const void* args) {
+    const struct marshal_glCopyImageSubDataOES* cmd = args;
+    gles_driver.ext.glCopyImageSubDataOES(cmd->srcName, cmd->srcTarget, cmd->srcLevel, cmd->srcX, cmd->srcY, cmd->srcZ, cmd->dstName, cmd->dstTarget, cmd->dstLevel, cmd->dstX, cmd->dstY, cmd->dstZ, cmd->srcWidth, cmd->srcHeight, cmd->srcDepth);
+}
+
+static void GL_APIENTRY marshal_glCopyImageSubDataOES(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCopyImageSubDataOES(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyImageSubDataOES* cmd = glthread_alloc(exec_glCopyImageSubDataOES, sizeof(*cmd));
+    cmd->srcName = srcName;
+    cmd->srcTarget = srcTarget;
+    cmd->srcLevel = srcLevel;
+    cmd->srcX = srcX;
+    cmd->srcY = srcY;
+    cmd->srcZ = srcZ;
+    cmd->dstName = dstName;
+    cmd->dstTarget = dstTarget;
+    cmd->dstLevel = dstLevel;
+    cmd->dstX = dstX;
+    cmd->dstY = dstY;
+    cmd->dstZ = dstZ;
+    cmd->srcWidth = srcWidth;
+    cmd->srcHeight = srcHeight;
+    cmd->srcDepth = srcDepth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyPathNV {
+    GLuint resultPath;
+    GLuint srcPath;
+};
+
+static void exec_glCopyPathNV(const void* args) {
+    const struct marshal_glCopyPathNV* cmd = args;
+    gles_driver.ext.glCopyPathNV(cmd->resultPath, cmd->srcPath);
+}
+
+static void GL_APIENTRY marshal_glCopyPathNV(GLuint resultPath, GLuint srcPath) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCopyPathNV(resultPath, srcPath);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyPathNV* cmd = glthread_alloc(exec_glCopyPathNV, sizeof(*cmd));
+    cmd->resultPath = resultPath;
+    cmd->srcPath = srcPath;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyTexSubImage3DOES {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glCopyTexSubImage3DOES(const void* args) {
+    const struct marshal_glCopyTexSubImage3DOES* cmd = args;
+    gles_driver.ext.glCopyTexSubImage3DOES(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glCopyTexSubImage3DOES(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCopyTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyTexSubImage3DOES* cmd = glthread_alloc(exec_glCopyTexSubImage3DOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCopyTextureLevelsAPPLE {
+    GLuint destinationTexture;
+    GLuint sourceTexture;
+    GLint sourceBaseLevel;
+    GLsizei sourceLevelCount;
+};
+
+static void exec_glCopyTextureLevelsAPPLE(const void* args) {
+    const struct marshal_glCopyTextureLevelsAPPLE* cmd = args;
+    gles_driver.ext.glCopyTextureLevelsAPPLE(cmd->destinationTexture, cmd->sourceTexture, cmd->sourceBaseLevel, cmd->sourceLevelCount);
+}
+
+static void GL_APIENTRY marshal_glCopyTextureLevelsAPPLE(GLuint destinationTexture, GLuint sourceTexture, GLint sourceBaseLevel, GLsizei sourceLevelCount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCopyTextureLevelsAPPLE(destinationTexture, sourceTexture, sourceBaseLevel, sourceLevelCount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCopyTextureLevelsAPPLE* cmd = glthread_alloc(exec_glCopyTextureLevelsAPPLE, sizeof(*cmd));
+    cmd->destinationTexture = destinationTexture;
+    cmd->sourceTexture = sourceTexture;
+    cmd->sourceBaseLevel = sourceBaseLevel;
+    cmd->sourceLevelCount = sourceLevelCount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCoverFillPathInstancedNV {
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLenum coverMode;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glCoverFillPathInstancedNV(const void* args) {
+    const struct marshal_glCoverFillPathInstancedNV* cmd = args;
+    gles_driver.ext.glCoverFillPathInstancedNV(cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->coverMode, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
+        return;
+    }
+    struct marshal_glCoverFillPathInstancedNV* cmd = glthread_alloc(exec_glCoverFillPathInstancedNV, sizeof(*cmd));
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->coverMode = coverMode;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glCoverFillPathNV {
+    GLuint path;
+    GLenum coverMode;
+};
+
+static void exec_glCoverFillPathNV(const void* args) {
+    const struct marshal_glCoverFillPathNV* cmd = args;
+    gles_driver.ext.glCoverFillPathNV(cmd->path, cmd->coverMode);
+}
+
+static void GL_APIENTRY marshal_glCoverFillPathNV(GLuint path, GLenum coverMode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverFillPathNV(path, coverMode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCoverFillPathNV* cmd = glthread_alloc(exec_glCoverFillPathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->coverMode = coverMode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCoverStrokePathInstancedNV {
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLenum coverMode;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glCoverStrokePathInstancedNV(const void* args) {
+    const struct marshal_glCoverStrokePathInstancedNV* cmd = args;
+    gles_driver.ext.glCoverStrokePathInstancedNV(cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->coverMode, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
+        return;
+    }
+    struct marshal_glCoverStrokePathInstancedNV* cmd = glthread_alloc(exec_glCoverStrokePathInstancedNV, sizeof(*cmd));
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->coverMode = coverMode;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glCoverStrokePathNV {
+    GLuint path;
+    GLenum coverMode;
+};
+
+static void exec_glCoverStrokePathNV(const void* args) {
+    const struct marshal_glCoverStrokePathNV* cmd = args;
+    gles_driver.ext.glCoverStrokePathNV(cmd->path, cmd->coverMode);
+}
+
+static void GL_APIENTRY marshal_glCoverStrokePathNV(GLuint path, GLenum coverMode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverStrokePathNV(path, coverMode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCoverStrokePathNV* cmd = glthread_alloc(exec_glCoverStrokePathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->coverMode = coverMode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCoverageMaskNV {
+    GLboolean mask;
+};
+
+static void exec_glCoverageMaskNV(const void* args) {
+    const struct marshal_glCoverageMaskNV* cmd = args;
+    gles_driver.ext.glCoverageMaskNV(cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glCoverageMaskNV(GLboolean mask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverageMaskNV(mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCoverageMaskNV* cmd = glthread_alloc(exec_glCoverageMaskNV, sizeof(*cmd));
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCoverageModulationNV {
+    GLenum components;
+};
+
+static void exec_glCoverageModulationNV(const void* args) {
+    const struct marshal_glCoverageModulationNV* cmd = args;
+    gles_driver.ext.glCoverageModulationNV(cmd->components);
+}
+
+static void GL_APIENTRY marshal_glCoverageModulationNV(GLenum components) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverageModulationNV(components);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCoverageModulationNV* cmd = glthread_alloc(exec_glCoverageModulationNV, sizeof(*cmd));
+    cmd->components = components;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCoverageModulationTableNV {
+    GLsizei n;
+    const GLfloat *v;
+};
+
+static void exec_glCoverageModulationTableNV(const void* args) {
+    const struct marshal_glCoverageModulationTableNV* cmd = args;
+    gles_driver.ext.glCoverageModulationTableNV(cmd->n, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glCoverageModulationTableNV(GLsizei n, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverageModulationTableNV(n, v);
+        return;
+    }
+    struct marshal_glCoverageModulationTableNV* cmd = glthread_alloc(exec_glCoverageModulationTableNV, sizeof(*cmd));
+    cmd->n = n;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glCoverageOperationNV {
+    GLenum operation;
+};
+
+static void exec_glCoverageOperationNV(const void* args) {
+    const struct marshal_glCoverageOperationNV* cmd = args;
+    gles_driver.ext.glCoverageOperationNV(cmd->operation);
+}
+
+static void GL_APIENTRY marshal_glCoverageOperationNV(GLenum operation) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCoverageOperationNV(operation);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glCoverageOperationNV* cmd = glthread_alloc(exec_glCoverageOperationNV, sizeof(*cmd));
+    cmd->operation = operation;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glCreateMemoryObjectsEXT {
+    GLsizei n;
+    GLuint *memoryObjects;
+};
+
+static void exec_glCreateMemoryObjectsEXT(const void* args) {
+    const struct marshal_glCreateMemoryObjectsEXT* cmd = args;
+    gles_driver.ext.glCreateMemoryObjectsEXT(cmd->n, cmd->memoryObjects);
+}
+
+static void GL_APIENTRY marshal_glCreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCreateMemoryObjectsEXT(n, memoryObjects);
+        return;
+    }
+    struct marshal_glCreateMemoryObjectsEXT* cmd = glthread_alloc(exec_glCreateMemoryObjectsEXT, sizeof(*cmd));
+    cmd->n = n;
+    cmd->memoryObjects = memoryObjects;
+    glthread_sync();
+}
+
+struct marshal_glCreatePerfQueryINTEL {
+    GLuint queryId;
+    GLuint *queryHandle;
+};
+
+static void exec_glCreatePerfQueryINTEL(const void* args) {
+    const struct marshal_glCreatePerfQueryINTEL* cmd = args;
+    gles_driver.ext.glCreatePerfQueryINTEL(cmd->queryId, cmd->queryHandle);
+}
+
+static void GL_APIENTRY marshal_glCreatePerfQueryINTEL(GLuint queryId, GLuint *queryHandle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glCreatePerfQueryINTEL(queryId, queryHandle);
+        return;
+    }
+    struct marshal_glCreatePerfQueryINTEL* cmd = glthread_alloc(exec_glCreatePerfQueryINTEL, sizeof(*cmd));
+    cmd->queryId = queryId;
+    cmd->queryHandle = queryHandle;
+    glthread_sync();
+}
+
+struct marshal_glCreateShaderProgramvEXT {
+    GLenum type;
+    GLsizei count;
+    const GLchar **strings;
+    GLuint *result;
+};
+
+static void exec_glCreateShaderProgramvEXT(const void* args) {
+    const struct marshal_glCreateShaderProgramvEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glCreateShaderProgramvEXT(cmd->type, cmd->count, cmd->strings);
+}
+
+static GLuint GL_APIENTRY marshal_glCreateShaderProgramvEXT(GLenum type, GLsizei count, const GLchar **strings) {
+    if (!glthread_active()) return gles_driver.ext.glCreateShaderProgramvEXT(type, count, strings);
+    struct marshal_glCreateShaderProgramvEXT* cmd = glthread_alloc(exec_glCreateShaderProgramvEXT, sizeof(*cmd));
+    cmd->type = type;
+    cmd->count = count;
+    cmd->strings = strings;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glDebugMessageCallbackKHR {
+    GLDEBUGPROCKHR callback;
+    const void *userParam;
+};
+
+static void exec_glDebugMessageCallbackKHR(const void* args) {
+    const struct marshal_glDebugMessageCallbackKHR* cmd = args;
+    gles_driver.ext.glDebugMessageCallbackKHR(cmd->callback, cmd->userParam);
+}
+
+static void GL_APIENTRY marshal_glDebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *userParam) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDebugMessageCallbackKHR(callback, userParam);
+        return;
+    }
+    struct marshal_glDebugMessageCallbackKHR* cmd = glthread_alloc(exec_glDebugMessageCallbackKHR, sizeof(*cmd));
+    cmd->callback = callback;
+    cmd->userParam = userParam;
+    glthread_sync();
+}
+
+struct marshal_glDebugMessageControlKHR {
+    GLenum source;
+    GLenum type;
+    GLenum severity;
+    GLsizei count;
+    const GLuint *ids;
+    GLboolean enabled;
+};
+
+static void exec_glDebugMessageControlKHR(const void* args) {
+    const struct marshal_glDebugMessageControlKHR* cmd = args;
+    gles_driver.ext.glDebugMessageControlKHR(cmd->source, cmd->type, cmd->severity, cmd->count, cmd->ids, cmd->enabled);
+}
+
+static void GL_APIENTRY marshal_glDebugMessageControlKHR(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDebugMessageControlKHR(source, type, severity, count, ids, enabled);
+        return;
+    }
+    struct marshal_glDebugMessageControlKHR* cmd = glthread_alloc(exec_glDebugMessageControlKHR, sizeof(*cmd));
+    cmd->source = source;
+    cmd->type = type;
+    cmd->severity = severity;
+    cmd->count = count;
+    cmd->ids = ids;
+    cmd->enabled = enabled;
+    glthread_sync();
+}
+
+struct marshal_glDebugMessageInsertKHR {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    GLsizei length;
+    const GLchar *buf;
+};
+
+static void exec_glDebugMessageInsertKHR(const void* args) {
+    const struct marshal_glDebugMessageInsertKHR* cmd = args;
+    gles_driver.ext.glDebugMessageInsertKHR(cmd->source, cmd->type, cmd->id, cmd->severity, cmd->length, cmd->buf);
+}
+
+static void GL_APIENTRY marshal_glDebugMessageInsertKHR(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDebugMessageInsertKHR(source, type, id, severity, length, buf);
+        return;
+    }
+    struct marshal_glDebugMessageInsertKHR* cmd = glthread_alloc(exec_glDebugMessageInsertKHR, sizeof(*cmd));
+    cmd->source = source;
+    cmd->type = type;
+    cmd->id = id;
+    cmd->severity = severity;
+    cmd->length = length;
+    cmd->buf = buf;
+    glthread_sync();
+}
+
+struct marshal_glDeleteFencesNV {
+    GLsizei n;
+    const GLuint *fences;
+};
+
+static void exec_glDeleteFencesNV(const void* args) {
+    const struct marshal_glDeleteFencesNV* cmd = args;
+    gles_driver.ext.glDeleteFencesNV(cmd->n, cmd->fences);
+}
+
+static void GL_APIENTRY marshal_glDeleteFencesNV(GLsizei n, const GLuint *fences) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteFencesNV(n, fences);
+        return;
+    }
+    int glt_sync = 0;
+    size_t fences_size = fences ? (size_t)(n * sizeof(*fences)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(fences_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteFencesNV* cmd = glthread_alloc(exec_glDeleteFencesNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->fences = glt_sync ? fences : glthread_copy(&glt_tail, fences, fences_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteMemoryObjectsEXT {
+    GLsizei n;
+    const GLuint *memoryObjects;
+};
+
+static void exec_glDeleteMemoryObjectsEXT(const void* args) {
+    const struct marshal_glDeleteMemoryObjectsEXT* cmd = args;
+    gles_driver.ext.glDeleteMemoryObjectsEXT(cmd->n, cmd->memoryObjects);
+}
+
+static void GL_APIENTRY marshal_glDeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObjects) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteMemoryObjectsEXT(n, memoryObjects);
+        return;
+    }
+    int glt_sync = 0;
+    size_t memoryObjects_size = memoryObjects ? (size_t)(n * sizeof(*memoryObjects)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(memoryObjects_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteMemoryObjectsEXT* cmd = glthread_alloc(exec_glDeleteMemoryObjectsEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->memoryObjects = glt_sync ? memoryObjects : glthread_copy(&glt_tail, memoryObjects, memoryObjects_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeletePathsNV {
+    GLuint path;
+    GLsizei range;
+};
+
+static void exec_glDeletePathsNV(const void* args) {
+    const struct marshal_glDeletePathsNV* cmd = args;
+    gles_driver.ext.glDeletePathsNV(cmd->path, cmd->range);
+}
+
+static void GL_APIENTRY marshal_glDeletePathsNV(GLuint path, GLsizei range) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeletePathsNV(path, range);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDeletePathsNV* cmd = glthread_alloc(exec_glDeletePathsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->range = range;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeletePerfMonitorsAMD {
+    GLsizei n;
+    GLuint *monitors;
+};
+
+static void exec_glDeletePerfMonitorsAMD(const void* args) {
+    const struct marshal_glDeletePerfMonitorsAMD* cmd = args;
+    gles_driver.ext.glDeletePerfMonitorsAMD(cmd->n, cmd->monitors);
+}
+
+static void GL_APIENTRY marshal_glDeletePerfMonitorsAMD(GLsizei n, GLuint *monitors) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeletePerfMonitorsAMD(n, monitors);
+        return;
+    }
+    struct marshal_glDeletePerfMonitorsAMD* cmd = glthread_alloc(exec_glDeletePerfMonitorsAMD, sizeof(*cmd));
+    cmd->n = n;
+    cmd->monitors = monitors;
+    glthread_sync();
+}
+
+struct marshal_glDeletePerfQueryINTEL {
+    GLuint queryHandle;
+};
+
+static void exec_glDeletePerfQueryINTEL(const void* args) {
+    const struct marshal_glDeletePerfQueryINTEL* cmd = args;
+    gles_driver.ext.glDeletePerfQueryINTEL(cmd->queryHandle);
+}
+
+static void GL_APIENTRY marshal_glDeletePerfQueryINTEL(GLuint queryHandle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeletePerfQueryINTEL(queryHandle);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDeletePerfQueryINTEL* cmd = glthread_alloc(exec_glDeletePerfQueryINTEL, sizeof(*cmd));
+    cmd->queryHandle = queryHandle;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteProgramPipelinesEXT {
+    GLsizei n;
+    const GLuint *pipelines;
+};
+
+static void exec_glDeleteProgramPipelinesEXT(const void* args) {
+    const struct marshal_glDeleteProgramPipelinesEXT* cmd = args;
+    gles_driver.ext.glDeleteProgramPipelinesEXT(cmd->n, cmd->pipelines);
+}
+
+static void GL_APIENTRY marshal_glDeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteProgramPipelinesEXT(n, pipelines);
+        return;
+    }
+    int glt_sync = 0;
+    size_t pipelines_size = pipelines ? (size_t)(n * sizeof(*pipelines)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(pipelines_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteProgramPipelinesEXT* cmd = glthread_alloc(exec_glDeleteProgramPipelinesEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->pipelines = glt_sync ? pipelines : glthread_copy(&glt_tail, pipelines, pipelines_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteQueriesEXT {
+    GLsizei n;
+    const GLuint *ids;
+};
+
+static void exec_glDeleteQueriesEXT(const void* args) {
+    const struct marshal_glDeleteQueriesEXT* cmd = args;
+    gles_driver.ext.glDeleteQueriesEXT(cmd->n, cmd->ids);
+}
+
+static void GL_APIENTRY marshal_glDeleteQueriesEXT(GLsizei n, const GLuint *ids) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteQueriesEXT(n, ids);
+        return;
+    }
+    int glt_sync = 0;
+    size_t ids_size = ids ? (size_t)(n * sizeof(*ids)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(ids_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteQueriesEXT* cmd = glthread_alloc(exec_glDeleteQueriesEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->ids = glt_sync ? ids : glthread_copy(&glt_tail, ids, ids_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteSemaphoresEXT {
+    GLsizei n;
+    const GLuint *semaphores;
+};
+
+static void exec_glDeleteSemaphoresEXT(const void* args) {
+    const struct marshal_glDeleteSemaphoresEXT* cmd = args;
+    gles_driver.ext.glDeleteSemaphoresEXT(cmd->n, cmd->semaphores);
+}
+
+static void GL_APIENTRY marshal_glDeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteSemaphoresEXT(n, semaphores);
+        return;
+    }
+    int glt_sync = 0;
+    size_t semaphores_size = semaphores ? (size_t)(n * sizeof(*semaphores)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(semaphores_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteSemaphoresEXT* cmd = glthread_alloc(exec_glDeleteSemaphoresEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->semaphores = glt_sync ? semaphores : glthread_copy(&glt_tail, semaphores, semaphores_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteSyncAPPLE {
+    GLsync sync;
+};
+
+static void exec_glDeleteSyncAPPLE(const void* args) {
+    const struct marshal_glDeleteSyncAPPLE* cmd = args;
+    gles_driver.ext.glDeleteSyncAPPLE(cmd->sync);
+}
+
+static void GL_APIENTRY marshal_glDeleteSyncAPPLE(GLsync sync) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteSyncAPPLE(sync);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDeleteSyncAPPLE* cmd = glthread_alloc(exec_glDeleteSyncAPPLE, sizeof(*cmd));
+    cmd->sync = sync;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDeleteVertexArraysOES {
+    GLsizei n;
+    const GLuint *arrays;
+};
+
+static void exec_glDeleteVertexArraysOES(const void* args) {
+    const struct marshal_glDeleteVertexArraysOES* cmd = args;
+    gles_driver.ext.glDeleteVertexArraysOES(cmd->n, cmd->arrays);
+}
+
+static void GL_APIENTRY marshal_glDeleteVertexArraysOES(GLsizei n, const GLuint *arrays) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDeleteVertexArraysOES(n, arrays);
+        return;
+    }
+    int glt_sync = 0;
+    size_t arrays_size = arrays ? (size_t)(n * sizeof(*arrays)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(arrays_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDeleteVertexArraysOES* cmd = glthread_alloc(exec_glDeleteVertexArraysOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->arrays = glt_sync ? arrays : glthread_copy(&glt_tail, arrays, arrays_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDepthRangeArrayfvNV {
+    GLuint first;
+    GLsizei count;
+    const GLfloat *v;
+};
+
+static void exec_glDepthRangeArrayfvNV(const void* args) {
+    const struct marshal_glDepthRangeArrayfvNV* cmd = args;
+    gles_driver.ext.glDepthRangeArrayfvNV(cmd->first, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glDepthRangeArrayfvNV(GLuint first, GLsizei count, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDepthRangeArrayfvNV(first, count, v);
+        return;
+    }
+    struct marshal_glDepthRangeArrayfvNV* cmd = glthread_alloc(exec_glDepthRangeArrayfvNV, sizeof(*cmd));
+    cmd->first = first;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glDepthRangeArrayfvOES {
+    GLuint first;
+    GLsizei count;
+    const GLfloat *v;
+};
+
+static void exec_glDepthRangeArrayfvOES(const void* args) {
+    const struct marshal_glDepthRangeArrayfvOES* cmd = args;
+    gles_driver.ext.glDepthRangeArrayfvOES(cmd->first, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glDepthRangeArrayfvOES(GLuint first, GLsizei count, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDepthRangeArrayfvOES(first, count, v);
+        return;
+    }
+    struct marshal_glDepthRangeArrayfvOES* cmd = glthread_alloc(exec_glDepthRangeArrayfvOES, sizeof(*cmd));
+    cmd->first = first;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glDepthRangeIndexedfNV {
+    GLuint index;
+    GLfloat n;
+    GLfloat f;
+};
+
+static void exec_glDepthRangeIndexedfNV(const void* args) {
+    const struct marshal_glDepthRangeIndexedfNV* cmd = args;
+    gles_driver.ext.glDepthRangeIndexedfNV(cmd->index, cmd->n, cmd->f);
+}
+
+static void GL_APIENTRY marshal_glDepthRangeIndexedfNV(GLuint index, GLfloat n, GLfloat f) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDepthRangeIndexedfNV(index, n, f);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDepthRangeIndexedfNV* cmd = glthread_alloc(exec_glDepthRangeIndexedfNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->n = n;
+    cmd->f = f;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDepthRangeIndexedfOES {
+    GLuint index;
+    GLfloat n;
+    GLfloat f;
+};
+
+static void exec_glDepthRangeIndexedfOES(const void* args) {
+    const struct marshal_glDepthRangeIndexedfOES* cmd = args;
+    gles_driver.ext.glDepthRangeIndexedfOES(cmd->index, cmd->n, cmd->f);
+}
+
+static void GL_APIENTRY marshal_glDepthRangeIndexedfOES(GLuint index, GLfloat n, GLfloat f) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDepthRangeIndexedfOES(index, n, f);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDepthRangeIndexedfOES* cmd = glthread_alloc(exec_glDepthRangeIndexedfOES, sizeof(*cmd));
+    cmd->index = index;
+    cmd->n = n;
+    cmd->f = f;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisableDriverControlQCOM {
+    GLuint driverControl;
+};
+
+static void exec_glDisableDriverControlQCOM(const void* args) {
+    const struct marshal_glDisableDriverControlQCOM* cmd = args;
+    gles_driver.ext.glDisableDriverControlQCOM(cmd->driverControl);
+}
+
+static void GL_APIENTRY marshal_glDisableDriverControlQCOM(GLuint driverControl) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDisableDriverControlQCOM(driverControl);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisableDriverControlQCOM* cmd = glthread_alloc(exec_glDisableDriverControlQCOM, sizeof(*cmd));
+    cmd->driverControl = driverControl;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisableiEXT {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glDisableiEXT(const void* args) {
+    const struct marshal_glDisableiEXT* cmd = args;
+    gles_driver.ext.glDisableiEXT(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glDisableiEXT(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDisableiEXT(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisableiEXT* cmd = glthread_alloc(exec_glDisableiEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisableiNV {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glDisableiNV(const void* args) {
+    const struct marshal_glDisableiNV* cmd = args;
+    gles_driver.ext.glDisableiNV(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glDisableiNV(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDisableiNV(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisableiNV* cmd = glthread_alloc(exec_glDisableiNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDisableiOES {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glDisableiOES(const void* args) {
+    const struct marshal_glDisableiOES* cmd = args;
+    gles_driver.ext.glDisableiOES(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glDisableiOES(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDisableiOES(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDisableiOES* cmd = glthread_alloc(exec_glDisableiOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDiscardFramebufferEXT {
+    GLenum target;
+    GLsizei numAttachments;
+    const GLenum *attachments;
+};
+
+static void exec_glDiscardFramebufferEXT(const void* args) {
+    const struct marshal_glDiscardFramebufferEXT* cmd = args;
+    gles_driver.ext.glDiscardFramebufferEXT(cmd->target, cmd->numAttachments, cmd->attachments);
+}
+
+static void GL_APIENTRY marshal_glDiscardFramebufferEXT(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDiscardFramebufferEXT(target, numAttachments, attachments);
+        return;
+    }
+    int glt_sync = 0;
+    size_t attachments_size = attachments ? (size_t)(numAttachments * sizeof(*attachments)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(attachments_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDiscardFramebufferEXT* cmd = glthread_alloc(exec_glDiscardFramebufferEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->numAttachments = numAttachments;
+    cmd->attachments = glt_sync ? attachments : glthread_copy(&glt_tail, attachments, attachments_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArraysInstancedANGLE {
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei primcount;
+};
+
+static void exec_glDrawArraysInstancedANGLE(const void* args) {
+    const struct marshal_glDrawArraysInstancedANGLE* cmd = args;
+    gles_driver.ext.glDrawArraysInstancedANGLE(cmd->mode, cmd->first, cmd->count, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glDrawArraysInstancedANGLE(GLenum mode, GLint first, GLsizei count, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawArraysInstancedANGLE(mode, first, count, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArraysInstancedANGLE* cmd = glthread_alloc(exec_glDrawArraysInstancedANGLE, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->first = first;
+    cmd->count = count;
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArraysInstancedBaseInstanceEXT {
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei instancecount;
+    GLuint baseinstance;
+};
+
+static void exec_glDrawArraysInstancedBaseInstanceEXT(const void* args) {
+    const struct marshal_glDrawArraysInstancedBaseInstanceEXT* cmd = args;
+    gles_driver.ext.glDrawArraysInstancedBaseInstanceEXT(cmd->mode, cmd->first, cmd->count, cmd->instancecount, cmd->baseinstance);
+}
+
+static void GL_APIENTRY marshal_glDrawArraysInstancedBaseInstanceEXT(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawArraysInstancedBaseInstanceEXT(mode, first, count, instancecount, baseinstance);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArraysInstancedBaseInstanceEXT* cmd = glthread_alloc(exec_glDrawArraysInstancedBaseInstanceEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->first = first;
+    cmd->count = count;
+    cmd->instancecount = instancecount;
+    cmd->baseinstance = baseinstance;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArraysInstancedEXT {
+    GLenum mode;
+    GLint start;
+    GLsizei count;
+    GLsizei primcount;
+};
+
+static void exec_glDrawArraysInstancedEXT(const void* args) {
+    const struct marshal_glDrawArraysInstancedEXT* cmd = args;
+    gles_driver.ext.glDrawArraysInstancedEXT(cmd->mode, cmd->start, cmd->count, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glDrawArraysInstancedEXT(GLenum mode, GLint start, GLsizei count, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawArraysInstancedEXT(mode, start, count, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArraysInstancedEXT* cmd = glthread_alloc(exec_glDrawArraysInstancedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->start = start;
+    cmd->count = count;
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawArraysInstancedNV {
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei primcount;
+};
+
+static void exec_glDrawArraysInstancedNV(const void* args) {
+    const struct marshal_glDrawArraysInstancedNV* cmd = args;
+    gles_driver.ext.glDrawArraysInstancedNV(cmd->mode, cmd->first, cmd->count, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glDrawArraysInstancedNV(GLenum mode, GLint first, GLsizei count, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawArraysInstancedNV(mode, first, count, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawArraysInstancedNV* cmd = glthread_alloc(exec_glDrawArraysInstancedNV, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->first = first;
+    cmd->count = count;
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawBuffersEXT {
+    GLsizei n;
+    const GLenum *bufs;
+};
+
+static void exec_glDrawBuffersEXT(const void* args) {
+    const struct marshal_glDrawBuffersEXT* cmd = args;
+    gles_driver.ext.glDrawBuffersEXT(cmd->n, cmd->bufs);
+}
+
+static void GL_APIENTRY marshal_glDrawBuffersEXT(GLsizei n, const GLenum *bufs) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawBuffersEXT(n, bufs);
+        return;
+    }
+    int glt_sync = 0;
+    size_t bufs_size = bufs ? (size_t)(n * sizeof(*bufs)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(bufs_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDrawBuffersEXT* cmd = glthread_alloc(exec_glDrawBuffersEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->bufs = glt_sync ? bufs : glthread_copy(&glt_tail, bufs, bufs_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawBuffersIndexedEXT {
+    GLint n;
+    const GLenum *location;
+    const GLint *indices;
+};
+
+static void exec_glDrawBuffersIndexedEXT(const void* args) {
+    const struct marshal_glDrawBuffersIndexedEXT* cmd = args;
+    gles_driver.ext.glDrawBuffersIndexedEXT(cmd->n, cmd->location, cmd->indices);
+}
+
+static void GL_APIENTRY marshal_glDrawBuffersIndexedEXT(GLint n, const GLenum *location, const GLint *indices) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawBuffersIndexedEXT(n, location, indices);
+        return;
+    }
+    struct marshal_glDrawBuffersIndexedEXT* cmd = glthread_alloc(exec_glDrawBuffersIndexedEXT, sizeof(*cmd));
+    cmd->n = n;
+    cmd->location = location;
+    cmd->indices = indices;
+    glthread_sync();
+}
+
+struct marshal_glDrawBuffersNV {
+    GLsizei n;
+    const GLenum *bufs;
+};
+
+static void exec_glDrawBuffersNV(const void* args) {
+    const struct marshal_glDrawBuffersNV* cmd = args;
+    gles_driver.ext.glDrawBuffersNV(cmd->n, cmd->bufs);
+}
+
+static void GL_APIENTRY marshal_glDrawBuffersNV(GLsizei n, const GLenum *bufs) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawBuffersNV(n, bufs);
+        return;
+    }
+    int glt_sync = 0;
+    size_t bufs_size = bufs ? (size_t)(n * sizeof(*bufs)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(bufs_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glDrawBuffersNV* cmd = glthread_alloc(exec_glDrawBuffersNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->n = n;
+    cmd->bufs = glt_sync ? bufs : glthread_copy(&glt_tail, bufs, bufs_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsBaseVertexEXT {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLint basevertex;
+};
+
+static void exec_glDrawElementsBaseVertexEXT(const void* args) {
+    const struct marshal_glDrawElementsBaseVertexEXT* cmd = args;
+    gles_driver.ext.glDrawElementsBaseVertexEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsBaseVertexEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsBaseVertexEXT(mode, count, type, indices, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsBaseVertexEXT* cmd = glthread_alloc(exec_glDrawElementsBaseVertexEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsBaseVertexOES {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLint basevertex;
+};
+
+static void exec_glDrawElementsBaseVertexOES(const void* args) {
+    const struct marshal_glDrawElementsBaseVertexOES* cmd = args;
+    gles_driver.ext.glDrawElementsBaseVertexOES(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsBaseVertexOES(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsBaseVertexOES(mode, count, type, indices, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsBaseVertexOES* cmd = glthread_alloc(exec_glDrawElementsBaseVertexOES, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedANGLE {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei primcount;
+};
+
+static void exec_glDrawElementsInstancedANGLE(const void* args) {
+    const struct marshal_glDrawElementsInstancedANGLE* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedANGLE(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedANGLE(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedANGLE(mode, count, type, indices, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedANGLE* cmd = glthread_alloc(exec_glDrawElementsInstancedANGLE, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedBaseInstanceEXT {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+    GLuint baseinstance;
+};
+
+static void exec_glDrawElementsInstancedBaseInstanceEXT(const void* args) {
+    const struct marshal_glDrawElementsInstancedBaseInstanceEXT* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedBaseInstanceEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->baseinstance);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedBaseInstanceEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedBaseInstanceEXT(mode, count, type, indices, instancecount, baseinstance);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedBaseInstanceEXT* cmd = glthread_alloc(exec_glDrawElementsInstancedBaseInstanceEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->instancecount = instancecount;
+    cmd->baseinstance = baseinstance;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedBaseVertexBaseInstanceEXT {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+    GLint basevertex;
+    GLuint baseinstance;
+};
+
+static void exec_glDrawElementsInstancedBaseVertexBaseInstanceEXT(const void* args) {
+    const struct marshal_glDrawElementsInstancedBaseVertexBaseInstanceEXT* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex, cmd->baseinstance);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedBaseVertexBaseInstanceEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT(mode, count, type, indices, instancecount, basevertex, baseinstance);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedBaseVertexBaseInstanceEXT* cmd = glthread_alloc(exec_glDrawElementsInstancedBaseVertexBaseInstanceEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->instancecount = instancecount;
+    cmd->basevertex = basevertex;
+    cmd->baseinstance = baseinstance;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedBaseVertexEXT {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+    GLint basevertex;
+};
+
+static void exec_glDrawElementsInstancedBaseVertexEXT(const void* args) {
+    const struct marshal_glDrawElementsInstancedBaseVertexEXT* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedBaseVertexEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedBaseVertexEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedBaseVertexEXT(mode, count, type, indices, instancecount, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedBaseVertexEXT* cmd = glthread_alloc(exec_glDrawElementsInstancedBaseVertexEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->instancecount = instancecount;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedBaseVertexOES {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+    GLint basevertex;
+};
+
+static void exec_glDrawElementsInstancedBaseVertexOES(const void* args) {
+    const struct marshal_glDrawElementsInstancedBaseVertexOES* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedBaseVertexOES(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedBaseVertexOES(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedBaseVertexOES(mode, count, type, indices, instancecount, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedBaseVertexOES* cmd = glthread_alloc(exec_glDrawElementsInstancedBaseVertexOES, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->instancecount = instancecount;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedEXT {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei primcount;
+};
+
+static void exec_glDrawElementsInstancedEXT(const void* args) {
+    const struct marshal_glDrawElementsInstancedEXT* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedEXT(mode, count, type, indices, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedEXT* cmd = glthread_alloc(exec_glDrawElementsInstancedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawElementsInstancedNV {
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei primcount;
+};
+
+static void exec_glDrawElementsInstancedNV(const void* args) {
+    const struct marshal_glDrawElementsInstancedNV* cmd = args;
+    gles_driver.ext.glDrawElementsInstancedNV(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glDrawElementsInstancedNV(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawElementsInstancedNV(mode, count, type, indices, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawElementsInstancedNV* cmd = glthread_alloc(exec_glDrawElementsInstancedNV, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawRangeElementsBaseVertexEXT {
+    GLenum mode;
+    GLuint start;
+    GLuint end;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLint basevertex;
+};
+
+static void exec_glDrawRangeElementsBaseVertexEXT(const void* args) {
+    const struct marshal_glDrawRangeElementsBaseVertexEXT* cmd = args;
+    gles_driver.ext.glDrawRangeElementsBaseVertexEXT(cmd->mode, cmd->start, cmd->end, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawRangeElementsBaseVertexEXT(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawRangeElementsBaseVertexEXT(mode, start, end, count, type, indices, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawRangeElementsBaseVertexEXT* cmd = glthread_alloc(exec_glDrawRangeElementsBaseVertexEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->start = start;
+    cmd->end = end;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawRangeElementsBaseVertexOES {
+    GLenum mode;
+    GLuint start;
+    GLuint end;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLint basevertex;
+};
+
+static void exec_glDrawRangeElementsBaseVertexOES(const void* args) {
+    const struct marshal_glDrawRangeElementsBaseVertexOES* cmd = args;
+    gles_driver.ext.glDrawRangeElementsBaseVertexOES(cmd->mode, cmd->start, cmd->end, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glDrawRangeElementsBaseVertexOES(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawRangeElementsBaseVertexOES(mode, start, end, count, type, indices, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawRangeElementsBaseVertexOES* cmd = glthread_alloc(exec_glDrawRangeElementsBaseVertexOES, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->start = start;
+    cmd->end = end;
+    cmd->count = count;
+    cmd->type = type;
+    cmd->indices = indices;
+    cmd->basevertex = basevertex;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawTransformFeedbackEXT {
+    GLenum mode;
+    GLuint id;
+};
+
+static void exec_glDrawTransformFeedbackEXT(const void* args) {
+    const struct marshal_glDrawTransformFeedbackEXT* cmd = args;
+    gles_driver.ext.glDrawTransformFeedbackEXT(cmd->mode, cmd->id);
+}
+
+static void GL_APIENTRY marshal_glDrawTransformFeedbackEXT(GLenum mode, GLuint id) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawTransformFeedbackEXT(mode, id);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawTransformFeedbackEXT* cmd = glthread_alloc(exec_glDrawTransformFeedbackEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->id = id;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawTransformFeedbackInstancedEXT {
+    GLenum mode;
+    GLuint id;
+    GLsizei instancecount;
+};
+
+static void exec_glDrawTransformFeedbackInstancedEXT(const void* args) {
+    const struct marshal_glDrawTransformFeedbackInstancedEXT* cmd = args;
+    gles_driver.ext.glDrawTransformFeedbackInstancedEXT(cmd->mode, cmd->id, cmd->instancecount);
+}
+
+static void GL_APIENTRY marshal_glDrawTransformFeedbackInstancedEXT(GLenum mode, GLuint id, GLsizei instancecount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawTransformFeedbackInstancedEXT(mode, id, instancecount);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawTransformFeedbackInstancedEXT* cmd = glthread_alloc(exec_glDrawTransformFeedbackInstancedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->id = id;
+    cmd->instancecount = instancecount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glDrawVkImageNV {
+    GLuint64 vkImage;
+    GLuint sampler;
+    GLfloat x0;
+    GLfloat y0;
+    GLfloat x1;
+    GLfloat y1;
+    GLfloat z;
+    GLfloat s0;
+    GLfloat t0;
+    GLfloat s1;
+    GLfloat t1;
+};
+
+static void exec_glDrawVkImageNV(const void* args) {
+    const struct marshal_glDrawVkImageNV* cmd = args;
+    gles_driver.ext.glDrawVkImageNV(cmd->vkImage, cmd->sampler, cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->z, cmd->s0, cmd->t0, cmd->s1, cmd->t1);
+}
+
+static void GL_APIENTRY marshal_glDrawVkImageNV(GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1) {
+    if (!glthread_active()) {
+        gles_driver.ext.glDrawVkImageNV(vkImage, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glDrawVkImageNV* cmd = glthread_alloc(exec_glDrawVkImageNV, sizeof(*cmd));
+    cmd->vkImage = vkImage;
+    cmd->sampler = sampler;
+    cmd->x0 = x0;
+    cmd->y0 = y0;
+    cmd->x1 = x1;
+    cmd->y1 = y1;
+    cmd->z = z;
+    cmd->s0 = s0;
+    cmd->t0 = t0;
+    cmd->s1 = s1;
+    cmd->t1 = t1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEGLImageTargetRenderbufferStorageOES {
+    GLenum target;
+    GLeglImageOES image;
+};
+
+static void exec_glEGLImageTargetRenderbufferStorageOES(const void* args) {
+    const struct marshal_glEGLImageTargetRenderbufferStorageOES* cmd = args;
+    gles_driver.ext.glEGLImageTargetRenderbufferStorageOES(cmd->target, cmd->image);
+}
+
+static void GL_APIENTRY marshal_glEGLImageTargetRenderbufferStorageOES(GLenum target, GLeglImageOES image) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEGLImageTargetRenderbufferStorageOES(target, image);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEGLImageTargetRenderbufferStorageOES* cmd = glthread_alloc(exec_glEGLImageTargetRenderbufferStorageOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->image = image;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEGLImageTargetTexStorageEXT {
+    GLenum target;
+    GLeglImageOES image;
+    const GLint*attrib_list;
+};
+
+static void exec_glEGLImageTargetTexStorageEXT(const void* args) {
+    const struct marshal_glEGLImageTargetTexStorageEXT* cmd = args;
+    gles_driver.ext.glEGLImageTargetTexStorageEXT(cmd->target, cmd->image, cmd->attrib_list);
+}
+
+static void GL_APIENTRY marshal_glEGLImageTargetTexStorageEXT(GLenum target, GLeglImageOES image, const GLint*attrib_list) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEGLImageTargetTexStorageEXT(target, image, attrib_list);
+        return;
+    }
+    struct marshal_glEGLImageTargetTexStorageEXT* cmd = glthread_alloc(exec_glEGLImageTargetTexStorageEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->image = image;
+    cmd->attrib_list = attrib_list;
+    glthread_sync();
+}
+
+struct marshal_glEGLImageTargetTexture2DOES {
+    GLenum target;
+    GLeglImageOES image;
+};
+
+static void exec_glEGLImageTargetTexture2DOES(const void* args) {
+    const struct marshal_glEGLImageTargetTexture2DOES* cmd = args;
+    gles_driver.ext.glEGLImageTargetTexture2DOES(cmd->target, cmd->image);
+}
+
+static void GL_APIENTRY marshal_glEGLImageTargetTexture2DOES(GLenum target, GLeglImageOES image) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEGLImageTargetTexture2DOES(target, image);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEGLImageTargetTexture2DOES* cmd = glthread_alloc(exec_glEGLImageTargetTexture2DOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->image = image;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEGLImageTargetTextureStorageEXT {
+    GLuint texture;
+    GLeglImageOES image;
+    const GLint*attrib_list;
+};
+
+static void exec_glEGLImageTargetTextureStorageEXT(const void* args) {
+    const struct marshal_glEGLImageTargetTextureStorageEXT* cmd = args;
+    gles_driver.ext.glEGLImageTargetTextureStorageEXT(cmd->texture, cmd->image, cmd->attrib_list);
+}
+
+static void GL_APIENTRY marshal_glEGLImageTargetTextureStorageEXT(GLuint texture, GLeglImageOES image, const GLint*attrib_list) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEGLImageTargetTextureStorageEXT(texture, image, attrib_list);
+        return;
+    }
+    struct marshal_glEGLImageTargetTextureStorageEXT* cmd = glthread_alloc(exec_glEGLImageTargetTextureStorageEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->image = image;
+    cmd->attrib_list = attrib_list;
+    glthread_sync();
+}
+
+struct marshal_glEnableDriverControlQCOM {
+    GLuint driverControl;
+};
+
+static void exec_glEnableDriverControlQCOM(const void* args) {
+    const struct marshal_glEnableDriverControlQCOM* cmd = args;
+    gles_driver.ext.glEnableDriverControlQCOM(cmd->driverControl);
+}
+
+static void GL_APIENTRY marshal_glEnableDriverControlQCOM(GLuint driverControl) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEnableDriverControlQCOM(driverControl);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnableDriverControlQCOM* cmd = glthread_alloc(exec_glEnableDriverControlQCOM, sizeof(*cmd));
+    cmd->driverControl = driverControl;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEnableiEXT {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glEnableiEXT(const void* args) {
+    const struct marshal_glEnableiEXT* cmd = args;
+    gles_driver.ext.glEnableiEXT(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glEnableiEXT(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEnableiEXT(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnableiEXT* cmd = glthread_alloc(exec_glEnableiEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEnableiNV {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glEnableiNV(const void* args) {
+    const struct marshal_glEnableiNV* cmd = args;
+    gles_driver.ext.glEnableiNV(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glEnableiNV(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEnableiNV(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnableiNV* cmd = glthread_alloc(exec_glEnableiNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEnableiOES {
+    GLenum target;
+    GLuint index;
+};
+
+static void exec_glEnableiOES(const void* args) {
+    const struct marshal_glEnableiOES* cmd = args;
+    gles_driver.ext.glEnableiOES(cmd->target, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glEnableiOES(GLenum target, GLuint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEnableiOES(target, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEnableiOES* cmd = glthread_alloc(exec_glEnableiOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndConditionalRenderNV {
+    char unused;
+};
+
+static void exec_glEndConditionalRenderNV(const void* args) {
+    (void)args;
+    gles_driver.ext.glEndConditionalRenderNV();
+}
+
+static void GL_APIENTRY marshal_glEndConditionalRenderNV(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEndConditionalRenderNV();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndConditionalRenderNV* cmd = glthread_alloc(exec_glEndConditionalRenderNV, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndPerfMonitorAMD {
+    GLuint monitor;
+};
+
+static void exec_glEndPerfMonitorAMD(const void* args) {
+    const struct marshal_glEndPerfMonitorAMD* cmd = args;
+    gles_driver.ext.glEndPerfMonitorAMD(cmd->monitor);
+}
+
+static void GL_APIENTRY marshal_glEndPerfMonitorAMD(GLuint monitor) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEndPerfMonitorAMD(monitor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndPerfMonitorAMD* cmd = glthread_alloc(exec_glEndPerfMonitorAMD, sizeof(*cmd));
+    cmd->monitor = monitor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndPerfQueryINTEL {
+    GLuint queryHandle;
+};
+
+static void exec_glEndPerfQueryINTEL(const void* args) {
+    const struct marshal_glEndPerfQueryINTEL* cmd = args;
+    gles_driver.ext.glEndPerfQueryINTEL(cmd->queryHandle);
+}
+
+static void GL_APIENTRY marshal_glEndPerfQueryINTEL(GLuint queryHandle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEndPerfQueryINTEL(queryHandle);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndPerfQueryINTEL* cmd = glthread_alloc(exec_glEndPerfQueryINTEL, sizeof(*cmd));
+    cmd->queryHandle = queryHandle;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndQueryEXT {
+    GLenum target;
+};
+
+static void exec_glEndQueryEXT(const void* args) {
+    const struct marshal_glEndQueryEXT* cmd = args;
+    gles_driver.ext.glEndQueryEXT(cmd->target);
+}
+
+static void GL_APIENTRY marshal_glEndQueryEXT(GLenum target) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEndQueryEXT(target);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndQueryEXT* cmd = glthread_alloc(exec_glEndQueryEXT, sizeof(*cmd));
+    cmd->target = target;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glEndTilingQCOM {
+    GLbitfield preserveMask;
+};
+
+static void exec_glEndTilingQCOM(const void* args) {
+    const struct marshal_glEndTilingQCOM* cmd = args;
+    gles_driver.ext.glEndTilingQCOM(cmd->preserveMask);
+}
+
+static void GL_APIENTRY marshal_glEndTilingQCOM(GLbitfield preserveMask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glEndTilingQCOM(preserveMask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glEndTilingQCOM* cmd = glthread_alloc(exec_glEndTilingQCOM, sizeof(*cmd));
+    cmd->preserveMask = preserveMask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glExtGetBufferPointervQCOM {
+    GLenum target;
+    void **params;
+};
+
+static void exec_glExtGetBufferPointervQCOM(const void* args) {
+    const struct marshal_glExtGetBufferPointervQCOM* cmd = args;
+    gles_driver.ext.glExtGetBufferPointervQCOM(cmd->target, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glExtGetBufferPointervQCOM(GLenum target, void **params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetBufferPointervQCOM(target, params);
+        return;
+    }
+    struct marshal_glExtGetBufferPointervQCOM* cmd = glthread_alloc(exec_glExtGetBufferPointervQCOM, sizeof(*cmd));
+    cmd->target = target;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glExtGetBuffersQCOM {
+    GLuint *buffers;
+    GLint maxBuffers;
+    GLint *numBuffers;
+};
+
+static void exec_glExtGetBuffersQCOM(const void* args) {
+    const struct marshal_glExtGetBuffersQCOM* cmd = args;
+    gles_driver.ext.glExtGetBuffersQCOM(cmd->buffers, cmd->maxBuffers, cmd->numBuffers);
+}
+
+static void GL_APIENTRY marshal_glExtGetBuffersQCOM(GLuint *buffers, GLint maxBuffers, GLint *numBuffers) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetBuffersQCOM(buffers, maxBuffers, numBuffers);
+        return;
+    }
+    struct marshal_glExtGetBuffersQCOM* cmd = glthread_alloc(exec_glExtGetBuffersQCOM, sizeof(*cmd));
+    cmd->buffers = buffers;
+    cmd->maxBuffers = maxBuffers;
+    cmd->numBuffers = numBuffers;
+    glthread_sync();
+}
+
+struct marshal_glExtGetFramebuffersQCOM {
+    GLuint *framebuffers;
+    GLint maxFramebuffers;
+    GLint *numFramebuffers;
+};
+
+static void exec_glExtGetFramebuffersQCOM(const void* args) {
+    const struct marshal_glExtGetFramebuffersQCOM* cmd = args;
+    gles_driver.ext.glExtGetFramebuffersQCOM(cmd->framebuffers, cmd->maxFramebuffers, cmd->numFramebuffers);
+}
+
+static void GL_APIENTRY marshal_glExtGetFramebuffersQCOM(GLuint *framebuffers, GLint maxFramebuffers, GLint *numFramebuffers) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetFramebuffersQCOM(framebuffers, maxFramebuffers, numFramebuffers);
+        return;
+    }
+    struct marshal_glExtGetFramebuffersQCOM* cmd = glthread_alloc(exec_glExtGetFramebuffersQCOM, sizeof(*cmd));
+    cmd->framebuffers = framebuffers;
+    cmd->maxFramebuffers = maxFramebuffers;
+    cmd->numFramebuffers = numFramebuffers;
+    glthread_sync();
+}
+
+struct marshal_glExtGetProgramBinarySourceQCOM {
+    GLuint program;
+    GLenum shadertype;
+    GLchar *source;
+    GLint *length;
+};
+
+static void exec_glExtGetProgramBinarySourceQCOM(const void* args) {
+    const struct marshal_glExtGetProgramBinarySourceQCOM* cmd = args;
+    gles_driver.ext.glExtGetProgramBinarySourceQCOM(cmd->program, cmd->shadertype, cmd->source, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glExtGetProgramBinarySourceQCOM(GLuint program, GLenum shadertype, GLchar *source, GLint *length) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetProgramBinarySourceQCOM(program, shadertype, source, length);
+        return;
+    }
+    struct marshal_glExtGetProgramBinarySourceQCOM* cmd = glthread_alloc(exec_glExtGetProgramBinarySourceQCOM, sizeof(*cmd));
+    cmd->program = program;
+    cmd->shadertype = shadertype;
+    cmd->source = source;
+    cmd->length = length;
+    glthread_sync();
+}
+
+struct marshal_glExtGetProgramsQCOM {
+    GLuint *programs;
+    GLint maxPrograms;
+    GLint *numPrograms;
+};
+
+static void exec_glExtGetProgramsQCOM(const void* args) {
+    const struct marshal_glExtGetProgramsQCOM* cmd = args;
+    gles_driver.ext.glExtGetProgramsQCOM(cmd->programs, cmd->maxPrograms, cmd->numPrograms);
+}
+
+static void GL_APIENTRY marshal_glExtGetProgramsQCOM(GLuint *programs, GLint maxPrograms, GLint *numPrograms) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetProgramsQCOM(programs, maxPrograms, numPrograms);
+        return;
+    }
+    struct marshal_glExtGetProgramsQCOM* cmd = glthread_alloc(exec_glExtGetProgramsQCOM, sizeof(*cmd));
+    cmd->programs = programs;
+    cmd->maxPrograms = maxPrograms;
+    cmd->numPrograms = numPrograms;
+    glthread_sync();
+}
+
+struct marshal_glExtGetRenderbuffersQCOM {
+    GLuint *renderbuffers;
+    GLint maxRenderbuffers;
+    GLint *numRenderbuffers;
+};
+
+static void exec_glExtGetRenderbuffersQCOM(const void* args) {
+    const struct marshal_glExtGetRenderbuffersQCOM* cmd = args;
+    gles_driver.ext.glExtGetRenderbuffersQCOM(cmd->renderbuffers, cmd->maxRenderbuffers, cmd->numRenderbuffers);
+}
+
+static void GL_APIENTRY marshal_glExtGetRenderbuffersQCOM(GLuint *renderbuffers, GLint maxRenderbuffers, GLint *numRenderbuffers) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetRenderbuffersQCOM(renderbuffers, maxRenderbuffers, numRenderbuffers);
+        return;
+    }
+    struct marshal_glExtGetRenderbuffersQCOM* cmd = glthread_alloc(exec_glExtGetRenderbuffersQCOM, sizeof(*cmd));
+    cmd->renderbuffers = renderbuffers;
+    cmd->maxRenderbuffers = maxRenderbuffers;
+    cmd->numRenderbuffers = numRenderbuffers;
+    glthread_sync();
+}
+
+struct marshal_glExtGetShadersQCOM {
+    GLuint *shaders;
+    GLint maxShaders;
+    GLint *numShaders;
+};
+
+static void exec_glExtGetShadersQCOM(const void* args) {
+    const struct marshal_glExtGetShadersQCOM* cmd = args;
+    gles_driver.ext.glExtGetShadersQCOM(cmd->shaders, cmd->maxShaders, cmd->numShaders);
+}
+
+static void GL_APIENTRY marshal_glExtGetShadersQCOM(GLuint *shaders, GLint maxShaders, GLint *numShaders) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetShadersQCOM(shaders, maxShaders, numShaders);
+        return;
+    }
+    struct marshal_glExtGetShadersQCOM* cmd = glthread_alloc(exec_glExtGetShadersQCOM, sizeof(*cmd));
+    cmd->shaders = shaders;
+    cmd->maxShaders = maxShaders;
+    cmd->numShaders = numShaders;
+    glthread_sync();
+}
+
+struct marshal_glExtGetTexLevelParameterivQCOM {
+    GLuint texture;
+    GLenum face;
+    GLint level;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glExtGetTexLevelParameterivQCOM(const void* args) {
+    const struct marshal_glExtGetTexLevelParameterivQCOM* cmd = args;
+    gles_driver.ext.glExtGetTexLevelParameterivQCOM(cmd->texture, cmd->face, cmd->level, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glExtGetTexLevelParameterivQCOM(GLuint texture, GLenum face, GLint level, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetTexLevelParameterivQCOM(texture, face, level, pname, params);
+        return;
+    }
+    struct marshal_glExtGetTexLevelParameterivQCOM* cmd = glthread_alloc(exec_glExtGetTexLevelParameterivQCOM, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->face = face;
+    cmd->level = level;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glExtGetTexSubImageQCOM {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLenum format;
+    GLenum type;
+    void *texels;
+};
+
+static void exec_glExtGetTexSubImageQCOM(const void* args) {
+    const struct marshal_glExtGetTexSubImageQCOM* cmd = args;
+    gles_driver.ext.glExtGetTexSubImageQCOM(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->format, cmd->type, cmd->texels);
+}
+
+static void GL_APIENTRY marshal_glExtGetTexSubImageQCOM(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, void *texels) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetTexSubImageQCOM(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, texels);
+        return;
+    }
+    struct marshal_glExtGetTexSubImageQCOM* cmd = glthread_alloc(exec_glExtGetTexSubImageQCOM, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->texels = texels;
+    glthread_sync();
+}
+
+struct marshal_glExtGetTexturesQCOM {
+    GLuint *textures;
+    GLint maxTextures;
+    GLint *numTextures;
+};
+
+static void exec_glExtGetTexturesQCOM(const void* args) {
+    const struct marshal_glExtGetTexturesQCOM* cmd = args;
+    gles_driver.ext.glExtGetTexturesQCOM(cmd->textures, cmd->maxTextures, cmd->numTextures);
+}
+
+static void GL_APIENTRY marshal_glExtGetTexturesQCOM(GLuint *textures, GLint maxTextures, GLint *numTextures) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtGetTexturesQCOM(textures, maxTextures, numTextures);
+        return;
+    }
+    struct marshal_glExtGetTexturesQCOM* cmd = glthread_alloc(exec_glExtGetTexturesQCOM, sizeof(*cmd));
+    cmd->textures = textures;
+    cmd->maxTextures = maxTextures;
+    cmd->numTextures = numTextures;
+    glthread_sync();
+}
+
+struct marshal_glExtIsProgramBinaryQCOM {
+    GLuint program;
+    GLboolean *result;
+};
+
+static void exec_glExtIsProgramBinaryQCOM(const void* args) {
+    const struct marshal_glExtIsProgramBinaryQCOM* cmd = args;
+    *cmd->result = gles_driver.ext.glExtIsProgramBinaryQCOM(cmd->program);
+}
+
+static GLboolean GL_APIENTRY marshal_glExtIsProgramBinaryQCOM(GLuint program) {
+    if (!glthread_active()) return gles_driver.ext.glExtIsProgramBinaryQCOM(program);
+    struct marshal_glExtIsProgramBinaryQCOM* cmd = glthread_alloc(exec_glExtIsProgramBinaryQCOM, sizeof(*cmd));
+    cmd->program = program;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glExtTexObjectStateOverrideiQCOM {
+    GLenum target;
+    GLenum pname;
+    GLint param;
+};
+
+static void exec_glExtTexObjectStateOverrideiQCOM(const void* args) {
+    const struct marshal_glExtTexObjectStateOverrideiQCOM* cmd = args;
+    gles_driver.ext.glExtTexObjectStateOverrideiQCOM(cmd->target, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glExtTexObjectStateOverrideiQCOM(GLenum target, GLenum pname, GLint param) {
+    if (!glthread_active()) {
+        gles_driver.ext.glExtTexObjectStateOverrideiQCOM(target, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glExtTexObjectStateOverrideiQCOM* cmd = glthread_alloc(exec_glExtTexObjectStateOverrideiQCOM, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->param = param;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFenceSyncAPPLE {
+    GLenum condition;
+    GLbitfield flags;
+    GLsync *result;
+};
+
+static void exec_glFenceSyncAPPLE(const void* args) {
+    const struct marshal_glFenceSyncAPPLE* cmd = args;
+    *cmd->result = gles_driver.ext.glFenceSyncAPPLE(cmd->condition, cmd->flags);
+}
+
+static GLsync GL_APIENTRY marshal_glFenceSyncAPPLE(GLenum condition, GLbitfield flags) {
+    if (!glthread_active()) return gles_driver.ext.glFenceSyncAPPLE(condition, flags);
+    struct marshal_glFenceSyncAPPLE* cmd = glthread_alloc(exec_glFenceSyncAPPLE, sizeof(*cmd));
+    cmd->condition = condition;
+    cmd->flags = flags;
+    GLsync glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glFinishFenceNV {
+    GLuint fence;
+};
+
+static void exec_glFinishFenceNV(const void* args) {
+    const struct marshal_glFinishFenceNV* cmd = args;
+    gles_driver.ext.glFinishFenceNV(cmd->fence);
+}
+
+static void GL_APIENTRY marshal_glFinishFenceNV(GLuint fence) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFinishFenceNV(fence);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFinishFenceNV* cmd = glthread_alloc(exec_glFinishFenceNV, sizeof(*cmd));
+    cmd->fence = fence;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFlushMappedBufferRangeEXT {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr length;
+};
+
+static void exec_glFlushMappedBufferRangeEXT(const void* args) {
+    const struct marshal_glFlushMappedBufferRangeEXT* cmd = args;
+    gles_driver.ext.glFlushMappedBufferRangeEXT(cmd->target, cmd->offset, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glFlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFlushMappedBufferRangeEXT(target, offset, length);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFlushMappedBufferRangeEXT* cmd = glthread_alloc(exec_glFlushMappedBufferRangeEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->length = length;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFragmentCoverageColorNV {
+    GLuint color;
+};
+
+static void exec_glFragmentCoverageColorNV(const void* args) {
+    const struct marshal_glFragmentCoverageColorNV* cmd = args;
+    gles_driver.ext.glFragmentCoverageColorNV(cmd->color);
+}
+
+static void GL_APIENTRY marshal_glFragmentCoverageColorNV(GLuint color) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFragmentCoverageColorNV(color);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFragmentCoverageColorNV* cmd = glthread_alloc(exec_glFragmentCoverageColorNV, sizeof(*cmd));
+    cmd->color = color;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferFetchBarrierEXT {
+    char unused;
+};
+
+static void exec_glFramebufferFetchBarrierEXT(const void* args) {
+    (void)args;
+    gles_driver.ext.glFramebufferFetchBarrierEXT();
+}
+
+static void GL_APIENTRY marshal_glFramebufferFetchBarrierEXT(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferFetchBarrierEXT();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferFetchBarrierEXT* cmd = glthread_alloc(exec_glFramebufferFetchBarrierEXT, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferFetchBarrierQCOM {
+    char unused;
+};
+
+static void exec_glFramebufferFetchBarrierQCOM(const void* args) {
+    (void)args;
+    gles_driver.ext.glFramebufferFetchBarrierQCOM();
+}
+
+static void GL_APIENTRY marshal_glFramebufferFetchBarrierQCOM(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferFetchBarrierQCOM();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferFetchBarrierQCOM* cmd = glthread_alloc(exec_glFramebufferFetchBarrierQCOM, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferFoveationConfigQCOM {
+    GLuint framebuffer;
+    GLuint numLayers;
+    GLuint focalPointsPerLayer;
+    GLuint requestedFeatures;
+    GLuint *providedFeatures;
+};
+
+static void exec_glFramebufferFoveationConfigQCOM(const void* args) {
+    const struct marshal_glFramebufferFoveationConfigQCOM* cmd = args;
+    gles_driver.ext.glFramebufferFoveationConfigQCOM(cmd->framebuffer, cmd->numLayers, cmd->focalPointsPerLayer, cmd->requestedFeatures, cmd->providedFeatures);
+}
+
+static void GL_APIENTRY marshal_glFramebufferFoveationConfigQCOM(GLuint framebuffer, GLuint numLayers, GLuint focalPointsPerLayer, GLuint requestedFeatures, GLuint *providedFeatures) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferFoveationConfigQCOM(framebuffer, numLayers, focalPointsPerLayer, requestedFeatures, providedFeatures);
+        return;
+    }
+    struct marshal_glFramebufferFoveationConfigQCOM* cmd = glthread_alloc(exec_glFramebufferFoveationConfigQCOM, sizeof(*cmd));
+    cmd->framebuffer = framebuffer;
+    cmd->numLayers = numLayers;
+    cmd->focalPointsPerLayer = focalPointsPerLayer;
+    cmd->requestedFeatures = requestedFeatures;
+    cmd->providedFeatures = providedFeatures;
+    glthread_sync();
+}
+
+struct marshal_glFramebufferFoveationParametersQCOM {
+    GLuint framebuffer;
+    GLuint layer;
+    GLuint focalPoint;
+    GLfloat focalX;
+    GLfloat focalY;
+    GLfloat gainX;
+    GLfloat gainY;
+    GLfloat foveaArea;
+};
+
+static void exec_glFramebufferFoveationParametersQCOM(const void* args) {
+    const struct marshal_glFramebufferFoveationParametersQCOM* cmd = args;
+    gles_driver.ext.glFramebufferFoveationParametersQCOM(cmd->framebuffer, cmd->layer, cmd->focalPoint, cmd->focalX, cmd->focalY, cmd->gainX, cmd->gainY, cmd->foveaArea);
+}
+
+static void GL_APIENTRY marshal_glFramebufferFoveationParametersQCOM(GLuint framebuffer, GLuint layer, GLuint focalPoint, GLfloat focalX, GLfloat focalY, GLfloat gainX, GLfloat gainY, GLfloat foveaArea) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferFoveationParametersQCOM(framebuffer, layer, focalPoint, focalX, focalY, gainX, gainY, foveaArea);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferFoveationParametersQCOM* cmd = glthread_alloc(exec_glFramebufferFoveationParametersQCOM, sizeof(*cmd));
+    cmd->framebuffer = framebuffer;
+    cmd->layer = layer;
+    cmd->focalPoint = focalPoint;
+    cmd->focalX = focalX;
+    cmd->focalY = focalY;
+    cmd->gainX = gainX;
+    cmd->gainY = gainY;
+    cmd->foveaArea = foveaArea;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferPixelLocalStorageSizeEXT {
+    GLuint target;
+    GLsizei size;
+};
+
+static void exec_glFramebufferPixelLocalStorageSizeEXT(const void* args) {
+    const struct marshal_glFramebufferPixelLocalStorageSizeEXT* cmd = args;
+    gles_driver.ext.glFramebufferPixelLocalStorageSizeEXT(cmd->target, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glFramebufferPixelLocalStorageSizeEXT(GLuint target, GLsizei size) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferPixelLocalStorageSizeEXT(target, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferPixelLocalStorageSizeEXT* cmd = glthread_alloc(exec_glFramebufferPixelLocalStorageSizeEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferSampleLocationsfvNV {
+    GLenum target;
+    GLuint start;
+    GLsizei count;
+    const GLfloat *v;
+};
+
+static void exec_glFramebufferSampleLocationsfvNV(const void* args) {
+    const struct marshal_glFramebufferSampleLocationsfvNV* cmd = args;
+    gles_driver.ext.glFramebufferSampleLocationsfvNV(cmd->target, cmd->start, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glFramebufferSampleLocationsfvNV(GLenum target, GLuint start, GLsizei count, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferSampleLocationsfvNV(target, start, count, v);
+        return;
+    }
+    struct marshal_glFramebufferSampleLocationsfvNV* cmd = glthread_alloc(exec_glFramebufferSampleLocationsfvNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->start = start;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glFramebufferTexture2DDownsampleIMG {
+    GLenum target;
+    GLenum attachment;
+    GLenum textarget;
+    GLuint texture;
+    GLint level;
+    GLint xscale;
+    GLint yscale;
+};
+
+static void exec_glFramebufferTexture2DDownsampleIMG(const void* args) {
+    const struct marshal_glFramebufferTexture2DDownsampleIMG* cmd = args;
+    gles_driver.ext.glFramebufferTexture2DDownsampleIMG(cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level, cmd->xscale, cmd->yscale);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTexture2DDownsampleIMG(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint xscale, GLint yscale) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTexture2DDownsampleIMG(target, attachment, textarget, texture, level, xscale, yscale);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTexture2DDownsampleIMG* cmd = glthread_alloc(exec_glFramebufferTexture2DDownsampleIMG, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->textarget = textarget;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->xscale = xscale;
+    cmd->yscale = yscale;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTexture2DMultisampleEXT {
+    GLenum target;
+    GLenum attachment;
+    GLenum textarget;
+    GLuint texture;
+    GLint level;
+    GLsizei samples;
+};
+
+static void exec_glFramebufferTexture2DMultisampleEXT(const void* args) {
+    const struct marshal_glFramebufferTexture2DMultisampleEXT* cmd = args;
+    gles_driver.ext.glFramebufferTexture2DMultisampleEXT(cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level, cmd->samples);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTexture2DMultisampleEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTexture2DMultisampleEXT(target, attachment, textarget, texture, level, samples);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTexture2DMultisampleEXT* cmd = glthread_alloc(exec_glFramebufferTexture2DMultisampleEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->textarget = textarget;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->samples = samples;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTexture2DMultisampleIMG {
+    GLenum target;
+    GLenum attachment;
+    GLenum textarget;
+    GLuint texture;
+    GLint level;
+    GLsizei samples;
+};
+
+static void exec_glFramebufferTexture2DMultisampleIMG(const void* args) {
+    const struct marshal_glFramebufferTexture2DMultisampleIMG* cmd = args;
+    gles_driver.ext.glFramebufferTexture2DMultisampleIMG(cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level, cmd->samples);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTexture2DMultisampleIMG(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTexture2DMultisampleIMG(target, attachment, textarget, texture, level, samples);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTexture2DMultisampleIMG* cmd = glthread_alloc(exec_glFramebufferTexture2DMultisampleIMG, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->textarget = textarget;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->samples = samples;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTexture3DOES {
+    GLenum target;
+    GLenum attachment;
+    GLenum textarget;
+    GLuint texture;
+    GLint level;
+    GLint zoffset;
+};
+
+static void exec_glFramebufferTexture3DOES(const void* args) {
+    const struct marshal_glFramebufferTexture3DOES* cmd = args;
+    gles_driver.ext.glFramebufferTexture3DOES(cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level, cmd->zoffset);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTexture3DOES(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTexture3DOES* cmd = glthread_alloc(exec_glFramebufferTexture3DOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->textarget = textarget;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->zoffset = zoffset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTextureEXT {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+};
+
+static void exec_glFramebufferTextureEXT(const void* args) {
+    const struct marshal_glFramebufferTextureEXT* cmd = args;
+    gles_driver.ext.glFramebufferTextureEXT(cmd->target, cmd->attachment, cmd->texture, cmd->level);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTextureEXT(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTextureEXT(target, attachment, texture, level);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTextureEXT* cmd = glthread_alloc(exec_glFramebufferTextureEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTextureLayerDownsampleIMG {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+    GLint layer;
+    GLint xscale;
+    GLint yscale;
+};
+
+static void exec_glFramebufferTextureLayerDownsampleIMG(const void* args) {
+    const struct marshal_glFramebufferTextureLayerDownsampleIMG* cmd = args;
+    gles_driver.ext.glFramebufferTextureLayerDownsampleIMG(cmd->target, cmd->attachment, cmd->texture, cmd->level, cmd->layer, cmd->xscale, cmd->yscale);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTextureLayerDownsampleIMG(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer, GLint xscale, GLint yscale) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTextureLayerDownsampleIMG(target, attachment, texture, level, layer, xscale, yscale);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTextureLayerDownsampleIMG* cmd = glthread_alloc(exec_glFramebufferTextureLayerDownsampleIMG, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->layer = layer;
+    cmd->xscale = xscale;
+    cmd->yscale = yscale;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTextureMultisampleMultiviewOVR {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+    GLsizei samples;
+    GLint baseViewIndex;
+    GLsizei numViews;
+};
+
+static void exec_glFramebufferTextureMultisampleMultiviewOVR(const void* args) {
+    const struct marshal_glFramebufferTextureMultisampleMultiviewOVR* cmd = args;
+    gles_driver.ext.glFramebufferTextureMultisampleMultiviewOVR(cmd->target, cmd->attachment, cmd->texture, cmd->level, cmd->samples, cmd->baseViewIndex, cmd->numViews);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTextureMultisampleMultiviewOVR(GLenum target, GLenum attachment, GLuint texture, GLint level, GLsizei samples, GLint baseViewIndex, GLsizei numViews) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTextureMultisampleMultiviewOVR(target, attachment, texture, level, samples, baseViewIndex, numViews);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTextureMultisampleMultiviewOVR* cmd = glthread_alloc(exec_glFramebufferTextureMultisampleMultiviewOVR, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->samples = samples;
+    cmd->baseViewIndex = baseViewIndex;
+    cmd->numViews = numViews;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTextureMultiviewOVR {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+    GLint baseViewIndex;
+    GLsizei numViews;
+};
+
+static void exec_glFramebufferTextureMultiviewOVR(const void* args) {
+    const struct marshal_glFramebufferTextureMultiviewOVR* cmd = args;
+    gles_driver.ext.glFramebufferTextureMultiviewOVR(cmd->target, cmd->attachment, cmd->texture, cmd->level, cmd->baseViewIndex, cmd->numViews);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTextureMultiviewOVR(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTextureMultiviewOVR(target, attachment, texture, level, baseViewIndex, numViews);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTextureMultiviewOVR* cmd = glthread_alloc(exec_glFramebufferTextureMultiviewOVR, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->baseViewIndex = baseViewIndex;
+    cmd->numViews = numViews;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glFramebufferTextureOES {
+    GLenum target;
+    GLenum attachment;
+    GLuint texture;
+    GLint level;
+};
+
+static void exec_glFramebufferTextureOES(const void* args) {
+    const struct marshal_glFramebufferTextureOES* cmd = args;
+    gles_driver.ext.glFramebufferTextureOES(cmd->target, cmd->attachment, cmd->texture, cmd->level);
+}
+
+static void GL_APIENTRY marshal_glFramebufferTextureOES(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    if (!glthread_active()) {
+        gles_driver.ext.glFramebufferTextureOES(target, attachment, texture, level);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glFramebufferTextureOES* cmd = glthread_alloc(exec_glFramebufferTextureOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->attachment = attachment;
+    cmd->texture = texture;
+    cmd->level = level;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glGenFencesNV {
+    GLsizei n;
+    GLuint *fences;
+};
+
+static void exec_glGenFencesNV(const void* args) {
+    const struct marshal_glGenFencesNV* cmd = args;
+    gles_driver.ext.glGenFencesNV(cmd->n, cmd->fences);
+}
+
+static void GL_APIENTRY marshal_glGenFencesNV(GLsizei n, GLuint *fences) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGenFencesNV(n, fences);
+        return;
+    }
+    struct marshal_glGenFencesNV* cmd = glthread_alloc(exec_glGenFencesNV, sizeof(*cmd));
+    cmd->n = n;
+    cmd->fences = fences;
+    glthread_sync();
+}
+
+struct marshal_glGenPathsNV {
+    GLsizei range;
+    GLuint *result;
+};
+
+static void exec_glGenPathsNV(const void* args) {
+    const struct marshal_glGenPathsNV* cmd = args;
+    *cmd->result = gles_driver.ext.glGenPathsNV(cmd->range);
+}
+
+static GLuint GL_APIENTRY marshal_glGenPathsNV(GLsizei range) {
+    if (!glthread_active()) return gles_driver.ext.glGenPathsNV(range);
+    struct marshal_glGenPathsNV* cmd = glthread_alloc(exec_glGenPathsNV, sizeof(*cmd));
+    cmd->range = range;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGenPerfMonitorsAMD {
+    GLsizei n;
+    GLuint *monitors;
+};
+
+static void exec_glGenPerfMonitorsAMD(const void* args) {
+    const struct marshal_glGenPerfMonitorsAMD* cmd = args;
+    gles_driver.ext.glGenPerfMonitorsAMD(cmd->n, cmd->monitors);
+}
+
+static void GL_APIENTRY marshal_glGenPerfMonitorsAMD(GLsizei n, GLuint *monitors) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGenPerfMonitorsAMD(n, monitors);
+        return;
+    }
+    struct marshal_glGenPerfMonitorsAMD* cmd = glthread_alloc(exec_glGenPerfMonitorsAMD, sizeof(*cmd));
+    cmd->n = n;
+    cmd->monitors = monitors;
+    glthread_sync();
+}
+
+struct marshal_glGenProgramPipelinesEXT {
+    GLsizei n;
+    GLuint *pipelines;
+};
+
+static void exec_glGenProgramPipelinesEXT(const void* args) {
+    const struct marshal_glGenProgramPipelinesEXT* cmd = args;
+    gles_driver.ext.glGenProgramPipelinesEXT(cmd->n, cmd->pipelines);
+}
+
+static void GL_APIENTRY marshal_glGenProgramPipelinesEXT(GLsizei n, GLuint *pipelines) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGenProgramPipelinesEXT(n, pipelines);
+        return;
+    }
+    struct marshal_glGenProgramPipelinesEXT* cmd = glthread_alloc(exec_glGenProgramPipelinesEXT, sizeof(*cmd));
+    cmd->n = n;
+    cmd->pipelines = pipelines;
+    glthread_sync();
+}
+
+struct marshal_glGenQueriesEXT {
+    GLsizei n;
+    GLuint *ids;
+};
+
+static void exec_glGenQueriesEXT(const void* args) {
+    const struct marshal_glGenQueriesEXT* cmd = args;
+    gles_driver.ext.glGenQueriesEXT(cmd->n, cmd->ids);
+}
+
+static void GL_APIENTRY marshal_glGenQueriesEXT(GLsizei n, GLuint *ids) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGenQueriesEXT(n, ids);
+        return;
+    }
+    struct marshal_glGenQueriesEXT* cmd = glthread_alloc(exec_glGenQueriesEXT, sizeof(*cmd));
+    cmd->n = n;
+    cmd->ids = ids;
+    glthread_sync();
+}
+
+struct marshal_glGenSemaphoresEXT {
+    GLsizei n;
+    GLuint *semaphores;
+};
+
+static void exec_glGenSemaphoresEXT(const void* args) {
+    const struct marshal_glGenSemaphoresEXT* cmd = args;
+    gles_driver.ext.glGenSemaphoresEXT(cmd->n, cmd->semaphores);
+}
+
+static void GL_APIENTRY marshal_glGenSemaphoresEXT(GLsizei n, GLuint *semaphores) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGenSemaphoresEXT(n, semaphores);
+        return;
+    }
+    struct marshal_glGenSemaphoresEXT* cmd = glthread_alloc(exec_glGenSemaphoresEXT, sizeof(*cmd));
+    cmd->n = n;
+    cmd->semaphores = semaphores;
+    glthread_sync();
+}
+
+struct marshal_glGenVertexArraysOES {
+    GLsizei n;
+    GLuint *arrays;
+};
+
+static void exec_glGenVertexArraysOES(const void* args) {
+    const struct marshal_glGenVertexArraysOES* cmd = args;
+    gles_driver.ext.glGenVertexArraysOES(cmd->n, cmd->arrays);
+}
+
+static void GL_APIENTRY marshal_glGenVertexArraysOES(GLsizei n, GLuint *arrays) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGenVertexArraysOES(n, arrays);
+        return;
+    }
+    struct marshal_glGenVertexArraysOES* cmd = glthread_alloc(exec_glGenVertexArraysOES, sizeof(*cmd));
+    cmd->n = n;
+    cmd->arrays = arrays;
+    glthread_sync();
+}
+
+struct marshal_glGetBufferPointervOES {
+    GLenum target;
+    GLenum pname;
+    void **params;
+};
+
+static void exec_glGetBufferPointervOES(const void* args) {
+    const struct marshal_glGetBufferPointervOES* cmd = args;
+    gles_driver.ext.glGetBufferPointervOES(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetBufferPointervOES(GLenum target, GLenum pname, void **params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetBufferPointervOES(target, pname, params);
+        return;
+    }
+    struct marshal_glGetBufferPointervOES* cmd = glthread_alloc(exec_glGetBufferPointervOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetCoverageModulationTableNV {
+    GLsizei bufSize;
+    GLfloat *v;
+};
+
+static void exec_glGetCoverageModulationTableNV(const void* args) {
+    const struct marshal_glGetCoverageModulationTableNV* cmd = args;
+    gles_driver.ext.glGetCoverageModulationTableNV(cmd->bufSize, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glGetCoverageModulationTableNV(GLsizei bufSize, GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetCoverageModulationTableNV(bufSize, v);
+        return;
+    }
+    struct marshal_glGetCoverageModulationTableNV* cmd = glthread_alloc(exec_glGetCoverageModulationTableNV, sizeof(*cmd));
+    cmd->bufSize = bufSize;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glGetDebugMessageLogKHR {
+    GLuint count;
+    GLsizei bufSize;
+    GLenum *sources;
+    GLenum *types;
+    GLuint *ids;
+    GLenum *severities;
+    GLsizei *lengths;
+    GLchar *messageLog;
+    GLuint *result;
+};
+
+static void exec_glGetDebugMessageLogKHR(const void* args) {
+    const struct marshal_glGetDebugMessageLogKHR* cmd = args;
+    *cmd->result = gles_driver.ext.glGetDebugMessageLogKHR(cmd->count, cmd->bufSize, cmd->sources, cmd->types, cmd->ids, cmd->severities, cmd->lengths, cmd->messageLog);
+}
+
+static GLuint GL_APIENTRY marshal_glGetDebugMessageLogKHR(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    if (!glthread_active()) return gles_driver.ext.glGetDebugMessageLogKHR(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    struct marshal_glGetDebugMessageLogKHR* cmd = glthread_alloc(exec_glGetDebugMessageLogKHR, sizeof(*cmd));
+    cmd->count = count;
+    cmd->bufSize = bufSize;
+    cmd->sources = sources;
+    cmd->types = types;
+    cmd->ids = ids;
+    cmd->severities = severities;
+    cmd->lengths = lengths;
+    cmd->messageLog = messageLog;
+    GLuint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetDriverControlStringQCOM {
+    GLuint driverControl;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *driverControlString;
+};
+
+static void exec_glGetDriverControlStringQCOM(const void* args) {
+    const struct marshal_glGetDriverControlStringQCOM* cmd = args;
+    gles_driver.ext.glGetDriverControlStringQCOM(cmd->driverControl, cmd->bufSize, cmd->length, cmd->driverControlString);
+}
+
+static void GL_APIENTRY marshal_glGetDriverControlStringQCOM(GLuint driverControl, GLsizei bufSize, GLsizei *length, GLchar *driverControlString) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetDriverControlStringQCOM(driverControl, bufSize, length, driverControlString);
+        return;
+    }
+    struct marshal_glGetDriverControlStringQCOM* cmd = glthread_alloc(exec_glGetDriverControlStringQCOM, sizeof(*cmd));
+    cmd->driverControl = driverControl;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->driverControlString = driverControlString;
+    glthread_sync();
+}
+
+struct marshal_glGetDriverControlsQCOM {
+    GLint *num;
+    GLsizei size;
+    GLuint *driverControls;
+};
+
+static void exec_glGetDriverControlsQCOM(const void* args) {
+    const struct marshal_glGetDriverControlsQCOM* cmd = args;
+    gles_driver.ext.glGetDriverControlsQCOM(cmd->num, cmd->size, cmd->driverControls);
+}
+
+static void GL_APIENTRY marshal_glGetDriverControlsQCOM(GLint *num, GLsizei size, GLuint *driverControls) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetDriverControlsQCOM(num, size, driverControls);
+        return;
+    }
+    struct marshal_glGetDriverControlsQCOM* cmd = glthread_alloc(exec_glGetDriverControlsQCOM, sizeof(*cmd));
+    cmd->num = num;
+    cmd->size = size;
+    cmd->driverControls = driverControls;
+    glthread_sync();
+}
+
+struct marshal_glGetFenceivNV {
+    GLuint fence;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetFenceivNV(const void* args) {
+    const struct marshal_glGetFenceivNV* cmd = args;
+    gles_driver.ext.glGetFenceivNV(cmd->fence, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetFenceivNV(GLuint fence, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetFenceivNV(fence, pname, params);
+        return;
+    }
+    struct marshal_glGetFenceivNV* cmd = glthread_alloc(exec_glGetFenceivNV, sizeof(*cmd));
+    cmd->fence = fence;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetFirstPerfQueryIdINTEL {
+    GLuint *queryId;
+};
+
+static void exec_glGetFirstPerfQueryIdINTEL(const void* args) {
+    const struct marshal_glGetFirstPerfQueryIdINTEL* cmd = args;
+    gles_driver.ext.glGetFirstPerfQueryIdINTEL(cmd->queryId);
+}
+
+static void GL_APIENTRY marshal_glGetFirstPerfQueryIdINTEL(GLuint *queryId) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetFirstPerfQueryIdINTEL(queryId);
+        return;
+    }
+    struct marshal_glGetFirstPerfQueryIdINTEL* cmd = glthread_alloc(exec_glGetFirstPerfQueryIdINTEL, sizeof(*cmd));
+    cmd->queryId = queryId;
+    glthread_sync();
+}
+
+struct marshal_glGetFloati_vNV {
+    GLenum target;
+    GLuint index;
+    GLfloat *data;
+};
+
+static void exec_glGetFloati_vNV(const void* args) {
+    const struct marshal_glGetFloati_vNV* cmd = args;
+    gles_driver.ext.glGetFloati_vNV(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetFloati_vNV(GLenum target, GLuint index, GLfloat *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetFloati_vNV(target, index, data);
+        return;
+    }
+    struct marshal_glGetFloati_vNV* cmd = glthread_alloc(exec_glGetFloati_vNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetFloati_vOES {
+    GLenum target;
+    GLuint index;
+    GLfloat *data;
+};
+
+static void exec_glGetFloati_vOES(const void* args) {
+    const struct marshal_glGetFloati_vOES* cmd = args;
+    gles_driver.ext.glGetFloati_vOES(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetFloati_vOES(GLenum target, GLuint index, GLfloat *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetFloati_vOES(target, index, data);
+        return;
+    }
+    struct marshal_glGetFloati_vOES* cmd = glthread_alloc(exec_glGetFloati_vOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetFragDataIndexEXT {
+    GLuint program;
+    const GLchar *name;
+    GLint *result;
+};
+
+static void exec_glGetFragDataIndexEXT(const void* args) {
+    const struct marshal_glGetFragDataIndexEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glGetFragDataIndexEXT(cmd->program, cmd->name);
+}
+
+static GLint GL_APIENTRY marshal_glGetFragDataIndexEXT(GLuint program, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.ext.glGetFragDataIndexEXT(program, name);
+    struct marshal_glGetFragDataIndexEXT* cmd = glthread_alloc(exec_glGetFragDataIndexEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->name = name;
+    GLint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetFramebufferPixelLocalStorageSizeEXT {
+    GLuint target;
+    GLsizei *result;
+};
+
+static void exec_glGetFramebufferPixelLocalStorageSizeEXT(const void* args) {
+    const struct marshal_glGetFramebufferPixelLocalStorageSizeEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glGetFramebufferPixelLocalStorageSizeEXT(cmd->target);
+}
+
+static GLsizei GL_APIENTRY marshal_glGetFramebufferPixelLocalStorageSizeEXT(GLuint target) {
+    if (!glthread_active()) return gles_driver.ext.glGetFramebufferPixelLocalStorageSizeEXT(target);
+    struct marshal_glGetFramebufferPixelLocalStorageSizeEXT* cmd = glthread_alloc(exec_glGetFramebufferPixelLocalStorageSizeEXT, sizeof(*cmd));
+    cmd->target = target;
+    GLsizei glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetGraphicsResetStatusEXT {
+    GLenum *result;
+};
+
+static void exec_glGetGraphicsResetStatusEXT(const void* args) {
+    const struct marshal_glGetGraphicsResetStatusEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glGetGraphicsResetStatusEXT();
+}
+
+static GLenum GL_APIENTRY marshal_glGetGraphicsResetStatusEXT(void) {
+    if (!glthread_active()) return gles_driver.ext.glGetGraphicsResetStatusEXT();
+    struct marshal_glGetGraphicsResetStatusEXT* cmd = glthread_alloc(exec_glGetGraphicsResetStatusEXT, sizeof(*cmd));
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetGraphicsResetStatusKHR {
+    GLenum *result;
+};
+
+static void exec_glGetGraphicsResetStatusKHR(const void* args) {
+    const struct marshal_glGetGraphicsResetStatusKHR* cmd = args;
+    *cmd->result = gles_driver.ext.glGetGraphicsResetStatusKHR();
+}
+
+static GLenum GL_APIENTRY marshal_glGetGraphicsResetStatusKHR(void) {
+    if (!glthread_active()) return gles_driver.ext.glGetGraphicsResetStatusKHR();
+    struct marshal_glGetGraphicsResetStatusKHR* cmd = glthread_alloc(exec_glGetGraphicsResetStatusKHR, sizeof(*cmd));
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetImageHandleNV {
+    GLuint texture;
+    GLint level;
+    GLboolean layered;
+    GLint layer;
+    GLenum format;
+    GLuint64 *result;
+};
+
+static void exec_glGetImageHandleNV(const void* args) {
+    const struct marshal_glGetImageHandleNV* cmd = args;
+    *cmd->result = gles_driver.ext.glGetImageHandleNV(cmd->texture, cmd->level, cmd->layered, cmd->layer, cmd->format);
+}
+
+static GLuint64 GL_APIENTRY marshal_glGetImageHandleNV(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format) {
+    if (!glthread_active()) return gles_driver.ext.glGetImageHandleNV(texture, level, layered, layer, format);
+    struct marshal_glGetImageHandleNV* cmd = glthread_alloc(exec_glGetImageHandleNV, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->level = level;
+    cmd->layered = layered;
+    cmd->layer = layer;
+    cmd->format = format;
+    GLuint64 glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetInteger64vAPPLE {
+    GLenum pname;
+    GLint64 *params;
+};
+
+static void exec_glGetInteger64vAPPLE(const void* args) {
+    const struct marshal_glGetInteger64vAPPLE* cmd = args;
+    gles_driver.ext.glGetInteger64vAPPLE(cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetInteger64vAPPLE(GLenum pname, GLint64 *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetInteger64vAPPLE(pname, params);
+        return;
+    }
+    struct marshal_glGetInteger64vAPPLE* cmd = glthread_alloc(exec_glGetInteger64vAPPLE, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetIntegeri_vEXT {
+    GLenum target;
+    GLuint index;
+    GLint *data;
+};
+
+static void exec_glGetIntegeri_vEXT(const void* args) {
+    const struct marshal_glGetIntegeri_vEXT* cmd = args;
+    gles_driver.ext.glGetIntegeri_vEXT(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetIntegeri_vEXT(GLenum target, GLuint index, GLint *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetIntegeri_vEXT(target, index, data);
+        return;
+    }
+    struct marshal_glGetIntegeri_vEXT* cmd = glthread_alloc(exec_glGetIntegeri_vEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetInternalformatSampleivNV {
+    GLenum target;
+    GLenum internalformat;
+    GLsizei samples;
+    GLenum pname;
+    GLsizei count;
+    GLint *params;
+};
+
+static void exec_glGetInternalformatSampleivNV(const void* args) {
+    const struct marshal_glGetInternalformatSampleivNV* cmd = args;
+    gles_driver.ext.glGetInternalformatSampleivNV(cmd->target, cmd->internalformat, cmd->samples, cmd->pname, cmd->count, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetInternalformatSampleivNV(GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei count, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetInternalformatSampleivNV(target, internalformat, samples, pname, count, params);
+        return;
+    }
+    struct marshal_glGetInternalformatSampleivNV* cmd = glthread_alloc(exec_glGetInternalformatSampleivNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->samples = samples;
+    cmd->pname = pname;
+    cmd->count = count;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetMemoryObjectParameterivEXT {
+    GLuint memoryObject;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetMemoryObjectParameterivEXT(const void* args) {
+    const struct marshal_glGetMemoryObjectParameterivEXT* cmd = args;
+    gles_driver.ext.glGetMemoryObjectParameterivEXT(cmd->memoryObject, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetMemoryObjectParameterivEXT(memoryObject, pname, params);
+        return;
+    }
+    struct marshal_glGetMemoryObjectParameterivEXT* cmd = glthread_alloc(exec_glGetMemoryObjectParameterivEXT, sizeof(*cmd));
+    cmd->memoryObject = memoryObject;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetNextPerfQueryIdINTEL {
+    GLuint queryId;
+    GLuint *nextQueryId;
+};
+
+static void exec_glGetNextPerfQueryIdINTEL(const void* args) {
+    const struct marshal_glGetNextPerfQueryIdINTEL* cmd = args;
+    gles_driver.ext.glGetNextPerfQueryIdINTEL(cmd->queryId, cmd->nextQueryId);
+}
+
+static void GL_APIENTRY marshal_glGetNextPerfQueryIdINTEL(GLuint queryId, GLuint *nextQueryId) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetNextPerfQueryIdINTEL(queryId, nextQueryId);
+        return;
+    }
+    struct marshal_glGetNextPerfQueryIdINTEL* cmd = glthread_alloc(exec_glGetNextPerfQueryIdINTEL, sizeof(*cmd));
+    cmd->queryId = queryId;
+    cmd->nextQueryId = nextQueryId;
+    glthread_sync();
+}
+
+struct marshal_glGetObjectLabelEXT {
+    GLenum type;
+    GLuint object;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *label;
+};
+
+static void exec_glGetObjectLabelEXT(const void* args) {
+    const struct marshal_glGetObjectLabelEXT* cmd = args;
+    gles_driver.ext.glGetObjectLabelEXT(cmd->type, cmd->object, cmd->bufSize, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glGetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetObjectLabelEXT(type, object, bufSize, length, label);
+        return;
+    }
+    struct marshal_glGetObjectLabelEXT* cmd = glthread_alloc(exec_glGetObjectLabelEXT, sizeof(*cmd));
+    cmd->type = type;
+    cmd->object = object;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glGetObjectLabelKHR {
+    GLenum identifier;
+    GLuint name;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *label;
+};
+
+static void exec_glGetObjectLabelKHR(const void* args) {
+    const struct marshal_glGetObjectLabelKHR* cmd = args;
+    gles_driver.ext.glGetObjectLabelKHR(cmd->identifier, cmd->name, cmd->bufSize, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glGetObjectLabelKHR(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetObjectLabelKHR(identifier, name, bufSize, length, label);
+        return;
+    }
+    struct marshal_glGetObjectLabelKHR* cmd = glthread_alloc(exec_glGetObjectLabelKHR, sizeof(*cmd));
+    cmd->identifier = identifier;
+    cmd->name = name;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glGetObjectPtrLabelKHR {
+    const void *ptr;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *label;
+};
+
+static void exec_glGetObjectPtrLabelKHR(const void* args) {
+    const struct marshal_glGetObjectPtrLabelKHR* cmd = args;
+    gles_driver.ext.glGetObjectPtrLabelKHR(cmd->ptr, cmd->bufSize, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glGetObjectPtrLabelKHR(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetObjectPtrLabelKHR(ptr, bufSize, length, label);
+        return;
+    }
+    struct marshal_glGetObjectPtrLabelKHR* cmd = glthread_alloc(exec_glGetObjectPtrLabelKHR, sizeof(*cmd));
+    cmd->ptr = ptr;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glGetPathCommandsNV {
+    GLuint path;
+    GLubyte *commands;
+};
+
+static void exec_glGetPathCommandsNV(const void* args) {
+    const struct marshal_glGetPathCommandsNV* cmd = args;
+    gles_driver.ext.glGetPathCommandsNV(cmd->path, cmd->commands);
+}
+
+static void GL_APIENTRY marshal_glGetPathCommandsNV(GLuint path, GLubyte *commands) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathCommandsNV(path, commands);
+        return;
+    }
+    struct marshal_glGetPathCommandsNV* cmd = glthread_alloc(exec_glGetPathCommandsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->commands = commands;
+    glthread_sync();
+}
+
+struct marshal_glGetPathCoordsNV {
+    GLuint path;
+    GLfloat *coords;
+};
+
+static void exec_glGetPathCoordsNV(const void* args) {
+    const struct marshal_glGetPathCoordsNV* cmd = args;
+    gles_driver.ext.glGetPathCoordsNV(cmd->path, cmd->coords);
+}
+
+static void GL_APIENTRY marshal_glGetPathCoordsNV(GLuint path, GLfloat *coords) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathCoordsNV(path, coords);
+        return;
+    }
+    struct marshal_glGetPathCoordsNV* cmd = glthread_alloc(exec_glGetPathCoordsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->coords = coords;
+    glthread_sync();
+}
+
+struct marshal_glGetPathDashArrayNV {
+    GLuint path;
+    GLfloat *dashArray;
+};
+
+static void exec_glGetPathDashArrayNV(const void* args) {
+    const struct marshal_glGetPathDashArrayNV* cmd = args;
+    gles_driver.ext.glGetPathDashArrayNV(cmd->path, cmd->dashArray);
+}
+
+static void GL_APIENTRY marshal_glGetPathDashArrayNV(GLuint path, GLfloat *dashArray) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathDashArrayNV(path, dashArray);
+        return;
+    }
+    struct marshal_glGetPathDashArrayNV* cmd = glthread_alloc(exec_glGetPathDashArrayNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->dashArray = dashArray;
+    glthread_sync();
+}
+
+struct marshal_glGetPathLengthNV {
+    GLuint path;
+    GLsizei startSegment;
+    GLsizei numSegments;
+    GLfloat *result;
+};
+
+static void exec_glGetPathLengthNV(const void* args) {
+    const struct marshal_glGetPathLengthNV* cmd = args;
+    *cmd->result = gles_driver.ext.glGetPathLengthNV(cmd->path, cmd->startSegment, cmd->numSegments);
+}
+
+static GLfloat GL_APIENTRY marshal_glGetPathLengthNV(GLuint path, GLsizei startSegment, GLsizei numSegments) {
+    if (!glthread_active()) return gles_driver.ext.glGetPathLengthNV(path, startSegment, numSegments);
+    struct marshal_glGetPathLengthNV* cmd = glthread_alloc(exec_glGetPathLengthNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->startSegment = startSegment;
+    cmd->numSegments = numSegments;
+    GLfloat glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetPathMetricRangeNV {
+    GLbitfield metricQueryMask;
+    GLuint firstPathName;
+    GLsizei numPaths;
+    GLsizei stride;
+    GLfloat *metrics;
+};
+
+static void exec_glGetPathMetricRangeNV(const void* args) {
+    const struct marshal_glGetPathMetricRangeNV* cmd = args;
+    gles_driver.ext.glGetPathMetricRangeNV(cmd->metricQueryMask, cmd->firstPathName, cmd->numPaths, cmd->stride, cmd->metrics);
+}
+
+static void GL_APIENTRY marshal_glGetPathMetricRangeNV(GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathMetricRangeNV(metricQueryMask, firstPathName, numPaths, stride, metrics);
+        return;
+    }
+    struct marshal_glGetPathMetricRangeNV* cmd = glthread_alloc(exec_glGetPathMetricRangeNV, sizeof(*cmd));
+    cmd->metricQueryMask = metricQueryMask;
+    cmd->firstPathName = firstPathName;
+    cmd->numPaths = numPaths;
+    cmd->stride = stride;
+    cmd->metrics = metrics;
+    glthread_sync();
+}
+
+struct marshal_glGetPathMetricsNV {
+    GLbitfield metricQueryMask;
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLsizei stride;
+    GLfloat *metrics;
+};
+
+static void exec_glGetPathMetricsNV(const void* args) {
+    const struct marshal_glGetPathMetricsNV* cmd = args;
+    gles_driver.ext.glGetPathMetricsNV(cmd->metricQueryMask, cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->stride, cmd->metrics);
+}
+
+static void GL_APIENTRY marshal_glGetPathMetricsNV(GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathMetricsNV(metricQueryMask, numPaths, pathNameType, paths, pathBase, stride, metrics);
+        return;
+    }
+    struct marshal_glGetPathMetricsNV* cmd = glthread_alloc(exec_glGetPathMetricsNV, sizeof(*cmd));
+    cmd->metricQueryMask = metricQueryMask;
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->stride = stride;
+    cmd->metrics = metrics;
+    glthread_sync();
+}
+
+struct marshal_glGetPathParameterfvNV {
+    GLuint path;
+    GLenum pname;
+    GLfloat *value;
+};
+
+static void exec_glGetPathParameterfvNV(const void* args) {
+    const struct marshal_glGetPathParameterfvNV* cmd = args;
+    gles_driver.ext.glGetPathParameterfvNV(cmd->path, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glGetPathParameterfvNV(GLuint path, GLenum pname, GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathParameterfvNV(path, pname, value);
+        return;
+    }
+    struct marshal_glGetPathParameterfvNV* cmd = glthread_alloc(exec_glGetPathParameterfvNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->pname = pname;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glGetPathParameterivNV {
+    GLuint path;
+    GLenum pname;
+    GLint *value;
+};
+
+static void exec_glGetPathParameterivNV(const void* args) {
+    const struct marshal_glGetPathParameterivNV* cmd = args;
+    gles_driver.ext.glGetPathParameterivNV(cmd->path, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glGetPathParameterivNV(GLuint path, GLenum pname, GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathParameterivNV(path, pname, value);
+        return;
+    }
+    struct marshal_glGetPathParameterivNV* cmd = glthread_alloc(exec_glGetPathParameterivNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->pname = pname;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glGetPathSpacingNV {
+    GLenum pathListMode;
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLfloat advanceScale;
+    GLfloat kerningScale;
+    GLenum transformType;
+    GLfloat *returnedSpacing;
+};
+
+static void exec_glGetPathSpacingNV(const void* args) {
+    const struct marshal_glGetPathSpacingNV* cmd = args;
+    gles_driver.ext.glGetPathSpacingNV(cmd->pathListMode, cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->advanceScale, cmd->kerningScale, cmd->transformType, cmd->returnedSpacing);
+}
+
+static void GL_APIENTRY marshal_glGetPathSpacingNV(GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPathSpacingNV(pathListMode, numPaths, pathNameType, paths, pathBase, advanceScale, kerningScale, transformType, returnedSpacing);
+        return;
+    }
+    struct marshal_glGetPathSpacingNV* cmd = glthread_alloc(exec_glGetPathSpacingNV, sizeof(*cmd));
+    cmd->pathListMode = pathListMode;
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->advanceScale = advanceScale;
+    cmd->kerningScale = kerningScale;
+    cmd->transformType = transformType;
+    cmd->returnedSpacing = returnedSpacing;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfCounterInfoINTEL {
+    GLuint queryId;
+    GLuint counterId;
+    GLuint counterNameLength;
+    GLchar *counterName;
+    GLuint counterDescLength;
+    GLchar *counterDesc;
+    GLuint *counterOffset;
+    GLuint *counterDataSize;
+    GLuint *counterTypeEnum;
+    GLuint *counterDataTypeEnum;
+    GLuint64 *rawCounterMaxValue;
+};
+
+static void exec_glGetPerfCounterInfoINTEL(const void* args) {
+    const struct marshal_glGetPerfCounterInfoINTEL* cmd = args;
+    gles_driver.ext.glGetPerfCounterInfoINTEL(cmd->queryId, cmd->counterId, cmd->counterNameLength, cmd->counterName, cmd->counterDescLength, cmd->counterDesc, cmd->counterOffset, cmd->counterDataSize, cmd->counterTypeEnum, cmd->counterDataTypeEnum, cmd->rawCounterMaxValue);
+}
+
+static void GL_APIENTRY marshal_glGetPerfCounterInfoINTEL(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfCounterInfoINTEL(queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue);
+        return;
+    }
+    struct marshal_glGetPerfCounterInfoINTEL* cmd = glthread_alloc(exec_glGetPerfCounterInfoINTEL, sizeof(*cmd));
+    cmd->queryId = queryId;
+    cmd->counterId = counterId;
+    cmd->counterNameLength = counterNameLength;
+    cmd->counterName = counterName;
+    cmd->counterDescLength = counterDescLength;
+    cmd->counterDesc = counterDesc;
+    cmd->counterOffset = counterOffset;
+    cmd->counterDataSize = counterDataSize;
+    cmd->counterTypeEnum = counterTypeEnum;
+    cmd->counterDataTypeEnum = counterDataTypeEnum;
+    cmd->rawCounterMaxValue = rawCounterMaxValue;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfMonitorCounterDataAMD {
+    GLuint monitor;
+    GLenum pname;
+    GLsizei dataSize;
+    GLuint *data;
+    GLint *bytesWritten;
+};
+
+static void exec_glGetPerfMonitorCounterDataAMD(const void* args) {
+    const struct marshal_glGetPerfMonitorCounterDataAMD* cmd = args;
+    gles_driver.ext.glGetPerfMonitorCounterDataAMD(cmd->monitor, cmd->pname, cmd->dataSize, cmd->data, cmd->bytesWritten);
+}
+
+static void GL_APIENTRY marshal_glGetPerfMonitorCounterDataAMD(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfMonitorCounterDataAMD(monitor, pname, dataSize, data, bytesWritten);
+        return;
+    }
+    struct marshal_glGetPerfMonitorCounterDataAMD* cmd = glthread_alloc(exec_glGetPerfMonitorCounterDataAMD, sizeof(*cmd));
+    cmd->monitor = monitor;
+    cmd->pname = pname;
+    cmd->dataSize = dataSize;
+    cmd->data = data;
+    cmd->bytesWritten = bytesWritten;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfMonitorCounterInfoAMD {
+    GLuint group;
+    GLuint counter;
+    GLenum pname;
+    void *data;
+};
+
+static void exec_glGetPerfMonitorCounterInfoAMD(const void* args) {
+    const struct marshal_glGetPerfMonitorCounterInfoAMD* cmd = args;
+    gles_driver.ext.glGetPerfMonitorCounterInfoAMD(cmd->group, cmd->counter, cmd->pname, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetPerfMonitorCounterInfoAMD(GLuint group, GLuint counter, GLenum pname, void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfMonitorCounterInfoAMD(group, counter, pname, data);
+        return;
+    }
+    struct marshal_glGetPerfMonitorCounterInfoAMD* cmd = glthread_alloc(exec_glGetPerfMonitorCounterInfoAMD, sizeof(*cmd));
+    cmd->group = group;
+    cmd->counter = counter;
+    cmd->pname = pname;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfMonitorCounterStringAMD {
+    GLuint group;
+    GLuint counter;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *counterString;
+};
+
+static void exec_glGetPerfMonitorCounterStringAMD(const void* args) {
+    const struct marshal_glGetPerfMonitorCounterStringAMD* cmd = args;
+    gles_driver.ext.glGetPerfMonitorCounterStringAMD(cmd->group, cmd->counter, cmd->bufSize, cmd->length, cmd->counterString);
+}
+
+static void GL_APIENTRY marshal_glGetPerfMonitorCounterStringAMD(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfMonitorCounterStringAMD(group, counter, bufSize, length, counterString);
+        return;
+    }
+    struct marshal_glGetPerfMonitorCounterStringAMD* cmd = glthread_alloc(exec_glGetPerfMonitorCounterStringAMD, sizeof(*cmd));
+    cmd->group = group;
+    cmd->counter = counter;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->counterString = counterString;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfMonitorCountersAMD {
+    GLuint group;
+    GLint *numCounters;
+    GLint *maxActiveCounters;
+    GLsizei counterSize;
+    GLuint *counters;
+};
+
+static void exec_glGetPerfMonitorCountersAMD(const void* args) {
+    const struct marshal_glGetPerfMonitorCountersAMD* cmd = args;
+    gles_driver.ext.glGetPerfMonitorCountersAMD(cmd->group, cmd->numCounters, cmd->maxActiveCounters, cmd->counterSize, cmd->counters);
+}
+
+static void GL_APIENTRY marshal_glGetPerfMonitorCountersAMD(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfMonitorCountersAMD(group, numCounters, maxActiveCounters, counterSize, counters);
+        return;
+    }
+    struct marshal_glGetPerfMonitorCountersAMD* cmd = glthread_alloc(exec_glGetPerfMonitorCountersAMD, sizeof(*cmd));
+    cmd->group = group;
+    cmd->numCounters = numCounters;
+    cmd->maxActiveCounters = maxActiveCounters;
+    cmd->counterSize = counterSize;
+    cmd->counters = counters;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfMonitorGroupStringAMD {
+    GLuint group;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *groupString;
+};
+
+static void exec_glGetPerfMonitorGroupStringAMD(const void* args) {
+    const struct marshal_glGetPerfMonitorGroupStringAMD* cmd = args;
+    gles_driver.ext.glGetPerfMonitorGroupStringAMD(cmd->group, cmd->bufSize, cmd->length, cmd->groupString);
+}
+
+static void GL_APIENTRY marshal_glGetPerfMonitorGroupStringAMD(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfMonitorGroupStringAMD(group, bufSize, length, groupString);
+        return;
+    }
+    struct marshal_glGetPerfMonitorGroupStringAMD* cmd = glthread_alloc(exec_glGetPerfMonitorGroupStringAMD, sizeof(*cmd));
+    cmd->group = group;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->groupString = groupString;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfMonitorGroupsAMD {
+    GLint *numGroups;
+    GLsizei groupsSize;
+    GLuint *groups;
+};
+
+static void exec_glGetPerfMonitorGroupsAMD(const void* args) {
+    const struct marshal_glGetPerfMonitorGroupsAMD* cmd = args;
+    gles_driver.ext.glGetPerfMonitorGroupsAMD(cmd->numGroups, cmd->groupsSize, cmd->groups);
+}
+
+static void GL_APIENTRY marshal_glGetPerfMonitorGroupsAMD(GLint *numGroups, GLsizei groupsSize, GLuint *groups) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfMonitorGroupsAMD(numGroups, groupsSize, groups);
+        return;
+    }
+    struct marshal_glGetPerfMonitorGroupsAMD* cmd = glthread_alloc(exec_glGetPerfMonitorGroupsAMD, sizeof(*cmd));
+    cmd->numGroups = numGroups;
+    cmd->groupsSize = groupsSize;
+    cmd->groups = groups;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfQueryDataINTEL {
+    GLuint queryHandle;
+    GLuint flags;
+    GLsizei dataSize;
+    void *data;
+    GLuint *bytesWritten;
+};
+
+static void exec_glGetPerfQueryDataINTEL(const void* args) {
+    const struct marshal_glGetPerfQueryDataINTEL* cmd = args;
+    gles_driver.ext.glGetPerfQueryDataINTEL(cmd->queryHandle, cmd->flags, cmd->dataSize, cmd->data, cmd->bytesWritten);
+}
+
+static void GL_APIENTRY marshal_glGetPerfQueryDataINTEL(GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfQueryDataINTEL(queryHandle, flags, dataSize, data, bytesWritten);
+        return;
+    }
+    struct marshal_glGetPerfQueryDataINTEL* cmd = glthread_alloc(exec_glGetPerfQueryDataINTEL, sizeof(*cmd));
+    cmd->queryHandle = queryHandle;
+    cmd->flags = flags;
+    cmd->dataSize = dataSize;
+    cmd->data = data;
+    cmd->bytesWritten = bytesWritten;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfQueryIdByNameINTEL {
+    GLchar *queryName;
+    GLuint *queryId;
+};
+
+static void exec_glGetPerfQueryIdByNameINTEL(const void* args) {
+    const struct marshal_glGetPerfQueryIdByNameINTEL* cmd = args;
+    gles_driver.ext.glGetPerfQueryIdByNameINTEL(cmd->queryName, cmd->queryId);
+}
+
+static void GL_APIENTRY marshal_glGetPerfQueryIdByNameINTEL(GLchar *queryName, GLuint *queryId) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfQueryIdByNameINTEL(queryName, queryId);
+        return;
+    }
+    struct marshal_glGetPerfQueryIdByNameINTEL* cmd = glthread_alloc(exec_glGetPerfQueryIdByNameINTEL, sizeof(*cmd));
+    cmd->queryName = queryName;
+    cmd->queryId = queryId;
+    glthread_sync();
+}
+
+struct marshal_glGetPerfQueryInfoINTEL {
+    GLuint queryId;
+    GLuint queryNameLength;
+    GLchar *queryName;
+    GLuint *dataSize;
+    GLuint *noCounters;
+    GLuint *noInstances;
+    GLuint *capsMask;
+};
+
+static void exec_glGetPerfQueryInfoINTEL(const void* args) {
+    const struct marshal_glGetPerfQueryInfoINTEL* cmd = args;
+    gles_driver.ext.glGetPerfQueryInfoINTEL(cmd->queryId, cmd->queryNameLength, cmd->queryName, cmd->dataSize, cmd->noCounters, cmd->noInstances, cmd->capsMask);
+}
+
+static void GL_APIENTRY marshal_glGetPerfQueryInfoINTEL(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPerfQueryInfoINTEL(queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask);
+        return;
+    }
+    struct marshal_glGetPerfQueryInfoINTEL* cmd = glthread_alloc(exec_glGetPerfQueryInfoINTEL, sizeof(*cmd));
+    cmd->queryId = queryId;
+    cmd->queryNameLength = queryNameLength;
+    cmd->queryName = queryName;
+    cmd->dataSize = dataSize;
+    cmd->noCounters = noCounters;
+    cmd->noInstances = noInstances;
+    cmd->capsMask = capsMask;
+    glthread_sync();
+}
+
+struct marshal_glGetPointervKHR {
+    GLenum pname;
+    void **params;
+};
+
+static void exec_glGetPointervKHR(const void* args) {
+    const struct marshal_glGetPointervKHR* cmd = args;
+    gles_driver.ext.glGetPointervKHR(cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetPointervKHR(GLenum pname, void **params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetPointervKHR(pname, params);
+        return;
+    }
+    struct marshal_glGetPointervKHR* cmd = glthread_alloc(exec_glGetPointervKHR, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramBinaryOES {
+    GLuint program;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLenum *binaryFormat;
+    void *binary;
+};
+
+static void exec_glGetProgramBinaryOES(const void* args) {
+    const struct marshal_glGetProgramBinaryOES* cmd = args;
+    gles_driver.ext.glGetProgramBinaryOES(cmd->program, cmd->bufSize, cmd->length, cmd->binaryFormat, cmd->binary);
+}
+
+static void GL_APIENTRY marshal_glGetProgramBinaryOES(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetProgramBinaryOES(program, bufSize, length, binaryFormat, binary);
+        return;
+    }
+    struct marshal_glGetProgramBinaryOES* cmd = glthread_alloc(exec_glGetProgramBinaryOES, sizeof(*cmd));
+    cmd->program = program;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->binaryFormat = binaryFormat;
+    cmd->binary = binary;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramPipelineInfoLogEXT {
+    GLuint pipeline;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *infoLog;
+};
+
+static void exec_glGetProgramPipelineInfoLogEXT(const void* args) {
+    const struct marshal_glGetProgramPipelineInfoLogEXT* cmd = args;
+    gles_driver.ext.glGetProgramPipelineInfoLogEXT(cmd->pipeline, cmd->bufSize, cmd->length, cmd->infoLog);
+}
+
+static void GL_APIENTRY marshal_glGetProgramPipelineInfoLogEXT(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetProgramPipelineInfoLogEXT(pipeline, bufSize, length, infoLog);
+        return;
+    }
+    struct marshal_glGetProgramPipelineInfoLogEXT* cmd = glthread_alloc(exec_glGetProgramPipelineInfoLogEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->infoLog = infoLog;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramPipelineivEXT {
+    GLuint pipeline;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetProgramPipelineivEXT(const void* args) {
+    const struct marshal_glGetProgramPipelineivEXT* cmd = args;
+    gles_driver.ext.glGetProgramPipelineivEXT(cmd->pipeline, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetProgramPipelineivEXT(pipeline, pname, params);
+        return;
+    }
+    struct marshal_glGetProgramPipelineivEXT* cmd = glthread_alloc(exec_glGetProgramPipelineivEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetProgramResourceLocationIndexEXT {
+    GLuint program;
+    GLenum programInterface;
+    const GLchar *name;
+    GLint *result;
+};
+
+static void exec_glGetProgramResourceLocationIndexEXT(const void* args) {
+    const struct marshal_glGetProgramResourceLocationIndexEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glGetProgramResourceLocationIndexEXT(cmd->program, cmd->programInterface, cmd->name);
+}
+
+static GLint GL_APIENTRY marshal_glGetProgramResourceLocationIndexEXT(GLuint program, GLenum programInterface, const GLchar *name) {
+    if (!glthread_active()) return gles_driver.ext.glGetProgramResourceLocationIndexEXT(program, programInterface, name);
+    struct marshal_glGetProgramResourceLocationIndexEXT* cmd = glthread_alloc(exec_glGetProgramResourceLocationIndexEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->name = name;
+    GLint glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetProgramResourcefvNV {
+    GLuint program;
+    GLenum programInterface;
+    GLuint index;
+    GLsizei propCount;
+    const GLenum *props;
+    GLsizei count;
+    GLsizei *length;
+    GLfloat *params;
+};
+
+static void exec_glGetProgramResourcefvNV(const void* args) {
+    const struct marshal_glGetProgramResourcefvNV* cmd = args;
+    gles_driver.ext.glGetProgramResourcefvNV(cmd->program, cmd->programInterface, cmd->index, cmd->propCount, cmd->props, cmd->count, cmd->length, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetProgramResourcefvNV(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetProgramResourcefvNV(program, programInterface, index, propCount, props, count, length, params);
+        return;
+    }
+    struct marshal_glGetProgramResourcefvNV* cmd = glthread_alloc(exec_glGetProgramResourcefvNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->programInterface = programInterface;
+    cmd->index = index;
+    cmd->propCount = propCount;
+    cmd->props = props;
+    cmd->count = count;
+    cmd->length = length;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryObjecti64vEXT {
+    GLuint id;
+    GLenum pname;
+    GLint64 *params;
+};
+
+static void exec_glGetQueryObjecti64vEXT(const void* args) {
+    const struct marshal_glGetQueryObjecti64vEXT* cmd = args;
+    gles_driver.ext.glGetQueryObjecti64vEXT(cmd->id, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetQueryObjecti64vEXT(id, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryObjecti64vEXT* cmd = glthread_alloc(exec_glGetQueryObjecti64vEXT, sizeof(*cmd));
+    cmd->id = id;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryObjectivEXT {
+    GLuint id;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetQueryObjectivEXT(const void* args) {
+    const struct marshal_glGetQueryObjectivEXT* cmd = args;
+    gles_driver.ext.glGetQueryObjectivEXT(cmd->id, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetQueryObjectivEXT(id, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryObjectivEXT* cmd = glthread_alloc(exec_glGetQueryObjectivEXT, sizeof(*cmd));
+    cmd->id = id;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryObjectui64vEXT {
+    GLuint id;
+    GLenum pname;
+    GLuint64 *params;
+};
+
+static void exec_glGetQueryObjectui64vEXT(const void* args) {
+    const struct marshal_glGetQueryObjectui64vEXT* cmd = args;
+    gles_driver.ext.glGetQueryObjectui64vEXT(cmd->id, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetQueryObjectui64vEXT(id, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryObjectui64vEXT* cmd = glthread_alloc(exec_glGetQueryObjectui64vEXT, sizeof(*cmd));
+    cmd->id = id;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryObjectuivEXT {
+    GLuint id;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetQueryObjectuivEXT(const void* args) {
+    const struct marshal_glGetQueryObjectuivEXT* cmd = args;
+    gles_driver.ext.glGetQueryObjectuivEXT(cmd->id, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetQueryObjectuivEXT(id, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryObjectuivEXT* cmd = glthread_alloc(exec_glGetQueryObjectuivEXT, sizeof(*cmd));
+    cmd->id = id;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetQueryivEXT {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetQueryivEXT(const void* args) {
+    const struct marshal_glGetQueryivEXT* cmd = args;
+    gles_driver.ext.glGetQueryivEXT(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetQueryivEXT(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetQueryivEXT(target, pname, params);
+        return;
+    }
+    struct marshal_glGetQueryivEXT* cmd = glthread_alloc(exec_glGetQueryivEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterIivEXT {
+    GLuint sampler;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetSamplerParameterIivEXT(const void* args) {
+    const struct marshal_glGetSamplerParameterIivEXT* cmd = args;
+    gles_driver.ext.glGetSamplerParameterIivEXT(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterIivEXT(GLuint sampler, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetSamplerParameterIivEXT(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterIivEXT* cmd = glthread_alloc(exec_glGetSamplerParameterIivEXT, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterIivOES {
+    GLuint sampler;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetSamplerParameterIivOES(const void* args) {
+    const struct marshal_glGetSamplerParameterIivOES* cmd = args;
+    gles_driver.ext.glGetSamplerParameterIivOES(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterIivOES(GLuint sampler, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetSamplerParameterIivOES(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterIivOES* cmd = glthread_alloc(exec_glGetSamplerParameterIivOES, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterIuivEXT {
+    GLuint sampler;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetSamplerParameterIuivEXT(const void* args) {
+    const struct marshal_glGetSamplerParameterIuivEXT* cmd = args;
+    gles_driver.ext.glGetSamplerParameterIuivEXT(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterIuivEXT(GLuint sampler, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetSamplerParameterIuivEXT(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterIuivEXT* cmd = glthread_alloc(exec_glGetSamplerParameterIuivEXT, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSamplerParameterIuivOES {
+    GLuint sampler;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetSamplerParameterIuivOES(const void* args) {
+    const struct marshal_glGetSamplerParameterIuivOES* cmd = args;
+    gles_driver.ext.glGetSamplerParameterIuivOES(cmd->sampler, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSamplerParameterIuivOES(GLuint sampler, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetSamplerParameterIuivOES(sampler, pname, params);
+        return;
+    }
+    struct marshal_glGetSamplerParameterIuivOES* cmd = glthread_alloc(exec_glGetSamplerParameterIuivOES, sizeof(*cmd));
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSemaphoreParameterui64vEXT {
+    GLuint semaphore;
+    GLenum pname;
+    GLuint64 *params;
+};
+
+static void exec_glGetSemaphoreParameterui64vEXT(const void* args) {
+    const struct marshal_glGetSemaphoreParameterui64vEXT* cmd = args;
+    gles_driver.ext.glGetSemaphoreParameterui64vEXT(cmd->semaphore, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, GLuint64 *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetSemaphoreParameterui64vEXT(semaphore, pname, params);
+        return;
+    }
+    struct marshal_glGetSemaphoreParameterui64vEXT* cmd = glthread_alloc(exec_glGetSemaphoreParameterui64vEXT, sizeof(*cmd));
+    cmd->semaphore = semaphore;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetSyncivAPPLE {
+    GLsync sync;
+    GLenum pname;
+    GLsizei count;
+    GLsizei *length;
+    GLint *values;
+};
+
+static void exec_glGetSyncivAPPLE(const void* args) {
+    const struct marshal_glGetSyncivAPPLE* cmd = args;
+    gles_driver.ext.glGetSyncivAPPLE(cmd->sync, cmd->pname, cmd->count, cmd->length, cmd->values);
+}
+
+static void GL_APIENTRY marshal_glGetSyncivAPPLE(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetSyncivAPPLE(sync, pname, count, length, values);
+        return;
+    }
+    struct marshal_glGetSyncivAPPLE* cmd = glthread_alloc(exec_glGetSyncivAPPLE, sizeof(*cmd));
+    cmd->sync = sync;
+    cmd->pname = pname;
+    cmd->count = count;
+    cmd->length = length;
+    cmd->values = values;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterIivEXT {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetTexParameterIivEXT(const void* args) {
+    const struct marshal_glGetTexParameterIivEXT* cmd = args;
+    gles_driver.ext.glGetTexParameterIivEXT(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterIivEXT(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetTexParameterIivEXT(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterIivEXT* cmd = glthread_alloc(exec_glGetTexParameterIivEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterIivOES {
+    GLenum target;
+    GLenum pname;
+    GLint *params;
+};
+
+static void exec_glGetTexParameterIivOES(const void* args) {
+    const struct marshal_glGetTexParameterIivOES* cmd = args;
+    gles_driver.ext.glGetTexParameterIivOES(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterIivOES(GLenum target, GLenum pname, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetTexParameterIivOES(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterIivOES* cmd = glthread_alloc(exec_glGetTexParameterIivOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterIuivEXT {
+    GLenum target;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetTexParameterIuivEXT(const void* args) {
+    const struct marshal_glGetTexParameterIuivEXT* cmd = args;
+    gles_driver.ext.glGetTexParameterIuivEXT(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetTexParameterIuivEXT(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterIuivEXT* cmd = glthread_alloc(exec_glGetTexParameterIuivEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTexParameterIuivOES {
+    GLenum target;
+    GLenum pname;
+    GLuint *params;
+};
+
+static void exec_glGetTexParameterIuivOES(const void* args) {
+    const struct marshal_glGetTexParameterIuivOES* cmd = args;
+    gles_driver.ext.glGetTexParameterIuivOES(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetTexParameterIuivOES(GLenum target, GLenum pname, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetTexParameterIuivOES(target, pname, params);
+        return;
+    }
+    struct marshal_glGetTexParameterIuivOES* cmd = glthread_alloc(exec_glGetTexParameterIuivOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetTextureHandleIMG {
+    GLuint texture;
+    GLuint64 *result;
+};
+
+static void exec_glGetTextureHandleIMG(const void* args) {
+    const struct marshal_glGetTextureHandleIMG* cmd = args;
+    *cmd->result = gles_driver.ext.glGetTextureHandleIMG(cmd->texture);
+}
+
+static GLuint64 GL_APIENTRY marshal_glGetTextureHandleIMG(GLuint texture) {
+    if (!glthread_active()) return gles_driver.ext.glGetTextureHandleIMG(texture);
+    struct marshal_glGetTextureHandleIMG* cmd = glthread_alloc(exec_glGetTextureHandleIMG, sizeof(*cmd));
+    cmd->texture = texture;
+    GLuint64 glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetTextureHandleNV {
+    GLuint texture;
+    GLuint64 *result;
+};
+
+static void exec_glGetTextureHandleNV(const void* args) {
+    const struct marshal_glGetTextureHandleNV* cmd = args;
+    *cmd->result = gles_driver.ext.glGetTextureHandleNV(cmd->texture);
+}
+
+static GLuint64 GL_APIENTRY marshal_glGetTextureHandleNV(GLuint texture) {
+    if (!glthread_active()) return gles_driver.ext.glGetTextureHandleNV(texture);
+    struct marshal_glGetTextureHandleNV* cmd = glthread_alloc(exec_glGetTextureHandleNV, sizeof(*cmd));
+    cmd->texture = texture;
+    GLuint64 glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetTextureSamplerHandleIMG {
+    GLuint texture;
+    GLuint sampler;
+    GLuint64 *result;
+};
+
+static void exec_glGetTextureSamplerHandleIMG(const void* args) {
+    const struct marshal_glGetTextureSamplerHandleIMG* cmd = args;
+    *cmd->result = gles_driver.ext.glGetTextureSamplerHandleIMG(cmd->texture, cmd->sampler);
+}
+
+static GLuint64 GL_APIENTRY marshal_glGetTextureSamplerHandleIMG(GLuint texture, GLuint sampler) {
+    if (!glthread_active()) return gles_driver.ext.glGetTextureSamplerHandleIMG(texture, sampler);
+    struct marshal_glGetTextureSamplerHandleIMG* cmd = glthread_alloc(exec_glGetTextureSamplerHandleIMG, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->sampler = sampler;
+    GLuint64 glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetTextureSamplerHandleNV {
+    GLuint texture;
+    GLuint sampler;
+    GLuint64 *result;
+};
+
+static void exec_glGetTextureSamplerHandleNV(const void* args) {
+    const struct marshal_glGetTextureSamplerHandleNV* cmd = args;
+    *cmd->result = gles_driver.ext.glGetTextureSamplerHandleNV(cmd->texture, cmd->sampler);
+}
+
+static GLuint64 GL_APIENTRY marshal_glGetTextureSamplerHandleNV(GLuint texture, GLuint sampler) {
+    if (!glthread_active()) return gles_driver.ext.glGetTextureSamplerHandleNV(texture, sampler);
+    struct marshal_glGetTextureSamplerHandleNV* cmd = glthread_alloc(exec_glGetTextureSamplerHandleNV, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->sampler = sampler;
+    GLuint64 glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetTranslatedShaderSourceANGLE {
+    GLuint shader;
+    GLsizei bufSize;
+    GLsizei *length;
+    GLchar *source;
+};
+
+static void exec_glGetTranslatedShaderSourceANGLE(const void* args) {
+    const struct marshal_glGetTranslatedShaderSourceANGLE* cmd = args;
+    gles_driver.ext.glGetTranslatedShaderSourceANGLE(cmd->shader, cmd->bufSize, cmd->length, cmd->source);
+}
+
+static void GL_APIENTRY marshal_glGetTranslatedShaderSourceANGLE(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetTranslatedShaderSourceANGLE(shader, bufSize, length, source);
+        return;
+    }
+    struct marshal_glGetTranslatedShaderSourceANGLE* cmd = glthread_alloc(exec_glGetTranslatedShaderSourceANGLE, sizeof(*cmd));
+    cmd->shader = shader;
+    cmd->bufSize = bufSize;
+    cmd->length = length;
+    cmd->source = source;
+    glthread_sync();
+}
+
+struct marshal_glGetUniformi64vNV {
+    GLuint program;
+    GLint location;
+    GLint64EXT *params;
+};
+
+static void exec_glGetUniformi64vNV(const void* args) {
+    const struct marshal_glGetUniformi64vNV* cmd = args;
+    gles_driver.ext.glGetUniformi64vNV(cmd->program, cmd->location, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetUniformi64vNV(GLuint program, GLint location, GLint64EXT *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetUniformi64vNV(program, location, params);
+        return;
+    }
+    struct marshal_glGetUniformi64vNV* cmd = glthread_alloc(exec_glGetUniformi64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetUnsignedBytei_vEXT {
+    GLenum target;
+    GLuint index;
+    GLubyte *data;
+};
+
+static void exec_glGetUnsignedBytei_vEXT(const void* args) {
+    const struct marshal_glGetUnsignedBytei_vEXT* cmd = args;
+    gles_driver.ext.glGetUnsignedBytei_vEXT(cmd->target, cmd->index, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetUnsignedBytei_vEXT(target, index, data);
+        return;
+    }
+    struct marshal_glGetUnsignedBytei_vEXT* cmd = glthread_alloc(exec_glGetUnsignedBytei_vEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetUnsignedBytevEXT {
+    GLenum pname;
+    GLubyte *data;
+};
+
+static void exec_glGetUnsignedBytevEXT(const void* args) {
+    const struct marshal_glGetUnsignedBytevEXT* cmd = args;
+    gles_driver.ext.glGetUnsignedBytevEXT(cmd->pname, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glGetUnsignedBytevEXT(GLenum pname, GLubyte *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetUnsignedBytevEXT(pname, data);
+        return;
+    }
+    struct marshal_glGetUnsignedBytevEXT* cmd = glthread_alloc(exec_glGetUnsignedBytevEXT, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glGetVkProcAddrNV {
+    const GLchar *name;
+    GLVULKANPROCNV *result;
+};
+
+static void exec_glGetVkProcAddrNV(const void* args) {
+    const struct marshal_glGetVkProcAddrNV* cmd = args;
+    *cmd->result = gles_driver.ext.glGetVkProcAddrNV(cmd->name);
+}
+
+static GLVULKANPROCNV GL_APIENTRY marshal_glGetVkProcAddrNV(const GLchar *name) {
+    if (!glthread_active()) return gles_driver.ext.glGetVkProcAddrNV(name);
+    struct marshal_glGetVkProcAddrNV* cmd = glthread_alloc(exec_glGetVkProcAddrNV, sizeof(*cmd));
+    cmd->name = name;
+    GLVULKANPROCNV glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glGetnUniformfvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLfloat *params;
+};
+
+static void exec_glGetnUniformfvEXT(const void* args) {
+    const struct marshal_glGetnUniformfvEXT* cmd = args;
+    gles_driver.ext.glGetnUniformfvEXT(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformfvEXT(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetnUniformfvEXT(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformfvEXT* cmd = glthread_alloc(exec_glGetnUniformfvEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformfvKHR {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLfloat *params;
+};
+
+static void exec_glGetnUniformfvKHR(const void* args) {
+    const struct marshal_glGetnUniformfvKHR* cmd = args;
+    gles_driver.ext.glGetnUniformfvKHR(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformfvKHR(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetnUniformfvKHR(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformfvKHR* cmd = glthread_alloc(exec_glGetnUniformfvKHR, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLint *params;
+};
+
+static void exec_glGetnUniformivEXT(const void* args) {
+    const struct marshal_glGetnUniformivEXT* cmd = args;
+    gles_driver.ext.glGetnUniformivEXT(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformivEXT(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetnUniformivEXT(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformivEXT* cmd = glthread_alloc(exec_glGetnUniformivEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformivKHR {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLint *params;
+};
+
+static void exec_glGetnUniformivKHR(const void* args) {
+    const struct marshal_glGetnUniformivKHR* cmd = args;
+    gles_driver.ext.glGetnUniformivKHR(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformivKHR(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetnUniformivKHR(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformivKHR* cmd = glthread_alloc(exec_glGetnUniformivKHR, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glGetnUniformuivKHR {
+    GLuint program;
+    GLint location;
+    GLsizei bufSize;
+    GLuint *params;
+};
+
+static void exec_glGetnUniformuivKHR(const void* args) {
+    const struct marshal_glGetnUniformuivKHR* cmd = args;
+    gles_driver.ext.glGetnUniformuivKHR(cmd->program, cmd->location, cmd->bufSize, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glGetnUniformuivKHR(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glGetnUniformuivKHR(program, location, bufSize, params);
+        return;
+    }
+    struct marshal_glGetnUniformuivKHR* cmd = glthread_alloc(exec_glGetnUniformuivKHR, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->bufSize = bufSize;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glImportMemoryFdEXT {
+    GLuint memory;
+    GLuint64 size;
+    GLenum handleType;
+    GLint fd;
+};
+
+static void exec_glImportMemoryFdEXT(const void* args) {
+    const struct marshal_glImportMemoryFdEXT* cmd = args;
+    gles_driver.ext.glImportMemoryFdEXT(cmd->memory, cmd->size, cmd->handleType, cmd->fd);
+}
+
+static void GL_APIENTRY marshal_glImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType, GLint fd) {
+    if (!glthread_active()) {
+        gles_driver.ext.glImportMemoryFdEXT(memory, size, handleType, fd);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glImportMemoryFdEXT* cmd = glthread_alloc(exec_glImportMemoryFdEXT, sizeof(*cmd));
+    cmd->memory = memory;
+    cmd->size = size;
+    cmd->handleType = handleType;
+    cmd->fd = fd;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glImportSemaphoreFdEXT {
+    GLuint semaphore;
+    GLenum handleType;
+    GLint fd;
+};
+
+static void exec_glImportSemaphoreFdEXT(const void* args) {
+    const struct marshal_glImportSemaphoreFdEXT* cmd = args;
+    gles_driver.ext.glImportSemaphoreFdEXT(cmd->semaphore, cmd->handleType, cmd->fd);
+}
+
+static void GL_APIENTRY marshal_glImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GLint fd) {
+    if (!glthread_active()) {
+        gles_driver.ext.glImportSemaphoreFdEXT(semaphore, handleType, fd);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glImportSemaphoreFdEXT* cmd = glthread_alloc(exec_glImportSemaphoreFdEXT, sizeof(*cmd));
+    cmd->semaphore = semaphore;
+    cmd->handleType = handleType;
+    cmd->fd = fd;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glInsertEventMarkerEXT {
+    GLsizei length;
+    const GLchar *marker;
+};
+
+static void exec_glInsertEventMarkerEXT(const void* args) {
+    const struct marshal_glInsertEventMarkerEXT* cmd = args;
+    gles_driver.ext.glInsertEventMarkerEXT(cmd->length, cmd->marker);
+}
+
+static void GL_APIENTRY marshal_glInsertEventMarkerEXT(GLsizei length, const GLchar *marker) {
+    if (!glthread_active()) {
+        gles_driver.ext.glInsertEventMarkerEXT(length, marker);
+        return;
+    }
+    struct marshal_glInsertEventMarkerEXT* cmd = glthread_alloc(exec_glInsertEventMarkerEXT, sizeof(*cmd));
+    cmd->length = length;
+    cmd->marker = marker;
+    glthread_sync();
+}
+
+struct marshal_glInterpolatePathsNV {
+    GLuint resultPath;
+    GLuint pathA;
+    GLuint pathB;
+    GLfloat weight;
+};
+
+static void exec_glInterpolatePathsNV(const void* args) {
+    const struct marshal_glInterpolatePathsNV* cmd = args;
+    gles_driver.ext.glInterpolatePathsNV(cmd->resultPath, cmd->pathA, cmd->pathB, cmd->weight);
+}
+
+static void GL_APIENTRY marshal_glInterpolatePathsNV(GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight) {
+    if (!glthread_active()) {
+        gles_driver.ext.glInterpolatePathsNV(resultPath, pathA, pathB, weight);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glInterpolatePathsNV* cmd = glthread_alloc(exec_glInterpolatePathsNV, sizeof(*cmd));
+    cmd->resultPath = resultPath;
+    cmd->pathA = pathA;
+    cmd->pathB = pathB;
+    cmd->weight = weight;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glIsEnablediEXT {
+    GLenum target;
+    GLuint index;
+    GLboolean *result;
+};
+
+static void exec_glIsEnablediEXT(const void* args) {
+    const struct marshal_glIsEnablediEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glIsEnablediEXT(cmd->target, cmd->index);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsEnablediEXT(GLenum target, GLuint index) {
+    if (!glthread_active()) return gles_driver.ext.glIsEnablediEXT(target, index);
+    struct marshal_glIsEnablediEXT* cmd = glthread_alloc(exec_glIsEnablediEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsEnablediNV {
+    GLenum target;
+    GLuint index;
+    GLboolean *result;
+};
+
+static void exec_glIsEnablediNV(const void* args) {
+    const struct marshal_glIsEnablediNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsEnablediNV(cmd->target, cmd->index);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsEnablediNV(GLenum target, GLuint index) {
+    if (!glthread_active()) return gles_driver.ext.glIsEnablediNV(target, index);
+    struct marshal_glIsEnablediNV* cmd = glthread_alloc(exec_glIsEnablediNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsEnablediOES {
+    GLenum target;
+    GLuint index;
+    GLboolean *result;
+};
+
+static void exec_glIsEnablediOES(const void* args) {
+    const struct marshal_glIsEnablediOES* cmd = args;
+    *cmd->result = gles_driver.ext.glIsEnablediOES(cmd->target, cmd->index);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsEnablediOES(GLenum target, GLuint index) {
+    if (!glthread_active()) return gles_driver.ext.glIsEnablediOES(target, index);
+    struct marshal_glIsEnablediOES* cmd = glthread_alloc(exec_glIsEnablediOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->index = index;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsFenceNV {
+    GLuint fence;
+    GLboolean *result;
+};
+
+static void exec_glIsFenceNV(const void* args) {
+    const struct marshal_glIsFenceNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsFenceNV(cmd->fence);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsFenceNV(GLuint fence) {
+    if (!glthread_active()) return gles_driver.ext.glIsFenceNV(fence);
+    struct marshal_glIsFenceNV* cmd = glthread_alloc(exec_glIsFenceNV, sizeof(*cmd));
+    cmd->fence = fence;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsImageHandleResidentNV {
+    GLuint64 handle;
+    GLboolean *result;
+};
+
+static void exec_glIsImageHandleResidentNV(const void* args) {
+    const struct marshal_glIsImageHandleResidentNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsImageHandleResidentNV(cmd->handle);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsImageHandleResidentNV(GLuint64 handle) {
+    if (!glthread_active()) return gles_driver.ext.glIsImageHandleResidentNV(handle);
+    struct marshal_glIsImageHandleResidentNV* cmd = glthread_alloc(exec_glIsImageHandleResidentNV, sizeof(*cmd));
+    cmd->handle = handle;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsMemoryObjectEXT {
+    GLuint memoryObject;
+    GLboolean *result;
+};
+
+static void exec_glIsMemoryObjectEXT(const void* args) {
+    const struct marshal_glIsMemoryObjectEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glIsMemoryObjectEXT(cmd->memoryObject);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsMemoryObjectEXT(GLuint memoryObject) {
+    if (!glthread_active()) return gles_driver.ext.glIsMemoryObjectEXT(memoryObject);
+    struct marshal_glIsMemoryObjectEXT* cmd = glthread_alloc(exec_glIsMemoryObjectEXT, sizeof(*cmd));
+    cmd->memoryObject = memoryObject;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsPathNV {
+    GLuint path;
+    GLboolean *result;
+};
+
+static void exec_glIsPathNV(const void* args) {
+    const struct marshal_glIsPathNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsPathNV(cmd->path);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsPathNV(GLuint path) {
+    if (!glthread_active()) return gles_driver.ext.glIsPathNV(path);
+    struct marshal_glIsPathNV* cmd = glthread_alloc(exec_glIsPathNV, sizeof(*cmd));
+    cmd->path = path;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsPointInFillPathNV {
+    GLuint path;
+    GLuint mask;
+    GLfloat x;
+    GLfloat y;
+    GLboolean *result;
+};
+
+static void exec_glIsPointInFillPathNV(const void* args) {
+    const struct marshal_glIsPointInFillPathNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsPointInFillPathNV(cmd->path, cmd->mask, cmd->x, cmd->y);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsPointInFillPathNV(GLuint path, GLuint mask, GLfloat x, GLfloat y) {
+    if (!glthread_active()) return gles_driver.ext.glIsPointInFillPathNV(path, mask, x, y);
+    struct marshal_glIsPointInFillPathNV* cmd = glthread_alloc(exec_glIsPointInFillPathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->mask = mask;
+    cmd->x = x;
+    cmd->y = y;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsPointInStrokePathNV {
+    GLuint path;
+    GLfloat x;
+    GLfloat y;
+    GLboolean *result;
+};
+
+static void exec_glIsPointInStrokePathNV(const void* args) {
+    const struct marshal_glIsPointInStrokePathNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsPointInStrokePathNV(cmd->path, cmd->x, cmd->y);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsPointInStrokePathNV(GLuint path, GLfloat x, GLfloat y) {
+    if (!glthread_active()) return gles_driver.ext.glIsPointInStrokePathNV(path, x, y);
+    struct marshal_glIsPointInStrokePathNV* cmd = glthread_alloc(exec_glIsPointInStrokePathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->x = x;
+    cmd->y = y;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsProgramPipelineEXT {
+    GLuint pipeline;
+    GLboolean *result;
+};
+
+static void exec_glIsProgramPipelineEXT(const void* args) {
+    const struct marshal_glIsProgramPipelineEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glIsProgramPipelineEXT(cmd->pipeline);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsProgramPipelineEXT(GLuint pipeline) {
+    if (!glthread_active()) return gles_driver.ext.glIsProgramPipelineEXT(pipeline);
+    struct marshal_glIsProgramPipelineEXT* cmd = glthread_alloc(exec_glIsProgramPipelineEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsQueryEXT {
+    GLuint id;
+    GLboolean *result;
+};
+
+static void exec_glIsQueryEXT(const void* args) {
+    const struct marshal_glIsQueryEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glIsQueryEXT(cmd->id);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsQueryEXT(GLuint id) {
+    if (!glthread_active()) return gles_driver.ext.glIsQueryEXT(id);
+    struct marshal_glIsQueryEXT* cmd = glthread_alloc(exec_glIsQueryEXT, sizeof(*cmd));
+    cmd->id = id;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsSemaphoreEXT {
+    GLuint semaphore;
+    GLboolean *result;
+};
+
+static void exec_glIsSemaphoreEXT(const void* args) {
+    const struct marshal_glIsSemaphoreEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glIsSemaphoreEXT(cmd->semaphore);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsSemaphoreEXT(GLuint semaphore) {
+    if (!glthread_active()) return gles_driver.ext.glIsSemaphoreEXT(semaphore);
+    struct marshal_glIsSemaphoreEXT* cmd = glthread_alloc(exec_glIsSemaphoreEXT, sizeof(*cmd));
+    cmd->semaphore = semaphore;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsSyncAPPLE {
+    GLsync sync;
+    GLboolean *result;
+};
+
+static void exec_glIsSyncAPPLE(const void* args) {
+    const struct marshal_glIsSyncAPPLE* cmd = args;
+    *cmd->result = gles_driver.ext.glIsSyncAPPLE(cmd->sync);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsSyncAPPLE(GLsync sync) {
+    if (!glthread_active()) return gles_driver.ext.glIsSyncAPPLE(sync);
+    struct marshal_glIsSyncAPPLE* cmd = glthread_alloc(exec_glIsSyncAPPLE, sizeof(*cmd));
+    cmd->sync = sync;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsTextureHandleResidentNV {
+    GLuint64 handle;
+    GLboolean *result;
+};
+
+static void exec_glIsTextureHandleResidentNV(const void* args) {
+    const struct marshal_glIsTextureHandleResidentNV* cmd = args;
+    *cmd->result = gles_driver.ext.glIsTextureHandleResidentNV(cmd->handle);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsTextureHandleResidentNV(GLuint64 handle) {
+    if (!glthread_active()) return gles_driver.ext.glIsTextureHandleResidentNV(handle);
+    struct marshal_glIsTextureHandleResidentNV* cmd = glthread_alloc(exec_glIsTextureHandleResidentNV, sizeof(*cmd));
+    cmd->handle = handle;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glIsVertexArrayOES {
+    GLuint array;
+    GLboolean *result;
+};
+
+static void exec_glIsVertexArrayOES(const void* args) {
+    const struct marshal_glIsVertexArrayOES* cmd = args;
+    *cmd->result = gles_driver.ext.glIsVertexArrayOES(cmd->array);
+}
+
+static GLboolean GL_APIENTRY marshal_glIsVertexArrayOES(GLuint array) {
+    if (!glthread_active()) return gles_driver.ext.glIsVertexArrayOES(array);
+    struct marshal_glIsVertexArrayOES* cmd = glthread_alloc(exec_glIsVertexArrayOES, sizeof(*cmd));
+    cmd->array = array;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glLabelObjectEXT {
+    GLenum type;
+    GLuint object;
+    GLsizei length;
+    const GLchar *label;
+};
+
+static void exec_glLabelObjectEXT(const void* args) {
+    const struct marshal_glLabelObjectEXT* cmd = args;
+    gles_driver.ext.glLabelObjectEXT(cmd->type, cmd->object, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glLabelObjectEXT(GLenum type, GLuint object, GLsizei length, const GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.ext.glLabelObjectEXT(type, object, length, label);
+        return;
+    }
+    struct marshal_glLabelObjectEXT* cmd = glthread_alloc(exec_glLabelObjectEXT, sizeof(*cmd));
+    cmd->type = type;
+    cmd->object = object;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glMakeImageHandleNonResidentNV {
+    GLuint64 handle;
+};
+
+static void exec_glMakeImageHandleNonResidentNV(const void* args) {
+    const struct marshal_glMakeImageHandleNonResidentNV* cmd = args;
+    gles_driver.ext.glMakeImageHandleNonResidentNV(cmd->handle);
+}
+
+static void GL_APIENTRY marshal_glMakeImageHandleNonResidentNV(GLuint64 handle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMakeImageHandleNonResidentNV(handle);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMakeImageHandleNonResidentNV* cmd = glthread_alloc(exec_glMakeImageHandleNonResidentNV, sizeof(*cmd));
+    cmd->handle = handle;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMakeImageHandleResidentNV {
+    GLuint64 handle;
+    GLenum access;
+};
+
+static void exec_glMakeImageHandleResidentNV(const void* args) {
+    const struct marshal_glMakeImageHandleResidentNV* cmd = args;
+    gles_driver.ext.glMakeImageHandleResidentNV(cmd->handle, cmd->access);
+}
+
+static void GL_APIENTRY marshal_glMakeImageHandleResidentNV(GLuint64 handle, GLenum access) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMakeImageHandleResidentNV(handle, access);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMakeImageHandleResidentNV* cmd = glthread_alloc(exec_glMakeImageHandleResidentNV, sizeof(*cmd));
+    cmd->handle = handle;
+    cmd->access = access;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMakeTextureHandleNonResidentNV {
+    GLuint64 handle;
+};
+
+static void exec_glMakeTextureHandleNonResidentNV(const void* args) {
+    const struct marshal_glMakeTextureHandleNonResidentNV* cmd = args;
+    gles_driver.ext.glMakeTextureHandleNonResidentNV(cmd->handle);
+}
+
+static void GL_APIENTRY marshal_glMakeTextureHandleNonResidentNV(GLuint64 handle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMakeTextureHandleNonResidentNV(handle);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMakeTextureHandleNonResidentNV* cmd = glthread_alloc(exec_glMakeTextureHandleNonResidentNV, sizeof(*cmd));
+    cmd->handle = handle;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMakeTextureHandleResidentNV {
+    GLuint64 handle;
+};
+
+static void exec_glMakeTextureHandleResidentNV(const void* args) {
+    const struct marshal_glMakeTextureHandleResidentNV* cmd = args;
+    gles_driver.ext.glMakeTextureHandleResidentNV(cmd->handle);
+}
+
+static void GL_APIENTRY marshal_glMakeTextureHandleResidentNV(GLuint64 handle) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMakeTextureHandleResidentNV(handle);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMakeTextureHandleResidentNV* cmd = glthread_alloc(exec_glMakeTextureHandleResidentNV, sizeof(*cmd));
+    cmd->handle = handle;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMapBufferOES {
+    GLenum target;
+    GLenum access;
+    void * *result;
+};
+
+static void exec_glMapBufferOES(const void* args) {
+    const struct marshal_glMapBufferOES* cmd = args;
+    *cmd->result = gles_driver.ext.glMapBufferOES(cmd->target, cmd->access);
+}
+
+static void * GL_APIENTRY marshal_glMapBufferOES(GLenum target, GLenum access) {
+    if (!glthread_active()) return gles_driver.ext.glMapBufferOES(target, access);
+    struct marshal_glMapBufferOES* cmd = glthread_alloc(exec_glMapBufferOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->access = access;
+    void *glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glMapBufferRangeEXT {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr length;
+    GLbitfield access;
+    void * *result;
+};
+
+static void exec_glMapBufferRangeEXT(const void* args) {
+    const struct marshal_glMapBufferRangeEXT* cmd = args;
+    *cmd->result = gles_driver.ext.glMapBufferRangeEXT(cmd->target, cmd->offset, cmd->length, cmd->access);
+}
+
+static void * GL_APIENTRY marshal_glMapBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if (!glthread_active()) return gles_driver.ext.glMapBufferRangeEXT(target, offset, length, access);
+    struct marshal_glMapBufferRangeEXT* cmd = glthread_alloc(exec_glMapBufferRangeEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->length = length;
+    cmd->access = access;
+    void *glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glMatrixFrustumEXT {
+    GLenum mode;
+    GLdouble left;
+    GLdouble right;
+    GLdouble bottom;
+    GLdouble top;
+    GLdouble zNear;
+    GLdouble zFar;
+};
+
+static void exec_glMatrixFrustumEXT(const void* args) {
+    const struct marshal_glMatrixFrustumEXT* cmd = args;
+    gles_driver.ext.glMatrixFrustumEXT(cmd->mode, cmd->left, cmd->right, cmd->bottom, cmd->top, cmd->zNear, cmd->zFar);
+}
+
+static void GL_APIENTRY marshal_glMatrixFrustumEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixFrustumEXT(mode, left, right, bottom, top, zNear, zFar);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixFrustumEXT* cmd = glthread_alloc(exec_glMatrixFrustumEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->left = left;
+    cmd->right = right;
+    cmd->bottom = bottom;
+    cmd->top = top;
+    cmd->zNear = zNear;
+    cmd->zFar = zFar;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixLoad3x2fNV {
+    GLenum matrixMode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixLoad3x2fNV(const void* args) {
+    const struct marshal_glMatrixLoad3x2fNV* cmd = args;
+    gles_driver.ext.glMatrixLoad3x2fNV(cmd->matrixMode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoad3x2fNV(GLenum matrixMode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoad3x2fNV(matrixMode, m);
+        return;
+    }
+    struct marshal_glMatrixLoad3x2fNV* cmd = glthread_alloc(exec_glMatrixLoad3x2fNV, sizeof(*cmd));
+    cmd->matrixMode = matrixMode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixLoad3x3fNV {
+    GLenum matrixMode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixLoad3x3fNV(const void* args) {
+    const struct marshal_glMatrixLoad3x3fNV* cmd = args;
+    gles_driver.ext.glMatrixLoad3x3fNV(cmd->matrixMode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoad3x3fNV(GLenum matrixMode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoad3x3fNV(matrixMode, m);
+        return;
+    }
+    struct marshal_glMatrixLoad3x3fNV* cmd = glthread_alloc(exec_glMatrixLoad3x3fNV, sizeof(*cmd));
+    cmd->matrixMode = matrixMode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixLoadIdentityEXT {
+    GLenum mode;
+};
+
+static void exec_glMatrixLoadIdentityEXT(const void* args) {
+    const struct marshal_glMatrixLoadIdentityEXT* cmd = args;
+    gles_driver.ext.glMatrixLoadIdentityEXT(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoadIdentityEXT(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoadIdentityEXT(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixLoadIdentityEXT* cmd = glthread_alloc(exec_glMatrixLoadIdentityEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixLoadTranspose3x3fNV {
+    GLenum matrixMode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixLoadTranspose3x3fNV(const void* args) {
+    const struct marshal_glMatrixLoadTranspose3x3fNV* cmd = args;
+    gles_driver.ext.glMatrixLoadTranspose3x3fNV(cmd->matrixMode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoadTranspose3x3fNV(GLenum matrixMode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoadTranspose3x3fNV(matrixMode, m);
+        return;
+    }
+    struct marshal_glMatrixLoadTranspose3x3fNV* cmd = glthread_alloc(exec_glMatrixLoadTranspose3x3fNV, sizeof(*cmd));
+    cmd->matrixMode = matrixMode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixLoadTransposedEXT {
+    GLenum mode;
+    const GLdouble *m;
+};
+
+static void exec_glMatrixLoadTransposedEXT(const void* args) {
+    const struct marshal_glMatrixLoadTransposedEXT* cmd = args;
+    gles_driver.ext.glMatrixLoadTransposedEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoadTransposedEXT(GLenum mode, const GLdouble *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoadTransposedEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixLoadTransposedEXT* cmd = glthread_alloc(exec_glMatrixLoadTransposedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixLoadTransposefEXT {
+    GLenum mode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixLoadTransposefEXT(const void* args) {
+    const struct marshal_glMatrixLoadTransposefEXT* cmd = args;
+    gles_driver.ext.glMatrixLoadTransposefEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoadTransposefEXT(GLenum mode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoadTransposefEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixLoadTransposefEXT* cmd = glthread_alloc(exec_glMatrixLoadTransposefEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixLoaddEXT {
+    GLenum mode;
+    const GLdouble *m;
+};
+
+static void exec_glMatrixLoaddEXT(const void* args) {
+    const struct marshal_glMatrixLoaddEXT* cmd = args;
+    gles_driver.ext.glMatrixLoaddEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoaddEXT(GLenum mode, const GLdouble *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoaddEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixLoaddEXT* cmd = glthread_alloc(exec_glMatrixLoaddEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixLoadfEXT {
+    GLenum mode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixLoadfEXT(const void* args) {
+    const struct marshal_glMatrixLoadfEXT* cmd = args;
+    gles_driver.ext.glMatrixLoadfEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixLoadfEXT(GLenum mode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixLoadfEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixLoadfEXT* cmd = glthread_alloc(exec_glMatrixLoadfEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMult3x2fNV {
+    GLenum matrixMode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixMult3x2fNV(const void* args) {
+    const struct marshal_glMatrixMult3x2fNV* cmd = args;
+    gles_driver.ext.glMatrixMult3x2fNV(cmd->matrixMode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMult3x2fNV(GLenum matrixMode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMult3x2fNV(matrixMode, m);
+        return;
+    }
+    struct marshal_glMatrixMult3x2fNV* cmd = glthread_alloc(exec_glMatrixMult3x2fNV, sizeof(*cmd));
+    cmd->matrixMode = matrixMode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMult3x3fNV {
+    GLenum matrixMode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixMult3x3fNV(const void* args) {
+    const struct marshal_glMatrixMult3x3fNV* cmd = args;
+    gles_driver.ext.glMatrixMult3x3fNV(cmd->matrixMode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMult3x3fNV(GLenum matrixMode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMult3x3fNV(matrixMode, m);
+        return;
+    }
+    struct marshal_glMatrixMult3x3fNV* cmd = glthread_alloc(exec_glMatrixMult3x3fNV, sizeof(*cmd));
+    cmd->matrixMode = matrixMode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMultTranspose3x3fNV {
+    GLenum matrixMode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixMultTranspose3x3fNV(const void* args) {
+    const struct marshal_glMatrixMultTranspose3x3fNV* cmd = args;
+    gles_driver.ext.glMatrixMultTranspose3x3fNV(cmd->matrixMode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMultTranspose3x3fNV(GLenum matrixMode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMultTranspose3x3fNV(matrixMode, m);
+        return;
+    }
+    struct marshal_glMatrixMultTranspose3x3fNV* cmd = glthread_alloc(exec_glMatrixMultTranspose3x3fNV, sizeof(*cmd));
+    cmd->matrixMode = matrixMode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMultTransposedEXT {
+    GLenum mode;
+    const GLdouble *m;
+};
+
+static void exec_glMatrixMultTransposedEXT(const void* args) {
+    const struct marshal_glMatrixMultTransposedEXT* cmd = args;
+    gles_driver.ext.glMatrixMultTransposedEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMultTransposedEXT(GLenum mode, const GLdouble *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMultTransposedEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixMultTransposedEXT* cmd = glthread_alloc(exec_glMatrixMultTransposedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMultTransposefEXT {
+    GLenum mode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixMultTransposefEXT(const void* args) {
+    const struct marshal_glMatrixMultTransposefEXT* cmd = args;
+    gles_driver.ext.glMatrixMultTransposefEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMultTransposefEXT(GLenum mode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMultTransposefEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixMultTransposefEXT* cmd = glthread_alloc(exec_glMatrixMultTransposefEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMultdEXT {
+    GLenum mode;
+    const GLdouble *m;
+};
+
+static void exec_glMatrixMultdEXT(const void* args) {
+    const struct marshal_glMatrixMultdEXT* cmd = args;
+    gles_driver.ext.glMatrixMultdEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMultdEXT(GLenum mode, const GLdouble *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMultdEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixMultdEXT* cmd = glthread_alloc(exec_glMatrixMultdEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixMultfEXT {
+    GLenum mode;
+    const GLfloat *m;
+};
+
+static void exec_glMatrixMultfEXT(const void* args) {
+    const struct marshal_glMatrixMultfEXT* cmd = args;
+    gles_driver.ext.glMatrixMultfEXT(cmd->mode, cmd->m);
+}
+
+static void GL_APIENTRY marshal_glMatrixMultfEXT(GLenum mode, const GLfloat *m) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixMultfEXT(mode, m);
+        return;
+    }
+    struct marshal_glMatrixMultfEXT* cmd = glthread_alloc(exec_glMatrixMultfEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->m = m;
+    glthread_sync();
+}
+
+struct marshal_glMatrixOrthoEXT {
+    GLenum mode;
+    GLdouble left;
+    GLdouble right;
+    GLdouble bottom;
+    GLdouble top;
+    GLdouble zNear;
+    GLdouble zFar;
+};
+
+static void exec_glMatrixOrthoEXT(const void* args) {
+    const struct marshal_glMatrixOrthoEXT* cmd = args;
+    gles_driver.ext.glMatrixOrthoEXT(cmd->mode, cmd->left, cmd->right, cmd->bottom, cmd->top, cmd->zNear, cmd->zFar);
+}
+
+static void GL_APIENTRY marshal_glMatrixOrthoEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixOrthoEXT(mode, left, right, bottom, top, zNear, zFar);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixOrthoEXT* cmd = glthread_alloc(exec_glMatrixOrthoEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->left = left;
+    cmd->right = right;
+    cmd->bottom = bottom;
+    cmd->top = top;
+    cmd->zNear = zNear;
+    cmd->zFar = zFar;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixPopEXT {
+    GLenum mode;
+};
+
+static void exec_glMatrixPopEXT(const void* args) {
+    const struct marshal_glMatrixPopEXT* cmd = args;
+    gles_driver.ext.glMatrixPopEXT(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glMatrixPopEXT(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixPopEXT(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixPopEXT* cmd = glthread_alloc(exec_glMatrixPopEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixPushEXT {
+    GLenum mode;
+};
+
+static void exec_glMatrixPushEXT(const void* args) {
+    const struct marshal_glMatrixPushEXT* cmd = args;
+    gles_driver.ext.glMatrixPushEXT(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glMatrixPushEXT(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixPushEXT(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixPushEXT* cmd = glthread_alloc(exec_glMatrixPushEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixRotatedEXT {
+    GLenum mode;
+    GLdouble angle;
+    GLdouble x;
+    GLdouble y;
+    GLdouble z;
+};
+
+static void exec_glMatrixRotatedEXT(const void* args) {
+    const struct marshal_glMatrixRotatedEXT* cmd = args;
+    gles_driver.ext.glMatrixRotatedEXT(cmd->mode, cmd->angle, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glMatrixRotatedEXT(GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixRotatedEXT(mode, angle, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixRotatedEXT* cmd = glthread_alloc(exec_glMatrixRotatedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->angle = angle;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixRotatefEXT {
+    GLenum mode;
+    GLfloat angle;
+    GLfloat x;
+    GLfloat y;
+    GLfloat z;
+};
+
+static void exec_glMatrixRotatefEXT(const void* args) {
+    const struct marshal_glMatrixRotatefEXT* cmd = args;
+    gles_driver.ext.glMatrixRotatefEXT(cmd->mode, cmd->angle, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glMatrixRotatefEXT(GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixRotatefEXT(mode, angle, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixRotatefEXT* cmd = glthread_alloc(exec_glMatrixRotatefEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->angle = angle;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixScaledEXT {
+    GLenum mode;
+    GLdouble x;
+    GLdouble y;
+    GLdouble z;
+};
+
+static void exec_glMatrixScaledEXT(const void* args) {
+    const struct marshal_glMatrixScaledEXT* cmd = args;
+    gles_driver.ext.glMatrixScaledEXT(cmd->mode, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glMatrixScaledEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixScaledEXT(mode, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixScaledEXT* cmd = glthread_alloc(exec_glMatrixScaledEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixScalefEXT {
+    GLenum mode;
+    GLfloat x;
+    GLfloat y;
+    GLfloat z;
+};
+
+static void exec_glMatrixScalefEXT(const void* args) {
+    const struct marshal_glMatrixScalefEXT* cmd = args;
+    gles_driver.ext.glMatrixScalefEXT(cmd->mode, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glMatrixScalefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixScalefEXT(mode, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixScalefEXT* cmd = glthread_alloc(exec_glMatrixScalefEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixTranslatedEXT {
+    GLenum mode;
+    GLdouble x;
+    GLdouble y;
+    GLdouble z;
+};
+
+static void exec_glMatrixTranslatedEXT(const void* args) {
+    const struct marshal_glMatrixTranslatedEXT* cmd = args;
+    gles_driver.ext.glMatrixTranslatedEXT(cmd->mode, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glMatrixTranslatedEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixTranslatedEXT(mode, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixTranslatedEXT* cmd = glthread_alloc(exec_glMatrixTranslatedEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMatrixTranslatefEXT {
+    GLenum mode;
+    GLfloat x;
+    GLfloat y;
+    GLfloat z;
+};
+
+static void exec_glMatrixTranslatefEXT(const void* args) {
+    const struct marshal_glMatrixTranslatefEXT* cmd = args;
+    gles_driver.ext.glMatrixTranslatefEXT(cmd->mode, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glMatrixTranslatefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMatrixTranslatefEXT(mode, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMatrixTranslatefEXT* cmd = glthread_alloc(exec_glMatrixTranslatefEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMaxShaderCompilerThreadsKHR {
+    GLuint count;
+};
+
+static void exec_glMaxShaderCompilerThreadsKHR(const void* args) {
+    const struct marshal_glMaxShaderCompilerThreadsKHR* cmd = args;
+    gles_driver.ext.glMaxShaderCompilerThreadsKHR(cmd->count);
+}
+
+static void GL_APIENTRY marshal_glMaxShaderCompilerThreadsKHR(GLuint count) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMaxShaderCompilerThreadsKHR(count);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMaxShaderCompilerThreadsKHR* cmd = glthread_alloc(exec_glMaxShaderCompilerThreadsKHR, sizeof(*cmd));
+    cmd->count = count;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMemoryObjectParameterivEXT {
+    GLuint memoryObject;
+    GLenum pname;
+    const GLint *params;
+};
+
+static void exec_glMemoryObjectParameterivEXT(const void* args) {
+    const struct marshal_glMemoryObjectParameterivEXT* cmd = args;
+    gles_driver.ext.glMemoryObjectParameterivEXT(cmd->memoryObject, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, const GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMemoryObjectParameterivEXT(memoryObject, pname, params);
+        return;
+    }
+    struct marshal_glMemoryObjectParameterivEXT* cmd = glthread_alloc(exec_glMemoryObjectParameterivEXT, sizeof(*cmd));
+    cmd->memoryObject = memoryObject;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glMinSampleShadingOES {
+    GLfloat value;
+};
+
+static void exec_glMinSampleShadingOES(const void* args) {
+    const struct marshal_glMinSampleShadingOES* cmd = args;
+    gles_driver.ext.glMinSampleShadingOES(cmd->value);
+}
+
+static void GL_APIENTRY marshal_glMinSampleShadingOES(GLfloat value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMinSampleShadingOES(value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMinSampleShadingOES* cmd = glthread_alloc(exec_glMinSampleShadingOES, sizeof(*cmd));
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMultiDrawArraysEXT {
+    GLenum mode;
+    const GLint *first;
+    const GLsizei *count;
+    GLsizei primcount;
+};
+
+static void exec_glMultiDrawArraysEXT(const void* args) {
+    const struct marshal_glMultiDrawArraysEXT* cmd = args;
+    gles_driver.ext.glMultiDrawArraysEXT(cmd->mode, cmd->first, cmd->count, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glMultiDrawArraysEXT(GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMultiDrawArraysEXT(mode, first, count, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    size_t first_size = first ? (size_t)(primcount * sizeof(*first)) : 0;
+    size_t count_size = count ? (size_t)(primcount * sizeof(*count)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(first_size) + GLTHREAD_ALIGN(count_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glMultiDrawArraysEXT* cmd = glthread_alloc(exec_glMultiDrawArraysEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->mode = mode;
+    cmd->first = glt_sync ? first : glthread_copy(&glt_tail, first, first_size);
+    cmd->count = glt_sync ? count : glthread_copy(&glt_tail, count, count_size);
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMultiDrawArraysIndirectEXT {
+    GLenum mode;
+    const void *indirect;
+    GLsizei drawcount;
+    GLsizei stride;
+};
+
+static void exec_glMultiDrawArraysIndirectEXT(const void* args) {
+    const struct marshal_glMultiDrawArraysIndirectEXT* cmd = args;
+    gles_driver.ext.glMultiDrawArraysIndirectEXT(cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
+}
+
+static void GL_APIENTRY marshal_glMultiDrawArraysIndirectEXT(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMultiDrawArraysIndirectEXT(mode, indirect, drawcount, stride);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMultiDrawArraysIndirectEXT* cmd = glthread_alloc(exec_glMultiDrawArraysIndirectEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->indirect = indirect;
+    cmd->drawcount = drawcount;
+    cmd->stride = stride;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMultiDrawElementsBaseVertexEXT {
+    GLenum mode;
+    const GLsizei *count;
+    GLenum type;
+    const void *const*indices;
+    GLsizei drawcount;
+    const GLint *basevertex;
+};
+
+static void exec_glMultiDrawElementsBaseVertexEXT(const void* args) {
+    const struct marshal_glMultiDrawElementsBaseVertexEXT* cmd = args;
+    gles_driver.ext.glMultiDrawElementsBaseVertexEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->drawcount, cmd->basevertex);
+}
+
+static void GL_APIENTRY marshal_glMultiDrawElementsBaseVertexEXT(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMultiDrawElementsBaseVertexEXT(mode, count, type, indices, drawcount, basevertex);
+        return;
+    }
+    int glt_sync = 0;
+    size_t count_size = count ? (size_t)(drawcount * sizeof(*count)) : 0;
+    size_t indices_size = indices ? (size_t)(drawcount * sizeof(*indices)) : 0;
+    size_t basevertex_size = basevertex ? (size_t)(drawcount * sizeof(*basevertex)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(count_size) + GLTHREAD_ALIGN(indices_size) + GLTHREAD_ALIGN(basevertex_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glMultiDrawElementsBaseVertexEXT* cmd = glthread_alloc(exec_glMultiDrawElementsBaseVertexEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->mode = mode;
+    cmd->count = glt_sync ? count : glthread_copy(&glt_tail, count, count_size);
+    cmd->type = type;
+    cmd->indices = glt_sync ? indices : glthread_copy(&glt_tail, indices, indices_size);
+    cmd->drawcount = drawcount;
+    cmd->basevertex = glt_sync ? basevertex : glthread_copy(&glt_tail, basevertex, basevertex_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMultiDrawElementsEXT {
+    GLenum mode;
+    const GLsizei *count;
+    GLenum type;
+    const void *const*indices;
+    GLsizei primcount;
+};
+
+static void exec_glMultiDrawElementsEXT(const void* args) {
+    const struct marshal_glMultiDrawElementsEXT* cmd = args;
+    gles_driver.ext.glMultiDrawElementsEXT(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->primcount);
+}
+
+static void GL_APIENTRY marshal_glMultiDrawElementsEXT(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMultiDrawElementsEXT(mode, count, type, indices, primcount);
+        return;
+    }
+    int glt_sync = 0;
+    size_t count_size = count ? (size_t)(primcount * sizeof(*count)) : 0;
+    size_t indices_size = indices ? (size_t)(primcount * sizeof(*indices)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(count_size) + GLTHREAD_ALIGN(indices_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glMultiDrawElementsEXT* cmd = glthread_alloc(exec_glMultiDrawElementsEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->mode = mode;
+    cmd->count = glt_sync ? count : glthread_copy(&glt_tail, count, count_size);
+    cmd->type = type;
+    cmd->indices = glt_sync ? indices : glthread_copy(&glt_tail, indices, indices_size);
+    cmd->primcount = primcount;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glMultiDrawElementsIndirectEXT {
+    GLenum mode;
+    GLenum type;
+    const void *indirect;
+    GLsizei drawcount;
+    GLsizei stride;
+};
+
+static void exec_glMultiDrawElementsIndirectEXT(const void* args) {
+    const struct marshal_glMultiDrawElementsIndirectEXT* cmd = args;
+    gles_driver.ext.glMultiDrawElementsIndirectEXT(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
+}
+
+static void GL_APIENTRY marshal_glMultiDrawElementsIndirectEXT(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    if (!glthread_active()) {
+        gles_driver.ext.glMultiDrawElementsIndirectEXT(mode, type, indirect, drawcount, stride);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glMultiDrawElementsIndirectEXT* cmd = glthread_alloc(exec_glMultiDrawElementsIndirectEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->type = type;
+    cmd->indirect = indirect;
+    cmd->drawcount = drawcount;
+    cmd->stride = stride;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glNamedBufferStorageExternalEXT {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+    GLeglClientBufferEXT clientBuffer;
+    GLbitfield flags;
+};
+
+static void exec_glNamedBufferStorageExternalEXT(const void* args) {
+    const struct marshal_glNamedBufferStorageExternalEXT* cmd = args;
+    gles_driver.ext.glNamedBufferStorageExternalEXT(cmd->buffer, cmd->offset, cmd->size, cmd->clientBuffer, cmd->flags);
+}
+
+static void GL_APIENTRY marshal_glNamedBufferStorageExternalEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags) {
+    if (!glthread_active()) {
+        gles_driver.ext.glNamedBufferStorageExternalEXT(buffer, offset, size, clientBuffer, flags);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glNamedBufferStorageExternalEXT* cmd = glthread_alloc(exec_glNamedBufferStorageExternalEXT, sizeof(*cmd));
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size = size;
+    cmd->clientBuffer = clientBuffer;
+    cmd->flags = flags;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glNamedBufferStorageMemEXT {
+    GLuint buffer;
+    GLsizeiptr size;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glNamedBufferStorageMemEXT(const void* args) {
+    const struct marshal_glNamedBufferStorageMemEXT* cmd = args;
+    gles_driver.ext.glNamedBufferStorageMemEXT(cmd->buffer, cmd->size, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glNamedBufferStorageMemEXT(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glNamedBufferStorageMemEXT(buffer, size, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glNamedBufferStorageMemEXT* cmd = glthread_alloc(exec_glNamedBufferStorageMemEXT, sizeof(*cmd));
+    cmd->buffer = buffer;
+    cmd->size = size;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glNamedFramebufferSampleLocationsfvNV {
+    GLuint framebuffer;
+    GLuint start;
+    GLsizei count;
+    const GLfloat *v;
+};
+
+static void exec_glNamedFramebufferSampleLocationsfvNV(const void* args) {
+    const struct marshal_glNamedFramebufferSampleLocationsfvNV* cmd = args;
+    gles_driver.ext.glNamedFramebufferSampleLocationsfvNV(cmd->framebuffer, cmd->start, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glNamedFramebufferSampleLocationsfvNV(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glNamedFramebufferSampleLocationsfvNV(framebuffer, start, count, v);
+        return;
+    }
+    struct marshal_glNamedFramebufferSampleLocationsfvNV* cmd = glthread_alloc(exec_glNamedFramebufferSampleLocationsfvNV, sizeof(*cmd));
+    cmd->framebuffer = framebuffer;
+    cmd->start = start;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glObjectLabelKHR {
+    GLenum identifier;
+    GLuint name;
+    GLsizei length;
+    const GLchar *label;
+};
+
+static void exec_glObjectLabelKHR(const void* args) {
+    const struct marshal_glObjectLabelKHR* cmd = args;
+    gles_driver.ext.glObjectLabelKHR(cmd->identifier, cmd->name, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.ext.glObjectLabelKHR(identifier, name, length, label);
+        return;
+    }
+    struct marshal_glObjectLabelKHR* cmd = glthread_alloc(exec_glObjectLabelKHR, sizeof(*cmd));
+    cmd->identifier = identifier;
+    cmd->name = name;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glObjectPtrLabelKHR {
+    const void *ptr;
+    GLsizei length;
+    const GLchar *label;
+};
+
+static void exec_glObjectPtrLabelKHR(const void* args) {
+    const struct marshal_glObjectPtrLabelKHR* cmd = args;
+    gles_driver.ext.glObjectPtrLabelKHR(cmd->ptr, cmd->length, cmd->label);
+}
+
+static void GL_APIENTRY marshal_glObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLchar *label) {
+    if (!glthread_active()) {
+        gles_driver.ext.glObjectPtrLabelKHR(ptr, length, label);
+        return;
+    }
+    struct marshal_glObjectPtrLabelKHR* cmd = glthread_alloc(exec_glObjectPtrLabelKHR, sizeof(*cmd));
+    cmd->ptr = ptr;
+    cmd->length = length;
+    cmd->label = label;
+    glthread_sync();
+}
+
+struct marshal_glPatchParameteriEXT {
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glPatchParameteriEXT(const void* args) {
+    const struct marshal_glPatchParameteriEXT* cmd = args;
+    gles_driver.ext.glPatchParameteriEXT(cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPatchParameteriEXT(GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPatchParameteriEXT(pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPatchParameteriEXT* cmd = glthread_alloc(exec_glPatchParameteriEXT, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPatchParameteriOES {
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glPatchParameteriOES(const void* args) {
+    const struct marshal_glPatchParameteriOES* cmd = args;
+    gles_driver.ext.glPatchParameteriOES(cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPatchParameteriOES(GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPatchParameteriOES(pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPatchParameteriOES* cmd = glthread_alloc(exec_glPatchParameteriOES, sizeof(*cmd));
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPathCommandsNV {
+    GLuint path;
+    GLsizei numCommands;
+    const GLubyte *commands;
+    GLsizei numCoords;
+    GLenum coordType;
+    const void *coords;
+};
+
+static void exec_glPathCommandsNV(const void* args) {
+    const struct marshal_glPathCommandsNV* cmd = args;
+    gles_driver.ext.glPathCommandsNV(cmd->path, cmd->numCommands, cmd->commands, cmd->numCoords, cmd->coordType, cmd->coords);
+}
+
+static void GL_APIENTRY marshal_glPathCommandsNV(GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathCommandsNV(path, numCommands, commands, numCoords, coordType, coords);
+        return;
+    }
+    struct marshal_glPathCommandsNV* cmd = glthread_alloc(exec_glPathCommandsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->numCommands = numCommands;
+    cmd->commands = commands;
+    cmd->numCoords = numCoords;
+    cmd->coordType = coordType;
+    cmd->coords = coords;
+    glthread_sync();
+}
+
+struct marshal_glPathCoordsNV {
+    GLuint path;
+    GLsizei numCoords;
+    GLenum coordType;
+    const void *coords;
+};
+
+static void exec_glPathCoordsNV(const void* args) {
+    const struct marshal_glPathCoordsNV* cmd = args;
+    gles_driver.ext.glPathCoordsNV(cmd->path, cmd->numCoords, cmd->coordType, cmd->coords);
+}
+
+static void GL_APIENTRY marshal_glPathCoordsNV(GLuint path, GLsizei numCoords, GLenum coordType, const void *coords) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathCoordsNV(path, numCoords, coordType, coords);
+        return;
+    }
+    struct marshal_glPathCoordsNV* cmd = glthread_alloc(exec_glPathCoordsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->numCoords = numCoords;
+    cmd->coordType = coordType;
+    cmd->coords = coords;
+    glthread_sync();
+}
+
+struct marshal_glPathCoverDepthFuncNV {
+    GLenum func;
+};
+
+static void exec_glPathCoverDepthFuncNV(const void* args) {
+    const struct marshal_glPathCoverDepthFuncNV* cmd = args;
+    gles_driver.ext.glPathCoverDepthFuncNV(cmd->func);
+}
+
+static void GL_APIENTRY marshal_glPathCoverDepthFuncNV(GLenum func) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathCoverDepthFuncNV(func);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPathCoverDepthFuncNV* cmd = glthread_alloc(exec_glPathCoverDepthFuncNV, sizeof(*cmd));
+    cmd->func = func;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPathDashArrayNV {
+    GLuint path;
+    GLsizei dashCount;
+    const GLfloat *dashArray;
+};
+
+static void exec_glPathDashArrayNV(const void* args) {
+    const struct marshal_glPathDashArrayNV* cmd = args;
+    gles_driver.ext.glPathDashArrayNV(cmd->path, cmd->dashCount, cmd->dashArray);
+}
+
+static void GL_APIENTRY marshal_glPathDashArrayNV(GLuint path, GLsizei dashCount, const GLfloat *dashArray) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathDashArrayNV(path, dashCount, dashArray);
+        return;
+    }
+    struct marshal_glPathDashArrayNV* cmd = glthread_alloc(exec_glPathDashArrayNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->dashCount = dashCount;
+    cmd->dashArray = dashArray;
+    glthread_sync();
+}
+
+struct marshal_glPathGlyphIndexArrayNV {
+    GLuint firstPathName;
+    GLenum fontTarget;
+    const void *fontName;
+    GLbitfield fontStyle;
+    GLuint firstGlyphIndex;
+    GLsizei numGlyphs;
+    GLuint pathParameterTemplate;
+    GLfloat emScale;
+    GLenum *result;
+};
+
+static void exec_glPathGlyphIndexArrayNV(const void* args) {
+    const struct marshal_glPathGlyphIndexArrayNV* cmd = args;
+    *cmd->result = gles_driver.ext.glPathGlyphIndexArrayNV(cmd->firstPathName, cmd->fontTarget, cmd->fontName, cmd->fontStyle, cmd->firstGlyphIndex, cmd->numGlyphs, cmd->pathParameterTemplate, cmd->emScale);
+}
+
+static GLenum GL_APIENTRY marshal_glPathGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+    if (!glthread_active()) return gles_driver.ext.glPathGlyphIndexArrayNV(firstPathName, fontTarget, fontName, fontStyle, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale);
+    struct marshal_glPathGlyphIndexArrayNV* cmd = glthread_alloc(exec_glPathGlyphIndexArrayNV, sizeof(*cmd));
+    cmd->firstPathName = firstPathName;
+    cmd->fontTarget = fontTarget;
+    cmd->fontName = fontName;
+    cmd->fontStyle = fontStyle;
+    cmd->firstGlyphIndex = firstGlyphIndex;
+    cmd->numGlyphs = numGlyphs;
+    cmd->pathParameterTemplate = pathParameterTemplate;
+    cmd->emScale = emScale;
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glPathGlyphIndexRangeNV {
+    GLenum fontTarget;
+    const void *fontName;
+    GLbitfield fontStyle;
+    GLuint pathParameterTemplate;
+    GLfloat emScale;
+    GLuint *baseAndCount;
+    GLenum *result;
+};
+
+static void exec_glPathGlyphIndexRangeNV(const void* args) {
+    const struct marshal_glPathGlyphIndexRangeNV* cmd = args;
+    *cmd->result = gles_driver.ext.glPathGlyphIndexRangeNV(cmd->fontTarget, cmd->fontName, cmd->fontStyle, cmd->pathParameterTemplate, cmd->emScale, cmd->baseAndCount);
+}
+
+static GLenum GL_APIENTRY marshal_glPathGlyphIndexRangeNV(GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint *baseAndCount) {
+    if (!glthread_active()) return gles_driver.ext.glPathGlyphIndexRangeNV(fontTarget, fontName, fontStyle, pathParameterTemplate, emScale, baseAndCount);
+    struct marshal_glPathGlyphIndexRangeNV* cmd = glthread_alloc(exec_glPathGlyphIndexRangeNV, sizeof(*cmd));
+    cmd->fontTarget = fontTarget;
+    cmd->fontName = fontName;
+    cmd->fontStyle = fontStyle;
+    cmd->pathParameterTemplate = pathParameterTemplate;
+    cmd->emScale = emScale;
+    cmd->baseAndCount = baseAndCount;
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glPathGlyphRangeNV {
+    GLuint firstPathName;
+    GLenum fontTarget;
+    const void *fontName;
+    GLbitfield fontStyle;
+    GLuint firstGlyph;
+    GLsizei numGlyphs;
+    GLenum handleMissingGlyphs;
+    GLuint pathParameterTemplate;
+    GLfloat emScale;
+};
+
+static void exec_glPathGlyphRangeNV(const void* args) {
+    const struct marshal_glPathGlyphRangeNV* cmd = args;
+    gles_driver.ext.glPathGlyphRangeNV(cmd->firstPathName, cmd->fontTarget, cmd->fontName, cmd->fontStyle, cmd->firstGlyph, cmd->numGlyphs, cmd->handleMissingGlyphs, cmd->pathParameterTemplate, cmd->emScale);
+}
+
+static void GL_APIENTRY marshal_glPathGlyphRangeNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathGlyphRangeNV(firstPathName, fontTarget, fontName, fontStyle, firstGlyph, numGlyphs, handleMissingGlyphs, pathParameterTemplate, emScale);
+        return;
+    }
+    struct marshal_glPathGlyphRangeNV* cmd = glthread_alloc(exec_glPathGlyphRangeNV, sizeof(*cmd));
+    cmd->firstPathName = firstPathName;
+    cmd->fontTarget = fontTarget;
+    cmd->fontName = fontName;
+    cmd->fontStyle = fontStyle;
+    cmd->firstGlyph = firstGlyph;
+    cmd->numGlyphs = numGlyphs;
+    cmd->handleMissingGlyphs = handleMissingGlyphs;
+    cmd->pathParameterTemplate = pathParameterTemplate;
+    cmd->emScale = emScale;
+    glthread_sync();
+}
+
+struct marshal_glPathGlyphsNV {
+    GLuint firstPathName;
+    GLenum fontTarget;
+    const void *fontName;
+    GLbitfield fontStyle;
+    GLsizei numGlyphs;
+    GLenum type;
+    const void *charcodes;
+    GLenum handleMissingGlyphs;
+    GLuint pathParameterTemplate;
+    GLfloat emScale;
+};
+
+static void exec_glPathGlyphsNV(const void* args) {
+    const struct marshal_glPathGlyphsNV* cmd = args;
+    gles_driver.ext.glPathGlyphsNV(cmd->firstPathName, cmd->fontTarget, cmd->fontName, cmd->fontStyle, cmd->numGlyphs, cmd->type, cmd->charcodes, cmd->handleMissingGlyphs, cmd->pathParameterTemplate, cmd->emScale);
+}
+
+static void GL_APIENTRY marshal_glPathGlyphsNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathGlyphsNV(firstPathName, fontTarget, fontName, fontStyle, numGlyphs, type, charcodes, handleMissingGlyphs, pathParameterTemplate, emScale);
+        return;
+    }
+    struct marshal_glPathGlyphsNV* cmd = glthread_alloc(exec_glPathGlyphsNV, sizeof(*cmd));
+    cmd->firstPathName = firstPathName;
+    cmd->fontTarget = fontTarget;
+    cmd->fontName = fontName;
+    cmd->fontStyle = fontStyle;
+    cmd->numGlyphs = numGlyphs;
+    cmd->type = type;
+    cmd->charcodes = charcodes;
+    cmd->handleMissingGlyphs = handleMissingGlyphs;
+    cmd->pathParameterTemplate = pathParameterTemplate;
+    cmd->emScale = emScale;
+    glthread_sync();
+}
+
+struct marshal_glPathMemoryGlyphIndexArrayNV {
+    GLuint firstPathName;
+    GLenum fontTarget;
+    GLsizeiptr fontSize;
+    const void *fontData;
+    GLsizei faceIndex;
+    GLuint firstGlyphIndex;
+    GLsizei numGlyphs;
+    GLuint pathParameterTemplate;
+    GLfloat emScale;
+    GLenum *result;
+};
+
+static void exec_glPathMemoryGlyphIndexArrayNV(const void* args) {
+    const struct marshal_glPathMemoryGlyphIndexArrayNV* cmd = args;
+    *cmd->result = gles_driver.ext.glPathMemoryGlyphIndexArrayNV(cmd->firstPathName, cmd->fontTarget, cmd->fontSize, cmd->fontData, cmd->faceIndex, cmd->firstGlyphIndex, cmd->numGlyphs, cmd->pathParameterTemplate, cmd->emScale);
+}
+
+static GLenum GL_APIENTRY marshal_glPathMemoryGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+    if (!glthread_active()) return gles_driver.ext.glPathMemoryGlyphIndexArrayNV(firstPathName, fontTarget, fontSize, fontData, faceIndex, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale);
+    struct marshal_glPathMemoryGlyphIndexArrayNV* cmd = glthread_alloc(exec_glPathMemoryGlyphIndexArrayNV, sizeof(*cmd));
+    cmd->firstPathName = firstPathName;
+    cmd->fontTarget = fontTarget;
+    cmd->fontSize = fontSize;
+    cmd->fontData = fontData;
+    cmd->faceIndex = faceIndex;
+    cmd->firstGlyphIndex = firstGlyphIndex;
+    cmd->numGlyphs = numGlyphs;
+    cmd->pathParameterTemplate = pathParameterTemplate;
+    cmd->emScale = emScale;
+    GLenum glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glPathParameterfNV {
+    GLuint path;
+    GLenum pname;
+    GLfloat value;
+};
+
+static void exec_glPathParameterfNV(const void* args) {
+    const struct marshal_glPathParameterfNV* cmd = args;
+    gles_driver.ext.glPathParameterfNV(cmd->path, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPathParameterfNV(GLuint path, GLenum pname, GLfloat value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathParameterfNV(path, pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPathParameterfNV* cmd = glthread_alloc(exec_glPathParameterfNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPathParameterfvNV {
+    GLuint path;
+    GLenum pname;
+    const GLfloat *value;
+};
+
+static void exec_glPathParameterfvNV(const void* args) {
+    const struct marshal_glPathParameterfvNV* cmd = args;
+    gles_driver.ext.glPathParameterfvNV(cmd->path, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPathParameterfvNV(GLuint path, GLenum pname, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathParameterfvNV(path, pname, value);
+        return;
+    }
+    struct marshal_glPathParameterfvNV* cmd = glthread_alloc(exec_glPathParameterfvNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->pname = pname;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glPathParameteriNV {
+    GLuint path;
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glPathParameteriNV(const void* args) {
+    const struct marshal_glPathParameteriNV* cmd = args;
+    gles_driver.ext.glPathParameteriNV(cmd->path, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPathParameteriNV(GLuint path, GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathParameteriNV(path, pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPathParameteriNV* cmd = glthread_alloc(exec_glPathParameteriNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPathParameterivNV {
+    GLuint path;
+    GLenum pname;
+    const GLint *value;
+};
+
+static void exec_glPathParameterivNV(const void* args) {
+    const struct marshal_glPathParameterivNV* cmd = args;
+    gles_driver.ext.glPathParameterivNV(cmd->path, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glPathParameterivNV(GLuint path, GLenum pname, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathParameterivNV(path, pname, value);
+        return;
+    }
+    struct marshal_glPathParameterivNV* cmd = glthread_alloc(exec_glPathParameterivNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->pname = pname;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glPathStencilDepthOffsetNV {
+    GLfloat factor;
+    GLfloat units;
+};
+
+static void exec_glPathStencilDepthOffsetNV(const void* args) {
+    const struct marshal_glPathStencilDepthOffsetNV* cmd = args;
+    gles_driver.ext.glPathStencilDepthOffsetNV(cmd->factor, cmd->units);
+}
+
+static void GL_APIENTRY marshal_glPathStencilDepthOffsetNV(GLfloat factor, GLfloat units) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathStencilDepthOffsetNV(factor, units);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPathStencilDepthOffsetNV* cmd = glthread_alloc(exec_glPathStencilDepthOffsetNV, sizeof(*cmd));
+    cmd->factor = factor;
+    cmd->units = units;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPathStencilFuncNV {
+    GLenum func;
+    GLint ref;
+    GLuint mask;
+};
+
+static void exec_glPathStencilFuncNV(const void* args) {
+    const struct marshal_glPathStencilFuncNV* cmd = args;
+    gles_driver.ext.glPathStencilFuncNV(cmd->func, cmd->ref, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glPathStencilFuncNV(GLenum func, GLint ref, GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathStencilFuncNV(func, ref, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPathStencilFuncNV* cmd = glthread_alloc(exec_glPathStencilFuncNV, sizeof(*cmd));
+    cmd->func = func;
+    cmd->ref = ref;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPathStringNV {
+    GLuint path;
+    GLenum format;
+    GLsizei length;
+    const void *pathString;
+};
+
+static void exec_glPathStringNV(const void* args) {
+    const struct marshal_glPathStringNV* cmd = args;
+    gles_driver.ext.glPathStringNV(cmd->path, cmd->format, cmd->length, cmd->pathString);
+}
+
+static void GL_APIENTRY marshal_glPathStringNV(GLuint path, GLenum format, GLsizei length, const void *pathString) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathStringNV(path, format, length, pathString);
+        return;
+    }
+    struct marshal_glPathStringNV* cmd = glthread_alloc(exec_glPathStringNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->format = format;
+    cmd->length = length;
+    cmd->pathString = pathString;
+    glthread_sync();
+}
+
+struct marshal_glPathSubCommandsNV {
+    GLuint path;
+    GLsizei commandStart;
+    GLsizei commandsToDelete;
+    GLsizei numCommands;
+    const GLubyte *commands;
+    GLsizei numCoords;
+    GLenum coordType;
+    const void *coords;
+};
+
+static void exec_glPathSubCommandsNV(const void* args) {
+    const struct marshal_glPathSubCommandsNV* cmd = args;
+    gles_driver.ext.glPathSubCommandsNV(cmd->path, cmd->commandStart, cmd->commandsToDelete, cmd->numCommands, cmd->commands, cmd->numCoords, cmd->coordType, cmd->coords);
+}
+
+static void GL_APIENTRY marshal_glPathSubCommandsNV(GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathSubCommandsNV(path, commandStart, commandsToDelete, numCommands, commands, numCoords, coordType, coords);
+        return;
+    }
+    struct marshal_glPathSubCommandsNV* cmd = glthread_alloc(exec_glPathSubCommandsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->commandStart = commandStart;
+    cmd->commandsToDelete = commandsToDelete;
+    cmd->numCommands = numCommands;
+    cmd->commands = commands;
+    cmd->numCoords = numCoords;
+    cmd->coordType = coordType;
+    cmd->coords = coords;
+    glthread_sync();
+}
+
+struct marshal_glPathSubCoordsNV {
+    GLuint path;
+    GLsizei coordStart;
+    GLsizei numCoords;
+    GLenum coordType;
+    const void *coords;
+};
+
+static void exec_glPathSubCoordsNV(const void* args) {
+    const struct marshal_glPathSubCoordsNV* cmd = args;
+    gles_driver.ext.glPathSubCoordsNV(cmd->path, cmd->coordStart, cmd->numCoords, cmd->coordType, cmd->coords);
+}
+
+static void GL_APIENTRY marshal_glPathSubCoordsNV(GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPathSubCoordsNV(path, coordStart, numCoords, coordType, coords);
+        return;
+    }
+    struct marshal_glPathSubCoordsNV* cmd = glthread_alloc(exec_glPathSubCoordsNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->coordStart = coordStart;
+    cmd->numCoords = numCoords;
+    cmd->coordType = coordType;
+    cmd->coords = coords;
+    glthread_sync();
+}
+
+struct marshal_glPointAlongPathNV {
+    GLuint path;
+    GLsizei startSegment;
+    GLsizei numSegments;
+    GLfloat distance;
+    GLfloat *x;
+    GLfloat *y;
+    GLfloat *tangentX;
+    GLfloat *tangentY;
+    GLboolean *result;
+};
+
+static void exec_glPointAlongPathNV(const void* args) {
+    const struct marshal_glPointAlongPathNV* cmd = args;
+    *cmd->result = gles_driver.ext.glPointAlongPathNV(cmd->path, cmd->startSegment, cmd->numSegments, cmd->distance, cmd->x, cmd->y, cmd->tangentX, cmd->tangentY);
+}
+
+static GLboolean GL_APIENTRY marshal_glPointAlongPathNV(GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY) {
+    if (!glthread_active()) return gles_driver.ext.glPointAlongPathNV(path, startSegment, numSegments, distance, x, y, tangentX, tangentY);
+    struct marshal_glPointAlongPathNV* cmd = glthread_alloc(exec_glPointAlongPathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->startSegment = startSegment;
+    cmd->numSegments = numSegments;
+    cmd->distance = distance;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->tangentX = tangentX;
+    cmd->tangentY = tangentY;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glPolygonModeNV {
+    GLenum face;
+    GLenum mode;
+};
+
+static void exec_glPolygonModeNV(const void* args) {
+    const struct marshal_glPolygonModeNV* cmd = args;
+    gles_driver.ext.glPolygonModeNV(cmd->face, cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glPolygonModeNV(GLenum face, GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPolygonModeNV(face, mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPolygonModeNV* cmd = glthread_alloc(exec_glPolygonModeNV, sizeof(*cmd));
+    cmd->face = face;
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPolygonOffsetClampEXT {
+    GLfloat factor;
+    GLfloat units;
+    GLfloat clamp;
+};
+
+static void exec_glPolygonOffsetClampEXT(const void* args) {
+    const struct marshal_glPolygonOffsetClampEXT* cmd = args;
+    gles_driver.ext.glPolygonOffsetClampEXT(cmd->factor, cmd->units, cmd->clamp);
+}
+
+static void GL_APIENTRY marshal_glPolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat clamp) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPolygonOffsetClampEXT(factor, units, clamp);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPolygonOffsetClampEXT* cmd = glthread_alloc(exec_glPolygonOffsetClampEXT, sizeof(*cmd));
+    cmd->factor = factor;
+    cmd->units = units;
+    cmd->clamp = clamp;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPopDebugGroupKHR {
+    char unused;
+};
+
+static void exec_glPopDebugGroupKHR(const void* args) {
+    (void)args;
+    gles_driver.ext.glPopDebugGroupKHR();
+}
+
+static void GL_APIENTRY marshal_glPopDebugGroupKHR(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPopDebugGroupKHR();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPopDebugGroupKHR* cmd = glthread_alloc(exec_glPopDebugGroupKHR, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPopGroupMarkerEXT {
+    char unused;
+};
+
+static void exec_glPopGroupMarkerEXT(const void* args) {
+    (void)args;
+    gles_driver.ext.glPopGroupMarkerEXT();
+}
+
+static void GL_APIENTRY marshal_glPopGroupMarkerEXT(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPopGroupMarkerEXT();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPopGroupMarkerEXT* cmd = glthread_alloc(exec_glPopGroupMarkerEXT, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPrimitiveBoundingBoxEXT {
+    GLfloat minX;
+    GLfloat minY;
+    GLfloat minZ;
+    GLfloat minW;
+    GLfloat maxX;
+    GLfloat maxY;
+    GLfloat maxZ;
+    GLfloat maxW;
+};
+
+static void exec_glPrimitiveBoundingBoxEXT(const void* args) {
+    const struct marshal_glPrimitiveBoundingBoxEXT* cmd = args;
+    gles_driver.ext.glPrimitiveBoundingBoxEXT(cmd->minX, cmd->minY, cmd->minZ, cmd->minW, cmd->maxX, cmd->maxY, cmd->maxZ, cmd->maxW);
+}
+
+static void GL_APIENTRY marshal_glPrimitiveBoundingBoxEXT(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPrimitiveBoundingBoxEXT(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPrimitiveBoundingBoxEXT* cmd = glthread_alloc(exec_glPrimitiveBoundingBoxEXT, sizeof(*cmd));
+    cmd->minX = minX;
+    cmd->minY = minY;
+    cmd->minZ = minZ;
+    cmd->minW = minW;
+    cmd->maxX = maxX;
+    cmd->maxY = maxY;
+    cmd->maxZ = maxZ;
+    cmd->maxW = maxW;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPrimitiveBoundingBoxOES {
+    GLfloat minX;
+    GLfloat minY;
+    GLfloat minZ;
+    GLfloat minW;
+    GLfloat maxX;
+    GLfloat maxY;
+    GLfloat maxZ;
+    GLfloat maxW;
+};
+
+static void exec_glPrimitiveBoundingBoxOES(const void* args) {
+    const struct marshal_glPrimitiveBoundingBoxOES* cmd = args;
+    gles_driver.ext.glPrimitiveBoundingBoxOES(cmd->minX, cmd->minY, cmd->minZ, cmd->minW, cmd->maxX, cmd->maxY, cmd->maxZ, cmd->maxW);
+}
+
+static void GL_APIENTRY marshal_glPrimitiveBoundingBoxOES(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPrimitiveBoundingBoxOES(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glPrimitiveBoundingBoxOES* cmd = glthread_alloc(exec_glPrimitiveBoundingBoxOES, sizeof(*cmd));
+    cmd->minX = minX;
+    cmd->minY = minY;
+    cmd->minZ = minZ;
+    cmd->minW = minW;
+    cmd->maxX = maxX;
+    cmd->maxY = maxY;
+    cmd->maxZ = maxZ;
+    cmd->maxW = maxW;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramBinaryOES {
+    GLuint program;
+    GLenum binaryFormat;
+    const void *binary;
+    GLint length;
+};
+
+static void exec_glProgramBinaryOES(const void* args) {
+    const struct marshal_glProgramBinaryOES* cmd = args;
+    gles_driver.ext.glProgramBinaryOES(cmd->program, cmd->binaryFormat, cmd->binary, cmd->length);
+}
+
+static void GL_APIENTRY marshal_glProgramBinaryOES(GLuint program, GLenum binaryFormat, const void *binary, GLint length) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramBinaryOES(program, binaryFormat, binary, length);
+        return;
+    }
+    struct marshal_glProgramBinaryOES* cmd = glthread_alloc(exec_glProgramBinaryOES, sizeof(*cmd));
+    cmd->program = program;
+    cmd->binaryFormat = binaryFormat;
+    cmd->binary = binary;
+    cmd->length = length;
+    glthread_sync();
+}
+
+struct marshal_glProgramParameteriEXT {
+    GLuint program;
+    GLenum pname;
+    GLint value;
+};
+
+static void exec_glProgramParameteriEXT(const void* args) {
+    const struct marshal_glProgramParameteriEXT* cmd = args;
+    gles_driver.ext.glProgramParameteriEXT(cmd->program, cmd->pname, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramParameteriEXT(GLuint program, GLenum pname, GLint value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramParameteriEXT(program, pname, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramParameteriEXT* cmd = glthread_alloc(exec_glProgramParameteriEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->pname = pname;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramPathFragmentInputGenNV {
+    GLuint program;
+    GLint location;
+    GLenum genMode;
+    GLint components;
+    const GLfloat *coeffs;
+};
+
+static void exec_glProgramPathFragmentInputGenNV(const void* args) {
+    const struct marshal_glProgramPathFragmentInputGenNV* cmd = args;
+    gles_driver.ext.glProgramPathFragmentInputGenNV(cmd->program, cmd->location, cmd->genMode, cmd->components, cmd->coeffs);
+}
+
+static void GL_APIENTRY marshal_glProgramPathFragmentInputGenNV(GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramPathFragmentInputGenNV(program, location, genMode, components, coeffs);
+        return;
+    }
+    struct marshal_glProgramPathFragmentInputGenNV* cmd = glthread_alloc(exec_glProgramPathFragmentInputGenNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->genMode = genMode;
+    cmd->components = components;
+    cmd->coeffs = coeffs;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform1fEXT {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+};
+
+static void exec_glProgramUniform1fEXT(const void* args) {
+    const struct marshal_glProgramUniform1fEXT* cmd = args;
+    gles_driver.ext.glProgramUniform1fEXT(cmd->program, cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1fEXT(program, location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1fEXT* cmd = glthread_alloc(exec_glProgramUniform1fEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform1fvEXT(const void* args) {
+    const struct marshal_glProgramUniform1fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniform1fvEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1fvEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform1fvEXT* cmd = glthread_alloc(exec_glProgramUniform1fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1i64NV {
+    GLuint program;
+    GLint location;
+    GLint64EXT x;
+};
+
+static void exec_glProgramUniform1i64NV(const void* args) {
+    const struct marshal_glProgramUniform1i64NV* cmd = args;
+    gles_driver.ext.glProgramUniform1i64NV(cmd->program, cmd->location, cmd->x);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1i64NV(GLuint program, GLint location, GLint64EXT x) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1i64NV(program, location, x);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1i64NV* cmd = glthread_alloc(exec_glProgramUniform1i64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1i64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glProgramUniform1i64vNV(const void* args) {
+    const struct marshal_glProgramUniform1i64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform1i64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1i64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform1i64vNV* cmd = glthread_alloc(exec_glProgramUniform1i64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform1iEXT {
+    GLuint program;
+    GLint location;
+    GLint v0;
+};
+
+static void exec_glProgramUniform1iEXT(const void* args) {
+    const struct marshal_glProgramUniform1iEXT* cmd = args;
+    gles_driver.ext.glProgramUniform1iEXT(cmd->program, cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1iEXT(GLuint program, GLint location, GLint v0) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1iEXT(program, location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1iEXT* cmd = glthread_alloc(exec_glProgramUniform1iEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1ivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform1ivEXT(const void* args) {
+    const struct marshal_glProgramUniform1ivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform1ivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1ivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform1ivEXT* cmd = glthread_alloc(exec_glProgramUniform1ivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1ui64NV {
+    GLuint program;
+    GLint location;
+    GLuint64EXT x;
+};
+
+static void exec_glProgramUniform1ui64NV(const void* args) {
+    const struct marshal_glProgramUniform1ui64NV* cmd = args;
+    gles_driver.ext.glProgramUniform1ui64NV(cmd->program, cmd->location, cmd->x);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1ui64NV(GLuint program, GLint location, GLuint64EXT x) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1ui64NV(program, location, x);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1ui64NV* cmd = glthread_alloc(exec_glProgramUniform1ui64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1ui64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glProgramUniform1ui64vNV(const void* args) {
+    const struct marshal_glProgramUniform1ui64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform1ui64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1ui64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform1ui64vNV* cmd = glthread_alloc(exec_glProgramUniform1ui64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform1uiEXT {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+};
+
+static void exec_glProgramUniform1uiEXT(const void* args) {
+    const struct marshal_glProgramUniform1uiEXT* cmd = args;
+    gles_driver.ext.glProgramUniform1uiEXT(cmd->program, cmd->location, cmd->v0);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1uiEXT(program, location, v0);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform1uiEXT* cmd = glthread_alloc(exec_glProgramUniform1uiEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform1uivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform1uivEXT(const void* args) {
+    const struct marshal_glProgramUniform1uivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform1uivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform1uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform1uivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 1 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform1uivEXT* cmd = glthread_alloc(exec_glProgramUniform1uivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2fEXT {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+};
+
+static void exec_glProgramUniform2fEXT(const void* args) {
+    const struct marshal_glProgramUniform2fEXT* cmd = args;
+    gles_driver.ext.glProgramUniform2fEXT(cmd->program, cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2fEXT(program, location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2fEXT* cmd = glthread_alloc(exec_glProgramUniform2fEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform2fvEXT(const void* args) {
+    const struct marshal_glProgramUniform2fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniform2fvEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2fvEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform2fvEXT* cmd = glthread_alloc(exec_glProgramUniform2fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2i64NV {
+    GLuint program;
+    GLint location;
+    GLint64EXT x;
+    GLint64EXT y;
+};
+
+static void exec_glProgramUniform2i64NV(const void* args) {
+    const struct marshal_glProgramUniform2i64NV* cmd = args;
+    gles_driver.ext.glProgramUniform2i64NV(cmd->program, cmd->location, cmd->x, cmd->y);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2i64NV(program, location, x, y);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2i64NV* cmd = glthread_alloc(exec_glProgramUniform2i64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2i64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glProgramUniform2i64vNV(const void* args) {
+    const struct marshal_glProgramUniform2i64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform2i64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2i64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform2i64vNV* cmd = glthread_alloc(exec_glProgramUniform2i64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform2iEXT {
+    GLuint program;
+    GLint location;
+    GLint v0;
+    GLint v1;
+};
+
+static void exec_glProgramUniform2iEXT(const void* args) {
+    const struct marshal_glProgramUniform2iEXT* cmd = args;
+    gles_driver.ext.glProgramUniform2iEXT(cmd->program, cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2iEXT(program, location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2iEXT* cmd = glthread_alloc(exec_glProgramUniform2iEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2ivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform2ivEXT(const void* args) {
+    const struct marshal_glProgramUniform2ivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform2ivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2ivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform2ivEXT* cmd = glthread_alloc(exec_glProgramUniform2ivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2ui64NV {
+    GLuint program;
+    GLint location;
+    GLuint64EXT x;
+    GLuint64EXT y;
+};
+
+static void exec_glProgramUniform2ui64NV(const void* args) {
+    const struct marshal_glProgramUniform2ui64NV* cmd = args;
+    gles_driver.ext.glProgramUniform2ui64NV(cmd->program, cmd->location, cmd->x, cmd->y);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2ui64NV(program, location, x, y);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2ui64NV* cmd = glthread_alloc(exec_glProgramUniform2ui64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2ui64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glProgramUniform2ui64vNV(const void* args) {
+    const struct marshal_glProgramUniform2ui64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform2ui64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2ui64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform2ui64vNV* cmd = glthread_alloc(exec_glProgramUniform2ui64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform2uiEXT {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+};
+
+static void exec_glProgramUniform2uiEXT(const void* args) {
+    const struct marshal_glProgramUniform2uiEXT* cmd = args;
+    gles_driver.ext.glProgramUniform2uiEXT(cmd->program, cmd->location, cmd->v0, cmd->v1);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2uiEXT(program, location, v0, v1);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform2uiEXT* cmd = glthread_alloc(exec_glProgramUniform2uiEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform2uivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform2uivEXT(const void* args) {
+    const struct marshal_glProgramUniform2uivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform2uivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform2uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform2uivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 2 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform2uivEXT* cmd = glthread_alloc(exec_glProgramUniform2uivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3fEXT {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+};
+
+static void exec_glProgramUniform3fEXT(const void* args) {
+    const struct marshal_glProgramUniform3fEXT* cmd = args;
+    gles_driver.ext.glProgramUniform3fEXT(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3fEXT(program, location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3fEXT* cmd = glthread_alloc(exec_glProgramUniform3fEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform3fvEXT(const void* args) {
+    const struct marshal_glProgramUniform3fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniform3fvEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3fvEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform3fvEXT* cmd = glthread_alloc(exec_glProgramUniform3fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3i64NV {
+    GLuint program;
+    GLint location;
+    GLint64EXT x;
+    GLint64EXT y;
+    GLint64EXT z;
+};
+
+static void exec_glProgramUniform3i64NV(const void* args) {
+    const struct marshal_glProgramUniform3i64NV* cmd = args;
+    gles_driver.ext.glProgramUniform3i64NV(cmd->program, cmd->location, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3i64NV(program, location, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3i64NV* cmd = glthread_alloc(exec_glProgramUniform3i64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3i64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glProgramUniform3i64vNV(const void* args) {
+    const struct marshal_glProgramUniform3i64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform3i64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3i64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform3i64vNV* cmd = glthread_alloc(exec_glProgramUniform3i64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform3iEXT {
+    GLuint program;
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+};
+
+static void exec_glProgramUniform3iEXT(const void* args) {
+    const struct marshal_glProgramUniform3iEXT* cmd = args;
+    gles_driver.ext.glProgramUniform3iEXT(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3iEXT(program, location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3iEXT* cmd = glthread_alloc(exec_glProgramUniform3iEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3ivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform3ivEXT(const void* args) {
+    const struct marshal_glProgramUniform3ivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform3ivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3ivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform3ivEXT* cmd = glthread_alloc(exec_glProgramUniform3ivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3ui64NV {
+    GLuint program;
+    GLint location;
+    GLuint64EXT x;
+    GLuint64EXT y;
+    GLuint64EXT z;
+};
+
+static void exec_glProgramUniform3ui64NV(const void* args) {
+    const struct marshal_glProgramUniform3ui64NV* cmd = args;
+    gles_driver.ext.glProgramUniform3ui64NV(cmd->program, cmd->location, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3ui64NV(program, location, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3ui64NV* cmd = glthread_alloc(exec_glProgramUniform3ui64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3ui64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glProgramUniform3ui64vNV(const void* args) {
+    const struct marshal_glProgramUniform3ui64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform3ui64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3ui64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform3ui64vNV* cmd = glthread_alloc(exec_glProgramUniform3ui64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform3uiEXT {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+    GLuint v2;
+};
+
+static void exec_glProgramUniform3uiEXT(const void* args) {
+    const struct marshal_glProgramUniform3uiEXT* cmd = args;
+    gles_driver.ext.glProgramUniform3uiEXT(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3uiEXT(program, location, v0, v1, v2);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform3uiEXT* cmd = glthread_alloc(exec_glProgramUniform3uiEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform3uivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform3uivEXT(const void* args) {
+    const struct marshal_glProgramUniform3uivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform3uivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform3uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform3uivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 3 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform3uivEXT* cmd = glthread_alloc(exec_glProgramUniform3uivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4fEXT {
+    GLuint program;
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+    GLfloat v3;
+};
+
+static void exec_glProgramUniform4fEXT(const void* args) {
+    const struct marshal_glProgramUniform4fEXT* cmd = args;
+    gles_driver.ext.glProgramUniform4fEXT(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4fEXT(program, location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4fEXT* cmd = glthread_alloc(exec_glProgramUniform4fEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniform4fvEXT(const void* args) {
+    const struct marshal_glProgramUniform4fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniform4fvEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4fvEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform4fvEXT* cmd = glthread_alloc(exec_glProgramUniform4fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4i64NV {
+    GLuint program;
+    GLint location;
+    GLint64EXT x;
+    GLint64EXT y;
+    GLint64EXT z;
+    GLint64EXT w;
+};
+
+static void exec_glProgramUniform4i64NV(const void* args) {
+    const struct marshal_glProgramUniform4i64NV* cmd = args;
+    gles_driver.ext.glProgramUniform4i64NV(cmd->program, cmd->location, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4i64NV(program, location, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4i64NV* cmd = glthread_alloc(exec_glProgramUniform4i64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4i64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glProgramUniform4i64vNV(const void* args) {
+    const struct marshal_glProgramUniform4i64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform4i64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4i64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform4i64vNV* cmd = glthread_alloc(exec_glProgramUniform4i64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform4iEXT {
+    GLuint program;
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+    GLint v3;
+};
+
+static void exec_glProgramUniform4iEXT(const void* args) {
+    const struct marshal_glProgramUniform4iEXT* cmd = args;
+    gles_driver.ext.glProgramUniform4iEXT(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4iEXT(program, location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4iEXT* cmd = glthread_alloc(exec_glProgramUniform4iEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4ivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+static void exec_glProgramUniform4ivEXT(const void* args) {
+    const struct marshal_glProgramUniform4ivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform4ivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4ivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform4ivEXT* cmd = glthread_alloc(exec_glProgramUniform4ivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4ui64NV {
+    GLuint program;
+    GLint location;
+    GLuint64EXT x;
+    GLuint64EXT y;
+    GLuint64EXT z;
+    GLuint64EXT w;
+};
+
+static void exec_glProgramUniform4ui64NV(const void* args) {
+    const struct marshal_glProgramUniform4ui64NV* cmd = args;
+    gles_driver.ext.glProgramUniform4ui64NV(cmd->program, cmd->location, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4ui64NV(program, location, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4ui64NV* cmd = glthread_alloc(exec_glProgramUniform4ui64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4ui64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glProgramUniform4ui64vNV(const void* args) {
+    const struct marshal_glProgramUniform4ui64vNV* cmd = args;
+    gles_driver.ext.glProgramUniform4ui64vNV(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4ui64vNV(program, location, count, value);
+        return;
+    }
+    struct marshal_glProgramUniform4ui64vNV* cmd = glthread_alloc(exec_glProgramUniform4ui64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniform4uiEXT {
+    GLuint program;
+    GLint location;
+    GLuint v0;
+    GLuint v1;
+    GLuint v2;
+    GLuint v3;
+};
+
+static void exec_glProgramUniform4uiEXT(const void* args) {
+    const struct marshal_glProgramUniform4uiEXT* cmd = args;
+    gles_driver.ext.glProgramUniform4uiEXT(cmd->program, cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4uiEXT(program, location, v0, v1, v2, v3);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniform4uiEXT* cmd = glthread_alloc(exec_glProgramUniform4uiEXT, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->v0 = v0;
+    cmd->v1 = v1;
+    cmd->v2 = v2;
+    cmd->v3 = v3;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniform4uivEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint *value;
+};
+
+static void exec_glProgramUniform4uivEXT(const void* args) {
+    const struct marshal_glProgramUniform4uivEXT* cmd = args;
+    gles_driver.ext.glProgramUniform4uivEXT(cmd->program, cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniform4uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniform4uivEXT(program, location, count, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniform4uivEXT* cmd = glthread_alloc(exec_glProgramUniform4uivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformHandleui64IMG {
+    GLuint program;
+    GLint location;
+    GLuint64 value;
+};
+
+static void exec_glProgramUniformHandleui64IMG(const void* args) {
+    const struct marshal_glProgramUniformHandleui64IMG* cmd = args;
+    gles_driver.ext.glProgramUniformHandleui64IMG(cmd->program, cmd->location, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformHandleui64IMG(GLuint program, GLint location, GLuint64 value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformHandleui64IMG(program, location, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniformHandleui64IMG* cmd = glthread_alloc(exec_glProgramUniformHandleui64IMG, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformHandleui64NV {
+    GLuint program;
+    GLint location;
+    GLuint64 value;
+};
+
+static void exec_glProgramUniformHandleui64NV(const void* args) {
+    const struct marshal_glProgramUniformHandleui64NV* cmd = args;
+    gles_driver.ext.glProgramUniformHandleui64NV(cmd->program, cmd->location, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformHandleui64NV(GLuint program, GLint location, GLuint64 value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformHandleui64NV(program, location, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glProgramUniformHandleui64NV* cmd = glthread_alloc(exec_glProgramUniformHandleui64NV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformHandleui64vIMG {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint64 *values;
+};
+
+static void exec_glProgramUniformHandleui64vIMG(const void* args) {
+    const struct marshal_glProgramUniformHandleui64vIMG* cmd = args;
+    gles_driver.ext.glProgramUniformHandleui64vIMG(cmd->program, cmd->location, cmd->count, cmd->values);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformHandleui64vIMG(GLuint program, GLint location, GLsizei count, const GLuint64 *values) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformHandleui64vIMG(program, location, count, values);
+        return;
+    }
+    struct marshal_glProgramUniformHandleui64vIMG* cmd = glthread_alloc(exec_glProgramUniformHandleui64vIMG, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->values = values;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniformHandleui64vNV {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    const GLuint64 *values;
+};
+
+static void exec_glProgramUniformHandleui64vNV(const void* args) {
+    const struct marshal_glProgramUniformHandleui64vNV* cmd = args;
+    gles_driver.ext.glProgramUniformHandleui64vNV(cmd->program, cmd->location, cmd->count, cmd->values);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformHandleui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64 *values) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformHandleui64vNV(program, location, count, values);
+        return;
+    }
+    struct marshal_glProgramUniformHandleui64vNV* cmd = glthread_alloc(exec_glProgramUniformHandleui64vNV, sizeof(*cmd));
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->values = values;
+    glthread_sync();
+}
+
+struct marshal_glProgramUniformMatrix2fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix2fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix2fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix2fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix2fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 4 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix2fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix2fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix2x3fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix2x3fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix2x3fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix2x3fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix2x3fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix2x3fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix2x3fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix2x4fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix2x4fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix2x4fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix2x4fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix2x4fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix2x4fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix2x4fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix3fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix3fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix3fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix3fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix3fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 9 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix3fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix3fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix3x2fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix3x2fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix3x2fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix3x2fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix3x2fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix3x2fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix3x2fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix3x4fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix3x4fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix3x4fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix3x4fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix3x4fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix3x4fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix3x4fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix4fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix4fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix4fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix4fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix4fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 16 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix4fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix4fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix4x2fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix4x2fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix4x2fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix4x2fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix4x2fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix4x2fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix4x2fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glProgramUniformMatrix4x3fvEXT {
+    GLuint program;
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glProgramUniformMatrix4x3fvEXT(const void* args) {
+    const struct marshal_glProgramUniformMatrix4x3fvEXT* cmd = args;
+    gles_driver.ext.glProgramUniformMatrix4x3fvEXT(cmd->program, cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glProgramUniformMatrix4x3fvEXT(program, location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glProgramUniformMatrix4x3fvEXT* cmd = glthread_alloc(exec_glProgramUniformMatrix4x3fvEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->program = program;
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glPushDebugGroupKHR {
+    GLenum source;
+    GLuint id;
+    GLsizei length;
+    const GLchar *message;
+};
+
+static void exec_glPushDebugGroupKHR(const void* args) {
+    const struct marshal_glPushDebugGroupKHR* cmd = args;
+    gles_driver.ext.glPushDebugGroupKHR(cmd->source, cmd->id, cmd->length, cmd->message);
+}
+
+static void GL_APIENTRY marshal_glPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPushDebugGroupKHR(source, id, length, message);
+        return;
+    }
+    struct marshal_glPushDebugGroupKHR* cmd = glthread_alloc(exec_glPushDebugGroupKHR, sizeof(*cmd));
+    cmd->source = source;
+    cmd->id = id;
+    cmd->length = length;
+    cmd->message = message;
+    glthread_sync();
+}
+
+struct marshal_glPushGroupMarkerEXT {
+    GLsizei length;
+    const GLchar *marker;
+};
+
+static void exec_glPushGroupMarkerEXT(const void* args) {
+    const struct marshal_glPushGroupMarkerEXT* cmd = args;
+    gles_driver.ext.glPushGroupMarkerEXT(cmd->length, cmd->marker);
+}
+
+static void GL_APIENTRY marshal_glPushGroupMarkerEXT(GLsizei length, const GLchar *marker) {
+    if (!glthread_active()) {
+        gles_driver.ext.glPushGroupMarkerEXT(length, marker);
+        return;
+    }
+    struct marshal_glPushGroupMarkerEXT* cmd = glthread_alloc(exec_glPushGroupMarkerEXT, sizeof(*cmd));
+    cmd->length = length;
+    cmd->marker = marker;
+    glthread_sync();
+}
+
+struct marshal_glQueryCounterEXT {
+    GLuint id;
+    GLenum target;
+};
+
+static void exec_glQueryCounterEXT(const void* args) {
+    const struct marshal_glQueryCounterEXT* cmd = args;
+    gles_driver.ext.glQueryCounterEXT(cmd->id, cmd->target);
+}
+
+static void GL_APIENTRY marshal_glQueryCounterEXT(GLuint id, GLenum target) {
+    if (!glthread_active()) {
+        gles_driver.ext.glQueryCounterEXT(id, target);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glQueryCounterEXT* cmd = glthread_alloc(exec_glQueryCounterEXT, sizeof(*cmd));
+    cmd->id = id;
+    cmd->target = target;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRasterSamplesEXT {
+    GLuint samples;
+    GLboolean fixedsamplelocations;
+};
+
+static void exec_glRasterSamplesEXT(const void* args) {
+    const struct marshal_glRasterSamplesEXT* cmd = args;
+    gles_driver.ext.glRasterSamplesEXT(cmd->samples, cmd->fixedsamplelocations);
+}
+
+static void GL_APIENTRY marshal_glRasterSamplesEXT(GLuint samples, GLboolean fixedsamplelocations) {
+    if (!glthread_active()) {
+        gles_driver.ext.glRasterSamplesEXT(samples, fixedsamplelocations);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRasterSamplesEXT* cmd = glthread_alloc(exec_glRasterSamplesEXT, sizeof(*cmd));
+    cmd->samples = samples;
+    cmd->fixedsamplelocations = fixedsamplelocations;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glReadBufferIndexedEXT {
+    GLenum src;
+    GLint index;
+};
+
+static void exec_glReadBufferIndexedEXT(const void* args) {
+    const struct marshal_glReadBufferIndexedEXT* cmd = args;
+    gles_driver.ext.glReadBufferIndexedEXT(cmd->src, cmd->index);
+}
+
+static void GL_APIENTRY marshal_glReadBufferIndexedEXT(GLenum src, GLint index) {
+    if (!glthread_active()) {
+        gles_driver.ext.glReadBufferIndexedEXT(src, index);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glReadBufferIndexedEXT* cmd = glthread_alloc(exec_glReadBufferIndexedEXT, sizeof(*cmd));
+    cmd->src = src;
+    cmd->index = index;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glReadBufferNV {
+    GLenum mode;
+};
+
+static void exec_glReadBufferNV(const void* args) {
+    const struct marshal_glReadBufferNV* cmd = args;
+    gles_driver.ext.glReadBufferNV(cmd->mode);
+}
+
+static void GL_APIENTRY marshal_glReadBufferNV(GLenum mode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glReadBufferNV(mode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glReadBufferNV* cmd = glthread_alloc(exec_glReadBufferNV, sizeof(*cmd));
+    cmd->mode = mode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glReadnPixelsEXT {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    GLenum type;
+    GLsizei bufSize;
+    void *data;
+};
+
+static void exec_glReadnPixelsEXT(const void* args) {
+    const struct marshal_glReadnPixelsEXT* cmd = args;
+    gles_driver.ext.glReadnPixelsEXT(cmd->x, cmd->y, cmd->width, cmd->height, cmd->format, cmd->type, cmd->bufSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glReadnPixelsEXT(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glReadnPixelsEXT(x, y, width, height, format, type, bufSize, data);
+        return;
+    }
+    struct marshal_glReadnPixelsEXT* cmd = glthread_alloc(exec_glReadnPixelsEXT, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->bufSize = bufSize;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glReadnPixelsKHR {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    GLenum type;
+    GLsizei bufSize;
+    void *data;
+};
+
+static void exec_glReadnPixelsKHR(const void* args) {
+    const struct marshal_glReadnPixelsKHR* cmd = args;
+    gles_driver.ext.glReadnPixelsKHR(cmd->x, cmd->y, cmd->width, cmd->height, cmd->format, cmd->type, cmd->bufSize, cmd->data);
+}
+
+static void GL_APIENTRY marshal_glReadnPixelsKHR(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    if (!glthread_active()) {
+        gles_driver.ext.glReadnPixelsKHR(x, y, width, height, format, type, bufSize, data);
+        return;
+    }
+    struct marshal_glReadnPixelsKHR* cmd = glthread_alloc(exec_glReadnPixelsKHR, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->bufSize = bufSize;
+    cmd->data = data;
+    glthread_sync();
+}
+
+struct marshal_glRenderbufferStorageMultisampleANGLE {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorageMultisampleANGLE(const void* args) {
+    const struct marshal_glRenderbufferStorageMultisampleANGLE* cmd = args;
+    gles_driver.ext.glRenderbufferStorageMultisampleANGLE(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorageMultisampleANGLE(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glRenderbufferStorageMultisampleANGLE(target, samples, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorageMultisampleANGLE* cmd = glthread_alloc(exec_glRenderbufferStorageMultisampleANGLE, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRenderbufferStorageMultisampleAPPLE {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorageMultisampleAPPLE(const void* args) {
+    const struct marshal_glRenderbufferStorageMultisampleAPPLE* cmd = args;
+    gles_driver.ext.glRenderbufferStorageMultisampleAPPLE(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorageMultisampleAPPLE(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glRenderbufferStorageMultisampleAPPLE(target, samples, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorageMultisampleAPPLE* cmd = glthread_alloc(exec_glRenderbufferStorageMultisampleAPPLE, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRenderbufferStorageMultisampleEXT {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorageMultisampleEXT(const void* args) {
+    const struct marshal_glRenderbufferStorageMultisampleEXT* cmd = args;
+    gles_driver.ext.glRenderbufferStorageMultisampleEXT(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorageMultisampleEXT(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glRenderbufferStorageMultisampleEXT(target, samples, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorageMultisampleEXT* cmd = glthread_alloc(exec_glRenderbufferStorageMultisampleEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRenderbufferStorageMultisampleIMG {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorageMultisampleIMG(const void* args) {
+    const struct marshal_glRenderbufferStorageMultisampleIMG* cmd = args;
+    gles_driver.ext.glRenderbufferStorageMultisampleIMG(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorageMultisampleIMG(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glRenderbufferStorageMultisampleIMG(target, samples, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorageMultisampleIMG* cmd = glthread_alloc(exec_glRenderbufferStorageMultisampleIMG, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glRenderbufferStorageMultisampleNV {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glRenderbufferStorageMultisampleNV(const void* args) {
+    const struct marshal_glRenderbufferStorageMultisampleNV* cmd = args;
+    gles_driver.ext.glRenderbufferStorageMultisampleNV(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glRenderbufferStorageMultisampleNV(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glRenderbufferStorageMultisampleNV(target, samples, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glRenderbufferStorageMultisampleNV* cmd = glthread_alloc(exec_glRenderbufferStorageMultisampleNV, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glResolveDepthValuesNV {
+    char unused;
+};
+
+static void exec_glResolveDepthValuesNV(const void* args) {
+    (void)args;
+    gles_driver.ext.glResolveDepthValuesNV();
+}
+
+static void GL_APIENTRY marshal_glResolveDepthValuesNV(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glResolveDepthValuesNV();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glResolveDepthValuesNV* cmd = glthread_alloc(exec_glResolveDepthValuesNV, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glResolveMultisampleFramebufferAPPLE {
+    char unused;
+};
+
+static void exec_glResolveMultisampleFramebufferAPPLE(const void* args) {
+    (void)args;
+    gles_driver.ext.glResolveMultisampleFramebufferAPPLE();
+}
+
+static void GL_APIENTRY marshal_glResolveMultisampleFramebufferAPPLE(void) {
+    if (!glthread_active()) {
+        gles_driver.ext.glResolveMultisampleFramebufferAPPLE();
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glResolveMultisampleFramebufferAPPLE* cmd = glthread_alloc(exec_glResolveMultisampleFramebufferAPPLE, sizeof(*cmd));
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterIivEXT {
+    GLuint sampler;
+    GLenum pname;
+    const GLint *param;
+};
+
+static void exec_glSamplerParameterIivEXT(const void* args) {
+    const struct marshal_glSamplerParameterIivEXT* cmd = args;
+    gles_driver.ext.glSamplerParameterIivEXT(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterIivEXT(GLuint sampler, GLenum pname, const GLint *param) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSamplerParameterIivEXT(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterIivEXT* cmd = glthread_alloc(exec_glSamplerParameterIivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterIivOES {
+    GLuint sampler;
+    GLenum pname;
+    const GLint *param;
+};
+
+static void exec_glSamplerParameterIivOES(const void* args) {
+    const struct marshal_glSamplerParameterIivOES* cmd = args;
+    gles_driver.ext.glSamplerParameterIivOES(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterIivOES(GLuint sampler, GLenum pname, const GLint *param) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSamplerParameterIivOES(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterIivOES* cmd = glthread_alloc(exec_glSamplerParameterIivOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterIuivEXT {
+    GLuint sampler;
+    GLenum pname;
+    const GLuint *param;
+};
+
+static void exec_glSamplerParameterIuivEXT(const void* args) {
+    const struct marshal_glSamplerParameterIuivEXT* cmd = args;
+    gles_driver.ext.glSamplerParameterIuivEXT(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterIuivEXT(GLuint sampler, GLenum pname, const GLuint *param) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSamplerParameterIuivEXT(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterIuivEXT* cmd = glthread_alloc(exec_glSamplerParameterIuivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSamplerParameterIuivOES {
+    GLuint sampler;
+    GLenum pname;
+    const GLuint *param;
+};
+
+static void exec_glSamplerParameterIuivOES(const void* args) {
+    const struct marshal_glSamplerParameterIuivOES* cmd = args;
+    gles_driver.ext.glSamplerParameterIuivOES(cmd->sampler, cmd->pname, cmd->param);
+}
+
+static void GL_APIENTRY marshal_glSamplerParameterIuivOES(GLuint sampler, GLenum pname, const GLuint *param) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSamplerParameterIuivOES(sampler, pname, param);
+        return;
+    }
+    int glt_sync = 0;
+    size_t param_size = param ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*param)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(param_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glSamplerParameterIuivOES* cmd = glthread_alloc(exec_glSamplerParameterIuivOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->sampler = sampler;
+    cmd->pname = pname;
+    cmd->param = glt_sync ? param : glthread_copy(&glt_tail, param, param_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glScissorArrayvNV {
+    GLuint first;
+    GLsizei count;
+    const GLint *v;
+};
+
+static void exec_glScissorArrayvNV(const void* args) {
+    const struct marshal_glScissorArrayvNV* cmd = args;
+    gles_driver.ext.glScissorArrayvNV(cmd->first, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glScissorArrayvNV(GLuint first, GLsizei count, const GLint *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glScissorArrayvNV(first, count, v);
+        return;
+    }
+    struct marshal_glScissorArrayvNV* cmd = glthread_alloc(exec_glScissorArrayvNV, sizeof(*cmd));
+    cmd->first = first;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glScissorArrayvOES {
+    GLuint first;
+    GLsizei count;
+    const GLint *v;
+};
+
+static void exec_glScissorArrayvOES(const void* args) {
+    const struct marshal_glScissorArrayvOES* cmd = args;
+    gles_driver.ext.glScissorArrayvOES(cmd->first, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glScissorArrayvOES(GLuint first, GLsizei count, const GLint *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glScissorArrayvOES(first, count, v);
+        return;
+    }
+    struct marshal_glScissorArrayvOES* cmd = glthread_alloc(exec_glScissorArrayvOES, sizeof(*cmd));
+    cmd->first = first;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glScissorIndexedNV {
+    GLuint index;
+    GLint left;
+    GLint bottom;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glScissorIndexedNV(const void* args) {
+    const struct marshal_glScissorIndexedNV* cmd = args;
+    gles_driver.ext.glScissorIndexedNV(cmd->index, cmd->left, cmd->bottom, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glScissorIndexedNV(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glScissorIndexedNV(index, left, bottom, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glScissorIndexedNV* cmd = glthread_alloc(exec_glScissorIndexedNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->left = left;
+    cmd->bottom = bottom;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glScissorIndexedOES {
+    GLuint index;
+    GLint left;
+    GLint bottom;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glScissorIndexedOES(const void* args) {
+    const struct marshal_glScissorIndexedOES* cmd = args;
+    gles_driver.ext.glScissorIndexedOES(cmd->index, cmd->left, cmd->bottom, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glScissorIndexedOES(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glScissorIndexedOES(index, left, bottom, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glScissorIndexedOES* cmd = glthread_alloc(exec_glScissorIndexedOES, sizeof(*cmd));
+    cmd->index = index;
+    cmd->left = left;
+    cmd->bottom = bottom;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glScissorIndexedvNV {
+    GLuint index;
+    const GLint *v;
+};
+
+static void exec_glScissorIndexedvNV(const void* args) {
+    const struct marshal_glScissorIndexedvNV* cmd = args;
+    gles_driver.ext.glScissorIndexedvNV(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glScissorIndexedvNV(GLuint index, const GLint *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glScissorIndexedvNV(index, v);
+        return;
+    }
+    struct marshal_glScissorIndexedvNV* cmd = glthread_alloc(exec_glScissorIndexedvNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glScissorIndexedvOES {
+    GLuint index;
+    const GLint *v;
+};
+
+static void exec_glScissorIndexedvOES(const void* args) {
+    const struct marshal_glScissorIndexedvOES* cmd = args;
+    gles_driver.ext.glScissorIndexedvOES(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glScissorIndexedvOES(GLuint index, const GLint *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glScissorIndexedvOES(index, v);
+        return;
+    }
+    struct marshal_glScissorIndexedvOES* cmd = glthread_alloc(exec_glScissorIndexedvOES, sizeof(*cmd));
+    cmd->index = index;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glSelectPerfMonitorCountersAMD {
+    GLuint monitor;
+    GLboolean enable;
+    GLuint group;
+    GLint numCounters;
+    GLuint *counterList;
+};
+
+static void exec_glSelectPerfMonitorCountersAMD(const void* args) {
+    const struct marshal_glSelectPerfMonitorCountersAMD* cmd = args;
+    gles_driver.ext.glSelectPerfMonitorCountersAMD(cmd->monitor, cmd->enable, cmd->group, cmd->numCounters, cmd->counterList);
+}
+
+static void GL_APIENTRY marshal_glSelectPerfMonitorCountersAMD(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSelectPerfMonitorCountersAMD(monitor, enable, group, numCounters, counterList);
+        return;
+    }
+    struct marshal_glSelectPerfMonitorCountersAMD* cmd = glthread_alloc(exec_glSelectPerfMonitorCountersAMD, sizeof(*cmd));
+    cmd->monitor = monitor;
+    cmd->enable = enable;
+    cmd->group = group;
+    cmd->numCounters = numCounters;
+    cmd->counterList = counterList;
+    glthread_sync();
+}
+
+struct marshal_glSemaphoreParameterui64vEXT {
+    GLuint semaphore;
+    GLenum pname;
+    const GLuint64 *params;
+};
+
+static void exec_glSemaphoreParameterui64vEXT(const void* args) {
+    const struct marshal_glSemaphoreParameterui64vEXT* cmd = args;
+    gles_driver.ext.glSemaphoreParameterui64vEXT(cmd->semaphore, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, const GLuint64 *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSemaphoreParameterui64vEXT(semaphore, pname, params);
+        return;
+    }
+    struct marshal_glSemaphoreParameterui64vEXT* cmd = glthread_alloc(exec_glSemaphoreParameterui64vEXT, sizeof(*cmd));
+    cmd->semaphore = semaphore;
+    cmd->pname = pname;
+    cmd->params = params;
+    glthread_sync();
+}
+
+struct marshal_glSetFenceNV {
+    GLuint fence;
+    GLenum condition;
+};
+
+static void exec_glSetFenceNV(const void* args) {
+    const struct marshal_glSetFenceNV* cmd = args;
+    gles_driver.ext.glSetFenceNV(cmd->fence, cmd->condition);
+}
+
+static void GL_APIENTRY marshal_glSetFenceNV(GLuint fence, GLenum condition) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSetFenceNV(fence, condition);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSetFenceNV* cmd = glthread_alloc(exec_glSetFenceNV, sizeof(*cmd));
+    cmd->fence = fence;
+    cmd->condition = condition;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSignalSemaphoreEXT {
+    GLuint semaphore;
+    GLuint numBufferBarriers;
+    const GLuint *buffers;
+    GLuint numTextureBarriers;
+    const GLuint *textures;
+    const GLenum *dstLayouts;
+};
+
+static void exec_glSignalSemaphoreEXT(const void* args) {
+    const struct marshal_glSignalSemaphoreEXT* cmd = args;
+    gles_driver.ext.glSignalSemaphoreEXT(cmd->semaphore, cmd->numBufferBarriers, cmd->buffers, cmd->numTextureBarriers, cmd->textures, cmd->dstLayouts);
+}
+
+static void GL_APIENTRY marshal_glSignalSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSignalSemaphoreEXT(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts);
+        return;
+    }
+    struct marshal_glSignalSemaphoreEXT* cmd = glthread_alloc(exec_glSignalSemaphoreEXT, sizeof(*cmd));
+    cmd->semaphore = semaphore;
+    cmd->numBufferBarriers = numBufferBarriers;
+    cmd->buffers = buffers;
+    cmd->numTextureBarriers = numTextureBarriers;
+    cmd->textures = textures;
+    cmd->dstLayouts = dstLayouts;
+    glthread_sync();
+}
+
+struct marshal_glSignalVkFenceNV {
+    GLuint64 vkFence;
+};
+
+static void exec_glSignalVkFenceNV(const void* args) {
+    const struct marshal_glSignalVkFenceNV* cmd = args;
+    gles_driver.ext.glSignalVkFenceNV(cmd->vkFence);
+}
+
+static void GL_APIENTRY marshal_glSignalVkFenceNV(GLuint64 vkFence) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSignalVkFenceNV(vkFence);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSignalVkFenceNV* cmd = glthread_alloc(exec_glSignalVkFenceNV, sizeof(*cmd));
+    cmd->vkFence = vkFence;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSignalVkSemaphoreNV {
+    GLuint64 vkSemaphore;
+};
+
+static void exec_glSignalVkSemaphoreNV(const void* args) {
+    const struct marshal_glSignalVkSemaphoreNV* cmd = args;
+    gles_driver.ext.glSignalVkSemaphoreNV(cmd->vkSemaphore);
+}
+
+static void GL_APIENTRY marshal_glSignalVkSemaphoreNV(GLuint64 vkSemaphore) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSignalVkSemaphoreNV(vkSemaphore);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSignalVkSemaphoreNV* cmd = glthread_alloc(exec_glSignalVkSemaphoreNV, sizeof(*cmd));
+    cmd->vkSemaphore = vkSemaphore;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStartTilingQCOM {
+    GLuint x;
+    GLuint y;
+    GLuint width;
+    GLuint height;
+    GLbitfield preserveMask;
+};
+
+static void exec_glStartTilingQCOM(const void* args) {
+    const struct marshal_glStartTilingQCOM* cmd = args;
+    gles_driver.ext.glStartTilingQCOM(cmd->x, cmd->y, cmd->width, cmd->height, cmd->preserveMask);
+}
+
+static void GL_APIENTRY marshal_glStartTilingQCOM(GLuint x, GLuint y, GLuint width, GLuint height, GLbitfield preserveMask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStartTilingQCOM(x, y, width, height, preserveMask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStartTilingQCOM* cmd = glthread_alloc(exec_glStartTilingQCOM, sizeof(*cmd));
+    cmd->x = x;
+    cmd->y = y;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->preserveMask = preserveMask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilFillPathInstancedNV {
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLenum fillMode;
+    GLuint mask;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glStencilFillPathInstancedNV(const void* args) {
+    const struct marshal_glStencilFillPathInstancedNV* cmd = args;
+    gles_driver.ext.glStencilFillPathInstancedNV(cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->fillMode, cmd->mask, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glStencilFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues);
+        return;
+    }
+    struct marshal_glStencilFillPathInstancedNV* cmd = glthread_alloc(exec_glStencilFillPathInstancedNV, sizeof(*cmd));
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->fillMode = fillMode;
+    cmd->mask = mask;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glStencilFillPathNV {
+    GLuint path;
+    GLenum fillMode;
+    GLuint mask;
+};
+
+static void exec_glStencilFillPathNV(const void* args) {
+    const struct marshal_glStencilFillPathNV* cmd = args;
+    gles_driver.ext.glStencilFillPathNV(cmd->path, cmd->fillMode, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glStencilFillPathNV(GLuint path, GLenum fillMode, GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilFillPathNV(path, fillMode, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilFillPathNV* cmd = glthread_alloc(exec_glStencilFillPathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->fillMode = fillMode;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilStrokePathInstancedNV {
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLint reference;
+    GLuint mask;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glStencilStrokePathInstancedNV(const void* args) {
+    const struct marshal_glStencilStrokePathInstancedNV* cmd = args;
+    gles_driver.ext.glStencilStrokePathInstancedNV(cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->reference, cmd->mask, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glStencilStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues);
+        return;
+    }
+    struct marshal_glStencilStrokePathInstancedNV* cmd = glthread_alloc(exec_glStencilStrokePathInstancedNV, sizeof(*cmd));
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->reference = reference;
+    cmd->mask = mask;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glStencilStrokePathNV {
+    GLuint path;
+    GLint reference;
+    GLuint mask;
+};
+
+static void exec_glStencilStrokePathNV(const void* args) {
+    const struct marshal_glStencilStrokePathNV* cmd = args;
+    gles_driver.ext.glStencilStrokePathNV(cmd->path, cmd->reference, cmd->mask);
+}
+
+static void GL_APIENTRY marshal_glStencilStrokePathNV(GLuint path, GLint reference, GLuint mask) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilStrokePathNV(path, reference, mask);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilStrokePathNV* cmd = glthread_alloc(exec_glStencilStrokePathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->reference = reference;
+    cmd->mask = mask;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilThenCoverFillPathInstancedNV {
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLenum fillMode;
+    GLuint mask;
+    GLenum coverMode;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glStencilThenCoverFillPathInstancedNV(const void* args) {
+    const struct marshal_glStencilThenCoverFillPathInstancedNV* cmd = args;
+    gles_driver.ext.glStencilThenCoverFillPathInstancedNV(cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->fillMode, cmd->mask, cmd->coverMode, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glStencilThenCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilThenCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType, transformValues);
+        return;
+    }
+    struct marshal_glStencilThenCoverFillPathInstancedNV* cmd = glthread_alloc(exec_glStencilThenCoverFillPathInstancedNV, sizeof(*cmd));
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->fillMode = fillMode;
+    cmd->mask = mask;
+    cmd->coverMode = coverMode;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glStencilThenCoverFillPathNV {
+    GLuint path;
+    GLenum fillMode;
+    GLuint mask;
+    GLenum coverMode;
+};
+
+static void exec_glStencilThenCoverFillPathNV(const void* args) {
+    const struct marshal_glStencilThenCoverFillPathNV* cmd = args;
+    gles_driver.ext.glStencilThenCoverFillPathNV(cmd->path, cmd->fillMode, cmd->mask, cmd->coverMode);
+}
+
+static void GL_APIENTRY marshal_glStencilThenCoverFillPathNV(GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilThenCoverFillPathNV(path, fillMode, mask, coverMode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilThenCoverFillPathNV* cmd = glthread_alloc(exec_glStencilThenCoverFillPathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->fillMode = fillMode;
+    cmd->mask = mask;
+    cmd->coverMode = coverMode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glStencilThenCoverStrokePathInstancedNV {
+    GLsizei numPaths;
+    GLenum pathNameType;
+    const void *paths;
+    GLuint pathBase;
+    GLint reference;
+    GLuint mask;
+    GLenum coverMode;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glStencilThenCoverStrokePathInstancedNV(const void* args) {
+    const struct marshal_glStencilThenCoverStrokePathInstancedNV* cmd = args;
+    gles_driver.ext.glStencilThenCoverStrokePathInstancedNV(cmd->numPaths, cmd->pathNameType, cmd->paths, cmd->pathBase, cmd->reference, cmd->mask, cmd->coverMode, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glStencilThenCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilThenCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType, transformValues);
+        return;
+    }
+    struct marshal_glStencilThenCoverStrokePathInstancedNV* cmd = glthread_alloc(exec_glStencilThenCoverStrokePathInstancedNV, sizeof(*cmd));
+    cmd->numPaths = numPaths;
+    cmd->pathNameType = pathNameType;
+    cmd->paths = paths;
+    cmd->pathBase = pathBase;
+    cmd->reference = reference;
+    cmd->mask = mask;
+    cmd->coverMode = coverMode;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glStencilThenCoverStrokePathNV {
+    GLuint path;
+    GLint reference;
+    GLuint mask;
+    GLenum coverMode;
+};
+
+static void exec_glStencilThenCoverStrokePathNV(const void* args) {
+    const struct marshal_glStencilThenCoverStrokePathNV* cmd = args;
+    gles_driver.ext.glStencilThenCoverStrokePathNV(cmd->path, cmd->reference, cmd->mask, cmd->coverMode);
+}
+
+static void GL_APIENTRY marshal_glStencilThenCoverStrokePathNV(GLuint path, GLint reference, GLuint mask, GLenum coverMode) {
+    if (!glthread_active()) {
+        gles_driver.ext.glStencilThenCoverStrokePathNV(path, reference, mask, coverMode);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glStencilThenCoverStrokePathNV* cmd = glthread_alloc(exec_glStencilThenCoverStrokePathNV, sizeof(*cmd));
+    cmd->path = path;
+    cmd->reference = reference;
+    cmd->mask = mask;
+    cmd->coverMode = coverMode;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glSubpixelPrecisionBiasNV {
+    GLuint xbits;
+    GLuint ybits;
+};
+
+static void exec_glSubpixelPrecisionBiasNV(const void* args) {
+    const struct marshal_glSubpixelPrecisionBiasNV* cmd = args;
+    gles_driver.ext.glSubpixelPrecisionBiasNV(cmd->xbits, cmd->ybits);
+}
+
+static void GL_APIENTRY marshal_glSubpixelPrecisionBiasNV(GLuint xbits, GLuint ybits) {
+    if (!glthread_active()) {
+        gles_driver.ext.glSubpixelPrecisionBiasNV(xbits, ybits);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glSubpixelPrecisionBiasNV* cmd = glthread_alloc(exec_glSubpixelPrecisionBiasNV, sizeof(*cmd));
+    cmd->xbits = xbits;
+    cmd->ybits = ybits;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTestFenceNV {
+    GLuint fence;
+    GLboolean *result;
+};
+
+static void exec_glTestFenceNV(const void* args) {
+    const struct marshal_glTestFenceNV* cmd = args;
+    *cmd->result = gles_driver.ext.glTestFenceNV(cmd->fence);
+}
+
+static GLboolean GL_APIENTRY marshal_glTestFenceNV(GLuint fence) {
+    if (!glthread_active()) return gles_driver.ext.glTestFenceNV(fence);
+    struct marshal_glTestFenceNV* cmd = glthread_alloc(exec_glTestFenceNV, sizeof(*cmd));
+    cmd->fence = fence;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glTexBufferEXT {
+    GLenum target;
+    GLenum internalformat;
+    GLuint buffer;
+};
+
+static void exec_glTexBufferEXT(const void* args) {
+    const struct marshal_glTexBufferEXT* cmd = args;
+    gles_driver.ext.glTexBufferEXT(cmd->target, cmd->internalformat, cmd->buffer);
+}
+
+static void GL_APIENTRY marshal_glTexBufferEXT(GLenum target, GLenum internalformat, GLuint buffer) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexBufferEXT(target, internalformat, buffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexBufferEXT* cmd = glthread_alloc(exec_glTexBufferEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->buffer = buffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexBufferOES {
+    GLenum target;
+    GLenum internalformat;
+    GLuint buffer;
+};
+
+static void exec_glTexBufferOES(const void* args) {
+    const struct marshal_glTexBufferOES* cmd = args;
+    gles_driver.ext.glTexBufferOES(cmd->target, cmd->internalformat, cmd->buffer);
+}
+
+static void GL_APIENTRY marshal_glTexBufferOES(GLenum target, GLenum internalformat, GLuint buffer) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexBufferOES(target, internalformat, buffer);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexBufferOES* cmd = glthread_alloc(exec_glTexBufferOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->buffer = buffer;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexBufferRangeEXT {
+    GLenum target;
+    GLenum internalformat;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+static void exec_glTexBufferRangeEXT(const void* args) {
+    const struct marshal_glTexBufferRangeEXT* cmd = args;
+    gles_driver.ext.glTexBufferRangeEXT(cmd->target, cmd->internalformat, cmd->buffer, cmd->offset, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glTexBufferRangeEXT(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexBufferRangeEXT(target, internalformat, buffer, offset, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexBufferRangeEXT* cmd = glthread_alloc(exec_glTexBufferRangeEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexBufferRangeOES {
+    GLenum target;
+    GLenum internalformat;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+static void exec_glTexBufferRangeOES(const void* args) {
+    const struct marshal_glTexBufferRangeOES* cmd = args;
+    gles_driver.ext.glTexBufferRangeOES(cmd->target, cmd->internalformat, cmd->buffer, cmd->offset, cmd->size);
+}
+
+static void GL_APIENTRY marshal_glTexBufferRangeOES(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexBufferRangeOES(target, internalformat, buffer, offset, size);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexBufferRangeOES* cmd = glthread_alloc(exec_glTexBufferRangeOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->internalformat = internalformat;
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size = size;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexImage3DOES {
+    GLenum target;
+    GLint level;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLint border;
+    GLenum format;
+    GLenum type;
+    const void *pixels;
+};
+
+static void exec_glTexImage3DOES(const void* args) {
+    const struct marshal_glTexImage3DOES* cmd = args;
+    gles_driver.ext.glTexImage3DOES(cmd->target, cmd->level, cmd->internalformat, cmd->width, cmd->height, cmd->depth, cmd->border, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glTexImage3DOES(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glTexImage3DOES* cmd = glthread_alloc(exec_glTexImage3DOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->border = border;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexPageCommitmentEXT {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLboolean commit;
+};
+
+static void exec_glTexPageCommitmentEXT(const void* args) {
+    const struct marshal_glTexPageCommitmentEXT* cmd = args;
+    gles_driver.ext.glTexPageCommitmentEXT(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->commit);
+}
+
+static void GL_APIENTRY marshal_glTexPageCommitmentEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexPageCommitmentEXT(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexPageCommitmentEXT* cmd = glthread_alloc(exec_glTexPageCommitmentEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->commit = commit;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterIivEXT {
+    GLenum target;
+    GLenum pname;
+    const GLint *params;
+};
+
+static void exec_glTexParameterIivEXT(const void* args) {
+    const struct marshal_glTexParameterIivEXT* cmd = args;
+    gles_driver.ext.glTexParameterIivEXT(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterIivEXT(GLenum target, GLenum pname, const GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexParameterIivEXT(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterIivEXT* cmd = glthread_alloc(exec_glTexParameterIivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterIivOES {
+    GLenum target;
+    GLenum pname;
+    const GLint *params;
+};
+
+static void exec_glTexParameterIivOES(const void* args) {
+    const struct marshal_glTexParameterIivOES* cmd = args;
+    gles_driver.ext.glTexParameterIivOES(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterIivOES(GLenum target, GLenum pname, const GLint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexParameterIivOES(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterIivOES* cmd = glthread_alloc(exec_glTexParameterIivOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterIuivEXT {
+    GLenum target;
+    GLenum pname;
+    const GLuint *params;
+};
+
+static void exec_glTexParameterIuivEXT(const void* args) {
+    const struct marshal_glTexParameterIuivEXT* cmd = args;
+    gles_driver.ext.glTexParameterIuivEXT(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterIuivEXT(GLenum target, GLenum pname, const GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexParameterIuivEXT(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterIuivEXT* cmd = glthread_alloc(exec_glTexParameterIuivEXT, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexParameterIuivOES {
+    GLenum target;
+    GLenum pname;
+    const GLuint *params;
+};
+
+static void exec_glTexParameterIuivOES(const void* args) {
+    const struct marshal_glTexParameterIuivOES* cmd = args;
+    gles_driver.ext.glTexParameterIuivOES(cmd->target, cmd->pname, cmd->params);
+}
+
+static void GL_APIENTRY marshal_glTexParameterIuivOES(GLenum target, GLenum pname, const GLuint *params) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexParameterIuivOES(target, pname, params);
+        return;
+    }
+    int glt_sync = 0;
+    size_t params_size = params ? (size_t)((pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*params)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(params_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glTexParameterIuivOES* cmd = glthread_alloc(exec_glTexParameterIuivOES, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->target = target;
+    cmd->pname = pname;
+    cmd->params = glt_sync ? params : glthread_copy(&glt_tail, params, params_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage1DEXT {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+};
+
+static void exec_glTexStorage1DEXT(const void* args) {
+    const struct marshal_glTexStorage1DEXT* cmd = args;
+    gles_driver.ext.glTexStorage1DEXT(cmd->target, cmd->levels, cmd->internalformat, cmd->width);
+}
+
+static void GL_APIENTRY marshal_glTexStorage1DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorage1DEXT(target, levels, internalformat, width);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage1DEXT* cmd = glthread_alloc(exec_glTexStorage1DEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage2DEXT {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glTexStorage2DEXT(const void* args) {
+    const struct marshal_glTexStorage2DEXT* cmd = args;
+    gles_driver.ext.glTexStorage2DEXT(cmd->target, cmd->levels, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glTexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorage2DEXT(target, levels, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage2DEXT* cmd = glthread_alloc(exec_glTexStorage2DEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage3DEXT {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+};
+
+static void exec_glTexStorage3DEXT(const void* args) {
+    const struct marshal_glTexStorage3DEXT* cmd = args;
+    gles_driver.ext.glTexStorage3DEXT(cmd->target, cmd->levels, cmd->internalformat, cmd->width, cmd->height, cmd->depth);
+}
+
+static void GL_APIENTRY marshal_glTexStorage3DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorage3DEXT(target, levels, internalformat, width, height, depth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage3DEXT* cmd = glthread_alloc(exec_glTexStorage3DEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorage3DMultisampleOES {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLboolean fixedsamplelocations;
+};
+
+static void exec_glTexStorage3DMultisampleOES(const void* args) {
+    const struct marshal_glTexStorage3DMultisampleOES* cmd = args;
+    gles_driver.ext.glTexStorage3DMultisampleOES(cmd->target, cmd->samples, cmd->internalformat, cmd->width, cmd->height, cmd->depth, cmd->fixedsamplelocations);
+}
+
+static void GL_APIENTRY marshal_glTexStorage3DMultisampleOES(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorage3DMultisampleOES(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorage3DMultisampleOES* cmd = glthread_alloc(exec_glTexStorage3DMultisampleOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->fixedsamplelocations = fixedsamplelocations;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorageMem2DEXT {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTexStorageMem2DEXT(const void* args) {
+    const struct marshal_glTexStorageMem2DEXT* cmd = args;
+    gles_driver.ext.glTexStorageMem2DEXT(cmd->target, cmd->levels, cmd->internalFormat, cmd->width, cmd->height, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTexStorageMem2DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorageMem2DEXT(target, levels, internalFormat, width, height, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorageMem2DEXT* cmd = glthread_alloc(exec_glTexStorageMem2DEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorageMem2DMultisampleEXT {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLboolean fixedSampleLocations;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTexStorageMem2DMultisampleEXT(const void* args) {
+    const struct marshal_glTexStorageMem2DMultisampleEXT* cmd = args;
+    gles_driver.ext.glTexStorageMem2DMultisampleEXT(cmd->target, cmd->samples, cmd->internalFormat, cmd->width, cmd->height, cmd->fixedSampleLocations, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTexStorageMem2DMultisampleEXT(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorageMem2DMultisampleEXT(target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorageMem2DMultisampleEXT* cmd = glthread_alloc(exec_glTexStorageMem2DMultisampleEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->fixedSampleLocations = fixedSampleLocations;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorageMem3DEXT {
+    GLenum target;
+    GLsizei levels;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTexStorageMem3DEXT(const void* args) {
+    const struct marshal_glTexStorageMem3DEXT* cmd = args;
+    gles_driver.ext.glTexStorageMem3DEXT(cmd->target, cmd->levels, cmd->internalFormat, cmd->width, cmd->height, cmd->depth, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTexStorageMem3DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorageMem3DEXT(target, levels, internalFormat, width, height, depth, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorageMem3DEXT* cmd = glthread_alloc(exec_glTexStorageMem3DEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexStorageMem3DMultisampleEXT {
+    GLenum target;
+    GLsizei samples;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLboolean fixedSampleLocations;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTexStorageMem3DMultisampleEXT(const void* args) {
+    const struct marshal_glTexStorageMem3DMultisampleEXT* cmd = args;
+    gles_driver.ext.glTexStorageMem3DMultisampleEXT(cmd->target, cmd->samples, cmd->internalFormat, cmd->width, cmd->height, cmd->depth, cmd->fixedSampleLocations, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTexStorageMem3DMultisampleEXT(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexStorageMem3DMultisampleEXT(target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTexStorageMem3DMultisampleEXT* cmd = glthread_alloc(exec_glTexStorageMem3DMultisampleEXT, sizeof(*cmd));
+    cmd->target = target;
+    cmd->samples = samples;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->fixedSampleLocations = fixedSampleLocations;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTexSubImage3DOES {
+    GLenum target;
+    GLint level;
+    GLint xoffset;
+    GLint yoffset;
+    GLint zoffset;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLenum format;
+    GLenum type;
+    const void *pixels;
+};
+
+static void exec_glTexSubImage3DOES(const void* args) {
+    const struct marshal_glTexSubImage3DOES* cmd = args;
+    gles_driver.ext.glTexSubImage3DOES(cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->width, cmd->height, cmd->depth, cmd->format, cmd->type, cmd->pixels);
+}
+
+static void GL_APIENTRY marshal_glTexSubImage3DOES(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+        return;
+    }
+    int glt_sync = 0;
+    int pixels_bound = glthread_pixel_buffer_bound(GL_PIXEL_UNPACK_BUFFER);
+    glt_sync |= pixels_bound <= 0;
+    struct marshal_glTexSubImage3DOES* cmd = glthread_alloc(exec_glTexSubImage3DOES, sizeof(*cmd));
+    cmd->target = target;
+    cmd->level = level;
+    cmd->xoffset = xoffset;
+    cmd->yoffset = yoffset;
+    cmd->zoffset = zoffset;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->format = format;
+    cmd->type = type;
+    cmd->pixels = pixels;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureFoveationParametersQCOM {
+    GLuint texture;
+    GLuint layer;
+    GLuint focalPoint;
+    GLfloat focalX;
+    GLfloat focalY;
+    GLfloat gainX;
+    GLfloat gainY;
+    GLfloat foveaArea;
+};
+
+static void exec_glTextureFoveationParametersQCOM(const void* args) {
+    const struct marshal_glTextureFoveationParametersQCOM* cmd = args;
+    gles_driver.ext.glTextureFoveationParametersQCOM(cmd->texture, cmd->layer, cmd->focalPoint, cmd->focalX, cmd->focalY, cmd->gainX, cmd->gainY, cmd->foveaArea);
+}
+
+static void GL_APIENTRY marshal_glTextureFoveationParametersQCOM(GLuint texture, GLuint layer, GLuint focalPoint, GLfloat focalX, GLfloat focalY, GLfloat gainX, GLfloat gainY, GLfloat foveaArea) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureFoveationParametersQCOM(texture, layer, focalPoint, focalX, focalY, gainX, gainY, foveaArea);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureFoveationParametersQCOM* cmd = glthread_alloc(exec_glTextureFoveationParametersQCOM, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->layer = layer;
+    cmd->focalPoint = focalPoint;
+    cmd->focalX = focalX;
+    cmd->focalY = focalY;
+    cmd->gainX = gainX;
+    cmd->gainY = gainY;
+    cmd->foveaArea = foveaArea;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorage1DEXT {
+    GLuint texture;
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+};
+
+static void exec_glTextureStorage1DEXT(const void* args) {
+    const struct marshal_glTextureStorage1DEXT* cmd = args;
+    gles_driver.ext.glTextureStorage1DEXT(cmd->texture, cmd->target, cmd->levels, cmd->internalformat, cmd->width);
+}
+
+static void GL_APIENTRY marshal_glTextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorage1DEXT(texture, target, levels, internalformat, width);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorage1DEXT* cmd = glthread_alloc(exec_glTextureStorage1DEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorage2DEXT {
+    GLuint texture;
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+};
+
+static void exec_glTextureStorage2DEXT(const void* args) {
+    const struct marshal_glTextureStorage2DEXT* cmd = args;
+    gles_driver.ext.glTextureStorage2DEXT(cmd->texture, cmd->target, cmd->levels, cmd->internalformat, cmd->width, cmd->height);
+}
+
+static void GL_APIENTRY marshal_glTextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorage2DEXT(texture, target, levels, internalformat, width, height);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorage2DEXT* cmd = glthread_alloc(exec_glTextureStorage2DEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorage3DEXT {
+    GLuint texture;
+    GLenum target;
+    GLsizei levels;
+    GLenum internalformat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+};
+
+static void exec_glTextureStorage3DEXT(const void* args) {
+    const struct marshal_glTextureStorage3DEXT* cmd = args;
+    gles_driver.ext.glTextureStorage3DEXT(cmd->texture, cmd->target, cmd->levels, cmd->internalformat, cmd->width, cmd->height, cmd->depth);
+}
+
+static void GL_APIENTRY marshal_glTextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorage3DEXT* cmd = glthread_alloc(exec_glTextureStorage3DEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->target = target;
+    cmd->levels = levels;
+    cmd->internalformat = internalformat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorageMem2DEXT {
+    GLuint texture;
+    GLsizei levels;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTextureStorageMem2DEXT(const void* args) {
+    const struct marshal_glTextureStorageMem2DEXT* cmd = args;
+    gles_driver.ext.glTextureStorageMem2DEXT(cmd->texture, cmd->levels, cmd->internalFormat, cmd->width, cmd->height, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTextureStorageMem2DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorageMem2DEXT(texture, levels, internalFormat, width, height, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorageMem2DEXT* cmd = glthread_alloc(exec_glTextureStorageMem2DEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->levels = levels;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorageMem2DMultisampleEXT {
+    GLuint texture;
+    GLsizei samples;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLboolean fixedSampleLocations;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTextureStorageMem2DMultisampleEXT(const void* args) {
+    const struct marshal_glTextureStorageMem2DMultisampleEXT* cmd = args;
+    gles_driver.ext.glTextureStorageMem2DMultisampleEXT(cmd->texture, cmd->samples, cmd->internalFormat, cmd->width, cmd->height, cmd->fixedSampleLocations, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTextureStorageMem2DMultisampleEXT(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorageMem2DMultisampleEXT(texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorageMem2DMultisampleEXT* cmd = glthread_alloc(exec_glTextureStorageMem2DMultisampleEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->samples = samples;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->fixedSampleLocations = fixedSampleLocations;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorageMem3DEXT {
+    GLuint texture;
+    GLsizei levels;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTextureStorageMem3DEXT(const void* args) {
+    const struct marshal_glTextureStorageMem3DEXT* cmd = args;
+    gles_driver.ext.glTextureStorageMem3DEXT(cmd->texture, cmd->levels, cmd->internalFormat, cmd->width, cmd->height, cmd->depth, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTextureStorageMem3DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorageMem3DEXT(texture, levels, internalFormat, width, height, depth, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorageMem3DEXT* cmd = glthread_alloc(exec_glTextureStorageMem3DEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->levels = levels;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureStorageMem3DMultisampleEXT {
+    GLuint texture;
+    GLsizei samples;
+    GLenum internalFormat;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLboolean fixedSampleLocations;
+    GLuint memory;
+    GLuint64 offset;
+};
+
+static void exec_glTextureStorageMem3DMultisampleEXT(const void* args) {
+    const struct marshal_glTextureStorageMem3DMultisampleEXT* cmd = args;
+    gles_driver.ext.glTextureStorageMem3DMultisampleEXT(cmd->texture, cmd->samples, cmd->internalFormat, cmd->width, cmd->height, cmd->depth, cmd->fixedSampleLocations, cmd->memory, cmd->offset);
+}
+
+static void GL_APIENTRY marshal_glTextureStorageMem3DMultisampleEXT(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureStorageMem3DMultisampleEXT(texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureStorageMem3DMultisampleEXT* cmd = glthread_alloc(exec_glTextureStorageMem3DMultisampleEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->samples = samples;
+    cmd->internalFormat = internalFormat;
+    cmd->width = width;
+    cmd->height = height;
+    cmd->depth = depth;
+    cmd->fixedSampleLocations = fixedSampleLocations;
+    cmd->memory = memory;
+    cmd->offset = offset;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureViewEXT {
+    GLuint texture;
+    GLenum target;
+    GLuint origtexture;
+    GLenum internalformat;
+    GLuint minlevel;
+    GLuint numlevels;
+    GLuint minlayer;
+    GLuint numlayers;
+};
+
+static void exec_glTextureViewEXT(const void* args) {
+    const struct marshal_glTextureViewEXT* cmd = args;
+    gles_driver.ext.glTextureViewEXT(cmd->texture, cmd->target, cmd->origtexture, cmd->internalformat, cmd->minlevel, cmd->numlevels, cmd->minlayer, cmd->numlayers);
+}
+
+static void GL_APIENTRY marshal_glTextureViewEXT(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureViewEXT(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureViewEXT* cmd = glthread_alloc(exec_glTextureViewEXT, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->target = target;
+    cmd->origtexture = origtexture;
+    cmd->internalformat = internalformat;
+    cmd->minlevel = minlevel;
+    cmd->numlevels = numlevels;
+    cmd->minlayer = minlayer;
+    cmd->numlayers = numlayers;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTextureViewOES {
+    GLuint texture;
+    GLenum target;
+    GLuint origtexture;
+    GLenum internalformat;
+    GLuint minlevel;
+    GLuint numlevels;
+    GLuint minlayer;
+    GLuint numlayers;
+};
+
+static void exec_glTextureViewOES(const void* args) {
+    const struct marshal_glTextureViewOES* cmd = args;
+    gles_driver.ext.glTextureViewOES(cmd->texture, cmd->target, cmd->origtexture, cmd->internalformat, cmd->minlevel, cmd->numlevels, cmd->minlayer, cmd->numlayers);
+}
+
+static void GL_APIENTRY marshal_glTextureViewOES(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTextureViewOES(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glTextureViewOES* cmd = glthread_alloc(exec_glTextureViewOES, sizeof(*cmd));
+    cmd->texture = texture;
+    cmd->target = target;
+    cmd->origtexture = origtexture;
+    cmd->internalformat = internalformat;
+    cmd->minlevel = minlevel;
+    cmd->numlevels = numlevels;
+    cmd->minlayer = minlayer;
+    cmd->numlayers = numlayers;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glTransformPathNV {
+    GLuint resultPath;
+    GLuint srcPath;
+    GLenum transformType;
+    const GLfloat *transformValues;
+};
+
+static void exec_glTransformPathNV(const void* args) {
+    const struct marshal_glTransformPathNV* cmd = args;
+    gles_driver.ext.glTransformPathNV(cmd->resultPath, cmd->srcPath, cmd->transformType, cmd->transformValues);
+}
+
+static void GL_APIENTRY marshal_glTransformPathNV(GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues) {
+    if (!glthread_active()) {
+        gles_driver.ext.glTransformPathNV(resultPath, srcPath, transformType, transformValues);
+        return;
+    }
+    struct marshal_glTransformPathNV* cmd = glthread_alloc(exec_glTransformPathNV, sizeof(*cmd));
+    cmd->resultPath = resultPath;
+    cmd->srcPath = srcPath;
+    cmd->transformType = transformType;
+    cmd->transformValues = transformValues;
+    glthread_sync();
+}
+
+struct marshal_glUniform1i64NV {
+    GLint location;
+    GLint64EXT x;
+};
+
+static void exec_glUniform1i64NV(const void* args) {
+    const struct marshal_glUniform1i64NV* cmd = args;
+    gles_driver.ext.glUniform1i64NV(cmd->location, cmd->x);
+}
+
+static void GL_APIENTRY marshal_glUniform1i64NV(GLint location, GLint64EXT x) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform1i64NV(location, x);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform1i64NV* cmd = glthread_alloc(exec_glUniform1i64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1i64vNV {
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glUniform1i64vNV(const void* args) {
+    const struct marshal_glUniform1i64vNV* cmd = args;
+    gles_driver.ext.glUniform1i64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform1i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform1i64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform1i64vNV* cmd = glthread_alloc(exec_glUniform1i64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform1ui64NV {
+    GLint location;
+    GLuint64EXT x;
+};
+
+static void exec_glUniform1ui64NV(const void* args) {
+    const struct marshal_glUniform1ui64NV* cmd = args;
+    gles_driver.ext.glUniform1ui64NV(cmd->location, cmd->x);
+}
+
+static void GL_APIENTRY marshal_glUniform1ui64NV(GLint location, GLuint64EXT x) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform1ui64NV(location, x);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform1ui64NV* cmd = glthread_alloc(exec_glUniform1ui64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform1ui64vNV {
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glUniform1ui64vNV(const void* args) {
+    const struct marshal_glUniform1ui64vNV* cmd = args;
+    gles_driver.ext.glUniform1ui64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform1ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform1ui64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform1ui64vNV* cmd = glthread_alloc(exec_glUniform1ui64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform2i64NV {
+    GLint location;
+    GLint64EXT x;
+    GLint64EXT y;
+};
+
+static void exec_glUniform2i64NV(const void* args) {
+    const struct marshal_glUniform2i64NV* cmd = args;
+    gles_driver.ext.glUniform2i64NV(cmd->location, cmd->x, cmd->y);
+}
+
+static void GL_APIENTRY marshal_glUniform2i64NV(GLint location, GLint64EXT x, GLint64EXT y) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform2i64NV(location, x, y);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform2i64NV* cmd = glthread_alloc(exec_glUniform2i64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2i64vNV {
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glUniform2i64vNV(const void* args) {
+    const struct marshal_glUniform2i64vNV* cmd = args;
+    gles_driver.ext.glUniform2i64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform2i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform2i64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform2i64vNV* cmd = glthread_alloc(exec_glUniform2i64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform2ui64NV {
+    GLint location;
+    GLuint64EXT x;
+    GLuint64EXT y;
+};
+
+static void exec_glUniform2ui64NV(const void* args) {
+    const struct marshal_glUniform2ui64NV* cmd = args;
+    gles_driver.ext.glUniform2ui64NV(cmd->location, cmd->x, cmd->y);
+}
+
+static void GL_APIENTRY marshal_glUniform2ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform2ui64NV(location, x, y);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform2ui64NV* cmd = glthread_alloc(exec_glUniform2ui64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform2ui64vNV {
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glUniform2ui64vNV(const void* args) {
+    const struct marshal_glUniform2ui64vNV* cmd = args;
+    gles_driver.ext.glUniform2ui64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform2ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform2ui64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform2ui64vNV* cmd = glthread_alloc(exec_glUniform2ui64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform3i64NV {
+    GLint location;
+    GLint64EXT x;
+    GLint64EXT y;
+    GLint64EXT z;
+};
+
+static void exec_glUniform3i64NV(const void* args) {
+    const struct marshal_glUniform3i64NV* cmd = args;
+    gles_driver.ext.glUniform3i64NV(cmd->location, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glUniform3i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform3i64NV(location, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform3i64NV* cmd = glthread_alloc(exec_glUniform3i64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3i64vNV {
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glUniform3i64vNV(const void* args) {
+    const struct marshal_glUniform3i64vNV* cmd = args;
+    gles_driver.ext.glUniform3i64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform3i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform3i64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform3i64vNV* cmd = glthread_alloc(exec_glUniform3i64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform3ui64NV {
+    GLint location;
+    GLuint64EXT x;
+    GLuint64EXT y;
+    GLuint64EXT z;
+};
+
+static void exec_glUniform3ui64NV(const void* args) {
+    const struct marshal_glUniform3ui64NV* cmd = args;
+    gles_driver.ext.glUniform3ui64NV(cmd->location, cmd->x, cmd->y, cmd->z);
+}
+
+static void GL_APIENTRY marshal_glUniform3ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform3ui64NV(location, x, y, z);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform3ui64NV* cmd = glthread_alloc(exec_glUniform3ui64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform3ui64vNV {
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glUniform3ui64vNV(const void* args) {
+    const struct marshal_glUniform3ui64vNV* cmd = args;
+    gles_driver.ext.glUniform3ui64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform3ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform3ui64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform3ui64vNV* cmd = glthread_alloc(exec_glUniform3ui64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform4i64NV {
+    GLint location;
+    GLint64EXT x;
+    GLint64EXT y;
+    GLint64EXT z;
+    GLint64EXT w;
+};
+
+static void exec_glUniform4i64NV(const void* args) {
+    const struct marshal_glUniform4i64NV* cmd = args;
+    gles_driver.ext.glUniform4i64NV(cmd->location, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glUniform4i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform4i64NV(location, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform4i64NV* cmd = glthread_alloc(exec_glUniform4i64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4i64vNV {
+    GLint location;
+    GLsizei count;
+    const GLint64EXT *value;
+};
+
+static void exec_glUniform4i64vNV(const void* args) {
+    const struct marshal_glUniform4i64vNV* cmd = args;
+    gles_driver.ext.glUniform4i64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform4i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform4i64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform4i64vNV* cmd = glthread_alloc(exec_glUniform4i64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniform4ui64NV {
+    GLint location;
+    GLuint64EXT x;
+    GLuint64EXT y;
+    GLuint64EXT z;
+    GLuint64EXT w;
+};
+
+static void exec_glUniform4ui64NV(const void* args) {
+    const struct marshal_glUniform4ui64NV* cmd = args;
+    gles_driver.ext.glUniform4ui64NV(cmd->location, cmd->x, cmd->y, cmd->z, cmd->w);
+}
+
+static void GL_APIENTRY marshal_glUniform4ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform4ui64NV(location, x, y, z, w);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniform4ui64NV* cmd = glthread_alloc(exec_glUniform4ui64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->z = z;
+    cmd->w = w;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniform4ui64vNV {
+    GLint location;
+    GLsizei count;
+    const GLuint64EXT *value;
+};
+
+static void exec_glUniform4ui64vNV(const void* args) {
+    const struct marshal_glUniform4ui64vNV* cmd = args;
+    gles_driver.ext.glUniform4ui64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniform4ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniform4ui64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniform4ui64vNV* cmd = glthread_alloc(exec_glUniform4ui64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniformHandleui64IMG {
+    GLint location;
+    GLuint64 value;
+};
+
+static void exec_glUniformHandleui64IMG(const void* args) {
+    const struct marshal_glUniformHandleui64IMG* cmd = args;
+    gles_driver.ext.glUniformHandleui64IMG(cmd->location, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformHandleui64IMG(GLint location, GLuint64 value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformHandleui64IMG(location, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniformHandleui64IMG* cmd = glthread_alloc(exec_glUniformHandleui64IMG, sizeof(*cmd));
+    cmd->location = location;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformHandleui64NV {
+    GLint location;
+    GLuint64 value;
+};
+
+static void exec_glUniformHandleui64NV(const void* args) {
+    const struct marshal_glUniformHandleui64NV* cmd = args;
+    gles_driver.ext.glUniformHandleui64NV(cmd->location, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformHandleui64NV(GLint location, GLuint64 value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformHandleui64NV(location, value);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUniformHandleui64NV* cmd = glthread_alloc(exec_glUniformHandleui64NV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->value = value;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformHandleui64vIMG {
+    GLint location;
+    GLsizei count;
+    const GLuint64 *value;
+};
+
+static void exec_glUniformHandleui64vIMG(const void* args) {
+    const struct marshal_glUniformHandleui64vIMG* cmd = args;
+    gles_driver.ext.glUniformHandleui64vIMG(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformHandleui64vIMG(GLint location, GLsizei count, const GLuint64 *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformHandleui64vIMG(location, count, value);
+        return;
+    }
+    struct marshal_glUniformHandleui64vIMG* cmd = glthread_alloc(exec_glUniformHandleui64vIMG, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniformHandleui64vNV {
+    GLint location;
+    GLsizei count;
+    const GLuint64 *value;
+};
+
+static void exec_glUniformHandleui64vNV(const void* args) {
+    const struct marshal_glUniformHandleui64vNV* cmd = args;
+    gles_driver.ext.glUniformHandleui64vNV(cmd->location, cmd->count, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformHandleui64vNV(GLint location, GLsizei count, const GLuint64 *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformHandleui64vNV(location, count, value);
+        return;
+    }
+    struct marshal_glUniformHandleui64vNV* cmd = glthread_alloc(exec_glUniformHandleui64vNV, sizeof(*cmd));
+    cmd->location = location;
+    cmd->count = count;
+    cmd->value = value;
+    glthread_sync();
+}
+
+struct marshal_glUniformMatrix2x3fvNV {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix2x3fvNV(const void* args) {
+    const struct marshal_glUniformMatrix2x3fvNV* cmd = args;
+    gles_driver.ext.glUniformMatrix2x3fvNV(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix2x3fvNV(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformMatrix2x3fvNV(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix2x3fvNV* cmd = glthread_alloc(exec_glUniformMatrix2x3fvNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix2x4fvNV {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix2x4fvNV(const void* args) {
+    const struct marshal_glUniformMatrix2x4fvNV* cmd = args;
+    gles_driver.ext.glUniformMatrix2x4fvNV(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix2x4fvNV(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformMatrix2x4fvNV(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix2x4fvNV* cmd = glthread_alloc(exec_glUniformMatrix2x4fvNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix3x2fvNV {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix3x2fvNV(const void* args) {
+    const struct marshal_glUniformMatrix3x2fvNV* cmd = args;
+    gles_driver.ext.glUniformMatrix3x2fvNV(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix3x2fvNV(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformMatrix3x2fvNV(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 6 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix3x2fvNV* cmd = glthread_alloc(exec_glUniformMatrix3x2fvNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix3x4fvNV {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix3x4fvNV(const void* args) {
+    const struct marshal_glUniformMatrix3x4fvNV* cmd = args;
+    gles_driver.ext.glUniformMatrix3x4fvNV(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix3x4fvNV(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformMatrix3x4fvNV(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix3x4fvNV* cmd = glthread_alloc(exec_glUniformMatrix3x4fvNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix4x2fvNV {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix4x2fvNV(const void* args) {
+    const struct marshal_glUniformMatrix4x2fvNV* cmd = args;
+    gles_driver.ext.glUniformMatrix4x2fvNV(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix4x2fvNV(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformMatrix4x2fvNV(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 8 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix4x2fvNV* cmd = glthread_alloc(exec_glUniformMatrix4x2fvNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUniformMatrix4x3fvNV {
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+static void exec_glUniformMatrix4x3fvNV(const void* args) {
+    const struct marshal_glUniformMatrix4x3fvNV* cmd = args;
+    gles_driver.ext.glUniformMatrix4x3fvNV(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+static void GL_APIENTRY marshal_glUniformMatrix4x3fvNV(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUniformMatrix4x3fvNV(location, count, transpose, value);
+        return;
+    }
+    int glt_sync = 0;
+    size_t value_size = value ? (size_t)(count * 12 * sizeof(*value)) : 0;
+    size_t glt_copy_size = GLTHREAD_ALIGN(value_size);
+    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;
+    struct marshal_glUniformMatrix4x3fvNV* cmd = glthread_alloc(exec_glUniformMatrix4x3fvNV, sizeof(*cmd) + (glt_sync ? 0 : glt_copy_size));
+    char* glt_tail = (char*)(cmd + 1);
+    cmd->location = location;
+    cmd->count = count;
+    cmd->transpose = transpose;
+    cmd->value = glt_sync ? value : glthread_copy(&glt_tail, value, value_size);
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glUnmapBufferOES {
+    GLenum target;
+    GLboolean *result;
+};
+
+static void exec_glUnmapBufferOES(const void* args) {
+    const struct marshal_glUnmapBufferOES* cmd = args;
+    *cmd->result = gles_driver.ext.glUnmapBufferOES(cmd->target);
+}
+
+static GLboolean GL_APIENTRY marshal_glUnmapBufferOES(GLenum target) {
+    if (!glthread_active()) return gles_driver.ext.glUnmapBufferOES(target);
+    struct marshal_glUnmapBufferOES* cmd = glthread_alloc(exec_glUnmapBufferOES, sizeof(*cmd));
+    cmd->target = target;
+    GLboolean glt_result;
+    cmd->result = &glt_result;
+    glthread_sync();
+    return glt_result;
+}
+
+struct marshal_glUseProgramStagesEXT {
+    GLuint pipeline;
+    GLbitfield stages;
+    GLuint program;
+};
+
+static void exec_glUseProgramStagesEXT(const void* args) {
+    const struct marshal_glUseProgramStagesEXT* cmd = args;
+    gles_driver.ext.glUseProgramStagesEXT(cmd->pipeline, cmd->stages, cmd->program);
+}
+
+static void GL_APIENTRY marshal_glUseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLuint program) {
+    if (!glthread_active()) {
+        gles_driver.ext.glUseProgramStagesEXT(pipeline, stages, program);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glUseProgramStagesEXT* cmd = glthread_alloc(exec_glUseProgramStagesEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    cmd->stages = stages;
+    cmd->program = program;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glValidateProgramPipelineEXT {
+    GLuint pipeline;
+};
+
+static void exec_glValidateProgramPipelineEXT(const void* args) {
+    const struct marshal_glValidateProgramPipelineEXT* cmd = args;
+    gles_driver.ext.glValidateProgramPipelineEXT(cmd->pipeline);
+}
+
+static void GL_APIENTRY marshal_glValidateProgramPipelineEXT(GLuint pipeline) {
+    if (!glthread_active()) {
+        gles_driver.ext.glValidateProgramPipelineEXT(pipeline);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glValidateProgramPipelineEXT* cmd = glthread_alloc(exec_glValidateProgramPipelineEXT, sizeof(*cmd));
+    cmd->pipeline = pipeline;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribDivisorANGLE {
+    GLuint index;
+    GLuint divisor;
+};
+
+static void exec_glVertexAttribDivisorANGLE(const void* args) {
+    const struct marshal_glVertexAttribDivisorANGLE* cmd = args;
+    gles_driver.ext.glVertexAttribDivisorANGLE(cmd->index, cmd->divisor);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribDivisorANGLE(GLuint index, GLuint divisor) {
+    if (!glthread_active()) {
+        gles_driver.ext.glVertexAttribDivisorANGLE(index, divisor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribDivisorANGLE* cmd = glthread_alloc(exec_glVertexAttribDivisorANGLE, sizeof(*cmd));
+    cmd->index = index;
+    cmd->divisor = divisor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribDivisorEXT {
+    GLuint index;
+    GLuint divisor;
+};
+
+static void exec_glVertexAttribDivisorEXT(const void* args) {
+    const struct marshal_glVertexAttribDivisorEXT* cmd = args;
+    gles_driver.ext.glVertexAttribDivisorEXT(cmd->index, cmd->divisor);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribDivisorEXT(GLuint index, GLuint divisor) {
+    if (!glthread_active()) {
+        gles_driver.ext.glVertexAttribDivisorEXT(index, divisor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribDivisorEXT* cmd = glthread_alloc(exec_glVertexAttribDivisorEXT, sizeof(*cmd));
+    cmd->index = index;
+    cmd->divisor = divisor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glVertexAttribDivisorNV {
+    GLuint index;
+    GLuint divisor;
+};
+
+static void exec_glVertexAttribDivisorNV(const void* args) {
+    const struct marshal_glVertexAttribDivisorNV* cmd = args;
+    gles_driver.ext.glVertexAttribDivisorNV(cmd->index, cmd->divisor);
+}
+
+static void GL_APIENTRY marshal_glVertexAttribDivisorNV(GLuint index, GLuint divisor) {
+    if (!glthread_active()) {
+        gles_driver.ext.glVertexAttribDivisorNV(index, divisor);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glVertexAttribDivisorNV* cmd = glthread_alloc(exec_glVertexAttribDivisorNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->divisor = divisor;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glViewportArrayvNV {
+    GLuint first;
+    GLsizei count;
+    const GLfloat *v;
+};
+
+static void exec_glViewportArrayvNV(const void* args) {
+    const struct marshal_glViewportArrayvNV* cmd = args;
+    gles_driver.ext.glViewportArrayvNV(cmd->first, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glViewportArrayvNV(GLuint first, GLsizei count, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportArrayvNV(first, count, v);
+        return;
+    }
+    struct marshal_glViewportArrayvNV* cmd = glthread_alloc(exec_glViewportArrayvNV, sizeof(*cmd));
+    cmd->first = first;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glViewportArrayvOES {
+    GLuint first;
+    GLsizei count;
+    const GLfloat *v;
+};
+
+static void exec_glViewportArrayvOES(const void* args) {
+    const struct marshal_glViewportArrayvOES* cmd = args;
+    gles_driver.ext.glViewportArrayvOES(cmd->first, cmd->count, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glViewportArrayvOES(GLuint first, GLsizei count, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportArrayvOES(first, count, v);
+        return;
+    }
+    struct marshal_glViewportArrayvOES* cmd = glthread_alloc(exec_glViewportArrayvOES, sizeof(*cmd));
+    cmd->first = first;
+    cmd->count = count;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glViewportIndexedfNV {
+    GLuint index;
+    GLfloat x;
+    GLfloat y;
+    GLfloat w;
+    GLfloat h;
+};
+
+static void exec_glViewportIndexedfNV(const void* args) {
+    const struct marshal_glViewportIndexedfNV* cmd = args;
+    gles_driver.ext.glViewportIndexedfNV(cmd->index, cmd->x, cmd->y, cmd->w, cmd->h);
+}
+
+static void GL_APIENTRY marshal_glViewportIndexedfNV(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportIndexedfNV(index, x, y, w, h);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glViewportIndexedfNV* cmd = glthread_alloc(exec_glViewportIndexedfNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = w;
+    cmd->h = h;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glViewportIndexedfOES {
+    GLuint index;
+    GLfloat x;
+    GLfloat y;
+    GLfloat w;
+    GLfloat h;
+};
+
+static void exec_glViewportIndexedfOES(const void* args) {
+    const struct marshal_glViewportIndexedfOES* cmd = args;
+    gles_driver.ext.glViewportIndexedfOES(cmd->index, cmd->x, cmd->y, cmd->w, cmd->h);
+}
+
+static void GL_APIENTRY marshal_glViewportIndexedfOES(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportIndexedfOES(index, x, y, w, h);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glViewportIndexedfOES* cmd = glthread_alloc(exec_glViewportIndexedfOES, sizeof(*cmd));
+    cmd->index = index;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = w;
+    cmd->h = h;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glViewportIndexedfvNV {
+    GLuint index;
+    const GLfloat *v;
+};
+
+static void exec_glViewportIndexedfvNV(const void* args) {
+    const struct marshal_glViewportIndexedfvNV* cmd = args;
+    gles_driver.ext.glViewportIndexedfvNV(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glViewportIndexedfvNV(GLuint index, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportIndexedfvNV(index, v);
+        return;
+    }
+    struct marshal_glViewportIndexedfvNV* cmd = glthread_alloc(exec_glViewportIndexedfvNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glViewportIndexedfvOES {
+    GLuint index;
+    const GLfloat *v;
+};
+
+static void exec_glViewportIndexedfvOES(const void* args) {
+    const struct marshal_glViewportIndexedfvOES* cmd = args;
+    gles_driver.ext.glViewportIndexedfvOES(cmd->index, cmd->v);
+}
+
+static void GL_APIENTRY marshal_glViewportIndexedfvOES(GLuint index, const GLfloat *v) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportIndexedfvOES(index, v);
+        return;
+    }
+    struct marshal_glViewportIndexedfvOES* cmd = glthread_alloc(exec_glViewportIndexedfvOES, sizeof(*cmd));
+    cmd->index = index;
+    cmd->v = v;
+    glthread_sync();
+}
+
+struct marshal_glViewportPositionWScaleNV {
+    GLuint index;
+    GLfloat xcoeff;
+    GLfloat ycoeff;
+};
+
+static void exec_glViewportPositionWScaleNV(const void* args) {
+    const struct marshal_glViewportPositionWScaleNV* cmd = args;
+    gles_driver.ext.glViewportPositionWScaleNV(cmd->index, cmd->xcoeff, cmd->ycoeff);
+}
+
+static void GL_APIENTRY marshal_glViewportPositionWScaleNV(GLuint index, GLfloat xcoeff, GLfloat ycoeff) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportPositionWScaleNV(index, xcoeff, ycoeff);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glViewportPositionWScaleNV* cmd = glthread_alloc(exec_glViewportPositionWScaleNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->xcoeff = xcoeff;
+    cmd->ycoeff = ycoeff;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glViewportSwizzleNV {
+    GLuint index;
+    GLenum swizzlex;
+    GLenum swizzley;
+    GLenum swizzlez;
+    GLenum swizzlew;
+};
+
+static void exec_glViewportSwizzleNV(const void* args) {
+    const struct marshal_glViewportSwizzleNV* cmd = args;
+    gles_driver.ext.glViewportSwizzleNV(cmd->index, cmd->swizzlex, cmd->swizzley, cmd->swizzlez, cmd->swizzlew);
+}
+
+static void GL_APIENTRY marshal_glViewportSwizzleNV(GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew) {
+    if (!glthread_active()) {
+        gles_driver.ext.glViewportSwizzleNV(index, swizzlex, swizzley, swizzlez, swizzlew);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glViewportSwizzleNV* cmd = glthread_alloc(exec_glViewportSwizzleNV, sizeof(*cmd));
+    cmd->index = index;
+    cmd->swizzlex = swizzlex;
+    cmd->swizzley = swizzley;
+    cmd->swizzlez = swizzlez;
+    cmd->swizzlew = swizzlew;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glWaitSemaphoreEXT {
+    GLuint semaphore;
+    GLuint numBufferBarriers;
+    const GLuint *buffers;
+    GLuint numTextureBarriers;
+    const GLuint *textures;
+    const GLenum *srcLayouts;
+};
+
+static void exec_glWaitSemaphoreEXT(const void* args) {
+    const struct marshal_glWaitSemaphoreEXT* cmd = args;
+    gles_driver.ext.glWaitSemaphoreEXT(cmd->semaphore, cmd->numBufferBarriers, cmd->buffers, cmd->numTextureBarriers, cmd->textures, cmd->srcLayouts);
+}
+
+static void GL_APIENTRY marshal_glWaitSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts) {
+    if (!glthread_active()) {
+        gles_driver.ext.glWaitSemaphoreEXT(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts);
+        return;
+    }
+    struct marshal_glWaitSemaphoreEXT* cmd = glthread_alloc(exec_glWaitSemaphoreEXT, sizeof(*cmd));
+    cmd->semaphore = semaphore;
+    cmd->numBufferBarriers = numBufferBarriers;
+    cmd->buffers = buffers;
+    cmd->numTextureBarriers = numTextureBarriers;
+    cmd->textures = textures;
+    cmd->srcLayouts = srcLayouts;
+    glthread_sync();
+}
+
+struct marshal_glWaitSyncAPPLE {
+    GLsync sync;
+    GLbitfield flags;
+    GLuint64 timeout;
+};
+
+static void exec_glWaitSyncAPPLE(const void* args) {
+    const struct marshal_glWaitSyncAPPLE* cmd = args;
+    gles_driver.ext.glWaitSyncAPPLE(cmd->sync, cmd->flags, cmd->timeout);
+}
+
+static void GL_APIENTRY marshal_glWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (!glthread_active()) {
+        gles_driver.ext.glWaitSyncAPPLE(sync, flags, timeout);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glWaitSyncAPPLE* cmd = glthread_alloc(exec_glWaitSyncAPPLE, sizeof(*cmd));
+    cmd->sync = sync;
+    cmd->flags = flags;
+    cmd->timeout = timeout;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glWaitVkSemaphoreNV {
+    GLuint64 vkSemaphore;
+};
+
+static void exec_glWaitVkSemaphoreNV(const void* args) {
+    const struct marshal_glWaitVkSemaphoreNV* cmd = args;
+    gles_driver.ext.glWaitVkSemaphoreNV(cmd->vkSemaphore);
+}
+
+static void GL_APIENTRY marshal_glWaitVkSemaphoreNV(GLuint64 vkSemaphore) {
+    if (!glthread_active()) {
+        gles_driver.ext.glWaitVkSemaphoreNV(vkSemaphore);
+        return;
+    }
+    int glt_sync = 0;
+    struct marshal_glWaitVkSemaphoreNV* cmd = glthread_alloc(exec_glWaitVkSemaphoreNV, sizeof(*cmd));
+    cmd->vkSemaphore = vkSemaphore;
+    if (glt_sync) glthread_sync();
+    else glthread_submit();
+}
+
+struct marshal_glWeightPathsNV {
+    GLuint resultPath;
+    GLsizei numPaths;
+    const GLuint *paths;
+    const GLfloat *weights;
+};
+
+static void exec_glWeightPathsNV(const void* args) {
+    const struct marshal_glWeightPathsNV* cmd = args;
+    gles_driver.ext.glWeightPathsNV(cmd->resultPath, cmd->numPaths, cmd->paths, cmd->weights);
+}
+
+static void GL_APIENTRY marshal_glWeightPathsNV(GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights) {
+    if (!glthread_active()) {
+        gles_driver.ext.glWeightPathsNV(resultPath, numPaths, paths, weights);
+        return;
+    }
+    struct marshal_glWeightPathsNV* cmd = glthread_alloc(exec_glWeightPathsNV, sizeof(*cmd));
+    cmd->resultPath = resultPath;
+    cmd->numPaths = numPaths;
+    cmd->paths = paths;
+    cmd->weights = weights;
+    glthread_sync();
+}
+
+struct marshal_glWindowRectanglesEXT {
+    GLenum mode;
+    GLsizei count;
+    const GLint *box;
+};
+
+static void exec_glWindowRectanglesEXT(const void* args) {
+    const struct marshal_glWindowRectanglesEXT* cmd = args;
+    gles_driver.ext.glWindowRectanglesEXT(cmd->mode, cmd->count, cmd->box);
+}
+
+static void GL_APIENTRY marshal_glWindowRectanglesEXT(GLenum mode, GLsizei count, const GLint *box) {
+    if (!glthread_active()) {
+        gles_driver.ext.glWindowRectanglesEXT(mode, count, box);
+        return;
+    }
+    struct marshal_glWindowRectanglesEXT* cmd = glthread_alloc(exec_glWindowRectanglesEXT, sizeof(*cmd));
+    cmd->mode = mode;
+    cmd->count = count;
+    cmd->box = box;
+    glthread_sync();
+}
+
+void glthread_install_marshallers(void) {
+    if (gles.core.glActiveShaderProgram) gles.core.glActiveShaderProgram = marshal_glActiveShaderProgram;
+    if (gles.core.glActiveTexture) gles.core.glActiveTexture = marshal_glActiveTexture;
+    if (gles.core.glAttachShader) gles.core.glAttachShader = marshal_glAttachShader;
+    if (gles.core.glBeginQuery) gles.core.glBeginQuery = marshal_glBeginQuery;
+    if (gles.core.glBeginTransformFeedback) gles.core.glBeginTransformFeedback = marshal_glBeginTransformFeedback;
+    if (gles.core.glBindAttribLocation) gles.core.glBindAttribLocation = marshal_glBindAttribLocation;
+    if (gles.core.glBindBuffer) gles.core.glBindBuffer = marshal_glBindBuffer;
+    if (gles.core.glBindBufferBase) gles.core.glBindBufferBase = marshal_glBindBufferBase;
+    if (gles.core.glBindBufferRange) gles.core.glBindBufferRange = marshal_glBindBufferRange;
+    if (gles.core.glBindFramebuffer) gles.core.glBindFramebuffer = marshal_glBindFramebuffer;
+    if (gles.core.glBindImageTexture) gles.core.glBindImageTexture = marshal_glBindImageTexture;
+    if (gles.core.glBindProgramPipeline) gles.core.glBindProgramPipeline = marshal_glBindProgramPipeline;
+    if (gles.core.glBindRenderbuffer) gles.core.glBindRenderbuffer = marshal_glBindRenderbuffer;
+    if (gles.core.glBindSampler) gles.core.glBindSampler = marshal_glBindSampler;
+    if (gles.core.glBindTexture) gles.core.glBindTexture = marshal_glBindTexture;
+    if (gles.core.glBindTransformFeedback) gles.core.glBindTransformFeedback = marshal_glBindTransformFeedback;
+    if (gles.core.glBindVertexArray) gles.core.glBindVertexArray = marshal_glBindVertexArray;
+    if (gles.core.glBindVertexBuffer) gles.core.glBindVertexBuffer = marshal_glBindVertexBuffer;
+    if (gles.core.glBlendBarrier) gles.core.glBlendBarrier = marshal_glBlendBarrier;
+    if (gles.core.glBlendColor) gles.core.glBlendColor = marshal_glBlendColor;
+    if (gles.core.glBlendEquation) gles.core.glBlendEquation = marshal_glBlendEquation;
+    if (gles.core.glBlendEquationSeparate) gles.core.glBlendEquationSeparate = marshal_glBlendEquationSeparate;
+    if (gles.core.glBlendEquationSeparatei) gles.core.glBlendEquationSeparatei = marshal_glBlendEquationSeparatei;
+    if (gles.core.glBlendEquationi) gles.core.glBlendEquationi = marshal_glBlendEquationi;
+    if (gles.core.glBlendFunc) gles.core.glBlendFunc = marshal_glBlendFunc;
+    if (gles.core.glBlendFuncSeparate) gles.core.glBlendFuncSeparate = marshal_glBlendFuncSeparate;
+    if (gles.core.glBlendFuncSeparatei) gles.core.glBlendFuncSeparatei = marshal_glBlendFuncSeparatei;
+    if (gles.core.glBlendFunci) gles.core.glBlendFunci = marshal_glBlendFunci;
+    if (gles.core.glBlitFramebuffer) gles.core.glBlitFramebuffer = marshal_glBlitFramebuffer;
+    if (gles.core.glBufferData) gles.core.glBufferData = marshal_glBufferData;
+    if (gles.core.glBufferSubData) gles.core.glBufferSubData = marshal_glBufferSubData;
+    if (gles.core.glCheckFramebufferStatus) gles.core.glCheckFramebufferStatus = marshal_glCheckFramebufferStatus;
+    if (gles.core.glClear) gles.core.glClear = marshal_glClear;
+    if (gles.core.glClearBufferfi) gles.core.glClearBufferfi = marshal_glClearBufferfi;
+    if (gles.core.glClearBufferfv) gles.core.glClearBufferfv = marshal_glClearBufferfv;
+    if (gles.core.glClearBufferiv) gles.core.glClearBufferiv = marshal_glClearBufferiv;
+    if (gles.core.glClearBufferuiv) gles.core.glClearBufferuiv = marshal_glClearBufferuiv;
+    if (gles.core.glClearColor) gles.core.glClearColor = marshal_glClearColor;
+    if (gles.core.glClearDepthf) gles.core.glClearDepthf = marshal_glClearDepthf;
+    if (gles.core.glClearStencil) gles.core.glClearStencil = marshal_glClearStencil;
+    if (gles.core.glClientWaitSync) gles.core.glClientWaitSync = marshal_glClientWaitSync;
+    if (gles.core.glColorMask) gles.core.glColorMask = marshal_glColorMask;
+    if (gles.core.glColorMaski) gles.core.glColorMaski = marshal_glColorMaski;
+    if (gles.core.glCompileShader) gles.core.glCompileShader = marshal_glCompileShader;
+    if (gles.core.glCompressedTexImage2D) gles.core.glCompressedTexImage2D = marshal_glCompressedTexImage2D;
+    if (gles.core.glCompressedTexImage3D) gles.core.glCompressedTexImage3D = marshal_glCompressedTexImage3D;
+    if (gles.core.glCompressedTexSubImage2D) gles.core.glCompressedTexSubImage2D = marshal_glCompressedTexSubImage2D;
+    if (gles.core.glCompressedTexSubImage3D) gles.core.glCompressedTexSubImage3D = marshal_glCompressedTexSubImage3D;
+    if (gles.core.glCopyBufferSubData) gles.core.glCopyBufferSubData = marshal_glCopyBufferSubData;
+    if (gles.core.glCopyImageSubData) gles.core.glCopyImageSubData = marshal_glCopyImageSubData;
+    if (gles.core.glCopyTexImage2D) gles.core.glCopyTexImage2D = marshal_glCopyTexImage2D;
+    if (gles.core.glCopyTexSubImage2D) gles.core.glCopyTexSubImage2D = marshal_glCopyTexSubImage2D;
+    if (gles.core.glCopyTexSubImage3D) gles.core.glCopyTexSubImage3D = marshal_glCopyTexSubImage3D;
+    if (gles.core.glCreateProgram) gles.core.glCreateProgram = marshal_glCreateProgram;
+    if (gles.core.glCreateShader) gles.core.glCreateShader = marshal_glCreateShader;
+    if (gles.core.glCreateShaderProgramv) gles.core.glCreateShaderProgramv = marshal_glCreateShaderProgramv;
+    if (gles.core.glCullFace) gles.core.glCullFace = marshal_glCullFace;
+    if (gles.core.glDebugMessageCallback) gles.core.glDebugMessageCallback = marshal_glDebugMessageCallback;
+    if (gles.core.glDebugMessageControl) gles.core.glDebugMessageControl = marshal_glDebugMessageControl;
+    if (gles.core.glDebugMessageInsert) gles.core.glDebugMessageInsert = marshal_glDebugMessageInsert;
+    if (gles.core.glDeleteBuffers) gles.core.glDeleteBuffers = marshal_glDeleteBuffers;
+    if (gles.core.glDeleteFramebuffers) gles.core.glDeleteFramebuffers = marshal_glDeleteFramebuffers;
+    if (gles.core.glDeleteProgram) gles.core.glDeleteProgram = marshal_glDeleteProgram;
+    if (gles.core.glDeleteProgramPipelines) gles.core.glDeleteProgramPipelines = marshal_glDeleteProgramPipelines;
+    if (gles.core.glDeleteQueries) gles.core.glDeleteQueries = marshal_glDeleteQueries;
+    if (gles.core.glDeleteRenderbuffers) gles.core.glDeleteRenderbuffers = marshal_glDeleteRenderbuffers;
+    if (gles.core.glDeleteSamplers) gles.core.glDeleteSamplers = marshal_glDeleteSamplers;
+    if (gles.core.glDeleteShader) gles.core.glDeleteShader = marshal_glDeleteShader;
+    if (gles.core.glDeleteSync) gles.core.glDeleteSync = marshal_glDeleteSync;
+    if (gles.core.glDeleteTextures) gles.core.glDeleteTextures = marshal_glDeleteTextures;
+    if (gles.core.glDeleteTransformFeedbacks) gles.core.glDeleteTransformFeedbacks = marshal_glDeleteTransformFeedbacks;
+    if (gles.core.glDeleteVertexArrays) gles.core.glDeleteVertexArrays = marshal_glDeleteVertexArrays;
+    if (gles.core.glDepthFunc) gles.core.glDepthFunc = marshal_glDepthFunc;
+    if (gles.core.glDepthMask) gles.core.glDepthMask = marshal_glDepthMask;
+    if (gles.core.glDepthRangef) gles.core.glDepthRangef = marshal_glDepthRangef;
+    if (gles.core.glDetachShader) gles.core.glDetachShader = marshal_glDetachShader;
+    if (gles.core.glDisable) gles.core.glDisable = marshal_glDisable;
+    if (gles.core.glDisableVertexAttribArray) gles.core.glDisableVertexAttribArray = marshal_glDisableVertexAttribArray;
+    if (gles.core.glDisablei) gles.core.glDisablei = marshal_glDisablei;
+    if (gles.core.glDispatchCompute) gles.core.glDispatchCompute = marshal_glDispatchCompute;
+    if (gles.core.glDispatchComputeIndirect) gles.core.glDispatchComputeIndirect = marshal_glDispatchComputeIndirect;
+    if (gles.core.glDrawArrays) gles.core.glDrawArrays = marshal_glDrawArrays;
+    if (gles.core.glDrawArraysIndirect) gles.core.glDrawArraysIndirect = marshal_glDrawArraysIndirect;
+    if (gles.core.glDrawArraysInstanced) gles.core.glDrawArraysInstanced = marshal_glDrawArraysInstanced;
+    if (gles.core.glDrawBuffers) gles.core.glDrawBuffers = marshal_glDrawBuffers;
+    if (gles.core.glDrawElements) gles.core.glDrawElements = marshal_glDrawElements;
+    if (gles.core.glDrawElementsBaseVertex) gles.core.glDrawElementsBaseVertex = marshal_glDrawElementsBaseVertex;
+    if (gles.core.glDrawElementsIndirect) gles.core.glDrawElementsIndirect = marshal_glDrawElementsIndirect;
+    if (gles.core.glDrawElementsInstanced) gles.core.glDrawElementsInstanced = marshal_glDrawElementsInstanced;
+    if (gles.core.glDrawElementsInstancedBaseVertex) gles.core.glDrawElementsInstancedBaseVertex = marshal_glDrawElementsInstancedBaseVertex;
+    if (gles.core.glDrawRangeElements) gles.core.glDrawRangeElements = marshal_glDrawRangeElements;
+    if (gles.core.glDrawRangeElementsBaseVertex) gles.core.glDrawRangeElementsBaseVertex = marshal_glDrawRangeElementsBaseVertex;
+    if (gles.core.glEnable) gles.core.glEnable = marshal_glEnable;
+    if (gles.core.glEnableVertexAttribArray) gles.core.glEnableVertexAttribArray = marshal_glEnableVertexAttribArray;
+    if (gles.core.glEnablei) gles.core.glEnablei = marshal_glEnablei;
+    if (gles.core.glEndQuery) gles.core.glEndQuery = marshal_glEndQuery;
+    if (gles.core.glEndTransformFeedback) gles.core.glEndTransformFeedback = marshal_glEndTransformFeedback;
+    if (gles.core.glFenceSync) gles.core.glFenceSync = marshal_glFenceSync;
+    if (gles.core.glFinish) gles.core.glFinish = marshal_glFinish;
+    if (gles.core.glFlush) gles.core.glFlush = marshal_glFlush;
+    if (gles.core.glFlushMappedBufferRange) gles.core.glFlushMappedBufferRange = marshal_glFlushMappedBufferRange;
+    if (gles.core.glFramebufferParameteri) gles.core.glFramebufferParameteri = marshal_glFramebufferParameteri;
+    if (gles.core.glFramebufferRenderbuffer) gles.core.glFramebufferRenderbuffer = marshal_glFramebufferRenderbuffer;
+    if (gles.core.glFramebufferTexture) gles.core.glFramebufferTexture = marshal_glFramebufferTexture;
+    if (gles.core.glFramebufferTexture2D) gles.core.glFramebufferTexture2D = marshal_glFramebufferTexture2D;
+    if (gles.core.glFramebufferTextureLayer) gles.core.glFramebufferTextureLayer = marshal_glFramebufferTextureLayer;
+    if (gles.core.glFrontFace) gles.core.glFrontFace = marshal_glFrontFace;
+    if (gles.core.glGenBuffers) gles.core.glGenBuffers = marshal_glGenBuffers;
+    if (gles.core.glGenFramebuffers) gles.core.glGenFramebuffers = marshal_glGenFramebuffers;
+    if (gles.core.glGenProgramPipelines) gles.core.glGenProgramPipelines = marshal_glGenProgramPipelines;
+    if (gles.core.glGenQueries) gles.core.glGenQueries = marshal_glGenQueries;
+    if (gles.core.glGenRenderbuffers) gles.core.glGenRenderbuffers = marshal_glGenRenderbuffers;
+    if (gles.core.glGenSamplers) gles.core.glGenSamplers = marshal_glGenSamplers;
+    if (gles.core.glGenTextures) gles.core.glGenTextures = marshal_glGenTextures;
+    if (gles.core.glGenTransformFeedbacks) gles.core.glGenTransformFeedbacks = marshal_glGenTransformFeedbacks;
+    if (gles.core.glGenVertexArrays) gles.core.glGenVertexArrays = marshal_glGenVertexArrays;
+    if (gles.core.glGenerateMipmap) gles.core.glGenerateMipmap = marshal_glGenerateMipmap;
+    if (gles.core.glGetActiveAttrib) gles.core.glGetActiveAttrib = marshal_glGetActiveAttrib;
+    if (gles.core.glGetActiveUniform) gles.core.glGetActiveUniform = marshal_glGetActiveUniform;
+    if (gles.core.glGetActiveUniformBlockName) gles.core.glGetActiveUniformBlockName = marshal_glGetActiveUniformBlockName;
+    if (gles.core.glGetActiveUniformBlockiv) gles.core.glGetActiveUniformBlockiv = marshal_glGetActiveUniformBlockiv;
+    if (gles.core.glGetActiveUniformsiv) gles.core.glGetActiveUniformsiv = marshal_glGetActiveUniformsiv;
+    if (gles.core.glGetAttachedShaders) gles.core.glGetAttachedShaders = marshal_glGetAttachedShaders;
+    if (gles.core.glGetAttribLocation) gles.core.glGetAttribLocation = marshal_glGetAttribLocation;
+    if (gles.core.glGetBooleani_v) gles.core.glGetBooleani_v = marshal_glGetBooleani_v;
+    if (gles.core.glGetBooleanv) gles.core.glGetBooleanv = marshal_glGetBooleanv;
+    if (gles.core.glGetBufferParameteri64v) gles.core.glGetBufferParameteri64v = marshal_glGetBufferParameteri64v;
+    if (gles.core.glGetBufferParameteriv) gles.core.glGetBufferParameteriv = marshal_glGetBufferParameteriv;
+    if (gles.core.glGetBufferPointerv) gles.core.glGetBufferPointerv = marshal_glGetBufferPointerv;
+    if (gles.core.glGetDebugMessageLog) gles.core.glGetDebugMessageLog = marshal_glGetDebugMessageLog;
+    if (gles.core.glGetError) gles.core.glGetError = marshal_glGetError;
+    if (gles.core.glGetFloatv) gles.core.glGetFloatv = marshal_glGetFloatv;
+    if (gles.core.glGetFragDataLocation) gles.core.glGetFragDataLocation = marshal_glGetFragDataLocation;
+    if (gles.core.glGetFramebufferAttachmentParameteriv) gles.core.glGetFramebufferAttachmentParameteriv = marshal_glGetFramebufferAttachmentParameteriv;
+    if (gles.core.glGetFramebufferParameteriv) gles.core.glGetFramebufferParameteriv = marshal_glGetFramebufferParameteriv;
+    if (gles.core.glGetGraphicsResetStatus) gles.core.glGetGraphicsResetStatus = marshal_glGetGraphicsResetStatus;
+    if (gles.core.glGetInteger64i_v) gles.core.glGetInteger64i_v = marshal_glGetInteger64i_v;
+    if (gles.core.glGetInteger64v) gles.core.glGetInteger64v = marshal_glGetInteger64v;
+    if (gles.core.glGetIntegeri_v) gles.core.glGetIntegeri_v = marshal_glGetIntegeri_v;
+    if (gles.core.glGetIntegerv) gles.core.glGetIntegerv = marshal_glGetIntegerv;
+    if (gles.core.glGetInternalformativ) gles.core.glGetInternalformativ = marshal_glGetInternalformativ;
+    if (gles.core.glGetMultisamplefv) gles.core.glGetMultisamplefv = marshal_glGetMultisamplefv;
+    if (gles.core.glGetObjectLabel) gles.core.glGetObjectLabel = marshal_glGetObjectLabel;
+    if (gles.core.glGetObjectPtrLabel) gles.core.glGetObjectPtrLabel = marshal_glGetObjectPtrLabel;
+    if (gles.core.glGetPointerv) gles.core.glGetPointerv = marshal_glGetPointerv;
+    if (gles.core.glGetProgramBinary) gles.core.glGetProgramBinary = marshal_glGetProgramBinary;
+    if (gles.core.glGetProgramInfoLog) gles.core.glGetProgramInfoLog = marshal_glGetProgramInfoLog;
+    if (gles.core.glGetProgramInterfaceiv) gles.core.glGetProgramInterfaceiv = marshal_glGetProgramInterfaceiv;
+    if (gles.core.glGetProgramPipelineInfoLog) gles.core.glGetProgramPipelineInfoLog = marshal_glGetProgramPipelineInfoLog;
+    if (gles.core.glGetProgramPipelineiv) gles.core.glGetProgramPipelineiv = marshal_glGetProgramPipelineiv;
+    if (gles.core.glGetProgramResourceIndex) gles.core.glGetProgramResourceIndex = marshal_glGetProgramResourceIndex;
+    if (gles.core.glGetProgramResourceLocation) gles.core.glGetProgramResourceLocation = marshal_glGetProgramResourceLocation;
+    if (gles.core.glGetProgramResourceName) gles.core.glGetProgramResourceName = marshal_glGetProgramResourceName;
+    if (gles.core.glGetProgramResourceiv) gles.core.glGetProgramResourceiv = marshal_glGetProgramResourceiv;
+    if (gles.core.glGetProgramiv) gles.core.glGetProgramiv = marshal_glGetProgramiv;
+    if (gles.core.glGetQueryObjectuiv) gles.core.glGetQueryObjectuiv = marshal_glGetQueryObjectuiv;
+    if (gles.core.glGetQueryiv) gles.core.glGetQueryiv = marshal_glGetQueryiv;
+    if (gles.core.glGetRenderbufferParameteriv) gles.core.glGetRenderbufferParameteriv = marshal_glGetRenderbufferParameteriv;
+    if (gles.core.glGetSamplerParameterIiv) gles.core.glGetSamplerParameterIiv = marshal_glGetSamplerParameterIiv;
+    if (gles.core.glGetSamplerParameterIuiv) gles.core.glGetSamplerParameterIuiv = marshal_glGetSamplerParameterIuiv;
+    if (gles.core.glGetSamplerParameterfv) gles.core.glGetSamplerParameterfv = marshal_glGetSamplerParameterfv;
+    if (gles.core.glGetSamplerParameteriv) gles.core.glGetSamplerParameteriv = marshal_glGetSamplerParameteriv;
+    if (gles.core.glGetShaderInfoLog) gles.core.glGetShaderInfoLog = marshal_glGetShaderInfoLog;
+    if (gles.core.glGetShaderPrecisionFormat) gles.core.glGetShaderPrecisionFormat = marshal_glGetShaderPrecisionFormat;
+    if (gles.core.glGetShaderSource) gles.core.glGetShaderSource = marshal_glGetShaderSource;
+    if (gles.core.glGetShaderiv) gles.core.glGetShaderiv = marshal_glGetShaderiv;
+    if (gles.core.glGetString) gles.core.glGetString = marshal_glGetString;
+    if (gles.core.glGetStringi) gles.core.glGetStringi = marshal_glGetStringi;
+    if (gles.core.glGetSynciv) gles.core.glGetSynciv = marshal_glGetSynciv;
+    if (gles.core.glGetTexLevelParameterfv) gles.core.glGetTexLevelParameterfv = marshal_glGetTexLevelParameterfv;
+    if (gles.core.glGetTexLevelParameteriv) gles.core.glGetTexLevelParameteriv = marshal_glGetTexLevelParameteriv;
+    if (gles.core.glGetTexParameterIiv) gles.core.glGetTexParameterIiv = marshal_glGetTexParameterIiv;
+    if (gles.core.glGetTexParameterIuiv) gles.core.glGetTexParameterIuiv = marshal_glGetTexParameterIuiv;
+    if (gles.core.glGetTexParameterfv) gles.core.glGetTexParameterfv = marshal_glGetTexParameterfv;
+    if (gles.core.glGetTexParameteriv) gles.core.glGetTexParameteriv = marshal_glGetTexParameteriv;
+    if (gles.core.glGetTransformFeedbackVarying) gles.core.glGetTransformFeedbackVarying = marshal_glGetTransformFeedbackVarying;
+    if (gles.core.glGetUniformBlockIndex) gles.core.glGetUniformBlockIndex = marshal_glGetUniformBlockIndex;
+    if (gles.core.glGetUniformIndices) gles.core.glGetUniformIndices = marshal_glGetUniformIndices;
+    if (gles.core.glGetUniformLocation) gles.core.glGetUniformLocation = marshal_glGetUniformLocation;
+    if (gles.core.glGetUniformfv) gles.core.glGetUniformfv = marshal_glGetUniformfv;
+    if (gles.core.glGetUniformiv) gles.core.glGetUniformiv = marshal_glGetUniformiv;
+    if (gles.core.glGetUniformuiv) gles.core.glGetUniformuiv = marshal_glGetUniformuiv;
+    if (gles.core.glGetVertexAttribIiv) gles.core.glGetVertexAttribIiv = marshal_glGetVertexAttribIiv;
+    if (gles.core.glGetVertexAttribIuiv) gles.core.glGetVertexAttribIuiv = marshal_glGetVertexAttribIuiv;
+    if (gles.core.glGetVertexAttribPointerv) gles.core.glGetVertexAttribPointerv = marshal_glGetVertexAttribPointerv;
+    if (gles.core.glGetVertexAttribfv) gles.core.glGetVertexAttribfv = marshal_glGetVertexAttribfv;
+    if (gles.core.glGetVertexAttribiv) gles.core.glGetVertexAttribiv = marshal_glGetVertexAttribiv;
+    if (gles.core.glGetnUniformfv) gles.core.glGetnUniformfv = marshal_glGetnUniformfv;
+    if (gles.core.glGetnUniformiv) gles.core.glGetnUniformiv = marshal_glGetnUniformiv;
+    if (gles.core.glGetnUniformuiv) gles.core.glGetnUniformuiv = marshal_glGetnUniformuiv;
+    if (gles.core.glHint) gles.core.glHint = marshal_glHint;
+    if (gles.core.glInvalidateFramebuffer) gles.core.glInvalidateFramebuffer = marshal_glInvalidateFramebuffer;
+    if (gles.core.glInvalidateSubFramebuffer) gles.core.glInvalidateSubFramebuffer = marshal_glInvalidateSubFramebuffer;
+    if (gles.core.glIsBuffer) gles.core.glIsBuffer = marshal_glIsBuffer;
+    if (gles.core.glIsEnabled) gles.core.glIsEnabled = marshal_glIsEnabled;
+    if (gles.core.glIsEnabledi) gles.core.glIsEnabledi = marshal_glIsEnabledi;
+    if (gles.core.glIsFramebuffer) gles.core.glIsFramebuffer = marshal_glIsFramebuffer;
+    if (gles.core.glIsProgram) gles.core.glIsProgram = marshal_glIsProgram;
+    if (gles.core.glIsProgramPipeline) gles.core.glIsProgramPipeline = marshal_glIsProgramPipeline;
+    if (gles.core.glIsQuery) gles.core.glIsQuery = marshal_glIsQuery;
+    if (gles.core.glIsRenderbuffer) gles.core.glIsRenderbuffer = marshal_glIsRenderbuffer;
+    if (gles.core.glIsSampler) gles.core.glIsSampler = marshal_glIsSampler;
+    if (gles.core.glIsShader) gles.core.glIsShader = marshal_glIsShader;
+    if (gles.core.glIsSync) gles.core.glIsSync = marshal_glIsSync;
+    if (gles.core.glIsTexture) gles.core.glIsTexture = marshal_glIsTexture;
+    if (gles.core.glIsTransformFeedback) gles.core.glIsTransformFeedback = marshal_glIsTransformFeedback;
+    if (gles.core.glIsVertexArray) gles.core.glIsVertexArray = marshal_glIsVertexArray;
+    if (gles.core.glLineWidth) gles.core.glLineWidth = marshal_glLineWidth;
+    if (gles.core.glLinkProgram) gles.core.glLinkProgram = marshal_glLinkProgram;
+    if (gles.core.glMapBufferRange) gles.core.glMapBufferRange = marshal_glMapBufferRange;
+    if (gles.core.glMemoryBarrier) gles.core.glMemoryBarrier = marshal_glMemoryBarrier;
+    if (gles.core.glMemoryBarrierByRegion) gles.core.glMemoryBarrierByRegion = marshal_glMemoryBarrierByRegion;
+    if (gles.core.glMinSampleShading) gles.core.glMinSampleShading = marshal_glMinSampleShading;
+    if (gles.core.glObjectLabel) gles.core.glObjectLabel = marshal_glObjectLabel;
+    if (gles.core.glObjectPtrLabel) gles.core.glObjectPtrLabel = marshal_glObjectPtrLabel;
+    if (gles.core.glPatchParameteri) gles.core.glPatchParameteri = marshal_glPatchParameteri;
+    if (gles.core.glPauseTransformFeedback) gles.core.glPauseTransformFeedback = marshal_glPauseTransformFeedback;
+    if (gles.core.glPixelStorei) gles.core.glPixelStorei = marshal_glPixelStorei;
+    if (gles.core.glPolygonOffset) gles.core.glPolygonOffset = marshal_glPolygonOffset;
+    if (gles.core.glPopDebugGroup) gles.core.glPopDebugGroup = marshal_glPopDebugGroup;
+    if (gles.core.glPrimitiveBoundingBox) gles.core.glPrimitiveBoundingBox = marshal_glPrimitiveBoundingBox;
+    if (gles.core.glProgramBinary) gles.core.glProgramBinary = marshal_glProgramBinary;
+    if (gles.core.glProgramParameteri) gles.core.glProgramParameteri = marshal_glProgramParameteri;
+    if (gles.core.glProgramUniform1f) gles.core.glProgramUniform1f = marshal_glProgramUniform1f;
+    if (gles.core.glProgramUniform1fv) gles.core.glProgramUniform1fv = marshal_glProgramUniform1fv;
+    if (gles.core.glProgramUniform1i) gles.core.glProgramUniform1i = marshal_glProgramUniform1i;
+    if (gles.core.glProgramUniform1iv) gles.core.glProgramUniform1iv = marshal_glProgramUniform1iv;
+    if (gles.core.glProgramUniform1ui) gles.core.glProgramUniform1ui = marshal_glProgramUniform1ui;
+    if (gles.core.glProgramUniform1uiv) gles.core.glProgramUniform1uiv = marshal_glProgramUniform1uiv;
+    if (gles.core.glProgramUniform2f) gles.core.glProgramUniform2f = marshal_glProgramUniform2f;
+    if (gles.core.glProgramUniform2fv) gles.core.glProgramUniform2fv = marshal_glProgramUniform2fv;
+    if (gles.core.glProgramUniform2i) gles.core.glProgramUniform2i = marshal_glProgramUniform2i;
+    if (gles.core.glProgramUniform2iv) gles.core.glProgramUniform2iv = marshal_glProgramUniform2iv;
+    if (gles.core.glProgramUniform2ui) gles.core.glProgramUniform2ui = marshal_glProgramUniform2ui;
+    if (gles.core.glProgramUniform2uiv) gles.core.glProgramUniform2uiv = marshal_glProgramUniform2uiv;
+    if (gles.core.glProgramUniform3f) gles.core.glProgramUniform3f = marshal_glProgramUniform3f;
+    if (gles.core.glProgramUniform3fv) gles.core.glProgramUniform3fv = marshal_glProgramUniform3fv;
+    if (gles.core.glProgramUniform3i) gles.core.glProgramUniform3i = marshal_glProgramUniform3i;
+    if (gles.core.glProgramUniform3iv) gles.core.glProgramUniform3iv = marshal_glProgramUniform3iv;
+    if (gles.core.glProgramUniform3ui) gles.core.glProgramUniform3ui = marshal_glProgramUniform3ui;
+    if (gles.core.glProgramUniform3uiv) gles.core.glProgramUniform3uiv = marshal_glProgramUniform3uiv;
+    if (gles.core.glProgramUniform4f) gles.core.glProgramUniform4f = marshal_glProgramUniform4f;
+    if (gles.core.glProgramUniform4fv) gles.core.glProgramUniform4fv = marshal_glProgramUniform4fv;
+    if (gles.core.glProgramUniform4i) gles.core.glProgramUniform4i = marshal_glProgramUniform4i;
+    if (gles.core.glProgramUniform4iv) gles.core.glProgramUniform4iv = marshal_glProgramUniform4iv;
+    if (gles.core.glProgramUniform4ui) gles.core.glProgramUniform4ui = marshal_glProgramUniform4ui;
+    if (gles.core.glProgramUniform4uiv) gles.core.glProgramUniform4uiv = marshal_glProgramUniform4uiv;
+    if (gles.core.glProgramUniformMatrix2fv) gles.core.glProgramUniformMatrix2fv = marshal_glProgramUniformMatrix2fv;
+    if (gles.core.glProgramUniformMatrix2x3fv) gles.core.glProgramUniformMatrix2x3fv = marshal_glProgramUniformMatrix2x3fv;
+    if (gles.core.glProgramUniformMatrix2x4fv) gles.core.glProgramUniformMatrix2x4fv = marshal_glProgramUniformMatrix2x4fv;
+    if (gles.core.glProgramUniformMatrix3fv) gles.core.glProgramUniformMatrix3fv = marshal_glProgramUniformMatrix3fv;
+    if (gles.core.glProgramUniformMatrix3x2fv) gles.core.glProgramUniformMatrix3x2fv = marshal_glProgramUniformMatrix3x2fv;
+    if (gles.core.glProgramUniformMatrix3x4fv) gles.core.glProgramUniformMatrix3x4fv = marshal_glProgramUniformMatrix3x4fv;
+    if (gles.core.glProgramUniformMatrix4fv) gles.core.glProgramUniformMatrix4fv = marshal_glProgramUniformMatrix4fv;
+    if (gles.core.glProgramUniformMatrix4x2fv) gles.core.glProgramUniformMatrix4x2fv = marshal_glProgramUniformMatrix4x2fv;
+    if (gles.core.glProgramUniformMatrix4x3fv) gles.core.glProgramUniformMatrix4x3fv = marshal_glProgramUniformMatrix4x3fv;
+    if (gles.core.glPushDebugGroup) gles.core.glPushDebugGroup = marshal_glPushDebugGroup;
+    if (gles.core.glReadBuffer) gles.core.glReadBuffer = marshal_glReadBuffer;
+    if (gles.core.glReadPixels) gles.core.glReadPixels = marshal_glReadPixels;
+    if (gles.core.glReadnPixels) gles.core.glReadnPixels = marshal_glReadnPixels;
+    if (gles.core.glReleaseShaderCompiler) gles.core.glReleaseShaderCompiler = marshal_glReleaseShaderCompiler;
+    if (gles.core.glRenderbufferStorage) gles.core.glRenderbufferStorage = marshal_glRenderbufferStorage;
+    if (gles.core.glRenderbufferStorageMultisample) gles.core.glRenderbufferStorageMultisample = marshal_glRenderbufferStorageMultisample;
+    if (gles.core.glResumeTransformFeedback) gles.core.glResumeTransformFeedback = marshal_glResumeTransformFeedback;
+    if (gles.core.glSampleCoverage) gles.core.glSampleCoverage = marshal_glSampleCoverage;
+    if (gles.core.glSampleMaski) gles.core.glSampleMaski = marshal_glSampleMaski;
+    if (gles.core.glSamplerParameterIiv) gles.core.glSamplerParameterIiv = marshal_glSamplerParameterIiv;
+    if (gles.core.glSamplerParameterIuiv) gles.core.glSamplerParameterIuiv = marshal_glSamplerParameterIuiv;
+    if (gles.core.glSamplerParameterf) gles.core.glSamplerParameterf = marshal_glSamplerParameterf;
+    if (gles.core.glSamplerParameterfv) gles.core.glSamplerParameterfv = marshal_glSamplerParameterfv;
+    if (gles.core.glSamplerParameteri) gles.core.glSamplerParameteri = marshal_glSamplerParameteri;
+    if (gles.core.glSamplerParameteriv) gles.core.glSamplerParameteriv = marshal_glSamplerParameteriv;
+    if (gles.core.glScissor) gles.core.glScissor = marshal_glScissor;
+    if (gles.core.glShaderBinary) gles.core.glShaderBinary = marshal_glShaderBinary;
+    if (gles.core.glShaderSource) gles.core.glShaderSource = marshal_glShaderSource;
+    if (gles.core.glStencilFunc) gles.core.glStencilFunc = marshal_glStencilFunc;
+    if (gles.core.glStencilFuncSeparate) gles.core.glStencilFuncSeparate = marshal_glStencilFuncSeparate;
+    if (gles.core.glStencilMask) gles.core.glStencilMask = marshal_glStencilMask;
+    if (gles.core.glStencilMaskSeparate) gles.core.glStencilMaskSeparate = marshal_glStencilMaskSeparate;
+    if (gles.core.glStencilOp) gles.core.glStencilOp = marshal_glStencilOp;
+    if (gles.core.glStencilOpSeparate) gles.core.glStencilOpSeparate = marshal_glStencilOpSeparate;
+    if (gles.core.glTexBuffer) gles.core.glTexBuffer = marshal_glTexBuffer;
+    if (gles.core.glTexBufferRange) gles.core.glTexBufferRange = marshal_glTexBufferRange;
+    if (gles.core.glTexImage2D) gles.core.glTexImage2D = marshal_glTexImage2D;
+    if (gles.core.glTexImage3D) gles.core.glTexImage3D = marshal_glTexImage3D;
+    if (gles.core.glTexParameterIiv) gles.core.glTexParameterIiv = marshal_glTexParameterIiv;
+    if (gles.core.glTexParameterIuiv) gles.core.glTexParameterIuiv = marshal_glTexParameterIuiv;
+    if (gles.core.glTexParameterf) gles.core.glTexParameterf = marshal_glTexParameterf;
+    if (gles.core.glTexParameterfv) gles.core.glTexParameterfv = marshal_glTexParameterfv;
+    if (gles.core.glTexParameteri) gles.core.glTexParameteri = marshal_glTexParameteri;
+    if (gles.core.glTexParameteriv) gles.core.glTexParameteriv = marshal_glTexParameteriv;
+    if (gles.core.glTexStorage2D) gles.core.glTexStorage2D = marshal_glTexStorage2D;
+    if (gles.core.glTexStorage2DMultisample) gles.core.glTexStorage2DMultisample = marshal_glTexStorage2DMultisample;
+    if (gles.core.glTexStorage3D) gles.core.glTexStorage3D = marshal_glTexStorage3D;
+    if (gles.core.glTexStorage3DMultisample) gles.core.glTexStorage3DMultisample = marshal_glTexStorage3DMultisample;
+    if (gles.core.glTexSubImage2D) gles.core.glTexSubImage2D = marshal_glTexSubImage2D;
+    if (gles.core.glTexSubImage3D) gles.core.glTexSubImage3D = marshal_glTexSubImage3D;
+    if (gles.core.glTransformFeedbackVaryings) gles.core.glTransformFeedbackVaryings = marshal_glTransformFeedbackVaryings;
+    if (gles.core.glUniform1f) gles.core.glUniform1f = marshal_glUniform1f;
+    if (gles.core.glUniform1fv) gles.core.glUniform1fv = marshal_glUniform1fv;
+    if (gles.core.glUniform1i) gles.core.glUniform1i = marshal_glUniform1i;
+    if (gles.core.glUniform1iv) gles.core.glUniform1iv = marshal_glUniform1iv;
+    if (gles.core.glUniform1ui) gles.core.glUniform1ui = marshal_glUniform1ui;
+    if (gles.core.glUniform1uiv) gles.core.glUniform1uiv = marshal_glUniform1uiv;
+    if (gles.core.glUniform2f) gles.core.glUniform2f = marshal_glUniform2f;
+    if (gles.core.glUniform2fv) gles.core.glUniform2fv = marshal_glUniform2fv;
+    if (gles.core.glUniform2i) gles.core.glUniform2i = marshal_glUniform2i;
+    if (gles.core.glUniform2iv) gles.core.glUniform2iv = marshal_glUniform2iv;
+    if (gles.core.glUniform2ui) gles.core.glUniform2ui = marshal_glUniform2ui;
+    if (gles.core.glUniform2uiv) gles.core.glUniform2uiv = marshal_glUniform2uiv;
+    if (gles.core.glUniform3f) gles.core.glUniform3f = marshal_glUniform3f;
+    if (gles.core.glUniform3fv) gles.core.glUniform3fv = marshal_glUniform3fv;
+    if (gles.core.glUniform3i) gles.core.glUniform3i = marshal_glUniform3i;
+    if (gles.core.glUniform3iv) gles.core.glUniform3iv = marshal_glUniform3iv;
+    if (gles.core.glUniform3ui) gles.core.glUniform3ui = marshal_glUniform3ui;
+    if (gles.core.glUniform3uiv) gles.core.glUniform3uiv = marshal_glUniform3uiv;
+    if (gles.core.glUniform4f) gles.core.glUniform4f = marshal_glUniform4f;
+    if (gles.core.glUniform4fv) gles.core.glUniform4fv = marshal_glUniform4fv;
+    if (gles.core.glUniform4i) gles.core.glUniform4i = marshal_glUniform4i;
+    if (gles.core.glUniform4iv) gles.core.glUniform4iv = marshal_glUniform4iv;
+    if (gles.core.glUniform4ui) gles.core.glUniform4ui = marshal_glUniform4ui;
+    if (gles.core.glUniform4uiv) gles.core.glUniform4uiv = marshal_glUniform4uiv;
+    if (gles.core.glUniformBlockBinding) gles.core.glUniformBlockBinding = marshal_glUniformBlockBinding;
+    if (gles.core.glUniformMatrix2fv) gles.core.glUniformMatrix2fv = marshal_glUniformMatrix2fv;
+    if (gles.core.glUniformMatrix2x3fv) gles.core.glUniformMatrix2x3fv = marshal_glUniformMatrix2x3fv;
+    if (gles.core.glUniformMatrix2x4fv) gles.core.glUniformMatrix2x4fv = marshal_glUniformMatrix2x4fv;
+    if (gles.core.glUniformMatrix3fv) gles.core.glUniformMatrix3fv = marshal_glUniformMatrix3fv;
+    if (gles.core.glUniformMatrix3x2fv) gles.core.glUniformMatrix3x2fv = marshal_glUniformMatrix3x2fv;
+    if (gles.core.glUniformMatrix3x4fv) gles.core.glUniformMatrix3x4fv = marshal_glUniformMatrix3x4fv;
+    if (gles.core.glUniformMatrix4fv) gles.core.glUniformMatrix4fv = marshal_glUniformMatrix4fv;
+    if (gles.core.glUniformMatrix4x2fv) gles.core.glUniformMatrix4x2fv = marshal_glUniformMatrix4x2fv;
+    if (gles.core.glUniformMatrix4x3fv) gles.core.glUniformMatrix4x3fv = marshal_glUniformMatrix4x3fv;
+    if (gles.core.glUnmapBuffer) gles.core.glUnmapBuffer = marshal_glUnmapBuffer;
+    if (gles.core.glUseProgram) gles.core.glUseProgram = marshal_glUseProgram;
+    if (gles.core.glUseProgramStages) gles.core.glUseProgramStages = marshal_glUseProgramStages;
+    if (gles.core.glValidateProgram) gles.core.glValidateProgram = marshal_glValidateProgram;
+    if (gles.core.glValidateProgramPipeline) gles.core.glValidateProgramPipeline = marshal_glValidateProgramPipeline;
+    if (gles.core.glVertexAttrib1f) gles.core.glVertexAttrib1f = marshal_glVertexAttrib1f;
+    if (gles.core.glVertexAttrib1fv) gles.core.glVertexAttrib1fv = marshal_glVertexAttrib1fv;
+    if (gles.core.glVertexAttrib2f) gles.core.glVertexAttrib2f = marshal_glVertexAttrib2f;
+    if (gles.core.glVertexAttrib2fv) gles.core.glVertexAttrib2fv = marshal_glVertexAttrib2fv;
+    if (gles.core.glVertexAttrib3f) gles.core.glVertexAttrib3f = marshal_glVertexAttrib3f;
+    if (gles.core.glVertexAttrib3fv) gles.core.glVertexAttrib3fv = marshal_glVertexAttrib3fv;
+    if (gles.core.glVertexAttrib4f) gles.core.glVertexAttrib4f = marshal_glVertexAttrib4f;
+    if (gles.core.glVertexAttrib4fv) gles.core.glVertexAttrib4fv = marshal_glVertexAttrib4fv;
+    if (gles.core.glVertexAttribBinding) gles.core.glVertexAttribBinding = marshal_glVertexAttribBinding;
+    if (gles.core.glVertexAttribDivisor) gles.core.glVertexAttribDivisor = marshal_glVertexAttribDivisor;
+    if (gles.core.glVertexAttribFormat) gles.core.glVertexAttribFormat = marshal_glVertexAttribFormat;
+    if (gles.core.glVertexAttribI4i) gles.core.glVertexAttribI4i = marshal_glVertexAttribI4i;
+    if (gles.core.glVertexAttribI4iv) gles.core.glVertexAttribI4iv = marshal_glVertexAttribI4iv;
+    if (gles.core.glVertexAttribI4ui) gles.core.glVertexAttribI4ui = marshal_glVertexAttribI4ui;
+    if (gles.core.glVertexAttribI4uiv) gles.core.glVertexAttribI4uiv = marshal_glVertexAttribI4uiv;
+    if (gles.core.glVertexAttribIFormat) gles.core.glVertexAttribIFormat = marshal_glVertexAttribIFormat;
+    if (gles.core.glVertexAttribIPointer) gles.core.glVertexAttribIPointer = marshal_glVertexAttribIPointer;
+    if (gles.core.glVertexAttribPointer) gles.core.glVertexAttribPointer = marshal_glVertexAttribPointer;
+    if (gles.core.glVertexBindingDivisor) gles.core.glVertexBindingDivisor = marshal_glVertexBindingDivisor;
+    if (gles.core.glViewport) gles.core.glViewport = marshal_glViewport;
+    if (gles.core.glWaitSync) gles.core.glWaitSync = marshal_glWaitSync;
+    if (gles.ext.glActiveShaderProgramEXT) gles.ext.glActiveShaderProgramEXT = marshal_glActiveShaderProgramEXT;
+    if (gles.ext.glAlphaFuncQCOM) gles.ext.glAlphaFuncQCOM = marshal_glAlphaFuncQCOM;
+    if (gles.ext.glApplyFramebufferAttachmentCMAAINTEL) gles.ext.glApplyFramebufferAttachmentCMAAINTEL = marshal_glApplyFramebufferAttachmentCMAAINTEL;
+    if (gles.ext.glBeginConditionalRenderNV) gles.ext.glBeginConditionalRenderNV = marshal_glBeginConditionalRenderNV;
+    if (gles.ext.glBeginPerfMonitorAMD) gles.ext.glBeginPerfMonitorAMD = marshal_glBeginPerfMonitorAMD;
+    if (gles.ext.glBeginPerfQueryINTEL) gles.ext.glBeginPerfQueryINTEL = marshal_glBeginPerfQueryINTEL;
+    if (gles.ext.glBeginQueryEXT) gles.ext.glBeginQueryEXT = marshal_glBeginQueryEXT;
+    if (gles.ext.glBindFragDataLocationEXT) gles.ext.glBindFragDataLocationEXT = marshal_glBindFragDataLocationEXT;
+    if (gles.ext.glBindFragDataLocationIndexedEXT) gles.ext.glBindFragDataLocationIndexedEXT = marshal_glBindFragDataLocationIndexedEXT;
+    if (gles.ext.glBindProgramPipelineEXT) gles.ext.glBindProgramPipelineEXT = marshal_glBindProgramPipelineEXT;
+    if (gles.ext.glBindVertexArrayOES) gles.ext.glBindVertexArrayOES = marshal_glBindVertexArrayOES;
+    if (gles.ext.glBlendBarrierKHR) gles.ext.glBlendBarrierKHR = marshal_glBlendBarrierKHR;
+    if (gles.ext.glBlendBarrierNV) gles.ext.glBlendBarrierNV = marshal_glBlendBarrierNV;
+    if (gles.ext.glBlendEquationSeparateiEXT) gles.ext.glBlendEquationSeparateiEXT = marshal_glBlendEquationSeparateiEXT;
+    if (gles.ext.glBlendEquationSeparateiOES) gles.ext.glBlendEquationSeparateiOES = marshal_glBlendEquationSeparateiOES;
+    if (gles.ext.glBlendEquationiEXT) gles.ext.glBlendEquationiEXT = marshal_glBlendEquationiEXT;
+    if (gles.ext.glBlendEquationiOES) gles.ext.glBlendEquationiOES = marshal_glBlendEquationiOES;
+    if (gles.ext.glBlendFuncSeparateiEXT) gles.ext.glBlendFuncSeparateiEXT = marshal_glBlendFuncSeparateiEXT;
+    if (gles.ext.glBlendFuncSeparateiOES) gles.ext.glBlendFuncSeparateiOES = marshal_glBlendFuncSeparateiOES;
+    if (gles.ext.glBlendFunciEXT) gles.ext.glBlendFunciEXT = marshal_glBlendFunciEXT;
+    if (gles.ext.glBlendFunciOES) gles.ext.glBlendFunciOES = marshal_glBlendFunciOES;
+    if (gles.ext.glBlendParameteriNV) gles.ext.glBlendParameteriNV = marshal_glBlendParameteriNV;
+    if (gles.ext.glBlitFramebufferANGLE) gles.ext.glBlitFramebufferANGLE = marshal_glBlitFramebufferANGLE;
+    if (gles.ext.glBlitFramebufferNV) gles.ext.glBlitFramebufferNV = marshal_glBlitFramebufferNV;
+    if (gles.ext.glBufferStorageEXT) gles.ext.glBufferStorageEXT = marshal_glBufferStorageEXT;
+    if (gles.ext.glBufferStorageExternalEXT) gles.ext.glBufferStorageExternalEXT = marshal_glBufferStorageExternalEXT;
+    if (gles.ext.glBufferStorageMemEXT) gles.ext.glBufferStorageMemEXT = marshal_glBufferStorageMemEXT;
+    if (gles.ext.glClearPixelLocalStorageuiEXT) gles.ext.glClearPixelLocalStorageuiEXT = marshal_glClearPixelLocalStorageuiEXT;
+    if (gles.ext.glClearTexImageEXT) gles.ext.glClearTexImageEXT = marshal_glClearTexImageEXT;
+    if (gles.ext.glClearTexSubImageEXT) gles.ext.glClearTexSubImageEXT = marshal_glClearTexSubImageEXT;
+    if (gles.ext.glClientWaitSyncAPPLE) gles.ext.glClientWaitSyncAPPLE = marshal_glClientWaitSyncAPPLE;
+    if (gles.ext.glClipControlEXT) gles.ext.glClipControlEXT = marshal_glClipControlEXT;
+    if (gles.ext.glColorMaskiEXT) gles.ext.glColorMaskiEXT = marshal_glColorMaskiEXT;
+    if (gles.ext.glColorMaskiOES) gles.ext.glColorMaskiOES = marshal_glColorMaskiOES;
+    if (gles.ext.glCompressedTexImage3DOES) gles.ext.glCompressedTexImage3DOES = marshal_glCompressedTexImage3DOES;
+    if (gles.ext.glCompressedTexSubImage3DOES) gles.ext.glCompressedTexSubImage3DOES = marshal_glCompressedTexSubImage3DOES;
+    if (gles.ext.glConservativeRasterParameteriNV) gles.ext.glConservativeRasterParameteriNV = marshal_glConservativeRasterParameteriNV;
+    if (gles.ext.glCopyBufferSubDataNV) gles.ext.glCopyBufferSubDataNV = marshal_glCopyBufferSubDataNV;
+    if (gles.ext.glCopyImageSubDataEXT) gles.ext.glCopyImageSubDataEXT = marshal_glCopyImageSubDataEXT;
+    if (gles.ext.glCopyImageSubDataOES) gles.ext.glCopyImageSubDataOES = marshal_glCopyImageSubDataOES;
+    if (gles.ext.glCopyPathNV) gles.ext.glCopyPathNV = marshal_glCopyPathNV;
+    if (gles.ext.glCopyTexSubImage3DOES) gles.ext.glCopyTexSubImage3DOES = marshal_glCopyTexSubImage3DOES;
+    if (gles.ext.glCopyTextureLevelsAPPLE) gles.ext.glCopyTextureLevelsAPPLE = marshal_glCopyTextureLevelsAPPLE;
+    if (gles.ext.glCoverFillPathInstancedNV) gles.ext.glCoverFillPathInstancedNV = marshal_glCoverFillPathInstancedNV;
+    if (gles.ext.glCoverFillPathNV) gles.ext.glCoverFillPathNV = marshal_glCoverFillPathNV;
+    if (gles.ext.glCoverStrokePathInstancedNV) gles.ext.glCoverStrokePathInstancedNV = marshal_glCoverStrokePathInstancedNV;
+    if (gles.ext.glCoverStrokePathNV) gles.ext.glCoverStrokePathNV = marshal_glCoverStrokePathNV;
+    if (gles.ext.glCoverageMaskNV) gles.ext.glCoverageMaskNV = marshal_glCoverageMaskNV;
+    if (gles.ext.glCoverageModulationNV) gles.ext.glCoverageModulationNV = marshal_glCoverageModulationNV;
+    if (gles.ext.glCoverageModulationTableNV) gles.ext.glCoverageModulationTableNV = marshal_glCoverageModulationTableNV;
+    if (gles.ext.glCoverageOperationNV) gles.ext.glCoverageOperationNV = marshal_glCoverageOperationNV;
+    if (gles.ext.glCreateMemoryObjectsEXT) gles.ext.glCreateMemoryObjectsEXT = marshal_glCreateMemoryObjectsEXT;
+    if (gles.ext.glCreatePerfQueryINTEL) gles.ext.glCreatePerfQueryINTEL = marshal_glCreatePerfQueryINTEL;
+    if (gles.ext.glCreateShaderProgramvEXT) gles.ext.glCreateShaderProgramvEXT = marshal_glCreateShaderProgramvEXT;
+    if (gles.ext.glDebugMessageCallbackKHR) gles.ext.glDebugMessageCallbackKHR = marshal_glDebugMessageCallbackKHR;
+    if (gles.ext.glDebugMessageControlKHR) gles.ext.glDebugMessageControlKHR = marshal_glDebugMessageControlKHR;
+    if (gles.ext.glDebugMessageInsertKHR) gles.ext.glDebugMessageInsertKHR = marshal_glDebugMessageInsertKHR;
+    if (gles.ext.glDeleteFencesNV) gles.ext.glDeleteFencesNV = marshal_glDeleteFencesNV;
+    if (gles.ext.glDeleteMemoryObjectsEXT) gles.ext.glDeleteMemoryObjectsEXT = marshal_glDeleteMemoryObjectsEXT;
+    if (gles.ext.glDeletePathsNV) gles.ext.glDeletePathsNV = marshal_glDeletePathsNV;
+    if (gles.ext.glDeletePerfMonitorsAMD) gles.ext.glDeletePerfMonitorsAMD = marshal_glDeletePerfMonitorsAMD;
+    if (gles.ext.glDeletePerfQueryINTEL) gles.ext.glDeletePerfQueryINTEL = marshal_glDeletePerfQueryINTEL;
+    if (gles.ext.glDeleteProgramPipelinesEXT) gles.ext.glDeleteProgramPipelinesEXT = marshal_glDeleteProgramPipelinesEXT;
+    if (gles.ext.glDeleteQueriesEXT) gles.ext.glDeleteQueriesEXT = marshal_glDeleteQueriesEXT;
+    if (gles.ext.glDeleteSemaphoresEXT) gles.ext.glDeleteSemaphoresEXT = marshal_glDeleteSemaphoresEXT;
+    if (gles.ext.glDeleteSyncAPPLE) gles.ext.glDeleteSyncAPPLE = marshal_glDeleteSyncAPPLE;
+    if (gles.ext.glDeleteVertexArraysOES) gles.ext.glDeleteVertexArraysOES = marshal_glDeleteVertexArraysOES;
+    if (gles.ext.glDepthRangeArrayfvNV) gles.ext.glDepthRangeArrayfvNV = marshal_glDepthRangeArrayfvNV;
+    if (gles.ext.glDepthRangeArrayfvOES) gles.ext.glDepthRangeArrayfvOES = marshal_glDepthRangeArrayfvOES;
+    if (gles.ext.glDepthRangeIndexedfNV) gles.ext.glDepthRangeIndexedfNV = marshal_glDepthRangeIndexedfNV;
+    if (gles.ext.glDepthRangeIndexedfOES) gles.ext.glDepthRangeIndexedfOES = marshal_glDepthRangeIndexedfOES;
+    if (gles.ext.glDisableDriverControlQCOM) gles.ext.glDisableDriverControlQCOM = marshal_glDisableDriverControlQCOM;
+    if (gles.ext.glDisableiEXT) gles.ext.glDisableiEXT = marshal_glDisableiEXT;
+    if (gles.ext.glDisableiNV) gles.ext.glDisableiNV = marshal_glDisableiNV;
+    if (gles.ext.glDisableiOES) gles.ext.glDisableiOES = marshal_glDisableiOES;
+    if (gles.ext.glDiscardFramebufferEXT) gles.ext.glDiscardFramebufferEXT = marshal_glDiscardFramebufferEXT;
+    if (gles.ext.glDrawArraysInstancedANGLE) gles.ext.glDrawArraysInstancedANGLE = marshal_glDrawArraysInstancedANGLE;
+    if (gles.ext.glDrawArraysInstancedBaseInstanceEXT) gles.ext.glDrawArraysInstancedBaseInstanceEXT = marshal_glDrawArraysInstancedBaseInstanceEXT;
+    if (gles.ext.glDrawArraysInstancedEXT) gles.ext.glDrawArraysInstancedEXT = marshal_glDrawArraysInstancedEXT;
+    if (gles.ext.glDrawArraysInstancedNV) gles.ext.glDrawArraysInstancedNV = marshal_glDrawArraysInstancedNV;
+    if (gles.ext.glDrawBuffersEXT) gles.ext.glDrawBuffersEXT = marshal_glDrawBuffersEXT;
+    if (gles.ext.glDrawBuffersIndexedEXT) gles.ext.glDrawBuffersIndexedEXT = marshal_glDrawBuffersIndexedEXT;
+    if (gles.ext.glDrawBuffersNV) gles.ext.glDrawBuffersNV = marshal_glDrawBuffersNV;
+    if (gles.ext.glDrawElementsBaseVertexEXT) gles.ext.glDrawElementsBaseVertexEXT = marshal_glDrawElementsBaseVertexEXT;
+    if (gles.ext.glDrawElementsBaseVertexOES) gles.ext.glDrawElementsBaseVertexOES = marshal_glDrawElementsBaseVertexOES;
+    if (gles.ext.glDrawElementsInstancedANGLE) gles.ext.glDrawElementsInstancedANGLE = marshal_glDrawElementsInstancedANGLE;
+    if (gles.ext.glDrawElementsInstancedBaseInstanceEXT) gles.ext.glDrawElementsInstancedBaseInstanceEXT = marshal_glDrawElementsInstancedBaseInstanceEXT;
+    if (gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT) gles.ext.glDrawElementsInstancedBaseVertexBaseInstanceEXT = marshal_glDrawElementsInstancedBaseVertexBaseInstanceEXT;
+    if (gles.ext.glDrawElementsInstancedBaseVertexEXT) gles.ext.glDrawElementsInstancedBaseVertexEXT = marshal_glDrawElementsInstancedBaseVertexEXT;
+    if (gles.ext.glDrawElementsInstancedBaseVertexOES) gles.ext.glDrawElementsInstancedBaseVertexOES = marshal_glDrawElementsInstancedBaseVertexOES;
+    if (gles.ext.glDrawElementsInstancedEXT) gles.ext.glDrawElementsInstancedEXT = marshal_glDrawElementsInstancedEXT;
+    if (gles.ext.glDrawElementsInstancedNV) gles.ext.glDrawElementsInstancedNV = marshal_glDrawElementsInstancedNV;
+    if (gles.ext.glDrawRangeElementsBaseVertexEXT) gles.ext.glDrawRangeElementsBaseVertexEXT = marshal_glDrawRangeElementsBaseVertexEXT;
+    if (gles.ext.glDrawRangeElementsBaseVertexOES) gles.ext.glDrawRangeElementsBaseVertexOES = marshal_glDrawRangeElementsBaseVertexOES;
+    if (gles.ext.glDrawTransformFeedbackEXT) gles.ext.glDrawTransformFeedbackEXT = marshal_glDrawTransformFeedbackEXT;
+    if (gles.ext.glDrawTransformFeedbackInstancedEXT) gles.ext.glDrawTransformFeedbackInstancedEXT = marshal_glDrawTransformFeedbackInstancedEXT;
+    if (gles.ext.glDrawVkImageNV) gles.ext.glDrawVkImageNV = marshal_glDrawVkImageNV;
+    if (gles.ext.glEGLImageTargetRenderbufferStorageOES) gles.ext.glEGLImageTargetRenderbufferStorageOES = marshal_glEGLImageTargetRenderbufferStorageOES;
+    if (gles.ext.glEGLImageTargetTexStorageEXT) gles.ext.glEGLImageTargetTexStorageEXT = marshal_glEGLImageTargetTexStorageEXT;
+    if (gles.ext.glEGLImageTargetTexture2DOES) gles.ext.glEGLImageTargetTexture2DOES = marshal_glEGLImageTargetTexture2DOES;
+    if (gles.ext.glEGLImageTargetTextureStorageEXT) gles.ext.glEGLImageTargetTextureStorageEXT = marshal_glEGLImageTargetTextureStorageEXT;
+    if (gles.ext.glEnableDriverControlQCOM) gles.ext.glEnableDriverControlQCOM = marshal_glEnableDriverControlQCOM;
+    if (gles.ext.glEnableiEXT) gles.ext.glEnableiEXT = marshal_glEnableiEXT;
+    if (gles.ext.glEnableiNV) gles.ext.glEnableiNV = marshal_glEnableiNV;
+    if (gles.ext.glEnableiOES) gles.ext.glEnableiOES = marshal_glEnableiOES;
+    if (gles.ext.glEndConditionalRenderNV) gles.ext.glEndConditionalRenderNV = marshal_glEndConditionalRenderNV;
+    if (gles.ext.glEndPerfMonitorAMD) gles.ext.glEndPerfMonitorAMD = marshal_glEndPerfMonitorAMD;
+    if (gles.ext.glEndPerfQueryINTEL) gles.ext.glEndPerfQueryINTEL = marshal_glEndPerfQueryINTEL;
+    if (gles.ext.glEndQueryEXT) gles.ext.glEndQueryEXT = marshal_glEndQueryEXT;
+    if (gles.ext.glEndTilingQCOM) gles.ext.glEndTilingQCOM = marshal_glEndTilingQCOM;
+    if (gles.ext.glExtGetBufferPointervQCOM) gles.ext.glExtGetBufferPointervQCOM = marshal_glExtGetBufferPointervQCOM;
+    if (gles.ext.glExtGetBuffersQCOM) gles.ext.glExtGetBuffersQCOM = marshal_glExtGetBuffersQCOM;
+    if (gles.ext.glExtGetFramebuffersQCOM) gles.ext.glExtGetFramebuffersQCOM = marshal_glExtGetFramebuffersQCOM;
+    if (gles.ext.glExtGetProgramBinarySourceQCOM) gles.ext.glExtGetProgramBinarySourceQCOM = marshal_glExtGetProgramBinarySourceQCOM;
+    if (gles.ext.glExtGetProgramsQCOM) gles.ext.glExtGetProgramsQCOM = marshal_glExtGetProgramsQCOM;
+    if (gles.ext.glExtGetRenderbuffersQCOM) gles.ext.glExtGetRenderbuffersQCOM = marshal_glExtGetRenderbuffersQCOM;
+    if (gles.ext.glExtGetShadersQCOM) gles.ext.glExtGetShadersQCOM = marshal_glExtGetShadersQCOM;
+    if (gles.ext.glExtGetTexLevelParameterivQCOM) gles.ext.glExtGetTexLevelParameterivQCOM = marshal_glExtGetTexLevelParameterivQCOM;
+    if (gles.ext.glExtGetTexSubImageQCOM) gles.ext.glExtGetTexSubImageQCOM = marshal_glExtGetTexSubImageQCOM;
+    if (gles.ext.glExtGetTexturesQCOM) gles.ext.glExtGetTexturesQCOM = marshal_glExtGetTexturesQCOM;
+    if (gles.ext.glExtIsProgramBinaryQCOM) gles.ext.glExtIsProgramBinaryQCOM = marshal_glExtIsProgramBinaryQCOM;
+    if (gles.ext.glExtTexObjectStateOverrideiQCOM) gles.ext.glExtTexObjectStateOverrideiQCOM = marshal_glExtTexObjectStateOverrideiQCOM;
+    if (gles.ext.glFenceSyncAPPLE) gles.ext.glFenceSyncAPPLE = marshal_glFenceSyncAPPLE;
+    if (gles.ext.glFinishFenceNV) gles.ext.glFinishFenceNV = marshal_glFinishFenceNV;
+    if (gles.ext.glFlushMappedBufferRangeEXT) gles.ext.glFlushMappedBufferRangeEXT = marshal_glFlushMappedBufferRangeEXT;
+    if (gles.ext.glFragmentCoverageColorNV) gles.ext.glFragmentCoverageColorNV = marshal_glFragmentCoverageColorNV;
+    if (gles.ext.glFramebufferFetchBarrierEXT) gles.ext.glFramebufferFetchBarrierEXT = marshal_glFramebufferFetchBarrierEXT;
+    if (gles.ext.glFramebufferFetchBarrierQCOM) gles.ext.glFramebufferFetchBarrierQCOM = marshal_glFramebufferFetchBarrierQCOM;
+    if (gles.ext.glFramebufferFoveationConfigQCOM) gles.ext.glFramebufferFoveationConfigQCOM = marshal_glFramebufferFoveationConfigQCOM;
+    if (gles.ext.glFramebufferFoveationParametersQCOM) gles.ext.glFramebufferFoveationParametersQCOM = marshal_glFramebufferFoveationParametersQCOM;
+    if (gles.ext.glFramebufferPixelLocalStorageSizeEXT) gles.ext.glFramebufferPixelLocalStorageSizeEXT = marshal_glFramebufferPixelLocalStorageSizeEXT;
+    if (gles.ext.glFramebufferSampleLocationsfvNV) gles.ext.glFramebufferSampleLocationsfvNV = marshal_glFramebufferSampleLocationsfvNV;
+    if (gles.ext.glFramebufferTexture2DDownsampleIMG) gles.ext.glFramebufferTexture2DDownsampleIMG = marshal_glFramebufferTexture2DDownsampleIMG;
+    if (gles.ext.glFramebufferTexture2DMultisampleEXT) gles.ext.glFramebufferTexture2DMultisampleEXT = marshal_glFramebufferTexture2DMultisampleEXT;
+    if (gles.ext.glFramebufferTexture2DMultisampleIMG) gles.ext.glFramebufferTexture2DMultisampleIMG = marshal_glFramebufferTexture2DMultisampleIMG;
+    if (gles.ext.glFramebufferTexture3DOES) gles.ext.glFramebufferTexture3DOES = marshal_glFramebufferTexture3DOES;
+    if (gles.ext.glFramebufferTextureEXT) gles.ext.glFramebufferTextureEXT = marshal_glFramebufferTextureEXT;
+    if (gles.ext.glFramebufferTextureLayerDownsampleIMG) gles.ext.glFramebufferTextureLayerDownsampleIMG = marshal_glFramebufferTextureLayerDownsampleIMG;
+    if (gles.ext.glFramebufferTextureMultisampleMultiviewOVR) gles.ext.glFramebufferTextureMultisampleMultiviewOVR = marshal_glFramebufferTextureMultisampleMultiviewOVR;
+    if (gles.ext.glFramebufferTextureMultiviewOVR) gles.ext.glFramebufferTextureMultiviewOVR = marshal_glFramebufferTextureMultiviewOVR;
+    if (gles.ext.glFramebufferTextureOES) gles.ext.glFramebufferTextureOES = marshal_glFramebufferTextureOES;
+    if (gles.ext.glGenFencesNV) gles.ext.glGenFencesNV = marshal_glGenFencesNV;
+    if (gles.ext.glGenPathsNV) gles.ext.glGenPathsNV = marshal_glGenPathsNV;
+    if (gles.ext.glGenPerfMonitorsAMD) gles.ext.glGenPerfMonitorsAMD = marshal_glGenPerfMonitorsAMD;
+    if (gles.ext.glGenProgramPipelinesEXT) gles.ext.glGenProgramPipelinesEXT = marshal_glGenProgramPipelinesEXT;
+    if (gles.ext.glGenQueriesEXT) gles.ext.glGenQueriesEXT = marshal_glGenQueriesEXT;
+    if (gles.ext.glGenSemaphoresEXT) gles.ext.glGenSemaphoresEXT = marshal_glGenSemaphoresEXT;
+    if (gles.ext.glGenVertexArraysOES) gles.ext.glGenVertexArraysOES = marshal_glGenVertexArraysOES;
+    if (gles.ext.glGetBufferPointervOES) gles.ext.glGetBufferPointervOES = marshal_glGetBufferPointervOES;
+    if (gles.ext.glGetCoverageModulationTableNV) gles.ext.glGetCoverageModulationTableNV = marshal_glGetCoverageModulationTableNV;
+    if (gles.ext.glGetDebugMessageLogKHR) gles.ext.glGetDebugMessageLogKHR = marshal_glGetDebugMessageLogKHR;
+    if (gles.ext.glGetDriverControlStringQCOM) gles.ext.glGetDriverControlStringQCOM = marshal_glGetDriverControlStringQCOM;
+    if (gles.ext.glGetDriverControlsQCOM) gles.ext.glGetDriverControlsQCOM = marshal_glGetDriverControlsQCOM;
+    if (gles.ext.glGetFenceivNV) gles.ext.glGetFenceivNV = marshal_glGetFenceivNV;
+    if (gles.ext.glGetFirstPerfQueryIdINTEL) gles.ext.glGetFirstPerfQueryIdINTEL = marshal_glGetFirstPerfQueryIdINTEL;
+    if (gles.ext.glGetFloati_vNV) gles.ext.glGetFloati_vNV = marshal_glGetFloati_vNV;
+    if (gles.ext.glGetFloati_vOES) gles.ext.glGetFloati_vOES = marshal_glGetFloati_vOES;
+    if (gles.ext.glGetFragDataIndexEXT) gles.ext.glGetFragDataIndexEXT = marshal_glGetFragDataIndexEXT;
+    if (gles.ext.glGetFramebufferPixelLocalStorageSizeEXT) gles.ext.glGetFramebufferPixelLocalStorageSizeEXT = marshal_glGetFramebufferPixelLocalStorageSizeEXT;
+    if (gles.ext.glGetGraphicsResetStatusEXT) gles.ext.glGetGraphicsResetStatusEXT = marshal_glGetGraphicsResetStatusEXT;
+    if (gles.ext.glGetGraphicsResetStatusKHR) gles.ext.glGetGraphicsResetStatusKHR = marshal_glGetGraphicsResetStatusKHR;
+    if (gles.ext.glGetImageHandleNV) gles.ext.glGetImageHandleNV = marshal_glGetImageHandleNV;
+    if (gles.ext.glGetInteger64vAPPLE) gles.ext.glGetInteger64vAPPLE = marshal_glGetInteger64vAPPLE;
+    if (gles.ext.glGetIntegeri_vEXT) gles.ext.glGetIntegeri_vEXT = marshal_glGetIntegeri_vEXT;
+    if (gles.ext.glGetInternalformatSampleivNV) gles.ext.glGetInternalformatSampleivNV = marshal_glGetInternalformatSampleivNV;
+    if (gles.ext.glGetMemoryObjectParameterivEXT) gles.ext.glGetMemoryObjectParameterivEXT = marshal_glGetMemoryObjectParameterivEXT;
+    if (gles.ext.glGetNextPerfQueryIdINTEL) gles.ext.glGetNextPerfQueryIdINTEL = marshal_glGetNextPerfQueryIdINTEL;
+    if (gles.ext.glGetObjectLabelEXT) gles.ext.glGetObjectLabelEXT = marshal_glGetObjectLabelEXT;
+    if (gles.ext.glGetObjectLabelKHR) gles.ext.glGetObjectLabelKHR = marshal_glGetObjectLabelKHR;
+    if (gles.ext.glGetObjectPtrLabelKHR) gles.ext.glGetObjectPtrLabelKHR = marshal_glGetObjectPtrLabelKHR;
+    if (gles.ext.glGetPathCommandsNV) gles.ext.glGetPathCommandsNV = marshal_glGetPathCommandsNV;
+    if (gles.ext.glGetPathCoordsNV) gles.ext.glGetPathCoordsNV = marshal_glGetPathCoordsNV;
+    if (gles.ext.glGetPathDashArrayNV) gles.ext.glGetPathDashArrayNV = marshal_glGetPathDashArrayNV;
+    if (gles.ext.glGetPathLengthNV) gles.ext.glGetPathLengthNV = marshal_glGetPathLengthNV;
+    if (gles.ext.glGetPathMetricRangeNV) gles.ext.glGetPathMetricRangeNV = marshal_glGetPathMetricRangeNV;
+    if (gles.ext.glGetPathMetricsNV) gles.ext.glGetPathMetricsNV = marshal_glGetPathMetricsNV;
+    if (gles.ext.glGetPathParameterfvNV) gles.ext.glGetPathParameterfvNV = marshal_glGetPathParameterfvNV;
+    if (gles.ext.glGetPathParameterivNV) gles.ext.glGetPathParameterivNV = marshal_glGetPathParameterivNV;
+    if (gles.ext.glGetPathSpacingNV) gles.ext.glGetPathSpacingNV = marshal_glGetPathSpacingNV;
+    if (gles.ext.glGetPerfCounterInfoINTEL) gles.ext.glGetPerfCounterInfoINTEL = marshal_glGetPerfCounterInfoINTEL;
+    if (gles.ext.glGetPerfMonitorCounterDataAMD) gles.ext.glGetPerfMonitorCounterDataAMD = marshal_glGetPerfMonitorCounterDataAMD;
+    if (gles.ext.glGetPerfMonitorCounterInfoAMD) gles.ext.glGetPerfMonitorCounterInfoAMD = marshal_glGetPerfMonitorCounterInfoAMD;
+    if (gles.ext.glGetPerfMonitorCounterStringAMD) gles.ext.glGetPerfMonitorCounterStringAMD = marshal_glGetPerfMonitorCounterStringAMD;
+    if (gles.ext.glGetPerfMonitorCountersAMD) gles.ext.glGetPerfMonitorCountersAMD = marshal_glGetPerfMonitorCountersAMD;
+    if (gles.ext.glGetPerfMonitorGroupStringAMD) gles.ext.glGetPerfMonitorGroupStringAMD = marshal_glGetPerfMonitorGroupStringAMD;
+    if (gles.ext.glGetPerfMonitorGroupsAMD) gles.ext.glGetPerfMonitorGroupsAMD = marshal_glGetPerfMonitorGroupsAMD;
+    if (gles.ext.glGetPerfQueryDataINTEL) gles.ext.glGetPerfQueryDataINTEL = marshal_glGetPerfQueryDataINTEL;
+    if (gles.ext.glGetPerfQueryIdByNameINTEL) gles.ext.glGetPerfQueryIdByNameINTEL = marshal_glGetPerfQueryIdByNameINTEL;
+    if (gles.ext.glGetPerfQueryInfoINTEL) gles.ext.glGetPerfQueryInfoINTEL = marshal_glGetPerfQueryInfoINTEL;
+    if (gles.ext.glGetPointervKHR) gles.ext.glGetPointervKHR = marshal_glGetPointervKHR;
+    if (gles.ext.glGetProgramBinaryOES) gles.ext.glGetProgramBinaryOES = marshal_glGetProgramBinaryOES;
+    if (gles.ext.glGetProgramPipelineInfoLogEXT) gles.ext.glGetProgramPipelineInfoLogEXT = marshal_glGetProgramPipelineInfoLogEXT;
+    if (gles.ext.glGetProgramPipelineivEXT) gles.ext.glGetProgramPipelineivEXT = marshal_glGetProgramPipelineivEXT;
+    if (gles.ext.glGetProgramResourceLocationIndexEXT) gles.ext.glGetProgramResourceLocationIndexEXT = marshal_glGetProgramResourceLocationIndexEXT;
+    if (gles.ext.glGetProgramResourcefvNV) gles.ext.glGetProgramResourcefvNV = marshal_glGetProgramResourcefvNV;
+    if (gles.ext.glGetQueryObjecti64vEXT) gles.ext.glGetQueryObjecti64vEXT = marshal_glGetQueryObjecti64vEXT;
+    if (gles.ext.glGetQueryObjectivEXT) gles.ext.glGetQueryObjectivEXT = marshal_glGetQueryObjectivEXT;
+    if (gles.ext.glGetQueryObjectui64vEXT) gles.ext.glGetQueryObjectui64vEXT = marshal_glGetQueryObjectui64vEXT;
+    if (gles.ext.glGetQueryObjectuivEXT) gles.ext.glGetQueryObjectuivEXT = marshal_glGetQueryObjectuivEXT;
+    if (gles.ext.glGetQueryivEXT) gles.ext.glGetQueryivEXT = marshal_glGetQueryivEXT;
+    if (gles.ext.glGetSamplerParameterIivEXT) gles.ext.glGetSamplerParameterIivEXT = marshal_glGetSamplerParameterIivEXT;
+    if (gles.ext.glGetSamplerParameterIivOES) gles.ext.glGetSamplerParameterIivOES = marshal_glGetSamplerParameterIivOES;
+    if (gles.ext.glGetSamplerParameterIuivEXT) gles.ext.glGetSamplerParameterIuivEXT = marshal_glGetSamplerParameterIuivEXT;
+    if (gles.ext.glGetSamplerParameterIuivOES) gles.ext.glGetSamplerParameterIuivOES = marshal_glGetSamplerParameterIuivOES;
+    if (gles.ext.glGetSemaphoreParameterui64vEXT) gles.ext.glGetSemaphoreParameterui64vEXT = marshal_glGetSemaphoreParameterui64vEXT;
+    if (gles.ext.glGetSyncivAPPLE) gles.ext.glGetSyncivAPPLE = marshal_glGetSyncivAPPLE;
+    if (gles.ext.glGetTexParameterIivEXT) gles.ext.glGetTexParameterIivEXT = marshal_glGetTexParameterIivEXT;
+    if (gles.ext.glGetTexParameterIivOES) gles.ext.glGetTexParameterIivOES = marshal_glGetTexParameterIivOES;
+    if (gles.ext.glGetTexParameterIuivEXT) gles.ext.glGetTexParameterIuivEXT = marshal_glGetTexParameterIuivEXT;
+    if (gles.ext.glGetTexParameterIuivOES) gles.ext.glGetTexParameterIuivOES = marshal_glGetTexParameterIuivOES;
+    if (gles.ext.glGetTextureHandleIMG) gles.ext.glGetTextureHandleIMG = marshal_glGetTextureHandleIMG;
+    if (gles.ext.glGetTextureHandleNV) gles.ext.glGetTextureHandleNV = marshal_glGetTextureHandleNV;
+    if (gles.ext.glGetTextureSamplerHandleIMG) gles.ext.glGetTextureSamplerHandleIMG = marshal_glGetTextureSamplerHandleIMG;
+    if (gles.ext.glGetTextureSamplerHandleNV) gles.ext.glGetTextureSamplerHandleNV = marshal_glGetTextureSamplerHandleNV;
+    if (gles.ext.glGetTranslatedShaderSourceANGLE) gles.ext.glGetTranslatedShaderSourceANGLE = marshal_glGetTranslatedShaderSourceANGLE;
+    if (gles.ext.glGetUniformi64vNV) gles.ext.glGetUniformi64vNV = marshal_glGetUniformi64vNV;
+    if (gles.ext.glGetUnsignedBytei_vEXT) gles.ext.glGetUnsignedBytei_vEXT = marshal_glGetUnsignedBytei_vEXT;
+    if (gles.ext.glGetUnsignedBytevEXT) gles.ext.glGetUnsignedBytevEXT = marshal_glGetUnsignedBytevEXT;
+    if (gles.ext.glGetVkProcAddrNV) gles.ext.glGetVkProcAddrNV = marshal_glGetVkProcAddrNV;
+    if (gles.ext.glGetnUniformfvEXT) gles.ext.glGetnUniformfvEXT = marshal_glGetnUniformfvEXT;
+    if (gles.ext.glGetnUniformfvKHR) gles.ext.glGetnUniformfvKHR = marshal_glGetnUniformfvKHR;
+    if (gles.ext.glGetnUniformivEXT) gles.ext.glGetnUniformivEXT = marshal_glGetnUniformivEXT;
+    if (gles.ext.glGetnUniformivKHR) gles.ext.glGetnUniformivKHR = marshal_glGetnUniformivKHR;
+    if (gles.ext.glGetnUniformuivKHR) gles.ext.glGetnUniformuivKHR = marshal_glGetnUniformuivKHR;
+    if (gles.ext.glImportMemoryFdEXT) gles.ext.glImportMemoryFdEXT = marshal_glImportMemoryFdEXT;
+    if (gles.ext.glImportSemaphoreFdEXT) gles.ext.glImportSemaphoreFdEXT = marshal_glImportSemaphoreFdEXT;
+    if (gles.ext.glInsertEventMarkerEXT) gles.ext.glInsertEventMarkerEXT = marshal_glInsertEventMarkerEXT;
+    if (gles.ext.glInterpolatePathsNV) gles.ext.glInterpolatePathsNV = marshal_glInterpolatePathsNV;
+    if (gles.ext.glIsEnablediEXT) gles.ext.glIsEnablediEXT = marshal_glIsEnablediEXT;
+    if (gles.ext.glIsEnablediNV) gles.ext.glIsEnablediNV = marshal_glIsEnablediNV;
+    if (gles.ext.glIsEnablediOES) gles.ext.glIsEnablediOES = marshal_glIsEnablediOES;
+    if (gles.ext.glIsFenceNV) gles.ext.glIsFenceNV = marshal_glIsFenceNV;
+    if (gles.ext.glIsImageHandleResidentNV) gles.ext.glIsImageHandleResidentNV = marshal_glIsImageHandleResidentNV;
+    if (gles.ext.glIsMemoryObjectEXT) gles.ext.glIsMemoryObjectEXT = marshal_glIsMemoryObjectEXT;
+    if (gles.ext.glIsPathNV) gles.ext.glIsPathNV = marshal_glIsPathNV;
+    if (gles.ext.glIsPointInFillPathNV) gles.ext.glIsPointInFillPathNV = marshal_glIsPointInFillPathNV;
+    if (gles.ext.glIsPointInStrokePathNV) gles.ext.glIsPointInStrokePathNV = marshal_glIsPointInStrokePathNV;
+    if (gles.ext.glIsProgramPipelineEXT) gles.ext.glIsProgramPipelineEXT = marshal_glIsProgramPipelineEXT;
+    if (gles.ext.glIsQueryEXT) gles.ext.glIsQueryEXT = marshal_glIsQueryEXT;
+    if (gles.ext.glIsSemaphoreEXT) gles.ext.glIsSemaphoreEXT = marshal_glIsSemaphoreEXT;
+    if (gles.ext.glIsSyncAPPLE) gles.ext.glIsSyncAPPLE = marshal_glIsSyncAPPLE;
+    if (gles.ext.glIsTextureHandleResidentNV) gles.ext.glIsTextureHandleResidentNV = marshal_glIsTextureHandleResidentNV;
+    if (gles.ext.glIsVertexArrayOES) gles.ext.glIsVertexArrayOES = marshal_glIsVertexArrayOES;
+    if (gles.ext.glLabelObjectEXT) gles.ext.glLabelObjectEXT = marshal_glLabelObjectEXT;
+    if (gles.ext.glMakeImageHandleNonResidentNV) gles.ext.glMakeImageHandleNonResidentNV = marshal_glMakeImageHandleNonResidentNV;
+    if (gles.ext.glMakeImageHandleResidentNV) gles.ext.glMakeImageHandleResidentNV = marshal_glMakeImageHandleResidentNV;
+    if (gles.ext.glMakeTextureHandleNonResidentNV) gles.ext.glMakeTextureHandleNonResidentNV = marshal_glMakeTextureHandleNonResidentNV;
+    if (gles.ext.glMakeTextureHandleResidentNV) gles.ext.glMakeTextureHandleResidentNV = marshal_glMakeTextureHandleResidentNV;
+    if (gles.ext.glMapBufferOES) gles.ext.glMapBufferOES = marshal_glMapBufferOES;
+    if (gles.ext.glMapBufferRangeEXT) gles.ext.glMapBufferRangeEXT = marshal_glMapBufferRangeEXT;
+    if (gles.ext.glMatrixFrustumEXT) gles.ext.glMatrixFrustumEXT = marshal_glMatrixFrustumEXT;
+    if (gles.ext.glMatrixLoad3x2fNV) gles.ext.glMatrixLoad3x2fNV = marshal_glMatrixLoad3x2fNV;
+    if (gles.ext.glMatrixLoad3x3fNV) gles.ext.glMatrixLoad3x3fNV = marshal_glMatrixLoad3x3fNV;
+    if (gles.ext.glMatrixLoadIdentityEXT) gles.ext.glMatrixLoadIdentityEXT = marshal_glMatrixLoadIdentityEXT;
+    if (gles.ext.glMatrixLoadTranspose3x3fNV) gles.ext.glMatrixLoadTranspose3x3fNV = marshal_glMatrixLoadTranspose3x3fNV;
+    if (gles.ext.glMatrixLoadTransposedEXT) gles.ext.glMatrixLoadTransposedEXT = marshal_glMatrixLoadTransposedEXT;
+    if (gles.ext.glMatrixLoadTransposefEXT) gles.ext.glMatrixLoadTransposefEXT = marshal_glMatrixLoadTransposefEXT;
+    if (gles.ext.glMatrixLoaddEXT) gles.ext.glMatrixLoaddEXT = marshal_glMatrixLoaddEXT;
+    if (gles.ext.glMatrixLoadfEXT) gles.ext.glMatrixLoadfEXT = marshal_glMatrixLoadfEXT;
+    if (gles.ext.glMatrixMult3x2fNV) gles.ext.glMatrixMult3x2fNV = marshal_glMatrixMult3x2fNV;
+    if (gles.ext.glMatrixMult3x3fNV) gles.ext.glMatrixMult3x3fNV = marshal_glMatrixMult3x3fNV;
+    if (gles.ext.glMatrixMultTranspose3x3fNV) gles.ext.glMatrixMultTranspose3x3fNV = marshal_glMatrixMultTranspose3x3fNV;
+    if (gles.ext.glMatrixMultTransposedEXT) gles.ext.glMatrixMultTransposedEXT = marshal_glMatrixMultTransposedEXT;
+    if (gles.ext.glMatrixMultTransposefEXT) gles.ext.glMatrixMultTransposefEXT = marshal_glMatrixMultTransposefEXT;
+    if (gles.ext.glMatrixMultdEXT) gles.ext.glMatrixMultdEXT = marshal_glMatrixMultdEXT;
+    if (gles.ext.glMatrixMultfEXT) gles.ext.glMatrixMultfEXT = marshal_glMatrixMultfEXT;
+    if (gles.ext.glMatrixOrthoEXT) gles.ext.glMatrixOrthoEXT = marshal_glMatrixOrthoEXT;
+    if (gles.ext.glMatrixPopEXT) gles.ext.glMatrixPopEXT = marshal_glMatrixPopEXT;
+    if (gles.ext.glMatrixPushEXT) gles.ext.glMatrixPushEXT = marshal_glMatrixPushEXT;
+    if (gles.ext.glMatrixRotatedEXT) gles.ext.glMatrixRotatedEXT = marshal_glMatrixRotatedEXT;
+    if (gles.ext.glMatrixRotatefEXT) gles.ext.glMatrixRotatefEXT = marshal_glMatrixRotatefEXT;
+    if (gles.ext.glMatrixScaledEXT) gles.ext.glMatrixScaledEXT = marshal_glMatrixScaledEXT;
+    if (gles.ext.glMatrixScalefEXT) gles.ext.glMatrixScalefEXT = marshal_glMatrixScalefEXT;
+    if (gles.ext.glMatrixTranslatedEXT) gles.ext.glMatrixTranslatedEXT = marshal_glMatrixTranslatedEXT;
+    if (gles.ext.glMatrixTranslatefEXT) gles.ext.glMatrixTranslatefEXT = marshal_glMatrixTranslatefEXT;
+    if (gles.ext.glMaxShaderCompilerThreadsKHR) gles.ext.glMaxShaderCompilerThreadsKHR = marshal_glMaxShaderCompilerThreadsKHR;
+    if (gles.ext.glMemoryObjectParameterivEXT) gles.ext.glMemoryObjectParameterivEXT = marshal_glMemoryObjectParameterivEXT;
+    if (gles.ext.glMinSampleShadingOES) gles.ext.glMinSampleShadingOES = marshal_glMinSampleShadingOES;
+    if (gles.ext.glMultiDrawArraysEXT) gles.ext.glMultiDrawArraysEXT = marshal_glMultiDrawArraysEXT;
+    if (gles.ext.glMultiDrawArraysIndirectEXT) gles.ext.glMultiDrawArraysIndirectEXT = marshal_glMultiDrawArraysIndirectEXT;
+    if (gles.ext.glMultiDrawElementsBaseVertexEXT) gles.ext.glMultiDrawElementsBaseVertexEXT = marshal_glMultiDrawElementsBaseVertexEXT;
+    if (gles.ext.glMultiDrawElementsEXT) gles.ext.glMultiDrawElementsEXT = marshal_glMultiDrawElementsEXT;
+    if (gles.ext.glMultiDrawElementsIndirectEXT) gles.ext.glMultiDrawElementsIndirectEXT = marshal_glMultiDrawElementsIndirectEXT;
+    if (gles.ext.glNamedBufferStorageExternalEXT) gles.ext.glNamedBufferStorageExternalEXT = marshal_glNamedBufferStorageExternalEXT;
+    if (gles.ext.glNamedBufferStorageMemEXT) gles.ext.glNamedBufferStorageMemEXT = marshal_glNamedBufferStorageMemEXT;
+    if (gles.ext.glNamedFramebufferSampleLocationsfvNV) gles.ext.glNamedFramebufferSampleLocationsfvNV = marshal_glNamedFramebufferSampleLocationsfvNV;
+    if (gles.ext.glObjectLabelKHR) gles.ext.glObjectLabelKHR = marshal_glObjectLabelKHR;
+    if (gles.ext.glObjectPtrLabelKHR) gles.ext.glObjectPtrLabelKHR = marshal_glObjectPtrLabelKHR;
+    if (gles.ext.glPatchParameteriEXT) gles.ext.glPatchParameteriEXT = marshal_glPatchParameteriEXT;
+    if (gles.ext.glPatchParameteriOES) gles.ext.glPatchParameteriOES = marshal_glPatchParameteriOES;
+    if (gles.ext.glPathCommandsNV) gles.ext.glPathCommandsNV = marshal_glPathCommandsNV;
+    if (gles.ext.glPathCoordsNV) gles.ext.glPathCoordsNV = marshal_glPathCoordsNV;
+    if (gles.ext.glPathCoverDepthFuncNV) gles.ext.glPathCoverDepthFuncNV = marshal_glPathCoverDepthFuncNV;
+    if (gles.ext.glPathDashArrayNV) gles.ext.glPathDashArrayNV = marshal_glPathDashArrayNV;
+    if (gles.ext.glPathGlyphIndexArrayNV) gles.ext.glPathGlyphIndexArrayNV = marshal_glPathGlyphIndexArrayNV;
+    if (gles.ext.glPathGlyphIndexRangeNV) gles.ext.glPathGlyphIndexRangeNV = marshal_glPathGlyphIndexRangeNV;
+    if (gles.ext.glPathGlyphRangeNV) gles.ext.glPathGlyphRangeNV = marshal_glPathGlyphRangeNV;
+    if (gles.ext.glPathGlyphsNV) gles.ext.glPathGlyphsNV = marshal_glPathGlyphsNV;
+    if (gles.ext.glPathMemoryGlyphIndexArrayNV) gles.ext.glPathMemoryGlyphIndexArrayNV = marshal_glPathMemoryGlyphIndexArrayNV;
+    if (gles.ext.glPathParameterfNV) gles.ext.glPathParameterfNV = marshal_glPathParameterfNV;
+    if (gles.ext.glPathParameterfvNV) gles.ext.glPathParameterfvNV = marshal_glPathParameterfvNV;
+    if (gles.ext.glPathParameteriNV) gles.ext.glPathParameteriNV = marshal_glPathParameteriNV;
+    if (gles.ext.glPathParameterivNV) gles.ext.glPathParameterivNV = marshal_glPathParameterivNV;
+    if (gles.ext.glPathStencilDepthOffsetNV) gles.ext.glPathStencilDepthOffsetNV = marshal_glPathStencilDepthOffsetNV;
+    if (gles.ext.glPathStencilFuncNV) gles.ext.glPathStencilFuncNV = marshal_glPathStencilFuncNV;
+    if (gles.ext.glPathStringNV) gles.ext.glPathStringNV = marshal_glPathStringNV;
+    if (gles.ext.glPathSubCommandsNV) gles.ext.glPathSubCommandsNV = marshal_glPathSubCommandsNV;
+    if (gles.ext.glPathSubCoordsNV) gles.ext.glPathSubCoordsNV = marshal_glPathSubCoordsNV;
+    if (gles.ext.glPointAlongPathNV) gles.ext.glPointAlongPathNV = marshal_glPointAlongPathNV;
+    if (gles.ext.glPolygonModeNV) gles.ext.glPolygonModeNV = marshal_glPolygonModeNV;
+    if (gles.ext.glPolygonOffsetClampEXT) gles.ext.glPolygonOffsetClampEXT = marshal_glPolygonOffsetClampEXT;
+    if (gles.ext.glPopDebugGroupKHR) gles.ext.glPopDebugGroupKHR = marshal_glPopDebugGroupKHR;
+    if (gles.ext.glPopGroupMarkerEXT) gles.ext.glPopGroupMarkerEXT = marshal_glPopGroupMarkerEXT;
+    if (gles.ext.glPrimitiveBoundingBoxEXT) gles.ext.glPrimitiveBoundingBoxEXT = marshal_glPrimitiveBoundingBoxEXT;
+    if (gles.ext.glPrimitiveBoundingBoxOES) gles.ext.glPrimitiveBoundingBoxOES = marshal_glPrimitiveBoundingBoxOES;
+    if (gles.ext.glProgramBinaryOES) gles.ext.glProgramBinaryOES = marshal_glProgramBinaryOES;
+    if (gles.ext.glProgramParameteriEXT) gles.ext.glProgramParameteriEXT = marshal_glProgramParameteriEXT;
+    if (gles.ext.glProgramPathFragmentInputGenNV) gles.ext.glProgramPathFragmentInputGenNV = marshal_glProgramPathFragmentInputGenNV;
+    if (gles.ext.glProgramUniform1fEXT) gles.ext.glProgramUniform1fEXT = marshal_glProgramUniform1fEXT;
+    if (gles.ext.glProgramUniform1fvEXT) gles.ext.glProgramUniform1fvEXT = marshal_glProgramUniform1fvEXT;
+    if (gles.ext.glProgramUniform1i64NV) gles.ext.glProgramUniform1i64NV = marshal_glProgramUniform1i64NV;
+    if (gles.ext.glProgramUniform1i64vNV) gles.ext.glProgramUniform1i64vNV = marshal_glProgramUniform1i64vNV;
+    if (gles.ext.glProgramUniform1iEXT) gles.ext.glProgramUniform1iEXT = marshal_glProgramUniform1iEXT;
+    if (gles.ext.glProgramUniform1ivEXT) gles.ext.glProgramUniform1ivEXT = marshal_glProgramUniform1ivEXT;
+    if (gles.ext.glProgramUniform1ui64NV) gles.ext.glProgramUniform1ui64NV = marshal_glProgramUniform1ui64NV;
+    if (gles.ext.glProgramUniform1ui64vNV) gles.ext.glProgramUniform1ui64vNV = marshal_glProgramUniform1ui64vNV;
+    if (gles.ext.glProgramUniform1uiEXT) gles.ext.glProgramUniform1uiEXT = marshal_glProgramUniform1uiEXT;
+    if (gles.ext.glProgramUniform1uivEXT) gles.ext.glProgramUniform1uivEXT = marshal_glProgramUniform1uivEXT;
+    if (gles.ext.glProgramUniform2fEXT) gles.ext.glProgramUniform2fEXT = marshal_glProgramUniform2fEXT;
+    if (gles.ext.glProgramUniform2fvEXT) gles.ext.glProgramUniform2fvEXT = marshal_glProgramUniform2fvEXT;
+    if (gles.ext.glProgramUniform2i64NV) gles.ext.glProgramUniform2i64NV = marshal_glProgramUniform2i64NV;
+    if (gles.ext.glProgramUniform2i64vNV) gles.ext.glProgramUniform2i64vNV = marshal_glProgramUniform2i64vNV;
+    if (gles.ext.glProgramUniform2iEXT) gles.ext.glProgramUniform2iEXT = marshal_glProgramUniform2iEXT;
+    if (gles.ext.glProgramUniform2ivEXT) gles.ext.glProgramUniform2ivEXT = marshal_glProgramUniform2ivEXT;
+    if (gles.ext.glProgramUniform2ui64NV) gles.ext.glProgramUniform2ui64NV = marshal_glProgramUniform2ui64NV;
+    if (gles.ext.glProgramUniform2ui64vNV) gles.ext.glProgramUniform2ui64vNV = marshal_glProgramUniform2ui64vNV;
+    if (gles.ext.glProgramUniform2uiEXT) gles.ext.glProgramUniform2uiEXT = marshal_glProgramUniform2uiEXT;
+    if (gles.ext.glProgramUniform2uivEXT) gles.ext.glProgramUniform2uivEXT = marshal_glProgramUniform2uivEXT;
+    if (gles.ext.glProgramUniform3fEXT) gles.ext.glProgramUniform3fEXT = marshal_glProgramUniform3fEXT;
+    if (gles.ext.glProgramUniform3fvEXT) gles.ext.glProgramUniform3fvEXT = marshal_glProgramUniform3fvEXT;
+    if (gles.ext.glProgramUniform3i64NV) gles.ext.glProgramUniform3i64NV = marshal_glProgramUniform3i64NV;
+    if (gles.ext.glProgramUniform3i64vNV) gles.ext.glProgramUniform3i64vNV = marshal_glProgramUniform3i64vNV;
+    if (gles.ext.glProgramUniform3iEXT) gles.ext.glProgramUniform3iEXT = marshal_glProgramUniform3iEXT;
+    if (gles.ext.glProgramUniform3ivEXT) gles.ext.glProgramUniform3ivEXT = marshal_glProgramUniform3ivEXT;
+    if (gles.ext.glProgramUniform3ui64NV) gles.ext.glProgramUniform3ui64NV = marshal_glProgramUniform3ui64NV;
+    if (gles.ext.glProgramUniform3ui64vNV) gles.ext.glProgramUniform3ui64vNV = marshal_glProgramUniform3ui64vNV;
+    if (gles.ext.glProgramUniform3uiEXT) gles.ext.glProgramUniform3uiEXT = marshal_glProgramUniform3uiEXT;
+    if (gles.ext.glProgramUniform3uivEXT) gles.ext.glProgramUniform3uivEXT = marshal_glProgramUniform3uivEXT;
+    if (gles.ext.glProgramUniform4fEXT) gles.ext.glProgramUniform4fEXT = marshal_glProgramUniform4fEXT;
+    if (gles.ext.glProgramUniform4fvEXT) gles.ext.glProgramUniform4fvEXT = marshal_glProgramUniform4fvEXT;
+    if (gles.ext.glProgramUniform4i64NV) gles.ext.glProgramUniform4i64NV = marshal_glProgramUniform4i64NV;
+    if (gles.ext.glProgramUniform4i64vNV) gles.ext.glProgramUniform4i64vNV = marshal_glProgramUniform4i64vNV;
+    if (gles.ext.glProgramUniform4iEXT) gles.ext.glProgramUniform4iEXT = marshal_glProgramUniform4iEXT;
+    if (gles.ext.glProgramUniform4ivEXT) gles.ext.glProgramUniform4ivEXT = marshal_glProgramUniform4ivEXT;
+    if (gles.ext.glProgramUniform4ui64NV) gles.ext.glProgramUniform4ui64NV = marshal_glProgramUniform4ui64NV;
+    if (gles.ext.glProgramUniform4ui64vNV) gles.ext.glProgramUniform4ui64vNV = marshal_glProgramUniform4ui64vNV;
+    if (gles.ext.glProgramUniform4uiEXT) gles.ext.glProgramUniform4uiEXT = marshal_glProgramUniform4uiEXT;
+    if (gles.ext.glProgramUniform4uivEXT) gles.ext.glProgramUniform4uivEXT = marshal_glProgramUniform4uivEXT;
+    if (gles.ext.glProgramUniformHandleui64IMG) gles.ext.glProgramUniformHandleui64IMG = marshal_glProgramUniformHandleui64IMG;
+    if (gles.ext.glProgramUniformHandleui64NV) gles.ext.glProgramUniformHandleui64NV = marshal_glProgramUniformHandleui64NV;
+    if (gles.ext.glProgramUniformHandleui64vIMG) gles.ext.glProgramUniformHandleui64vIMG = marshal_glProgramUniformHandleui64vIMG;
+    if (gles.ext.glProgramUniformHandleui64vNV) gles.ext.glProgramUniformHandleui64vNV = marshal_glProgramUniformHandleui64vNV;
+    if (gles.ext.glProgramUniformMatrix2fvEXT) gles.ext.glProgramUniformMatrix2fvEXT = marshal_glProgramUniformMatrix2fvEXT;
+    if (gles.ext.glProgramUniformMatrix2x3fvEXT) gles.ext.glProgramUniformMatrix2x3fvEXT = marshal_glProgramUniformMatrix2x3fvEXT;
+    if (gles.ext.glProgramUniformMatrix2x4fvEXT) gles.ext.glProgramUniformMatrix2x4fvEXT = marshal_glProgramUniformMatrix2x4fvEXT;
+    if (gles.ext.glProgramUniformMatrix3fvEXT) gles.ext.glProgramUniformMatrix3fvEXT = marshal_glProgramUniformMatrix3fvEXT;
+    if (gles.ext.glProgramUniformMatrix3x2fvEXT) gles.ext.glProgramUniformMatrix3x2fvEXT = marshal_glProgramUniformMatrix3x2fvEXT;
+    if (gles.ext.glProgramUniformMatrix3x4fvEXT) gles.ext.glProgramUniformMatrix3x4fvEXT = marshal_glProgramUniformMatrix3x4fvEXT;
+    if (gles.ext.glProgramUniformMatrix4fvEXT) gles.ext.glProgramUniformMatrix4fvEXT = marshal_glProgramUniformMatrix4fvEXT;
+    if (gles.ext.glProgramUniformMatrix4x2fvEXT) gles.ext.glProgramUniformMatrix4x2fvEXT = marshal_glProgramUniformMatrix4x2fvEXT;
+    if (gles.ext.glProgramUniformMatrix4x3fvEXT) gles.ext.glProgramUniformMatrix4x3fvEXT = marshal_glProgramUniformMatrix4x3fvEXT;
+    if (gles.ext.glPushDebugGroupKHR) gles.ext.glPushDebugGroupKHR = marshal_glPushDebugGroupKHR;
+    if (gles.ext.glPushGroupMarkerEXT) gles.ext.glPushGroupMarkerEXT = marshal_glPushGroupMarkerEXT;
+    if (gles.ext.glQueryCounterEXT) gles.ext.glQueryCounterEXT = marshal_glQueryCounterEXT;
+    if (gles.ext.glRasterSamplesEXT) gles.ext.glRasterSamplesEXT = marshal_glRasterSamplesEXT;
+    if (gles.ext.glReadBufferIndexedEXT) gles.ext.glReadBufferIndexedEXT = marshal_glReadBufferIndexedEXT;
+    if (gles.ext.glReadBufferNV) gles.ext.glReadBufferNV = marshal_glReadBufferNV;
+    if (gles.ext.glReadnPixelsEXT) gles.ext.glReadnPixelsEXT = marshal_glReadnPixelsEXT;
+    if (gles.ext.glReadnPixelsKHR) gles.ext.glReadnPixelsKHR = marshal_glReadnPixelsKHR;
+    if (gles.ext.glRenderbufferStorageMultisampleANGLE) gles.ext.glRenderbufferStorageMultisampleANGLE = marshal_glRenderbufferStorageMultisampleANGLE;
+    if (gles.ext.glRenderbufferStorageMultisampleAPPLE) gles.ext.glRenderbufferStorageMultisampleAPPLE = marshal_glRenderbufferStorageMultisampleAPPLE;
+    if (gles.ext.glRenderbufferStorageMultisampleEXT) gles.ext.glRenderbufferStorageMultisampleEXT = marshal_glRenderbufferStorageMultisampleEXT;
+    if (gles.ext.glRenderbufferStorageMultisampleIMG) gles.ext.glRenderbufferStorageMultisampleIMG = marshal_glRenderbufferStorageMultisampleIMG;
+    if (gles.ext.glRenderbufferStorageMultisampleNV) gles.ext.glRenderbufferStorageMultisampleNV = marshal_glRenderbufferStorageMultisampleNV;
+    if (gles.ext.glResolveDepthValuesNV) gles.ext.glResolveDepthValuesNV = marshal_glResolveDepthValuesNV;
+    if (gles.ext.glResolveMultisampleFramebufferAPPLE) gles.ext.glResolveMultisampleFramebufferAPPLE = marshal_glResolveMultisampleFramebufferAPPLE;
+    if (gles.ext.glSamplerParameterIivEXT) gles.ext.glSamplerParameterIivEXT = marshal_glSamplerParameterIivEXT;
+    if (gles.ext.glSamplerParameterIivOES) gles.ext.glSamplerParameterIivOES = marshal_glSamplerParameterIivOES;
+    if (gles.ext.glSamplerParameterIuivEXT) gles.ext.glSamplerParameterIuivEXT = marshal_glSamplerParameterIuivEXT;
+    if (gles.ext.glSamplerParameterIuivOES) gles.ext.glSamplerParameterIuivOES = marshal_glSamplerParameterIuivOES;
+    if (gles.ext.glScissorArrayvNV) gles.ext.glScissorArrayvNV = marshal_glScissorArrayvNV;
+    if (gles.ext.glScissorArrayvOES) gles.ext.glScissorArrayvOES = marshal_glScissorArrayvOES;
+    if (gles.ext.glScissorIndexedNV) gles.ext.glScissorIndexedNV = marshal_glScissorIndexedNV;
+    if (gles.ext.glScissorIndexedOES) gles.ext.glScissorIndexedOES = marshal_glScissorIndexedOES;
+    if (gles.ext.glScissorIndexedvNV) gles.ext.glScissorIndexedvNV = marshal_glScissorIndexedvNV;
+    if (gles.ext.glScissorIndexedvOES) gles.ext.glScissorIndexedvOES = marshal_glScissorIndexedvOES;
+    if (gles.ext.glSelectPerfMonitorCountersAMD) gles.ext.glSelectPerfMonitorCountersAMD = marshal_glSelectPerfMonitorCountersAMD;
+    if (gles.ext.glSemaphoreParameterui64vEXT) gles.ext.glSemaphoreParameterui64vEXT = marshal_glSemaphoreParameterui64vEXT;
+    if (gles.ext.glSetFenceNV) gles.ext.glSetFenceNV = marshal_glSetFenceNV;
+    if (gles.ext.glSignalSemaphoreEXT) gles.ext.glSignalSemaphoreEXT = marshal_glSignalSemaphoreEXT;
+    if (gles.ext.glSignalVkFenceNV) gles.ext.glSignalVkFenceNV = marshal_glSignalVkFenceNV;
+    if (gles.ext.glSignalVkSemaphoreNV) gles.ext.glSignalVkSemaphoreNV = marshal_glSignalVkSemaphoreNV;
+    if (gles.ext.glStartTilingQCOM) gles.ext.glStartTilingQCOM = marshal_glStartTilingQCOM;
+    if (gles.ext.glStencilFillPathInstancedNV) gles.ext.glStencilFillPathInstancedNV = marshal_glStencilFillPathInstancedNV;
+    if (gles.ext.glStencilFillPathNV) gles.ext.glStencilFillPathNV = marshal_glStencilFillPathNV;
+    if (gles.ext.glStencilStrokePathInstancedNV) gles.ext.glStencilStrokePathInstancedNV = marshal_glStencilStrokePathInstancedNV;
+    if (gles.ext.glStencilStrokePathNV) gles.ext.glStencilStrokePathNV = marshal_glStencilStrokePathNV;
+    if (gles.ext.glStencilThenCoverFillPathInstancedNV) gles.ext.glStencilThenCoverFillPathInstancedNV = marshal_glStencilThenCoverFillPathInstancedNV;
+    if (gles.ext.glStencilThenCoverFillPathNV) gles.ext.glStencilThenCoverFillPathNV = marshal_glStencilThenCoverFillPathNV;
+    if (gles.ext.glStencilThenCoverStrokePathInstancedNV) gles.ext.glStencilThenCoverStrokePathInstancedNV = marshal_glStencilThenCoverStrokePathInstancedNV;
+    if (gles.ext.glStencilThenCoverStrokePathNV) gles.ext.glStencilThenCoverStrokePathNV = marshal_glStencilThenCoverStrokePathNV;
+    if (gles.ext.glSubpixelPrecisionBiasNV) gles.ext.glSubpixelPrecisionBiasNV = marshal_glSubpixelPrecisionBiasNV;
+    if (gles.ext.glTestFenceNV) gles.ext.glTestFenceNV = marshal_glTestFenceNV;
+    if (gles.ext.glTexBufferEXT) gles.ext.glTexBufferEXT = marshal_glTexBufferEXT;
+    if (gles.ext.glTexBufferOES) gles.ext.glTexBufferOES = marshal_glTexBufferOES;
+    if (gles.ext.glTexBufferRangeEXT) gles.ext.glTexBufferRangeEXT = marshal_glTexBufferRangeEXT;
+    if (gles.ext.glTexBufferRangeOES) gles.ext.glTexBufferRangeOES = marshal_glTexBufferRangeOES;
+    if (gles.ext.glTexImage3DOES) gles.ext.glTexImage3DOES = marshal_glTexImage3DOES;
+    if (gles.ext.glTexPageCommitmentEXT) gles.ext.glTexPageCommitmentEXT = marshal_glTexPageCommitmentEXT;
+    if (gles.ext.glTexParameterIivEXT) gles.ext.glTexParameterIivEXT = marshal_glTexParameterIivEXT;
+    if (gles.ext.glTexParameterIivOES) gles.ext.glTexParameterIivOES = marshal_glTexParameterIivOES;
+    if (gles.ext.glTexParameterIuivEXT) gles.ext.glTexParameterIuivEXT = marshal_glTexParameterIuivEXT;
+    if (gles.ext.glTexParameterIuivOES) gles.ext.glTexParameterIuivOES = marshal_glTexParameterIuivOES;
+    if (gles.ext.glTexStorage1DEXT) gles.ext.glTexStorage1DEXT = marshal_glTexStorage1DEXT;
+    if (gles.ext.glTexStorage2DEXT) gles.ext.glTexStorage2DEXT = marshal_glTexStorage2DEXT;
+    if (gles.ext.glTexStorage3DEXT) gles.ext.glTexStorage3DEXT = marshal_glTexStorage3DEXT;
+    if (gles.ext.glTexStorage3DMultisampleOES) gles.ext.glTexStorage3DMultisampleOES = marshal_glTexStorage3DMultisampleOES;
+    if (gles.ext.glTexStorageMem2DEXT) gles.ext.glTexStorageMem2DEXT = marshal_glTexStorageMem2DEXT;
+    if (gles.ext.glTexStorageMem2DMultisampleEXT) gles.ext.glTexStorageMem2DMultisampleEXT = marshal_glTexStorageMem2DMultisampleEXT;
+    if (gles.ext.glTexStorageMem3DEXT) gles.ext.glTexStorageMem3DEXT = marshal_glTexStorageMem3DEXT;
+    if (gles.ext.glTexStorageMem3DMultisampleEXT) gles.ext.glTexStorageMem3DMultisampleEXT = marshal_glTexStorageMem3DMultisampleEXT;
+    if (gles.ext.glTexSubImage3DOES) gles.ext.glTexSubImage3DOES = marshal_glTexSubImage3DOES;
+    if (gles.ext.glTextureFoveationParametersQCOM) gles.ext.glTextureFoveationParametersQCOM = marshal_glTextureFoveationParametersQCOM;
+    if (gles.ext.glTextureStorage1DEXT) gles.ext.glTextureStorage1DEXT = marshal_glTextureStorage1DEXT;
+    if (gles.ext.glTextureStorage2DEXT) gles.ext.glTextureStorage2DEXT = marshal_glTextureStorage2DEXT;
+    if (gles.ext.glTextureStorage3DEXT) gles.ext.glTextureStorage3DEXT = marshal_glTextureStorage3DEXT;
+    if (gles.ext.glTextureStorageMem2DEXT) gles.ext.glTextureStorageMem2DEXT = marshal_glTextureStorageMem2DEXT;
+    if (gles.ext.glTextureStorageMem2DMultisampleEXT) gles.ext.glTextureStorageMem2DMultisampleEXT = marshal_glTextureStorageMem2DMultisampleEXT;
+    if (gles.ext.glTextureStorageMem3DEXT) gles.ext.glTextureStorageMem3DEXT = marshal_glTextureStorageMem3DEXT;
+    if (gles.ext.glTextureStorageMem3DMultisampleEXT) gles.ext.glTextureStorageMem3DMultisampleEXT = marshal_glTextureStorageMem3DMultisampleEXT;
+    if (gles.ext.glTextureViewEXT) gles.ext.glTextureViewEXT = marshal_glTextureViewEXT;
+    if (gles.ext.glTextureViewOES) gles.ext.glTextureViewOES = marshal_glTextureViewOES;
+    if (gles.ext.glTransformPathNV) gles.ext.glTransformPathNV = marshal_glTransformPathNV;
+    if (gles.ext.glUniform1i64NV) gles.ext.glUniform1i64NV = marshal_glUniform1i64NV;
+    if (gles.ext.glUniform1i64vNV) gles.ext.glUniform1i64vNV = marshal_glUniform1i64vNV;
+    if (gles.ext.glUniform1ui64NV) gles.ext.glUniform1ui64NV = marshal_glUniform1ui64NV;
+    if (gles.ext.glUniform1ui64vNV) gles.ext.glUniform1ui64vNV = marshal_glUniform1ui64vNV;
+    if (gles.ext.glUniform2i64NV) gles.ext.glUniform2i64NV = marshal_glUniform2i64NV;
+    if (gles.ext.glUniform2i64vNV) gles.ext.glUniform2i64vNV = marshal_glUniform2i64vNV;
+    if (gles.ext.glUniform2ui64NV) gles.ext.glUniform2ui64NV = marshal_glUniform2ui64NV;
+    if (gles.ext.glUniform2ui64vNV) gles.ext.glUniform2ui64vNV = marshal_glUniform2ui64vNV;
+    if (gles.ext.glUniform3i64NV) gles.ext.glUniform3i64NV = marshal_glUniform3i64NV;
+    if (gles.ext.glUniform3i64vNV) gles.ext.glUniform3i64vNV = marshal_glUniform3i64vNV;
+    if (gles.ext.glUniform3ui64NV) gles.ext.glUniform3ui64NV = marshal_glUniform3ui64NV;
+    if (gles.ext.glUniform3ui64vNV) gles.ext.glUniform3ui64vNV = marshal_glUniform3ui64vNV;
+    if (gles.ext.glUniform4i64NV) gles.ext.glUniform4i64NV = marshal_glUniform4i64NV;
+    if (gles.ext.glUniform4i64vNV) gles.ext.glUniform4i64vNV = marshal_glUniform4i64vNV;
+    if (gles.ext.glUniform4ui64NV) gles.ext.glUniform4ui64NV = marshal_glUniform4ui64NV;
+    if (gles.ext.glUniform4ui64vNV) gles.ext.glUniform4ui64vNV = marshal_glUniform4ui64vNV;
+    if (gles.ext.glUniformHandleui64IMG) gles.ext.glUniformHandleui64IMG = marshal_glUniformHandleui64IMG;
+    if (gles.ext.glUniformHandleui64NV) gles.ext.glUniformHandleui64NV = marshal_glUniformHandleui64NV;
+    if (gles.ext.glUniformHandleui64vIMG) gles.ext.glUniformHandleui64vIMG = marshal_glUniformHandleui64vIMG;
+    if (gles.ext.glUniformHandleui64vNV) gles.ext.glUniformHandleui64vNV = marshal_glUniformHandleui64vNV;
+    if (gles.ext.glUniformMatrix2x3fvNV) gles.ext.glUniformMatrix2x3fvNV = marshal_glUniformMatrix2x3fvNV;
+    if (gles.ext.glUniformMatrix2x4fvNV) gles.ext.glUniformMatrix2x4fvNV = marshal_glUniformMatrix2x4fvNV;
+    if (gles.ext.glUniformMatrix3x2fvNV) gles.ext.glUniformMatrix3x2fvNV = marshal_glUniformMatrix3x2fvNV;
+    if (gles.ext.glUniformMatrix3x4fvNV) gles.ext.glUniformMatrix3x4fvNV = marshal_glUniformMatrix3x4fvNV;
+    if (gles.ext.glUniformMatrix4x2fvNV) gles.ext.glUniformMatrix4x2fvNV = marshal_glUniformMatrix4x2fvNV;
+    if (gles.ext.glUniformMatrix4x3fvNV) gles.ext.glUniformMatrix4x3fvNV = marshal_glUniformMatrix4x3fvNV;
+    if (gles.ext.glUnmapBufferOES) gles.ext.glUnmapBufferOES = marshal_glUnmapBufferOES;
+    if (gles.ext.glUseProgramStagesEXT) gles.ext.glUseProgramStagesEXT = marshal_glUseProgramStagesEXT;
+    if (gles.ext.glValidateProgramPipelineEXT) gles.ext.glValidateProgramPipelineEXT = marshal_glValidateProgramPipelineEXT;
+    if (gles.ext.glVertexAttribDivisorANGLE) gles.ext.glVertexAttribDivisorANGLE = marshal_glVertexAttribDivisorANGLE;
+    if (gles.ext.glVertexAttribDivisorEXT) gles.ext.glVertexAttribDivisorEXT = marshal_glVertexAttribDivisorEXT;
+    if (gles.ext.glVertexAttribDivisorNV) gles.ext.glVertexAttribDivisorNV = marshal_glVertexAttribDivisorNV;
+    if (gles.ext.glViewportArrayvNV) gles.ext.glViewportArrayvNV = marshal_glViewportArrayvNV;
+    if (gles.ext.glViewportArrayvOES) gles.ext.glViewportArrayvOES = marshal_glViewportArrayvOES;
+    if (gles.ext.glViewportIndexedfNV) gles.ext.glViewportIndexedfNV = marshal_glViewportIndexedfNV;
+    if (gles.ext.glViewportIndexedfOES) gles.ext.glViewportIndexedfOES = marshal_glViewportIndexedfOES;
+    if (gles.ext.glViewportIndexedfvNV) gles.ext.glViewportIndexedfvNV = marshal_glViewportIndexedfvNV;
+    if (gles.ext.glViewportIndexedfvOES) gles.ext.glViewportIndexedfvOES = marshal_glViewportIndexedfvOES;
+    if (gles.ext.glViewportPositionWScaleNV) gles.ext.glViewportPositionWScaleNV = marshal_glViewportPositionWScaleNV;
+    if (gles.ext.glViewportSwizzleNV) gles.ext.glViewportSwizzleNV = marshal_glViewportSwizzleNV;
+    if (gles.ext.glWaitSemaphoreEXT) gles.ext.glWaitSemaphoreEXT = marshal_glWaitSemaphoreEXT;
+    if (gles.ext.glWaitSyncAPPLE) gles.ext.glWaitSyncAPPLE = marshal_glWaitSyncAPPLE;
+    if (gles.ext.glWaitVkSemaphoreNV) gles.ext.glWaitVkSemaphoreNV = marshal_glWaitVkSemaphoreNV;
+    if (gles.ext.glWeightPathsNV) gles.ext.glWeightPathsNV = marshal_glWeightPathsNV;
+    if (gles.ext.glWindowRectanglesEXT) gles.ext.glWindowRectanglesEXT = marshal_glWindowRectanglesEXT;
+}
@@ -1,28 +1,540 @@
 #include "state.h"
+#include "cache.h"
+#include "stats.h"
+#include "page_track.h"
+#include "object_table.h"
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
 
 #define STB_DS_IMPLEMENTATION
 #include "stb_ds.h"
 
-static struct {
-    GLuint key;
-    GLenum value;
-} *g_texture_target_map = NULL;
+enum {
+    BUFFER_SLOT_ARRAY,
+    BUFFER_SLOT_ELEMENT_ARRAY,
+    BUFFER_SLOT_COPY_READ,
+    BUFFER_SLOT_COPY_WRITE,
+    BUFFER_SLOT_PIXEL_PACK,
+    BUFFER_SLOT_PIXEL_UNPACK,
+    BUFFER_SLOT_TRANSFORM_FEEDBACK,
+    BUFFER_SLOT_UNIFORM,
+    BUFFER_SLOT_SHADER_STORAGE,
+    BUFFER_SLOT_ATOMIC_COUNTER,
+    BUFFER_SLOT_DRAW_INDIRECT,
+    BUFFER_SLOT_DISPATCH_INDIRECT,
+    BUFFER_SLOT_TEXTURE,
+    BUFFER_SLOT_PARAMETER, // Layer-only, GLES has no parameter buffer binding
+    BUFFER_SLOT_COUNT
+};
 
+enum {
+    TEXTURE_SLOT_2D,
+    TEXTURE_SLOT_2D_MULTISAMPLE,
+    TEXTURE_SLOT_2D_ARRAY,
+    TEXTURE_SLOT_2D_MULTISAMPLE_ARRAY,
+    TEXTURE_SLOT_3D,
+    TEXTURE_SLOT_CUBE_MAP,
+    TEXTURE_SLOT_CUBE_MAP_ARRAY,
+    TEXTURE_SLOT_BUFFER,
+    TEXTURE_SLOT_COUNT
+};
+
+struct indexed_buffer_binding {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+// Bindings as the application sees them. DSA emulations use the copy buffer
+// targets and a scratch texture unit behind the application's back, so for
+// those the driver's actual binding is tracked separately and only put back
+// when the application next uses them.
+struct binding_state {
+    GLuint buffers[BUFFER_SLOT_COUNT];
+    GLuint driver_copy_buffers[2]; // Driver bindings of GL_COPY_READ_BUFFER and GL_COPY_WRITE_BUFFER
+    struct indexed_buffer_binding uniform_buffers[STATE_MAX_UNIFORM_BUFFER_BINDINGS];
+    struct indexed_buffer_binding shader_storage_buffers[STATE_MAX_SHADER_STORAGE_BUFFER_BINDINGS];
+    GLuint vertex_array;
+    GLuint read_framebuffer;
+    GLuint draw_framebuffer;
+    GLuint transform_feedback;
+    GLuint active_texture_unit;
+    GLuint driver_active_texture_unit;
+    GLuint textures[STATE_MAX_TEXTURE_UNITS][TEXTURE_SLOT_COUNT];
+    GLuint samplers[STATE_MAX_TEXTURE_UNITS];
+    GLuint program;
+};
+
+enum {
+    CAP_SLOT_BLEND,
+    CAP_SLOT_CULL_FACE,
+    CAP_SLOT_DEPTH_TEST,
+    CAP_SLOT_DITHER,
+    CAP_SLOT_POLYGON_OFFSET_FILL,
+    CAP_SLOT_PRIMITIVE_RESTART_FIXED_INDEX,
+    CAP_SLOT_RASTERIZER_DISCARD,
+    CAP_SLOT_SAMPLE_ALPHA_TO_COVERAGE,
+    CAP_SLOT_SAMPLE_COVERAGE,
+    CAP_SLOT_SAMPLE_MASK,
+    CAP_SLOT_SAMPLE_SHADING,
+    CAP_SLOT_SCISSOR_TEST,
+    CAP_SLOT_STENCIL_TEST,
+    CAP_SLOT_COUNT
+};
+
+// Bits of render_state.valid, set once the matching value is known to match the driver.
+enum {
+    RENDER_VALID_BLEND_FUNC     = 1 << 0,
+    RENDER_VALID_BLEND_EQUATION = 1 << 1,
+    RENDER_VALID_BLEND_COLOR    = 1 << 2,
+    RENDER_VALID_DEPTH_FUNC     = 1 << 3,
+    RENDER_VALID_DEPTH_MASK     = 1 << 4,
+    RENDER_VALID_COLOR_MASK     = 1 << 5,
+    RENDER_VALID_CULL_FACE      = 1 << 6,
+    RENDER_VALID_FRONT_FACE     = 1 << 7,
+    RENDER_VALID_POLYGON_OFFSET = 1 << 8,
+    RENDER_VALID_VIEWPORT       = 1 << 9,
+    RENDER_VALID_SCISSOR        = 1 << 10,
+    RENDER_VALID_CLEAR_COLOR    = 1 << 11,
+};
+
+#define CAP_UNKNOWN (-1)
+
+struct render_state {
+    unsigned int valid;
+    signed char caps[CAP_SLOT_COUNT];
+    GLenum blend_func[4];
+    GLenum blend_equation[2];
+    GLfloat blend_color[4];
+    GLenum depth_func;
+    GLboolean depth_mask;
+    GLboolean color_mask[4];
+    GLenum cull_face;
+    GLenum front_face;
+    GLfloat polygon_offset[2];
+    GLint viewport[4];
+    GLint scissor[4];
+    GLfloat clear_color[4];
+    GLboolean primitive_restart;             // Desktop GL_PRIMITIVE_RESTART
+    GLboolean primitive_restart_fixed_index; // The application's GL_PRIMITIVE_RESTART_FIXED_INDEX
+    GLuint primitive_restart_index;
+    GLenum polygon_mode;
+};
+
+// New contexts start out with the GLES defaults. The viewport and scissor box
+// depend on the first surface, so they stay unknown until the application sets them.
+#define DEFAULT_RENDER_STATE { \
+    .valid = ~(unsigned int)(RENDER_VALID_VIEWPORT | RENDER_VALID_SCISSOR), \
+    .caps = { [CAP_SLOT_DITHER] = GL_TRUE }, \
+    .blend_func = { GL_ONE, GL_ZERO, GL_ONE, GL_ZERO }, \
+    .blend_equation = { GL_FUNC_ADD, GL_FUNC_ADD }, \
+    .depth_func = GL_LESS, \
+    .depth_mask = GL_TRUE, \
+    .color_mask = { GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE }, \
+    .cull_face = GL_BACK, \
+    .polygon_mode = GL_FILL, \
+    .front_face = GL_CCW, \
+}
+
+// --- Object tables ---
+
+#define OBJECT_FLAG_ALIVE   0x1
+#define OBJECT_FLAG_STORAGE 0x2 // Buffer has a data store of known size
+#define OBJECT_FLAG_LINKED  0x4 // Program was linked and its info resolved
+#define OBJECT_FLAG_MIRROR  0x8 // Buffer is mirrored on the CPU when its data store is specified
+#define OBJECT_FLAG_GPU_WRITTEN 0x10 // Buffer was bound where the GPU can write to it
+
+// Per-object records. Every record starts with a flags word; a zeroed record
+// means the layer knows nothing about that name.
+
+struct texture_object {
+    GLuint flags;
+    GLenum target;
+    GLboolean immutable;
+    struct state_texture_level levels[STATE_MAX_TEXTURE_LEVELS]; // internal_format is 0 for unspecified levels
+};
+
+static GLsizeiptr texture_memory_size(const struct texture_object* object);
+
+static void texture_object_destroy(void* entry) {
+    stats_add(STATS_TEXTURE_BYTES, (uint64_t)-texture_memory_size(entry));
+}
+
+struct buffer_object {
+    GLuint flags;
+    struct state_buffer_info info;
+    unsigned char* mirror; // CPU copy of the data store, NULL when missing or stale
+    GLuint generation;         // Unique across buffers, see buffer_next_generation
+    GLuint max_index;
+    struct state_index_copy index_copy;
+    GLuint upload_frame;       // Last frame with a partial upload, see state_buffer_note_upload
+    GLuint upload_streak;
+};
+
+static void buffer_object_destroy(void* entry) {
+    struct buffer_object* object = entry;
+    free(object->mirror);
+}
+
+struct vertex_array_object {
+    GLuint flags;
+    GLuint element_buffer; // The element array binding belongs to the VAO
+    GLuint instanced_bindings; // Bindings with a non-zero divisor, bit 31 covers 31 and up
+    GLuint base_instance;      // Instances the driver's instanced bindings are offset by
+    struct state_vertex_binding bindings[STATE_MAX_VERTEX_BINDINGS];
+};
+
+struct framebuffer_object {
+    GLuint flags;
+};
+
+struct transform_feedback_object {
+    GLuint flags;
+    struct state_transform_feedback counts;
+};
+
+struct program_object {
+    GLuint flags;
+    struct state_program_info info;
+    struct { char* key; GLint value; }* uniform_locations; // stb_ds string map, reset on relink
+};
+
+static void program_object_destroy(void* entry) {
+    struct program_object* object = entry;
+    shfree(object->uniform_locations);
+}
+
+// --- Contexts ---
+//
+// Textures, buffers, programs and shaders are shared between contexts created
+// with a share context, so their records live in the share group. Container
+// objects (VAOs, framebuffers) and all bindings are per context.
+
+struct state_share_group {
+    atomic_int refcount;
+    struct object_table textures;
+    struct object_table buffers;
+    struct object_table programs;
+    atomic_flag shader_sources_lock;
+    struct shader_source_entry* shader_sources; // stb_ds map, owned by the shader cache
+    atomic_flag uniform_locations_lock; // Guards the per-program uniform location maps
+    atomic_flag persistent_maps_lock;
+    struct state_persistent_map* persistent_maps; // stb_ds array
+    atomic_int persistent_map_count;   // Read without the lock by draws that have nothing to upload
+    atomic_flag orphans_lock;
+    struct state_orphaned_objects orphans; // Scratch objects of freed contexts
+};
+
+struct state_context {
+    atomic_int refcount; // One for the GLX context, one for the thread it is current on
+    struct state_share_group* share;
+    struct binding_state bindings;
+    struct render_state render_state;
+    struct object_table vertex_arrays;
+    struct object_table framebuffers;
+    struct object_table transform_feedbacks;
+    GLuint rebased_vertex_arrays; // Vertex arrays with a non-zero base_instance
+    struct state_transform_feedback* counted_transform_feedback; // Object whose active pass a layer query counts
+    GLboolean app_primitives_query; // The application has a GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN query active
+    struct state_scratch_objects scratch;
+};
+
+#define SHARE_GROUP_INIT { \
+    .refcount = 1, \
+    .textures = OBJECT_TABLE_INIT_DESTROY(struct texture_object, texture_object_destroy), \
+    .buffers = OBJECT_TABLE_INIT_DESTROY(struct buffer_object, buffer_object_destroy), \
+    .programs = OBJECT_TABLE_INIT_DESTROY(struct program_object, program_object_destroy), \
+    .shader_sources_lock = ATOMIC_FLAG_INIT, \
+    .uniform_locations_lock = ATOMIC_FLAG_INIT, \
+    .persistent_maps_lock = ATOMIC_FLAG_INIT, \
+    .orphans_lock = ATOMIC_FLAG_INIT, \
+}
+
+#define CONTEXT_TABLES_INIT \
+    .vertex_arrays = OBJECT_TABLE_INIT(struct vertex_array_object), \
+    .framebuffers = OBJECT_TABLE_INIT(struct framebuffer_object), \
+    .transform_feedbacks = OBJECT_TABLE_INIT(struct transform_feedback_object)
+
+// Used by threads that have no context current, and by single-context apps
+// until their first glXMakeContextCurrent, so the current pointer is never NULL.
+static struct state_share_group g_default_share_group = SHARE_GROUP_INIT;
+static struct state_context g_default_context = {
+    .share = &g_default_share_group,
+    .render_state = DEFAULT_RENDER_STATE,
+    CONTEXT_TABLES_INIT,
+};
+
+// initial-exec keeps the lookup a single %fs-relative load for the common case.
+static __thread struct state_context* t_current_context __attribute__((tls_model("initial-exec"))) = &g_default_context;
+
+// Marks name as known to exist, e.g. after its first bind.
+static void object_table_mark_alive(struct object_table* table, GLuint name) {
+    GLuint* flags = object_table_fetch(table, name);
+    if (flags) *flags |= OBJECT_FLAG_ALIVE;
+}
+
+static GLuint vertex_array_element_buffer(GLuint array) {
+    struct state_context* ctx = t_current_context;
+    struct vertex_array_object* object = object_table_lookup(&ctx->vertex_arrays, array);
+    return object ? object->element_buffer : 0;
+}
+
+static void vertex_array_set_element_buffer(GLuint array, GLuint buffer) {
+    struct state_context* ctx = t_current_context;
+    struct vertex_array_object* object = object_table_fetch(&ctx->vertex_arrays, array);
+    if (object) object->element_buffer = buffer;
+}
+
+
+static int buffer_slot_from_target(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER:              return BUFFER_SLOT_ARRAY;
+        case GL_ELEMENT_ARRAY_BUFFER:      return BUFFER_SLOT_ELEMENT_ARRAY;
+        case GL_COPY_READ_BUFFER:          return BUFFER_SLOT_COPY_READ;
+        case GL_COPY_WRITE_BUFFER:         return BUFFER_SLOT_COPY_WRITE;
+        case GL_PIXEL_PACK_BUFFER:         return BUFFER_SLOT_PIXEL_PACK;
+        case GL_PIXEL_UNPACK_BUFFER:       return BUFFER_SLOT_PIXEL_UNPACK;
+        case GL_TRANSFORM_FEEDBACK_BUFFER: return BUFFER_SLOT_TRANSFORM_FEEDBACK;
+        case GL_UNIFORM_BUFFER:            return BUFFER_SLOT_UNIFORM;
+        case GL_SHADER_STORAGE_BUFFER:     return BUFFER_SLOT_SHADER_STORAGE;
+        case GL_ATOMIC_COUNTER_BUFFER:     return BUFFER_SLOT_ATOMIC_COUNTER;
+        case GL_DRAW_INDIRECT_BUFFER:      return BUFFER_SLOT_DRAW_INDIRECT;
+        case GL_DISPATCH_INDIRECT_BUFFER:  return BUFFER_SLOT_DISPATCH_INDIRECT;
+        case GL_PARAMETER_BUFFER:          return BUFFER_SLOT_PARAMETER;
+        case GL_TEXTURE_BUFFER:            return BUFFER_SLOT_TEXTURE;
+        default:
+            fprintf(stderr, "Warning: unknown buffer target %#x in buffer_slot_from_target\n", target);
+            return -1;
+    }
+}
+
+static int texture_slot_from_target(GLenum target) {
+    switch (target) {
+        case GL_TEXTURE_1D:
+        case GL_TEXTURE_2D:
+            return TEXTURE_SLOT_2D;
+        case GL_TEXTURE_2D_MULTISAMPLE:
+            return TEXTURE_SLOT_2D_MULTISAMPLE;
+        case GL_TEXTURE_2D_ARRAY:
+            return TEXTURE_SLOT_2D_ARRAY;
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+            return TEXTURE_SLOT_2D_MULTISAMPLE_ARRAY;
+        case GL_TEXTURE_3D:
+            return TEXTURE_SLOT_3D;
+        case GL_TEXTURE_CUBE_MAP:
+        case GL_TEXTURE_CUBE_MAP_POSITIVE_X:
+        case GL_TEXTURE_CUBE_MAP_NEGATIVE_X:
+        case GL_TEXTURE_CUBE_MAP_POSITIVE_Y:
+        case GL_TEXTURE_CUBE_MAP_NEGATIVE_Y:
+        case GL_TEXTURE_CUBE_MAP_POSITIVE_Z:
+        case GL_TEXTURE_CUBE_MAP_NEGATIVE_Z:
+            return TEXTURE_SLOT_CUBE_MAP;
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+            return TEXTURE_SLOT_CUBE_MAP_ARRAY;
+        case GL_TEXTURE_BUFFER:
+            return TEXTURE_SLOT_BUFFER;
+        default:
+            fprintf(stderr, "Warning: unknown texture target %#x in texture_slot_from_target\n", target);
+            return -1;
+    }
+}
+
+static int cap_slot_from_cap(GLenum cap) {
+    switch (cap) {
+        case GL_BLEND:                         return CAP_SLOT_BLEND;
+        case GL_CULL_FACE:                     return CAP_SLOT_CULL_FACE;
+        case GL_DEPTH_TEST:                    return CAP_SLOT_DEPTH_TEST;
+        case GL_DITHER:                        return CAP_SLOT_DITHER;
+        case GL_POLYGON_OFFSET_FILL:           return CAP_SLOT_POLYGON_OFFSET_FILL;
+        case GL_PRIMITIVE_RESTART_FIXED_INDEX: return CAP_SLOT_PRIMITIVE_RESTART_FIXED_INDEX;
+        case GL_RASTERIZER_DISCARD:            return CAP_SLOT_RASTERIZER_DISCARD;
+        case GL_SAMPLE_ALPHA_TO_COVERAGE:      return CAP_SLOT_SAMPLE_ALPHA_TO_COVERAGE;
+        case GL_SAMPLE_COVERAGE:               return CAP_SLOT_SAMPLE_COVERAGE;
+        case GL_SAMPLE_MASK:                   return CAP_SLOT_SAMPLE_MASK;
+        case GL_SAMPLE_SHADING:                return CAP_SLOT_SAMPLE_SHADING;
+        case GL_SCISSOR_TEST:                  return CAP_SLOT_SCISSOR_TEST;
+        case GL_STENCIL_TEST:                  return CAP_SLOT_STENCIL_TEST;
+        default:                               return -1; // Not tracked, always forwarded
+    }
+}
+
+// Stores a render state value and reports whether the driver state changes.
+static int render_state_update(struct render_state* state, void* dst, const void* src, size_t size, unsigned int valid_bit) {
+    if ((state->valid & valid_bit) && memcmp(dst, src, size) == 0) return 0;
+    memcpy(dst, src, size);
+    state->valid |= valid_bit;
+    return 1;
+}
+
+static struct indexed_buffer_binding* indexed_binding(struct state_context* ctx, GLenum target, GLuint index) {
+    switch (target) {
+        case GL_UNIFORM_BUFFER:
+            if (index < STATE_MAX_UNIFORM_BUFFER_BINDINGS) return &ctx->bindings.uniform_buffers[index];
+            break;
+        case GL_SHADER_STORAGE_BUFFER:
+            if (index < STATE_MAX_SHADER_STORAGE_BUFFER_BINDINGS) return &ctx->bindings.shader_storage_buffers[index];
+            break;
+        default:
+            break;
+    }
+    return NULL;
+}
+
+static void share_group_free_contents(struct state_share_group* share) {
+    object_table_free(&share->textures);
+    object_table_free(&share->buffers);
+    object_table_free(&share->programs);
+    for (ptrdiff_t i = 0; i < arrlen(share->persistent_maps); ++i) page_track_release(share->persistent_maps[i].shadow);
+    arrfree(share->persistent_maps);
+    shader_cache_free_sources(&share->shader_sources);
+    // The driver deletes these along with the last context.
+    arrfree(share->orphans.buffers);
+    arrfree(share->orphans.programs);
+    arrfree(share->orphans.syncs);
+}
+
+static void share_group_release(struct state_share_group* share) {
+    if (atomic_fetch_sub_explicit(&share->refcount, 1, memory_order_acq_rel) != 1) return;
+    if (share == &g_default_share_group) return; // Freed in state_shutdown
+    share_group_free_contents(share);
+    free(share);
+}
+
+void state_shutdown(void) {
+    object_table_free(&g_default_context.vertex_arrays);
+    object_table_free(&g_default_context.framebuffers);
+    object_table_free(&g_default_context.transform_feedbacks);
+    share_group_free_contents(&g_default_share_group);
+}
+
+struct state_context* state_context_create(struct state_context* share_context) {
+    struct state_context* ctx = calloc(1, sizeof(*ctx));
+    if (!ctx) return NULL;
+    if (share_context) {
+        ctx->share = share_context->share;
+        atomic_fetch_add_explicit(&ctx->share->refcount, 1, memory_order_relaxed);
+    } else {
+        ctx->share = calloc(1, sizeof(*ctx->share));
+        if (!ctx->share) {
+            free(ctx);
+            return NULL;
+        }
+        *ctx->share = (struct state_share_group)SHARE_GROUP_INIT;
+    }
+    atomic_init(&ctx->refcount, 1);
+    ctx->render_state = (struct render_state)DEFAULT_RENDER_STATE;
+    ctx->vertex_arrays = (struct object_table)OBJECT_TABLE_INIT(struct vertex_array_object);
+    ctx->framebuffers = (struct object_table)OBJECT_TABLE_INIT(struct framebuffer_object);
+    ctx->transform_feedbacks = (struct object_table)OBJECT_TABLE_INIT(struct transform_feedback_object);
+    return ctx;
+}
+
+// Hands the layer's GL objects of a context to its share group, where they
+// stay until a context of the group deletes them. Buffers, programs and syncs
+// are shared, the other contexts can still see them.
+static void share_group_orphan_scratch(struct state_share_group* share, const struct state_scratch_objects* scratch) {
+    struct state_orphaned_objects* orphans = &share->orphans;
+    while (atomic_flag_test_and_set_explicit(&share->orphans_lock, memory_order_acquire)) {}
+#define ORPHAN(list, name) do { if (name) arrput(orphans->list, name); } while (0)
+    ORPHAN(programs, scratch->indirect_program);
+    ORPHAN(programs, scratch->edge_program);
+    ORPHAN(programs, scratch->clear_program);
+    ORPHAN(buffers, scratch->indirect_buffer);
+    ORPHAN(buffers, scratch->draw_id_buffer);
+    ORPHAN(buffers, scratch->draw_commands_buffer);
+    ORPHAN(buffers, scratch->stream_buffer);
+    ORPHAN(buffers, scratch->readback_buffer);
+    ORPHAN(buffers, scratch->clear_buffer);
+    for (int i = 0; i < STATE_EDGE_BUFFER_CACHE_SIZE; ++i) ORPHAN(buffers, scratch->edge_buffers[i].buffer);
+    for (GLuint i = 0; i < scratch->stream_fence_count; ++i) ORPHAN(syncs, scratch->stream_fences[i].fence);
+    for (int i = 0; i < STATE_READBACK_CACHE_SIZE; ++i) {
+        for (int j = 0; j < STATE_READBACK_DEPTH; ++j) {
+            ORPHAN(buffers, scratch->readbacks[i].staging[j]);
+            ORPHAN(syncs, scratch->readbacks[i].fences[j]);
+        }
+    }
+#undef ORPHAN
+    atomic_flag_clear_explicit(&share->orphans_lock, memory_order_release);
+}
+
+static void context_release(struct state_context* ctx) {
+    if (ctx == &g_default_context || atomic_fetch_sub_explicit(&ctx->refcount, 1, memory_order_acq_rel) != 1) return;
+    object_table_free(&ctx->vertex_arrays);
+    object_table_free(&ctx->framebuffers);
+    object_table_free(&ctx->transform_feedbacks);
+    share_group_orphan_scratch(ctx->share, &ctx->scratch);
+    share_group_release(ctx->share);
+    free(ctx);
+}
+
+void state_context_destroy(struct state_context* ctx) {
+    if (!ctx) return;
+    context_release(ctx);
+}
+
+void state_context_make_current(struct state_context* ctx) {
+    if (!ctx) ctx = &g_default_context;
+    struct state_context* previous = t_current_context;
+    if (ctx == previous) return;
+    if (ctx != &g_default_context) atomic_fetch_add_explicit(&ctx->refcount, 1, memory_order_relaxed);
+    t_current_context = ctx;
+    context_release(previous);
+}
+
+int state_take_orphaned_objects(struct state_orphaned_objects* orphans) {
+    struct state_share_group* share = t_current_context->share;
+    if (t_current_context == &g_default_context) return 0;
+    while (atomic_flag_test_and_set_explicit(&share->orphans_lock, memory_order_acquire)) {}
+    *orphans = share->orphans;
+    memset(&share->orphans, 0, sizeof(share->orphans));
+    atomic_flag_clear_explicit(&share->orphans_lock, memory_order_release);
+    return orphans->buffers || orphans->programs || orphans->syncs;
+}
+
+struct state_scratch_objects* state_get_scratch_objects(void) {
+    return &t_current_context->scratch;
+}
+
+struct shader_source_entry** state_shader_sources_lock(void) {
+    struct state_share_group* share = t_current_context->share;
+    while (atomic_flag_test_and_set_explicit(&share->shader_sources_lock, memory_order_acquire)) {}
+    return &share->shader_sources;
+}
+
+void state_shader_sources_unlock(void) {
+    atomic_flag_clear_explicit(&t_current_context->share->shader_sources_lock, memory_order_release);
+}
 
 void state_texture_set_target(GLuint texture, GLenum target) {
+    struct state_context* ctx = t_current_context;
     if (texture == 0) return;
-    hmput(g_texture_target_map, texture, target);
+    struct texture_object* object = object_table_lookup(&ctx->share->textures, texture);
+    if (object && object->target == target) return;
+    object = object_table_fetch(&ctx->share->textures, texture);
+    if (!object) return;
+    object->flags |= OBJECT_FLAG_ALIVE;
+    object->target = target;
 }
 
 GLenum state_texture_get_target(GLuint texture) {
+    struct state_context* ctx = t_current_context;
     if (texture == 0) return 0;
-    return hmget(g_texture_target_map, texture);
+    struct texture_object* object = object_table_lookup(&ctx->share->textures, texture);
+    return object ? object->target : 0;
 }
 
 void state_texture_remove(GLuint texture) {
+    struct state_context* ctx = t_current_context;
     if (texture == 0) return;
-    hmdel(g_texture_target_map, texture);
+    object_table_clear(&ctx->share->textures, texture);
+    for (GLuint unit = 0; unit < STATE_MAX_TEXTURE_UNITS; ++unit) {
+        for (int slot = 0; slot < TEXTURE_SLOT_COUNT; ++slot) {
+            if (ctx->bindings.textures[unit][slot] == texture) ctx->bindings.textures[unit][slot] = 0;
+        }
+    }
 }
 
 GLenum get_texture_binding_from_target(GLenum target) {
@@ -49,3 +561,915 @@ GLenum get_texture_binding_from_target(GLenum target) {
             return GL_TEXTURE_BINDING_2D;
     }
 }
+
+// --- Texture metadata ---
+
+// Bytes per texel of uncompressed formats, 0 for unknown or compressed ones.
+static GLsizei texture_format_texel_size(GLenum internal_format) {
+    switch (internal_format) {
+        case GL_R8: case GL_R8_SNORM: case GL_R8I: case GL_R8UI: case GL_RED: case GL_STENCIL_INDEX8:
+            return 1;
+        case GL_R16: case GL_R16_SNORM: case GL_R16F: case GL_R16I: case GL_R16UI:
+        case GL_RG8: case GL_RG8_SNORM: case GL_RG8I: case GL_RG8UI: case GL_RG:
+        case GL_RGB565: case GL_RGBA4: case GL_RGB5_A1: case GL_DEPTH_COMPONENT16:
+            return 2;
+        case GL_RGB8: case GL_RGB8_SNORM: case GL_RGB8I: case GL_RGB8UI: case GL_SRGB8: case GL_RGB:
+        case GL_DEPTH_COMPONENT24:
+            return 3;
+        case GL_R32F: case GL_R32I: case GL_R32UI:
+        case GL_RG16: case GL_RG16_SNORM: case GL_RG16F: case GL_RG16I: case GL_RG16UI:
+        case GL_RGBA8: case GL_RGBA8_SNORM: case GL_RGBA8I: case GL_RGBA8UI: case GL_SRGB8_ALPHA8: case GL_RGBA:
+        case GL_RGB10_A2: case GL_RGB10_A2UI: case GL_R11F_G11F_B10F: case GL_RGB9_E5:
+        case GL_DEPTH_COMPONENT32: case GL_DEPTH_COMPONENT32F: case GL_DEPTH24_STENCIL8: case GL_DEPTH_COMPONENT:
+        case GL_DEPTH_STENCIL:
+            return 4;
+        case GL_RGB16: case GL_RGB16_SNORM: case GL_RGB16F: case GL_RGB16I: case GL_RGB16UI:
+            return 6;
+        case GL_RG32F: case GL_RG32I: case GL_RG32UI:
+        case GL_RGBA16: case GL_RGBA16_SNORM: case GL_RGBA16F: case GL_RGBA16I: case GL_RGBA16UI:
+        case GL_DEPTH32F_STENCIL8:
+            return 8;
+        case GL_RGB32F: case GL_RGB32I: case GL_RGB32UI:
+            return 12;
+        case GL_RGBA32F: case GL_RGBA32I: case GL_RGBA32UI:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+static GLsizeiptr texture_level_size(const struct texture_object* object, const struct state_texture_level* entry) {
+    if (entry->internal_format == 0) return 0;
+    GLsizeiptr faces = object->target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+    if (entry->compressed_size) return faces * entry->compressed_size;
+    GLsizeiptr texel_size = texture_format_texel_size(entry->internal_format);
+    GLsizeiptr samples = entry->samples > 0 ? entry->samples : 1;
+    return faces * texel_size * samples * entry->width * entry->height * entry->depth;
+}
+
+// Estimated size in bytes of all levels, faces and layers, counting the
+// levels of unknown size as 0.
+static GLsizeiptr texture_memory_size(const struct texture_object* object) {
+    GLsizeiptr size = 0;
+    for (GLint level = 0; level < STATE_MAX_TEXTURE_LEVELS; ++level) {
+        size += texture_level_size(object, &object->levels[level]);
+    }
+    return size;
+}
+
+// Moves STATS_TEXTURE_BYTES by the change in object's size since before.
+// Shrinking wraps the unsigned add around, which subtracts.
+static void texture_memory_changed(const struct texture_object* object, GLsizeiptr before) {
+    GLsizeiptr after = texture_memory_size(object);
+    if (after != before) stats_add(STATS_TEXTURE_BYTES, (uint64_t)(after - before));
+}
+
+static struct texture_object* texture_object_fetch(GLuint texture) {
+    if (texture == 0) return NULL;
+    struct texture_object* object = object_table_fetch(&t_current_context->share->textures, texture);
+    if (object) object->flags |= OBJECT_FLAG_ALIVE;
+    return object;
+}
+
+static struct texture_object* texture_object_lookup(GLuint texture) {
+    if (texture == 0) return NULL;
+    return object_table_lookup(&t_current_context->share->textures, texture);
+}
+
+static void texture_level_set(struct state_texture_level* entry, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth, GLsizei samples, GLsizei compressed_size) {
+    entry->width = width;
+    entry->height = height;
+    entry->depth = depth;
+    entry->internal_format = internal_format;
+    entry->samples = samples;
+    entry->compressed_size = compressed_size;
+}
+
+void state_texture_set_image(GLuint texture, GLint level, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth) {
+    if (level < 0 || level >= STATE_MAX_TEXTURE_LEVELS) return;
+    struct texture_object* object = texture_object_fetch(texture);
+    if (!object) return;
+    GLsizeiptr before = texture_memory_size(object);
+    texture_level_set(&object->levels[level], internal_format, width, height, depth, 0, 0);
+    texture_memory_changed(object, before);
+}
+
+void state_texture_set_compressed_image(GLuint texture, GLint level, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth, GLsizei image_size) {
+    if (level < 0 || level >= STATE_MAX_TEXTURE_LEVELS) return;
+    struct texture_object* object = texture_object_fetch(texture);
+    if (!object) return;
+    GLsizeiptr before = texture_memory_size(object);
+    // Cube faces are specified one at a time, so record the size of a single face.
+    texture_level_set(&object->levels[level], internal_format, width, height, depth, 0, image_size);
+    texture_memory_changed(object, before);
+}
+
+void state_texture_set_storage(GLuint texture, GLsizei levels, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth, GLsizei samples) {
+    struct texture_object* object = texture_object_fetch(texture);
+    if (!object) return;
+    // Only 3D textures shrink in depth, array layers are kept.
+    GLsizeiptr before = texture_memory_size(object);
+    int minify_depth = object->target == GL_TEXTURE_3D;
+    memset(object->levels, 0, sizeof(object->levels));
+    object->immutable = GL_TRUE;
+    if (levels > STATE_MAX_TEXTURE_LEVELS) levels = STATE_MAX_TEXTURE_LEVELS;
+    for (GLsizei level = 0; level < levels; ++level) {
+        texture_level_set(&object->levels[level], internal_format, width, height, depth, samples, 0);
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+        if (minify_depth) depth = depth > 1 ? depth / 2 : 1;
+    }
+    texture_memory_changed(object, before);
+}
+
+void state_texture_generate_levels(GLuint texture) {
+    struct texture_object* object = texture_object_lookup(texture);
+    if (!object || object->immutable) return;
+    // Level 0 is assumed to be the base level.
+    struct state_texture_level base = object->levels[0];
+    if (base.internal_format == 0 || base.compressed_size) return;
+    GLsizeiptr before = texture_memory_size(object);
+    int minify_depth = object->target == GL_TEXTURE_3D;
+    GLsizei width = base.width, height = base.height, depth = base.depth;
+    for (GLint level = 1; level < STATE_MAX_TEXTURE_LEVELS && (width > 1 || height > 1 || (minify_depth && depth > 1)); ++level) {
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+        if (minify_depth) depth = depth > 1 ? depth / 2 : 1;
+        texture_level_set(&object->levels[level], base.internal_format, width, height, depth, 0, 0);
+    }
+    texture_memory_changed(object, before);
+}
+
+const struct state_texture_level* state_texture_get_level(GLuint texture, GLint level) {
+    if (level < 0 || level >= STATE_MAX_TEXTURE_LEVELS) return NULL;
+    struct texture_object* object = texture_object_lookup(texture);
+    if (!object || object->levels[level].internal_format == 0) return NULL;
+    return &object->levels[level];
+}
+
+// --- Buffers ---
+
+static GLuint* driver_copy_buffer(struct state_context* ctx, GLenum target) {
+    if (target == GL_COPY_READ_BUFFER) return &ctx->bindings.driver_copy_buffers[0];
+    if (target == GL_COPY_WRITE_BUFFER) return &ctx->bindings.driver_copy_buffers[1];
+    return NULL;
+}
+
+int state_buffer_bind(GLenum target, GLuint buffer) {
+    struct state_context* ctx = t_current_context;
+    GLuint* driver_binding = driver_copy_buffer(ctx, target);
+    if (driver_binding) {
+        // The copy targets may hold a scratch binding, so compare against the driver.
+        ctx->bindings.buffers[target == GL_COPY_READ_BUFFER ? BUFFER_SLOT_COPY_READ : BUFFER_SLOT_COPY_WRITE] = buffer;
+        return state_buffer_bind_scratch(target, buffer);
+    }
+    int slot = buffer_slot_from_target(target);
+    if (slot < 0) return 1;
+    if (ctx->bindings.buffers[slot] == buffer) return 0;
+    ctx->bindings.buffers[slot] = buffer;
+    if (buffer != 0) object_table_mark_alive(&ctx->share->buffers, buffer);
+    if (slot == BUFFER_SLOT_ELEMENT_ARRAY) vertex_array_set_element_buffer(ctx->bindings.vertex_array, buffer);
+    return 1;
+}
+
+int state_buffer_bind_scratch(GLenum target, GLuint buffer) {
+    struct state_context* ctx = t_current_context;
+    GLuint* driver_binding = driver_copy_buffer(ctx, target);
+    if (!driver_binding || *driver_binding == buffer) return 0;
+    *driver_binding = buffer;
+    if (buffer != 0) object_table_mark_alive(&ctx->share->buffers, buffer);
+    return 1;
+}
+
+int state_buffer_sync_scratch(GLenum target) {
+    struct state_context* ctx = t_current_context;
+    GLuint* driver_binding = driver_copy_buffer(ctx, target);
+    if (!driver_binding) return 0;
+    GLuint buffer = ctx->bindings.buffers[target == GL_COPY_READ_BUFFER ? BUFFER_SLOT_COPY_READ : BUFFER_SLOT_COPY_WRITE];
+    if (*driver_binding == buffer) return 0;
+    *driver_binding = buffer;
+    return 1;
+}
+
+GLuint state_buffer_get_scratch_binding(GLenum target) {
+    GLuint* driver_binding = driver_copy_buffer(t_current_context, target);
+    return driver_binding ? *driver_binding : 0;
+}
+
+void state_buffer_bind_indexed(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    // Indexed binds also update the generic binding point.
+    struct state_context* ctx = t_current_context;
+    state_buffer_bind(target, buffer);
+    struct indexed_buffer_binding* binding = indexed_binding(ctx, target, index);
+    if (!binding) return;
+    binding->buffer = buffer;
+    binding->offset = offset;
+    binding->size = size;
+}
+
+GLuint state_buffer_get_binding(GLenum target) {
+    struct state_context* ctx = t_current_context;
+    int slot = buffer_slot_from_target(target);
+    if (slot < 0) return 0;
+    return ctx->bindings.buffers[slot];
+}
+
+GLuint state_buffer_get_indexed_binding(GLenum target, GLuint index) {
+    struct state_context* ctx = t_current_context;
+    struct indexed_buffer_binding* binding = indexed_binding(ctx, target, index);
+    return binding ? binding->buffer : 0;
+}
+
+void state_buffer_remove(GLuint buffer) {
+    struct state_context* ctx = t_current_context;
+    if (buffer == 0) return;
+    for (int slot = 0; slot < BUFFER_SLOT_COUNT; ++slot) {
+        if (ctx->bindings.buffers[slot] == buffer) ctx->bindings.buffers[slot] = 0;
+    }
+    for (int i = 0; i < 2; ++i) {
+        if (ctx->bindings.driver_copy_buffers[i] == buffer) ctx->bindings.driver_copy_buffers[i] = 0;
+    }
+    for (GLuint i = 0; i < STATE_MAX_UNIFORM_BUFFER_BINDINGS; ++i) {
+        if (ctx->bindings.uniform_buffers[i].buffer == buffer) memset(&ctx->bindings.uniform_buffers[i], 0, sizeof(struct indexed_buffer_binding));
+    }
+    for (GLuint i = 0; i < STATE_MAX_SHADER_STORAGE_BUFFER_BINDINGS; ++i) {
+        if (ctx->bindings.shader_storage_buffers[i].buffer == buffer) memset(&ctx->bindings.shader_storage_buffers[i], 0, sizeof(struct indexed_buffer_binding));
+    }
+    if (vertex_array_element_buffer(ctx->bindings.vertex_array) == buffer) {
+        vertex_array_set_element_buffer(ctx->bindings.vertex_array, 0);
+    }
+    object_table_clear(&ctx->share->buffers, buffer);
+}
+
+// Generations are drawn from one counter, so caches keyed by buffer name and
+// generation can't mistake a deleted buffer for a new one with the same name.
+static GLuint buffer_next_generation(void) {
+    static _Atomic GLuint counter;
+    return atomic_fetch_add_explicit(&counter, 1, memory_order_relaxed) + 1;
+}
+
+static struct buffer_object* buffer_object_fetch(GLuint buffer) {
+    if (buffer == 0) return NULL;
+    return object_table_fetch(&t_current_context->share->buffers, buffer);
+}
+
+void state_buffer_set_data(GLuint buffer, GLsizeiptr size, GLenum usage) {
+    struct buffer_object* object = buffer_object_fetch(buffer);
+    if (!object) return;
+    // Respecifying the data store also unmaps it.
+    memset(&object->info, 0, sizeof(object->info));
+    object->flags |= OBJECT_FLAG_ALIVE | OBJECT_FLAG_STORAGE;
+    object->info.size = size;
+    object->info.usage = usage;
+    object->generation = buffer_next_generation();
+    object->max_index = UINT32_MAX;
+}
+
+void state_buffer_set_storage(GLuint buffer, GLsizeiptr size, GLbitfield flags) {
+    struct buffer_object* object = buffer_object_fetch(buffer);
+    if (!object) return;
+    memset(&object->info, 0, sizeof(object->info));
+    object->flags |= OBJECT_FLAG_ALIVE | OBJECT_FLAG_STORAGE;
+    object->info.size = size;
+    object->info.usage = GL_DYNAMIC_DRAW;
+    object->info.storage_flags = flags;
+    object->info.immutable = GL_TRUE;
+    object->generation = buffer_next_generation();
+    object->max_index = UINT32_MAX;
+}
+
+void state_buffer_set_mapping(GLuint buffer, void* pointer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    struct buffer_object* object = buffer_object_fetch(buffer);
+    if (!object) return;
+    // Writes through a mapping land any time until it is unmapped.
+    if ((access | object->info.map_access) & GL_MAP_WRITE_BIT) {
+        object->generation = buffer_next_generation();
+        object->max_index = UINT32_MAX;
+    }
+    object->info.map_pointer = pointer;
+    object->info.map_offset = offset;
+    object->info.map_length = length;
+    object->info.map_access = access;
+}
+
+void state_buffer_clear_mapping(GLuint buffer) {
+    state_buffer_set_mapping(buffer, NULL, 0, 0, 0);
+}
+
+const struct state_buffer_info* state_buffer_get_info(GLuint buffer) {
+    if (buffer == 0) return NULL;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object || !(object->flags & OBJECT_FLAG_STORAGE)) return NULL;
+    return &object->info;
+}
+
+void state_buffer_mirror_enable(GLuint buffer) {
+    struct buffer_object* object = buffer_object_fetch(buffer);
+    if (object) object->flags |= OBJECT_FLAG_MIRROR;
+}
+
+void state_buffer_mirror_reset(GLuint buffer, const void* data) {
+    if (buffer == 0) return;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object || !(object->flags & OBJECT_FLAG_MIRROR)) return;
+    free(object->mirror);
+    object->mirror = NULL;
+    if (object->info.size <= 0) return;
+    // A store specified without data is undefined, so any contents will do.
+    object->mirror = data ? malloc(object->info.size) : calloc(1, object->info.size);
+    if (object->mirror && data) memcpy(object->mirror, data, object->info.size);
+}
+
+void state_buffer_mirror_write(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+    if (buffer == 0) return;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object || !object->mirror) return;
+    if (offset < 0 || size < 0 || offset + size > object->info.size || !data) {
+        // Out-of-range writes fail in the driver too, but don't trust the copy anymore.
+        state_buffer_mirror_invalidate(buffer);
+        return;
+    }
+    memcpy(object->mirror + offset, data, size);
+}
+
+void state_buffer_mirror_invalidate(GLuint buffer) {
+    if (buffer == 0) return;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object || !object->mirror) return;
+    free(object->mirror);
+    object->mirror = NULL;
+}
+
+const void* state_buffer_get_mirror(GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (buffer == 0) return NULL;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object || !object->mirror) return NULL;
+    if (offset < 0 || size < 0 || offset + size > object->info.size) return NULL;
+    return object->mirror + offset;
+}
+
+void state_buffer_modified(GLuint buffer) {
+    if (buffer == 0) return;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (object) object->generation = buffer_next_generation();
+}
+
+void state_buffer_mark_gpu_written(GLuint buffer) {
+    struct buffer_object* object = buffer_object_fetch(buffer);
+    if (object) object->flags |= OBJECT_FLAG_GPU_WRITTEN;
+}
+
+GLuint state_buffer_get_generation(GLuint buffer) {
+    if (buffer == 0) return 0;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object) return 0;
+    if (object->flags & OBJECT_FLAG_GPU_WRITTEN) object->generation = buffer_next_generation();
+    return object->generation;
+}
+
+GLuint state_buffer_note_upload(GLuint buffer, GLuint frame) {
+    if (buffer == 0) return 0;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object) return 0;
+    if (object->upload_frame != frame) {
+        object->upload_streak = object->upload_frame + 1 == frame ? object->upload_streak + 1 : 1;
+        object->upload_frame = frame;
+    }
+    return object->upload_streak;
+}
+
+void state_buffer_set_max_index(GLuint buffer, GLuint max_index) {
+    if (buffer == 0) return;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (object) object->max_index = max_index;
+}
+
+void state_buffer_raise_max_index(GLuint buffer, GLuint max_index) {
+    if (buffer == 0) return;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (object && max_index > object->max_index) object->max_index = max_index;
+}
+
+GLuint state_buffer_get_max_index(GLuint buffer) {
+    if (buffer == 0) return UINT32_MAX;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    if (!object || (object->flags & OBJECT_FLAG_GPU_WRITTEN)) return UINT32_MAX;
+    return object->max_index;
+}
+
+struct state_index_copy* state_buffer_get_index_copy(GLuint buffer) {
+    if (buffer == 0) return NULL;
+    struct buffer_object* object = object_table_lookup(&t_current_context->share->buffers, buffer);
+    return object ? &object->index_copy : NULL;
+}
+
+void state_persistent_map_add(const struct state_persistent_map* map) {
+    struct state_share_group* share = t_current_context->share;
+    while (atomic_flag_test_and_set_explicit(&share->persistent_maps_lock, memory_order_acquire)) {}
+    arrput(share->persistent_maps, *map);
+    atomic_store_explicit(&share->persistent_map_count, (int)arrlen(share->persistent_maps), memory_order_relaxed);
+    atomic_flag_clear_explicit(&share->persistent_maps_lock, memory_order_release);
+}
+
+int state_persistent_map_remove(GLuint buffer, struct state_persistent_map* map) {
+    struct state_share_group* share = t_current_context->share;
+    if (buffer == 0 || atomic_load_explicit(&share->persistent_map_count, memory_order_relaxed) == 0) return 0;
+    int found = 0;
+    while (atomic_flag_test_and_set_explicit(&share->persistent_maps_lock, memory_order_acquire)) {}
+    for (ptrdiff_t i = 0; i < arrlen(share->persistent_maps); ++i) {
+        if (share->persistent_maps[i].buffer != buffer) continue;
+        *map = share->persistent_maps[i];
+        arrdelswap(share->persistent_maps, i);
+        found = 1;
+        break;
+    }
+    atomic_store_explicit(&share->persistent_map_count, (int)arrlen(share->persistent_maps), memory_order_relaxed);
+    atomic_flag_clear_explicit(&share->persistent_maps_lock, memory_order_release);
+    return found;
+}
+
+int state_persistent_map_get(GLuint buffer, struct state_persistent_map* map) {
+    struct state_share_group* share = t_current_context->share;
+    if (buffer == 0 || atomic_load_explicit(&share->persistent_map_count, memory_order_relaxed) == 0) return 0;
+    int found = 0;
+    while (atomic_flag_test_and_set_explicit(&share->persistent_maps_lock, memory_order_acquire)) {}
+    for (ptrdiff_t i = 0; i < arrlen(share->persistent_maps) && !found; ++i) {
+        if (share->persistent_maps[i].buffer != buffer) continue;
+        *map = share->persistent_maps[i];
+        page_track_retain(map->shadow);
+        found = 1;
+    }
+    atomic_flag_clear_explicit(&share->persistent_maps_lock, memory_order_release);
+    return found;
+}
+
+size_t state_persistent_maps_get(struct state_persistent_map** maps) {
+    struct state_share_group* share = t_current_context->share;
+    if (atomic_load_explicit(&share->persistent_map_count, memory_order_relaxed) == 0) return 0;
+    while (atomic_flag_test_and_set_explicit(&share->persistent_maps_lock, memory_order_acquire)) {}
+    size_t count = arrlen(share->persistent_maps);
+    arrsetlen(*maps, count);
+    for (size_t i = 0; i < count; ++i) {
+        (*maps)[i] = share->persistent_maps[i];
+        page_track_retain((*maps)[i].shadow);
+    }
+    atomic_flag_clear_explicit(&share->persistent_maps_lock, memory_order_release);
+    return count;
+}
+
+// --- Vertex arrays ---
+
+int state_vertex_array_bind(GLuint array) {
+    struct state_context* ctx = t_current_context;
+    if (ctx->bindings.vertex_array == array) return 0;
+    ctx->bindings.vertex_array = array;
+    ctx->bindings.buffers[BUFFER_SLOT_ELEMENT_ARRAY] = vertex_array_element_buffer(array);
+    if (array != 0) object_table_mark_alive(&ctx->vertex_arrays, array);
+    return 1;
+}
+
+GLuint state_vertex_array_get_binding(void) {
+    struct state_context* ctx = t_current_context;
+    return ctx->bindings.vertex_array;
+}
+
+void state_vertex_array_set_element_buffer(GLuint array, GLuint buffer) {
+    struct state_context* ctx = t_current_context;
+    vertex_array_set_element_buffer(array, buffer);
+    if (array == ctx->bindings.vertex_array) ctx->bindings.buffers[BUFFER_SLOT_ELEMENT_ARRAY] = buffer;
+}
+
+void state_vertex_array_set_buffer(GLuint array, GLuint binding, GLuint buffer, GLintptr offset, GLsizei stride) {
+    struct state_context* ctx = t_current_context;
+    if (binding >= STATE_MAX_VERTEX_BINDINGS) return;
+    struct vertex_array_object* object = object_table_fetch(&ctx->vertex_arrays, array);
+    if (!object) return;
+    object->bindings[binding].buffer = buffer;
+    object->bindings[binding].offset = offset;
+    object->bindings[binding].stride = stride;
+}
+
+void state_vertex_array_set_divisor(GLuint array, GLuint binding, GLuint divisor) {
+    struct state_context* ctx = t_current_context;
+    struct vertex_array_object* object = object_table_fetch(&ctx->vertex_arrays, array);
+    if (!object) return;
+    GLuint bit = 1u << (binding < 31 ? binding : 31);
+    if (divisor) object->instanced_bindings |= bit;
+    else if (binding < 31) object->instanced_bindings &= ~bit;
+    if (binding < STATE_MAX_VERTEX_BINDINGS) object->bindings[binding].divisor = divisor;
+}
+
+int state_vertex_array_is_instanced(GLuint array) {
+    return state_vertex_array_get_instanced(array) != 0;
+}
+
+GLuint state_vertex_array_get_instanced(GLuint array) {
+    struct state_context* ctx = t_current_context;
+    struct vertex_array_object* object = object_table_lookup(&ctx->vertex_arrays, array);
+    return object ? object->instanced_bindings : 0;
+}
+
+const struct state_vertex_binding* state_vertex_array_get_bindings(GLuint array) {
+    struct state_context* ctx = t_current_context;
+    struct vertex_array_object* object = object_table_lookup(&ctx->vertex_arrays, array);
+    return object ? object->bindings : NULL;
+}
+
+void state_vertex_array_set_base_instance(GLuint array, GLuint base_instance) {
+    struct state_context* ctx = t_current_context;
+    struct vertex_array_object* object = object_table_fetch(&ctx->vertex_arrays, array);
+    if (!object || object->base_instance == base_instance) return;
+    if (object->base_instance == 0) ctx->rebased_vertex_arrays++;
+    else if (base_instance == 0) ctx->rebased_vertex_arrays--;
+    object->base_instance = base_instance;
+}
+
+GLuint state_vertex_array_get_base_instance(GLuint array) {
+    struct state_context* ctx = t_current_context;
+    if (ctx->rebased_vertex_arrays == 0) return 0;
+    struct vertex_array_object* object = object_table_lookup(&ctx->vertex_arrays, array);
+    return object ? object->base_instance : 0;
+}
+
+void state_vertex_array_remove(GLuint array) {
+    struct state_context* ctx = t_current_context;
+    if (array == 0) return;
+    state_vertex_array_set_base_instance(array, 0);
+    object_table_clear(&ctx->vertex_arrays, array);
+    if (ctx->bindings.vertex_array == array) state_vertex_array_bind(0);
+}
+
+// --- Framebuffers ---
+
+int state_framebuffer_bind(GLenum target, GLuint framebuffer) {
+    struct state_context* ctx = t_current_context;
+    int changed = 0;
+    if ((target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER) && ctx->bindings.read_framebuffer != framebuffer) {
+        ctx->bindings.read_framebuffer = framebuffer;
+        changed = 1;
+    }
+    if ((target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER) && ctx->bindings.draw_framebuffer != framebuffer) {
+        ctx->bindings.draw_framebuffer = framebuffer;
+        changed = 1;
+    }
+    if (changed && framebuffer != 0) object_table_mark_alive(&ctx->framebuffers, framebuffer);
+    return changed;
+}
+
+GLuint state_framebuffer_get_binding(GLenum target) {
+    // GL_FRAMEBUFFER_BINDING is an alias of GL_DRAW_FRAMEBUFFER_BINDING.
+    struct state_context* ctx = t_current_context;
+    return target == GL_READ_FRAMEBUFFER ? ctx->bindings.read_framebuffer : ctx->bindings.draw_framebuffer;
+}
+
+void state_framebuffer_remove(GLuint framebuffer) {
+    struct state_context* ctx = t_current_context;
+    if (framebuffer == 0) return;
+    if (ctx->bindings.read_framebuffer == framebuffer) ctx->bindings.read_framebuffer = 0;
+    if (ctx->bindings.draw_framebuffer == framebuffer) ctx->bindings.draw_framebuffer = 0;
+    object_table_clear(&ctx->framebuffers, framebuffer);
+}
+
+// --- Transform feedback ---
+
+int state_transform_feedback_bind(GLuint id) {
+    struct state_context* ctx = t_current_context;
+    if (ctx->bindings.transform_feedback == id) return 0;
+    ctx->bindings.transform_feedback = id;
+    if (id != 0) object_table_mark_alive(&ctx->transform_feedbacks, id);
+    return 1;
+}
+
+GLuint state_transform_feedback_get_binding(void) {
+    return t_current_context->bindings.transform_feedback;
+}
+
+struct state_transform_feedback* state_transform_feedback_get(GLuint id) {
+    struct transform_feedback_object* object = object_table_fetch(&t_current_context->transform_feedbacks, id);
+    return object ? &object->counts : NULL;
+}
+
+void state_transform_feedback_remove(GLuint id) {
+    struct state_context* ctx = t_current_context;
+    if (id == 0) return;
+    struct transform_feedback_object* object = object_table_lookup(&ctx->transform_feedbacks, id);
+    if (object && ctx->counted_transform_feedback == &object->counts) ctx->counted_transform_feedback = NULL;
+    if (ctx->bindings.transform_feedback == id) ctx->bindings.transform_feedback = 0;
+    object_table_clear(&ctx->transform_feedbacks, id);
+}
+
+void state_transform_feedback_set_counted(struct state_transform_feedback* counts) {
+    t_current_context->counted_transform_feedback = counts;
+}
+
+struct state_transform_feedback* state_transform_feedback_get_counted(void) {
+    return t_current_context->counted_transform_feedback;
+}
+
+void state_transform_feedback_app_query(GLboolean active) {
+    t_current_context->app_primitives_query = active;
+}
+
+int state_transform_feedback_get_app_query(void) {
+    return t_current_context->app_primitives_query;
+}
+
+// --- Textures and samplers ---
+
+int state_texture_set_active_unit(GLenum texture) {
+    struct state_context* ctx = t_current_context;
+    GLuint unit = texture - GL_TEXTURE0;
+    if (unit >= STATE_MAX_TEXTURE_UNITS) {
+        fprintf(stderr, "Warning: texture unit %u is beyond the tracked range in state_texture_set_active_unit\n", unit);
+        ctx->bindings.driver_active_texture_unit = STATE_MAX_TEXTURE_UNITS; // Unknown, forces the next sync
+        return 1;
+    }
+    ctx->bindings.active_texture_unit = unit;
+    return state_texture_set_driver_active_unit(unit);
+}
+
+int state_texture_set_driver_active_unit(GLuint unit) {
+    struct state_context* ctx = t_current_context;
+    if (ctx->bindings.driver_active_texture_unit == unit) return 0;
+    ctx->bindings.driver_active_texture_unit = unit;
+    return 1;
+}
+
+int state_texture_sync_active_unit(void) {
+    struct state_context* ctx = t_current_context;
+    return state_texture_set_driver_active_unit(ctx->bindings.active_texture_unit);
+}
+
+GLenum state_texture_get_active_unit(void) {
+    struct state_context* ctx = t_current_context;
+    return GL_TEXTURE0 + ctx->bindings.active_texture_unit;
+}
+
+int state_texture_bind(GLenum target, GLuint texture) {
+    return state_texture_bind_unit(t_current_context->bindings.active_texture_unit, target, texture);
+}
+
+int state_texture_bind_unit(GLuint unit, GLenum target, GLuint texture) {
+    struct state_context* ctx = t_current_context;
+    int slot = texture_slot_from_target(target);
+    if (slot < 0 || unit >= STATE_MAX_TEXTURE_UNITS) return 1;
+    if (ctx->bindings.textures[unit][slot] == texture) return 0;
+    ctx->bindings.textures[unit][slot] = texture;
+    return 1;
+}
+
+GLuint state_texture_get_binding(GLenum target) {
+    struct state_context* ctx = t_current_context;
+    int slot = texture_slot_from_target(target);
+    if (slot < 0) return 0;
+    return ctx->bindings.textures[ctx->bindings.active_texture_unit][slot];
+}
+
+int state_sampler_bind(GLuint unit, GLuint sampler) {
+    struct state_context* ctx = t_current_context;
+    if (unit >= STATE_MAX_TEXTURE_UNITS) return 1;
+    if (ctx->bindings.samplers[unit] == sampler) return 0;
+    ctx->bindings.samplers[unit] = sampler;
+    return 1;
+}
+
+GLuint state_sampler_get_binding(GLuint unit) {
+    struct state_context* ctx = t_current_context;
+    if (unit >= STATE_MAX_TEXTURE_UNITS) return 0;
+    return ctx->bindings.samplers[unit];
+}
+
+void state_sampler_remove(GLuint sampler) {
+    struct state_context* ctx = t_current_context;
+    if (sampler == 0) return;
+    for (GLuint unit = 0; unit < STATE_MAX_TEXTURE_UNITS; ++unit) {
+        if (ctx->bindings.samplers[unit] == sampler) ctx->bindings.samplers[unit] = 0;
+    }
+}
+
+// --- Programs ---
+
+int state_program_use(GLuint program) {
+    struct state_context* ctx = t_current_context;
+    if (ctx->bindings.program == program) return 0;
+    ctx->bindings.program = program;
+    if (program != 0) object_table_mark_alive(&ctx->share->programs, program);
+    return 1;
+}
+
+GLuint state_program_get_current(void) {
+    struct state_context* ctx = t_current_context;
+    return ctx->bindings.program;
+}
+
+static void program_uniform_locations_reset(struct program_object* object) {
+    atomic_flag* lock = &t_current_context->share->uniform_locations_lock;
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {}
+    shfree(object->uniform_locations);
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+void state_program_set_linked(GLuint program, const struct state_program_info* info) {
+    if (program == 0) return;
+    struct program_object* object = object_table_fetch(&t_current_context->share->programs, program);
+    if (!object) return;
+    object->flags |= OBJECT_FLAG_ALIVE | OBJECT_FLAG_LINKED;
+    object->info = *info;
+    program_uniform_locations_reset(object);
+}
+
+void state_program_set_unlinked(GLuint program) {
+    if (program == 0) return;
+    struct program_object* object = object_table_lookup(&t_current_context->share->programs, program);
+    if (!object) return;
+    object->flags &= ~OBJECT_FLAG_LINKED;
+    memset(&object->info, 0, sizeof(object->info));
+    program_uniform_locations_reset(object);
+}
+
+const struct state_program_info* state_program_get_info(GLuint program) {
+    if (program == 0) return NULL;
+    struct program_object* object = object_table_lookup(&t_current_context->share->programs, program);
+    if (!object || !(object->flags & OBJECT_FLAG_LINKED)) return NULL;
+    return &object->info;
+}
+
+int state_program_lookup_uniform(GLuint program, const GLchar* name, GLint* location) {
+    if (program == 0) return 0;
+    struct program_object* object = object_table_lookup(&t_current_context->share->programs, program);
+    if (!object || !(object->flags & OBJECT_FLAG_LINKED)) return 0;
+    atomic_flag* lock = &t_current_context->share->uniform_locations_lock;
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {}
+    ptrdiff_t index = shgeti(object->uniform_locations, name);
+    if (index >= 0) *location = object->uniform_locations[index].value;
+    atomic_flag_clear_explicit(lock, memory_order_release);
+    return index >= 0;
+}
+
+void state_program_cache_uniform(GLuint program, const GLchar* name, GLint location) {
+    // Only linked programs have stable locations.
+    if (program == 0) return;
+    struct program_object* object = object_table_lookup(&t_current_context->share->programs, program);
+    if (!object || !(object->flags & OBJECT_FLAG_LINKED)) return;
+    atomic_flag* lock = &t_current_context->share->uniform_locations_lock;
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {}
+    if (!object->uniform_locations) sh_new_strdup(object->uniform_locations);
+    shput(object->uniform_locations, name, location);
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+void state_program_remove(GLuint program) {
+    // A deleted program stays current until replaced, so only its record goes.
+    struct state_context* ctx = t_current_context;
+    if (program == 0) return;
+    object_table_clear(&ctx->share->programs, program);
+}
+
+// --- Render state ---
+
+int state_render_enable(GLenum cap, GLboolean enabled) {
+    struct render_state* state = &t_current_context->render_state;
+    int slot = cap_slot_from_cap(cap);
+    if (slot < 0) return 1;
+    signed char value = enabled ? GL_TRUE : GL_FALSE;
+    if (state->caps[slot] == value) return 0;
+    state->caps[slot] = value;
+    return 1;
+}
+
+void state_render_enable_indexed(GLenum cap) {
+    // glEnablei/glDisablei leave the non-indexed value ambiguous until the next glEnable/glDisable.
+    struct render_state* state = &t_current_context->render_state;
+    int slot = cap_slot_from_cap(cap);
+    if (slot >= 0) state->caps[slot] = CAP_UNKNOWN;
+}
+
+int state_render_blend_func(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLenum value[4] = { src_rgb, dst_rgb, src_alpha, dst_alpha };
+    return render_state_update(state, state->blend_func, value, sizeof(value), RENDER_VALID_BLEND_FUNC);
+}
+
+void state_render_blend_func_indexed(void) {
+    struct render_state* state = &t_current_context->render_state;
+    state->valid &= ~RENDER_VALID_BLEND_FUNC;
+}
+
+int state_render_blend_equation(GLenum mode_rgb, GLenum mode_alpha) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLenum value[2] = { mode_rgb, mode_alpha };
+    return render_state_update(state, state->blend_equation, value, sizeof(value), RENDER_VALID_BLEND_EQUATION);
+}
+
+void state_render_blend_equation_indexed(void) {
+    struct render_state* state = &t_current_context->render_state;
+    state->valid &= ~RENDER_VALID_BLEND_EQUATION;
+}
+
+int state_render_blend_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLfloat value[4] = { red, green, blue, alpha };
+    return render_state_update(state, state->blend_color, value, sizeof(value), RENDER_VALID_BLEND_COLOR);
+}
+
+int state_render_depth_func(GLenum func) {
+    struct render_state* state = &t_current_context->render_state;
+    return render_state_update(state, &state->depth_func, &func, sizeof(func), RENDER_VALID_DEPTH_FUNC);
+}
+
+int state_render_depth_mask(GLboolean flag) {
+    struct render_state* state = &t_current_context->render_state;
+    return render_state_update(state, &state->depth_mask, &flag, sizeof(flag), RENDER_VALID_DEPTH_MASK);
+}
+
+int state_render_color_mask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLboolean value[4] = { red, green, blue, alpha };
+    return render_state_update(state, state->color_mask, value, sizeof(value), RENDER_VALID_COLOR_MASK);
+}
+
+void state_render_color_mask_indexed(void) {
+    struct render_state* state = &t_current_context->render_state;
+    state->valid &= ~RENDER_VALID_COLOR_MASK;
+}
+
+int state_render_cull_face(GLenum mode) {
+    struct render_state* state = &t_current_context->render_state;
+    return render_state_update(state, &state->cull_face, &mode, sizeof(mode), RENDER_VALID_CULL_FACE);
+}
+
+int state_render_front_face(GLenum mode) {
+    struct render_state* state = &t_current_context->render_state;
+    return render_state_update(state, &state->front_face, &mode, sizeof(mode), RENDER_VALID_FRONT_FACE);
+}
+
+int state_render_polygon_offset(GLfloat factor, GLfloat units) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLfloat value[2] = { factor, units };
+    return render_state_update(state, state->polygon_offset, value, sizeof(value), RENDER_VALID_POLYGON_OFFSET);
+}
+
+void state_render_polygon_offset_clamp(void) {
+    // The clamp is not shadowed, so the next glPolygonOffset must reach the driver to reset it.
+    struct render_state* state = &t_current_context->render_state;
+    state->valid &= ~RENDER_VALID_POLYGON_OFFSET;
+}
+
+int state_render_viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLint value[4] = { x, y, width, height };
+    return render_state_update(state, state->viewport, value, sizeof(value), RENDER_VALID_VIEWPORT);
+}
+
+int state_render_scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLint value[4] = { x, y, width, height };
+    return render_state_update(state, state->scissor, value, sizeof(value), RENDER_VALID_SCISSOR);
+}
+
+void state_render_scissor_indexed(GLuint first) {
+    // Scissor box 0 is the one glScissor sets.
+    struct render_state* state = &t_current_context->render_state;
+    if (first == 0) state->valid &= ~RENDER_VALID_SCISSOR;
+}
+
+int state_render_clear_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    struct render_state* state = &t_current_context->render_state;
+    const GLfloat value[4] = { red, green, blue, alpha };
+    return render_state_update(state, state->clear_color, value, sizeof(value), RENDER_VALID_CLEAR_COLOR);
+}
+
+GLboolean state_render_primitive_restart(GLenum cap, GLboolean enabled) {
+    struct render_state* state = &t_current_context->render_state;
+    if (cap == GL_PRIMITIVE_RESTART) state->primitive_restart = enabled;
+    else state->primitive_restart_fixed_index = enabled;
+    return state->primitive_restart || state->primitive_restart_fixed_index;
+}
+
+GLboolean state_render_get_primitive_restart_cap(GLenum cap) {
+    struct render_state* state = &t_current_context->render_state;
+    return cap == GL_PRIMITIVE_RESTART ? state->primitive_restart : state->primitive_restart_fixed_index;
+}
+
+void state_render_primitive_restart_index(GLuint index) {
+    t_current_context->render_state.primitive_restart_index = index;
+}
+
+GLuint state_render_get_primitive_restart_index(void) {
+    return t_current_context->render_state.primitive_restart_index;
+}
+
+int state_render_get_primitive_restart(GLuint* index) {
+    struct render_state* state = &t_current_context->render_state;
+    *index = state->primitive_restart_index;
+    // The fixed index takes precedence over the application's.
+    return state->primitive_restart && !state->primitive_restart_fixed_index;
+}
+
+void state_render_polygon_mode(GLenum mode) {
+    t_current_context->render_state.polygon_mode = mode;
+}
+
+GLenum state_render_get_polygon_mode(void) {
+    return t_current_context->render_state.polygon_mode;
+}
@@ -2,6 +2,128 @@
 #define STATE_H
 
 #include <GL/glcorearb.h>
+#include <stddef.h>
+
+#define STATE_MAX_TEXTURE_UNITS 96
+#define STATE_MAX_UNIFORM_BUFFER_BINDINGS 96
+#define STATE_MAX_SHADER_STORAGE_BUFFER_BINDINGS 32
+
+struct state_context;
+struct shader_source_entry;
+
+void state_shutdown(void);
+
+// Per-context layer state. Each thread has its own current context, and
+// contexts created with a share context share texture, buffer, program and
+// shader records. Threads with no current context use a built-in default.
+
+struct state_context* state_context_create(struct state_context* share_context);
+// Like GLX contexts, a destroyed context lives on until it is no longer
+// current on any thread.
+void state_context_destroy(struct state_context* ctx);
+void state_context_make_current(struct state_context* ctx);
+
+// Layer GL objects of freed contexts, left to their share group because the
+// layer can only delete them with a context of the group current. stb_ds
+// arrays.
+struct state_orphaned_objects {
+    GLuint* buffers;
+    GLuint* programs;
+    GLsync* syncs;
+};
+
+// Moves the orphaned objects of the current share group to orphans, for the
+// caller to delete and free. Returns 0 when there are none.
+int state_take_orphaned_objects(struct state_orphaned_objects* orphans);
+
+// GL_LINES index list of the triangles of one draw, for glPolygonMode(GL_LINE)
+// emulation. Element draws are keyed by their element buffer range and its
+// generation, array draws by their vertex range.
+#define STATE_EDGE_BUFFER_CACHE_SIZE 32
+
+struct state_edge_buffer {
+    GLuint buffer;       // 0 when the entry is free
+    GLsizeiptr size;
+    GLuint source;       // Element buffer, 0 for array draws
+    GLuint generation;
+    GLenum mode;
+    GLenum type;         // Source index type, 0 for array draws
+    GLintptr first;      // First index or vertex
+    GLsizei count;
+    GLenum edge_type;
+    GLsizei edge_count;
+    GLuint last_use;
+};
+
+// Fence of the streaming upload ring, signaled once the GPU is done with
+// everything allocated from the ring before it was inserted.
+#define STATE_STREAM_FENCES 8
+
+struct state_stream_fence {
+    GLsync fence;
+    GLuint64 allocated; // Ring bytes allocated when the fence was inserted
+};
+
+// Fenced copies of a buffer range for asynchronous glGetBufferSubData. Each
+// call reads the newest finished copy and starts the next one.
+#define STATE_READBACK_CACHE_SIZE 8
+#define STATE_READBACK_DEPTH 3
+
+struct state_readback {
+    GLuint buffer;       // 0 when the entry is free
+    GLintptr offset;
+    GLsizeiptr size;
+    GLuint staging[STATE_READBACK_DEPTH];
+    GLsync fences[STATE_READBACK_DEPTH];   // Copy in flight or unread, NULL for a free stage
+    GLuint serials[STATE_READBACK_DEPTH];  // Order the copies were made in
+    GLuint serial;
+    GLuint last_use;
+};
+
+// GL objects the layer creates for its own emulations, created lazily by the
+// emulations that need them. They belong to the current context and are
+// released by the driver along with it.
+struct state_scratch_objects {
+    GLuint indirect_program;           // Rewrites indirect draw commands on the GPU
+    GLboolean indirect_program_failed;
+    GLuint indirect_buffer;            // Per-draw base instances followed by the rewritten commands
+    GLsizeiptr indirect_buffer_size;
+    GLuint draw_id_buffer;             // Draw IDs 0..draw_id_count-1 for the glt_draw_id attribute
+    GLsizei draw_id_count;
+    GLuint draw_commands_buffer;       // Indirect commands built for client multi-draws
+    GLsizeiptr draw_commands_size;
+    GLuint edge_program;               // Builds wireframe edge lists on the GPU
+    GLboolean edge_program_failed;
+    struct state_edge_buffer edge_buffers[STATE_EDGE_BUFFER_CACHE_SIZE];
+    GLuint edge_buffer_clock;
+    GLuint stream_buffer;              // Staging ring streamed uploads are copied from
+    GLsizeiptr stream_size;
+    GLsizeiptr stream_head;            // Offset of the next allocation
+    GLuint64 stream_allocated;         // Bytes allocated so far, skipped ring tails included
+    GLuint64 stream_freed;             // Bytes of those the GPU is done with
+    struct state_stream_fence stream_fences[STATE_STREAM_FENCES]; // Oldest first
+    GLuint stream_fence_count;
+    GLuint frame;                      // Frames presented with this context current
+    GLuint readback_buffer;            // Staging copy for readbacks of buffers that can't be mapped
+    GLsizeiptr readback_buffer_size;
+    struct state_readback readbacks[STATE_READBACK_CACHE_SIZE];
+    GLuint readback_clock;
+    GLuint clear_program;              // Fills buffer ranges with a repeated pattern on the GPU
+    GLboolean clear_program_failed;
+    GLsizeiptr clear_max_range;        // Largest storage block range it can bind
+    GLint clear_alignment;             // Offset alignment of those ranges
+    GLuint clear_buffer;               // Copies of the last clear value, for clears without compute
+    GLsizeiptr clear_filled;           // Bytes of it holding copies
+    GLubyte clear_pattern[16];
+    GLuint clear_element_size;
+};
+
+struct state_scratch_objects* state_get_scratch_objects(void);
+
+// Shader sources of the current share group. The returned stb_ds map may only
+// be used until the matching unlock.
+struct shader_source_entry** state_shader_sources_lock(void);
+void state_shader_sources_unlock(void);
 
 // Texture related functions, used to implement direct state access
 
@@ -10,4 +132,266 @@ GLenum state_texture_get_target(GLuint texture);
 void state_texture_remove(GLuint texture);
 GLenum get_texture_binding_from_target(GLenum target);
 
+// Texture image metadata, recorded by the image and storage entry points so
+// level queries don't need a driver round-trip. The estimated size of every
+// texture is kept in STATS_TEXTURE_BYTES.
+
+#define STATE_MAX_TEXTURE_LEVELS 16
+
+struct state_texture_level {
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;             // Layer count for array textures
+    GLenum internal_format;
+    GLsizei samples;           // 0 unless multisampled
+    GLsizei compressed_size;   // Per face, 0 unless compressed
+};
+
+void state_texture_set_image(GLuint texture, GLint level, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth);
+void state_texture_set_compressed_image(GLuint texture, GLint level, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth, GLsizei image_size);
+void state_texture_set_storage(GLuint texture, GLsizei levels, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth, GLsizei samples);
+void state_texture_generate_levels(GLuint texture);
+// Returns NULL for levels that were never specified through the layer.
+const struct state_texture_level* state_texture_get_level(GLuint texture, GLint level);
+
+// Shadow of the current bindings, so emulations can save and restore them
+// without a glGetIntegerv round-trip to the driver. The bind functions return
+// non-zero when the call changes the driver's binding.
+//
+// DSA emulations bind buffers to GL_COPY_READ_BUFFER/GL_COPY_WRITE_BUFFER and
+// textures to a scratch unit without restoring them. The *_scratch and
+// *_sync functions track those driver-side bindings; the sync functions return
+// non-zero when the application's binding has to be put back before use.
+
+int state_buffer_bind(GLenum target, GLuint buffer);
+void state_buffer_bind_indexed(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+GLuint state_buffer_get_binding(GLenum target);
+int state_buffer_bind_scratch(GLenum target, GLuint buffer);
+int state_buffer_sync_scratch(GLenum target);
+GLuint state_buffer_get_scratch_binding(GLenum target);
+GLuint state_buffer_get_indexed_binding(GLenum target, GLuint index);
+void state_buffer_remove(GLuint buffer);
+
+// Buffer data store and mapping, recorded by the buffer entry points so the
+// layer does not have to query them back from the driver.
+
+struct state_buffer_info {
+    GLsizeiptr size;
+    GLenum usage;
+    GLbitfield storage_flags; // Only set for glBufferStorage
+    GLboolean immutable;
+    void* map_pointer;        // NULL when not mapped
+    GLintptr map_offset;
+    GLsizeiptr map_length;
+    GLbitfield map_access;
+};
+
+void state_buffer_set_data(GLuint buffer, GLsizeiptr size, GLenum usage);
+void state_buffer_set_storage(GLuint buffer, GLsizeiptr size, GLbitfield flags);
+void state_buffer_set_mapping(GLuint buffer, void* pointer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+void state_buffer_clear_mapping(GLuint buffer);
+// Returns NULL for buffers whose data store was never specified.
+const struct state_buffer_info* state_buffer_get_info(GLuint buffer);
+
+// CPU mirrors of indirect command buffers, so emulated indirect draws can read
+// commands without mapping. A buffer marked with state_buffer_mirror_enable
+// gets a mirror the next time its data store is specified, and loses it when
+// the GPU may write to it.
+
+void state_buffer_mirror_enable(GLuint buffer);
+void state_buffer_mirror_reset(GLuint buffer, const void* data);
+void state_buffer_mirror_write(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data);
+void state_buffer_mirror_invalidate(GLuint buffer);
+// Returns the mirrored bytes at offset, or NULL without an up-to-date mirror
+// covering the range.
+const void* state_buffer_get_mirror(GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+// Write counter of the data store, bumped for every change the layer sees.
+// Buffers bound where the GPU can write to them report a new generation on
+// every call from then on.
+void state_buffer_modified(GLuint buffer);
+void state_buffer_mark_gpu_written(GLuint buffer);
+GLuint state_buffer_get_generation(GLuint buffer);
+// Records a partial upload to buffer in frame and returns the number of
+// consecutive frames it has been uploaded to, this one included.
+GLuint state_buffer_note_upload(GLuint buffer, GLuint frame);
+
+// Largest 32-bit index written to the buffer, for index narrowing. Respecifying
+// the data store, writable mappings and GPU writes make it unknown
+// (UINT32_MAX) until the next scanned upload.
+void state_buffer_set_max_index(GLuint buffer, GLuint max_index);
+void state_buffer_raise_max_index(GLuint buffer, GLuint max_index);
+GLuint state_buffer_get_max_index(GLuint buffer);
+
+// Copy of an element buffer converted for the driver, with the primitive
+// restart index rewritten to all ones or 32-bit indices narrowed to 16 bits.
+// Valid while the conversion and the generation match the draw.
+struct state_index_copy {
+    GLuint buffer;        // 0 until created
+    GLenum type;          // Index type of the source
+    GLenum draw_type;     // Index type of the copy
+    GLuint restart_index;
+    GLuint generation;
+};
+
+// Returns NULL for buffers the layer has no record of.
+struct state_index_copy* state_buffer_get_index_copy(GLuint buffer);
+
+// Persistent mappings emulated without EXT_buffer_storage. The application
+// writes to a layer-owned shadow of the mapped range, and the layer uploads
+// what was written.
+struct page_track;
+
+struct state_persistent_map {
+    GLuint buffer;
+    GLintptr offset;           // Mapped range of the buffer
+    GLsizeiptr length;
+    GLbitfield access;
+    struct page_track* shadow; // Write-tracked unless the mapping is flushed explicitly
+};
+
+// The list owns a reference to each shadow. Mappings handed out carry a
+// reference of their own for the caller to release, so they stay usable
+// without a lock while other threads unmap them.
+void state_persistent_map_add(const struct state_persistent_map* map);
+// Takes the mapping of buffer out of the list, with the list's reference.
+// Returns 0 when it has none.
+int state_persistent_map_remove(GLuint buffer, struct state_persistent_map* map);
+// Copies the mapping of buffer. Returns 0 when it has none.
+int state_persistent_map_get(GLuint buffer, struct state_persistent_map* map);
+// Copies the mappings of the current share group to the stb_ds array *maps
+// and returns their number.
+size_t state_persistent_maps_get(struct state_persistent_map** maps);
+
+int state_vertex_array_bind(GLuint array);
+GLuint state_vertex_array_get_binding(void);
+void state_vertex_array_set_element_buffer(GLuint array, GLuint buffer);
+// Vertex buffer bindings and divisors, so emulations know whether the VAO has
+// instanced inputs and can offset them. Only the first
+// STATE_MAX_VERTEX_BINDINGS bindings are recorded.
+
+#define STATE_MAX_VERTEX_BINDINGS 16
+
+struct state_vertex_binding {
+    GLuint buffer;
+    GLsizei stride;    // Effective stride as the driver sees it
+    GLintptr offset;
+    GLuint divisor;
+};
+
+void state_vertex_array_set_buffer(GLuint array, GLuint binding, GLuint buffer, GLintptr offset, GLsizei stride);
+void state_vertex_array_set_divisor(GLuint array, GLuint binding, GLuint divisor);
+int state_vertex_array_is_instanced(GLuint array);
+// Bitmask of the bindings with a non-zero divisor, bit 31 covers 31 and up.
+GLuint state_vertex_array_get_instanced(GLuint array);
+// Returns NULL for arrays that have no recorded bindings.
+const struct state_vertex_binding* state_vertex_array_get_bindings(GLuint array);
+// Base instance emulation offsets the driver's instanced bindings and leaves
+// them offset until the next draw that needs another base instance.
+void state_vertex_array_set_base_instance(GLuint array, GLuint base_instance);
+GLuint state_vertex_array_get_base_instance(GLuint array);
+void state_vertex_array_remove(GLuint array);
+
+int state_framebuffer_bind(GLenum target, GLuint framebuffer);
+GLuint state_framebuffer_get_binding(GLenum target);
+void state_framebuffer_remove(GLuint framebuffer);
+
+// Primitive counts of the feedback passes of a transform feedback object, for
+// glDrawTransformFeedback emulation. Each pass is counted by a
+// GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN query from a small ring, so draws
+// can use the newest finished count without waiting for the last pass.
+#define STATE_XFB_QUERY_RING 4
+
+struct state_transform_feedback {
+    GLuint queries[STATE_XFB_QUERY_RING]; // 0 until the slot is first used
+    GLenum modes[STATE_XFB_QUERY_RING];   // Primitive mode of each slot's pass
+    GLuint passes[STATE_XFB_QUERY_RING];  // Pass number of each slot's pass
+    GLuint pending;       // Bitmask of the slots whose pass ended and whose result is unread
+    GLuint next;          // Slot of the next pass
+    GLuint pass_count;    // Passes counted so far
+    GLuint vertices;      // Vertices written by the newest pass read back
+    GLuint vertices_pass; // Pass number vertices belongs to, 0 before the first read
+};
+
+int state_transform_feedback_bind(GLuint id);
+GLuint state_transform_feedback_get_binding(void);
+// Returns NULL only on out of memory.
+struct state_transform_feedback* state_transform_feedback_get(GLuint id);
+void state_transform_feedback_remove(GLuint id);
+// Object whose active pass a layer query is counting, NULL when none is.
+void state_transform_feedback_set_counted(struct state_transform_feedback* counts);
+struct state_transform_feedback* state_transform_feedback_get_counted(void);
+// Whether the application has its own GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN
+// query active, which the layer's queries must not overlap.
+void state_transform_feedback_app_query(GLboolean active);
+int state_transform_feedback_get_app_query(void);
+
+int state_texture_set_active_unit(GLenum texture);
+GLenum state_texture_get_active_unit(void);
+int state_texture_set_driver_active_unit(GLuint unit);
+int state_texture_sync_active_unit(void);
+int state_texture_bind(GLenum target, GLuint texture);
+int state_texture_bind_unit(GLuint unit, GLenum target, GLuint texture);
+GLuint state_texture_get_binding(GLenum target);
+
+int state_sampler_bind(GLuint unit, GLuint sampler);
+GLuint state_sampler_get_binding(GLuint unit);
+void state_sampler_remove(GLuint sampler);
+
+// Per-program data resolved once after a successful link.
+
+struct state_program_info {
+    GLint draw_id_location;       // glt_draw_id, or -1
+    GLint base_instance_location; // glt_base_instance, or -1
+    GLint draw_id_attribute;      // glt_draw_id vertex input, or -1
+};
+
+int state_program_use(GLuint program);
+GLuint state_program_get_current(void);
+void state_program_set_linked(GLuint program, const struct state_program_info* info);
+void state_program_set_unlinked(GLuint program);
+// Returns NULL for programs that were not successfully linked through the layer.
+const struct state_program_info* state_program_get_info(GLuint program);
+// Uniform locations of linked programs, cached by name until the next link.
+int state_program_lookup_uniform(GLuint program, const GLchar* name, GLint* location);
+void state_program_cache_uniform(GLuint program, const GLchar* name, GLint location);
+void state_program_remove(GLuint program);
+
+// Shadow of the fixed-function render state. Each setter records the new value
+// and returns non-zero when it differs from the last known driver state.
+
+int state_render_enable(GLenum cap, GLboolean enabled);
+void state_render_enable_indexed(GLenum cap);
+int state_render_blend_func(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha);
+void state_render_blend_func_indexed(void);
+int state_render_blend_equation(GLenum mode_rgb, GLenum mode_alpha);
+void state_render_blend_equation_indexed(void);
+int state_render_blend_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+int state_render_depth_func(GLenum func);
+int state_render_depth_mask(GLboolean flag);
+int state_render_color_mask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void state_render_color_mask_indexed(void);
+int state_render_cull_face(GLenum mode);
+int state_render_front_face(GLenum mode);
+int state_render_polygon_offset(GLfloat factor, GLfloat units);
+void state_render_polygon_offset_clamp(void);
+int state_render_viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+int state_render_scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void state_render_scissor_indexed(GLuint first);
+int state_render_clear_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+// Desktop GL_PRIMITIVE_RESTART, which GLES lacks, and the application's own
+// GL_PRIMITIVE_RESTART_FIXED_INDEX. Both map to the driver's fixed-index cap,
+// which is on while either is. Recording one of them returns whether the
+// driver's cap should be on.
+GLboolean state_render_primitive_restart(GLenum cap, GLboolean enabled);
+GLboolean state_render_get_primitive_restart_cap(GLenum cap);
+void state_render_primitive_restart_index(GLuint index);
+GLuint state_render_get_primitive_restart_index(void);
+// Returns non-zero and the restart index when draws restart at the desktop
+// restart index rather than the fixed one.
+int state_render_get_primitive_restart(GLuint* index);
+// glPolygonMode without NV_polygon_mode, GL_FILL unless emulated.
+void state_render_polygon_mode(GLenum mode);
+GLenum state_render_get_polygon_mode(void);
+
 #endif // STATE_H
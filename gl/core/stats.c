@@ -0,0 +1,56 @@
+#include "stats.h"
+#include <stdio.h>
+#include <inttypes.h>
+
+uint64_t g_stats[STATS_COUNT];
+
+static const char* g_stats_names[STATS_COUNT] = {
+    [STATS_FRAMES]                     = "frames presented",
+    [STATS_FILTERED_ACTIVE_TEXTURE]    = "filtered glActiveTexture",
+    [STATS_FILTERED_BIND_BUFFER]       = "filtered glBindBuffer",
+    [STATS_FILTERED_BIND_FRAMEBUFFER]  = "filtered glBindFramebuffer",
+    [STATS_FILTERED_BIND_SAMPLER]      = "filtered glBindSampler",
+    [STATS_FILTERED_BIND_TEXTURE]      = "filtered glBindTexture",
+    [STATS_FILTERED_BIND_VERTEX_ARRAY] = "filtered glBindVertexArray",
+    [STATS_FILTERED_USE_PROGRAM]       = "filtered glUseProgram",
+    [STATS_FILTERED_ENABLE]            = "filtered glEnable/glDisable",
+    [STATS_FILTERED_BLEND]             = "filtered glBlend*",
+    [STATS_FILTERED_DEPTH]             = "filtered glDepthFunc/glDepthMask",
+    [STATS_FILTERED_COLOR_MASK]        = "filtered glColorMask",
+    [STATS_FILTERED_RASTER]            = "filtered glCullFace/glFrontFace/glPolygonOffset",
+    [STATS_FILTERED_VIEWPORT]          = "filtered glViewport",
+    [STATS_FILTERED_SCISSOR]           = "filtered glScissor",
+    [STATS_FILTERED_CLEAR_COLOR]       = "filtered glClearColor",
+    [STATS_UNIFORM_LOCATION_HITS]      = "glGetUniformLocation cache hits",
+    [STATS_UNIFORM_LOCATION_MISSES]    = "glGetUniformLocation cache misses",
+    [STATS_BATCHED_DRAWS]              = "batched glDrawElements",
+    [STATS_BATCH_MERGED_DRAWS]         = "batched draws merged into one index range",
+    [STATS_BATCH_SUBMITS]              = "driver draws issued for batches",
+    [STATS_GLTHREAD_SYNCS]             = "calls that waited for the GL thread",
+    [STATS_INDEX_CONVERSIONS]          = "element buffer copies converted",
+    [STATS_EDGE_LISTS_BUILT]           = "wireframe edge lists built",
+    [STATS_XFB_DRAWS]                  = "emulated transform feedback draws",
+    [STATS_XFB_PASSES_BEHIND]          = "feedback passes drawn behind the newest",
+    [STATS_XFB_WAIT_US]                = "microseconds waited for feedback counts",
+    [STATS_STREAMED_UPLOADS]           = "uploads streamed past a GPU sync",
+    [STATS_STREAM_RING_ORPHANS]        = "streaming ring orphaned when full",
+    [STATS_ASYNC_READBACKS]            = "buffer readbacks without waiting",
+    [STATS_READBACK_WAITS]             = "buffer readbacks that waited for a copy",
+    [STATS_CLEAR_COMPUTE_BYTES]        = "bytes of buffer clears filled on the GPU",
+    [STATS_CLEAR_COPY_BYTES]           = "bytes of buffer clears copied from staging",
+    [STATS_TEXTURE_BYTES]              = "bytes of texture images",
+};
+
+void stats_dump(void) {
+    uint64_t frames = g_stats[STATS_FRAMES];
+    fprintf(stderr, "--- Layer Statistics ---\n");
+    for (int i = 0; i < STATS_COUNT; ++i) {
+        uint64_t value = g_stats[i];
+        if (value == 0) continue;
+        if (i != STATS_FRAMES && i < STATS_TEXTURE_BYTES && frames > 0) {
+            fprintf(stderr, "  %-52s %12" PRIu64 " (%.1f/frame)\n", g_stats_names[i], value, (double)value / frames);
+        } else {
+            fprintf(stderr, "  %-52s %12" PRIu64 "\n", g_stats_names[i], value);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+
+enum stats_counter {
+    STATS_FRAMES,
+
+    // Calls dropped by the redundant state filter (LIBGL_FILTER_STATE)
+    STATS_FILTERED_ACTIVE_TEXTURE,
+    STATS_FILTERED_BIND_BUFFER,
+    STATS_FILTERED_BIND_FRAMEBUFFER,
+    STATS_FILTERED_BIND_SAMPLER,
+    STATS_FILTERED_BIND_TEXTURE,
+    STATS_FILTERED_BIND_VERTEX_ARRAY,
+    STATS_FILTERED_USE_PROGRAM,
+    STATS_FILTERED_ENABLE,
+    STATS_FILTERED_BLEND,
+    STATS_FILTERED_DEPTH,
+    STATS_FILTERED_COLOR_MASK,
+    STATS_FILTERED_RASTER,
+    STATS_FILTERED_VIEWPORT,
+    STATS_FILTERED_SCISSOR,
+    STATS_FILTERED_CLEAR_COLOR,
+
+    // glGetUniformLocation calls answered from the per-program cache, and the ones that reached the driver
+    STATS_UNIFORM_LOCATION_HITS,
+    STATS_UNIFORM_LOCATION_MISSES,
+
+    // Draw batching (LIBGL_BATCH_DRAWS): draws that entered a batch, the ones
+    // appended to the previous draw's index range, and the driver draws issued
+    STATS_BATCHED_DRAWS,
+    STATS_BATCH_MERGED_DRAWS,
+    STATS_BATCH_SUBMITS,
+
+    // Threaded dispatch (LIBGL_GLTHREAD): calls that waited for the GL thread
+    STATS_GLTHREAD_SYNCS,
+
+    // Element buffer copies converted for a primitive restart index GLES can't
+    // restart at, or narrowed to 16-bit indices (LIBGL_NARROW_INDICES)
+    STATS_INDEX_CONVERSIONS,
+
+    // Wireframe edge lists built for glPolygonMode(GL_LINE) emulation
+    STATS_EDGE_LISTS_BUILT,
+
+    // Emulated glDrawTransformFeedback: draws, the feedback passes they lagged
+    // behind the newest one in total, and microseconds spent waiting for
+    // counts (LIBGL_XFB_STRICT, or a full query ring)
+    STATS_XFB_DRAWS,
+    STATS_XFB_PASSES_BEHIND,
+    STATS_XFB_WAIT_US,
+
+    // Streaming uploads (LIBGL_STREAM_UPLOADS): uploads to buffers updated
+    // every frame that went through the staging ring instead of waiting for
+    // the GPU, and the times the ring was full and got orphaned
+    STATS_STREAMED_UPLOADS,
+    STATS_STREAM_RING_ORPHANS,
+
+    // Asynchronous readback (LIBGL_ASYNC_READBACK): glGetBufferSubData calls
+    // answered from a finished copy, and the ones that had to wait for one
+    STATS_ASYNC_READBACKS,
+    STATS_READBACK_WAITS,
+
+    // Bytes filled by glClearBuffer*Data, with a compute pass and by copies
+    // from a staging buffer holding the clear value
+    STATS_CLEAR_COMPUTE_BYTES,
+    STATS_CLEAR_COPY_BYTES,
+
+    // Current values rather than running totals, printed without a per-frame
+    // average. Estimated bytes of texture images specified through the layer,
+    // all levels, faces and layers of the textures that still exist
+    STATS_TEXTURE_BYTES,
+
+    STATS_COUNT
+};
+
+extern uint64_t g_stats[STATS_COUNT];
+
+static inline void stats_add(enum stats_counter counter, uint64_t value) {
+    __atomic_fetch_add(&g_stats[counter], value, __ATOMIC_RELAXED);
+}
+
+static inline void stats_inc(enum stats_counter counter) {
+    stats_add(counter, 1);
+}
+
+// Prints every non-zero counter, with a per-frame average once frames have been presented.
+void stats_dump(void);
+
+#endif // STATS_H
@@ -1,10 +1,11 @@
 #include "cache.h"
+#include "config.h"
 #include "gles.h"
 #include "sha256.h"
+#include "state.h"
 
 #include "stb_ds.h"
 
-ShaderSourceEntry* g_shader_source_map = NULL;
 char g_cache_dir[256];
 
 // --- Helper Functions ---
@@ -39,23 +40,29 @@ static void calculate_program_hash(GLuint program, char* out_hash_str) {
     }
     gles.core.glGetAttachedShaders(program, num_shaders, NULL, shaders);
 
+    ShaderSourceEntry** sources = state_shader_sources_lock();
     size_t total_source_len = 0;
     for (int i = 0; i < num_shaders; ++i) {
-        char* source = hmget(g_shader_source_map, (uintptr_t)shaders[i]);
+        char* source = hmget(*sources, (uintptr_t)shaders[i]);
         if (source) {
             total_source_len += strlen(source);
         }
     }
 
     if (total_source_len == 0) {
+        state_shader_sources_unlock();
         free(shaders);
         out_hash_str[0] = '\0';
         return;
     }
 
-    char* concatenated_source = (char*)malloc(total_source_len + 1);
+    // Options that change how sources are translated are part of the key, so a
+    // binary built with another lowering is never loaded.
+    const char* variant = g_config.draw_id_attrib ? "\n#draw_id_attrib" : "";
+    char* concatenated_source = (char*)malloc(total_source_len + strlen(variant) + 1);
     if (!concatenated_source) {
         fprintf(stderr, "[Cache] Failed to allocate memory for concatenated sources.\n");
+        state_shader_sources_unlock();
         free(shaders);
         out_hash_str[0] = '\0';
         return;
@@ -63,14 +70,16 @@ static void calculate_program_hash(GLuint program, char* out_hash_str) {
     concatenated_source[0] = '\0'; // Start with an empty string for strcat
 
     for (int i = 0; i < num_shaders; ++i) {
-        char* source = hmget(g_shader_source_map, (uintptr_t)shaders[i]);
+        char* source = hmget(*sources, (uintptr_t)shaders[i]);
         if (source) {
             strcat(concatenated_source, source);
         }
     }
+    state_shader_sources_unlock();
+    strcat(concatenated_source, variant);
 
     uint8_t hash[32];
-    sha256((const uint8_t*)concatenated_source, total_source_len, hash);
+    sha256((const uint8_t*)concatenated_source, strlen(concatenated_source), hash);
 
     // Free the temporary concatenated buffer
     free(concatenated_source);
@@ -90,12 +99,18 @@ void shader_cache_init() {
 
 void shader_cache_shutdown() {
     printf("[Cache] Shutting down shader cache system.\n");
-    shfree(g_shader_source_map);
+}
+
+void shader_cache_free_sources(ShaderSourceEntry** sources) {
+    for (ptrdiff_t i = 0; i < hmlen(*sources); ++i) free((*sources)[i].value);
+    hmfree(*sources);
 }
 
 void shader_cache_add_source(GLuint shader, const GLchar* source) {
     char* source_copy = strdup(source);
-    hmput(g_shader_source_map, (uintptr_t)shader, source_copy);
+    ShaderSourceEntry** sources = state_shader_sources_lock();
+    hmput(*sources, (uintptr_t)shader, source_copy);
+    state_shader_sources_unlock();
 }
 
 int shader_cache_load_program(GLuint program) {
@@ -172,8 +187,10 @@ void shader_cache_save_program(GLuint program) {
 }
 
 void shader_cache_remove_program(GLuint program) {
-    if (hmgeti(g_shader_source_map, program) >= 0) {
-        free(hmget(g_shader_source_map, program));
-        hmdel(g_shader_source_map, program);
+    ShaderSourceEntry** sources = state_shader_sources_lock();
+    if (hmgeti(*sources, program) >= 0) {
+        free(hmget(*sources, program));
+        hmdel(*sources, program);
     }
+    state_shader_sources_unlock();
 }
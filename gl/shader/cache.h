@@ -10,17 +10,20 @@
 
 #include <GLES2/gl2.h>
 
-typedef struct {
+// Shader sources are kept per share group, see state_shader_sources_lock().
+typedef struct shader_source_entry {
     uintptr_t key;
     char* value; // The source code string
 } ShaderSourceEntry;
 
-extern ShaderSourceEntry* g_shader_source_map;
 extern char g_cache_dir[256];
 
 void shader_cache_init();
 void shader_cache_shutdown();
 
+// Frees a share group's shader source map.
+void shader_cache_free_sources(ShaderSourceEntry** sources);
+
 // Stores the original, unconverted source code for a shader.
 void shader_cache_add_source(GLuint shader, const GLchar* source);
 
@@ -1,5 +1,6 @@
 #include "translate.h"
 #include "gles.h"
+#include "config.h"
 
 #include <iostream>
 #include <string>
@@ -134,26 +135,68 @@ const TBuiltInResource GetDefaultBuiltInResources() {
     return Resources;
 }
 
+extern "C" GLint shader_base_instance_binding(void) {
+    static GLint binding = -2;
+    if (binding == -2) {
+        GLint max_bindings = 0, max_vertex_blocks = 0;
+        gles.core.glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &max_bindings);
+        gles.core.glGetIntegerv(GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &max_vertex_blocks);
+        // Leave the application at least the minimum the spec guarantees.
+        binding = (max_vertex_blocks > 0 && max_bindings >= 6) ? max_bindings - 1 : -1;
+    }
+    return binding;
+}
+
+extern "C" GLint shader_draw_id_attribute(void) {
+    static GLint location = -2;
+    if (location == -2) {
+        GLint max_attribs = 0;
+        if (g_config.draw_id_attrib) gles.core.glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &max_attribs);
+        location = max_attribs > 1 ? max_attribs - 1 : -1;
+    }
+    return location;
+}
+
 extern "C" char* shader_translate(GLenum shader_type, const char* source) {
     std::string source_str(source);
     std::string processed_source;
+    std::string builtin_declarations;
 
-    auto preprocess_builtin = [&](const std::string& builtin_name, const std::string& uniform_name) {
+    auto preprocess_builtin = [&](const std::string& builtin_name, const std::string& replacement, const std::string& declaration) {
         std::regex builtin_regex("\\b" + builtin_name + "\\b");
-        if (std::regex_search(source_str, builtin_regex)) {
-            source_str = std::regex_replace(source_str, builtin_regex, uniform_name);
-
-            size_t version_end_pos = source_str.find('\n');
-            if (version_end_pos == std::string::npos) {
-                source_str += "\nuniform int " + uniform_name + ";\n";
-            } else {
-                source_str.insert(version_end_pos + 1, "uniform int " + uniform_name + ";\n");
-            }
-        }
+        if (!std::regex_search(source_str, builtin_regex)) return false;
+        source_str = std::regex_replace(source_str, builtin_regex, replacement);
+        builtin_declarations += declaration;
+        return true;
     };
 
-    preprocess_builtin("gl_DrawID", "glt_draw_id");
-    preprocess_builtin("gl_BaseInstance", "glt_base_instance");
+    GLint draw_id_attribute = shader_type == GL_VERTEX_SHADER ? shader_draw_id_attribute() : -1;
+    std::string draw_id_declaration = draw_id_attribute >= 0
+        ? "layout(location = " + std::to_string(draw_id_attribute) + ") in int glt_draw_id;\n"
+        : "uniform int glt_draw_id;\n";
+    bool uses_draw_id = preprocess_builtin("gl_DrawID", "glt_draw_id", draw_id_declaration);
+
+    // Indirect draws can't hand base instances to the CPU without a sync, so
+    // they set glt_base_instance to -1 and write them to a per-draw buffer.
+    GLint base_instance_binding = shader_type == GL_VERTEX_SHADER ? shader_base_instance_binding() : -1;
+    if (base_instance_binding >= 0) {
+        std::string declaration = uses_draw_id ? "" : draw_id_declaration;
+        declaration += "uniform int glt_base_instance;\n"
+                       "layout(std430, binding = " + std::to_string(base_instance_binding) + ") readonly buffer glt_base_instance_buffer { int glt_base_instances[]; };\n"
+                       "int glt_get_base_instance() { return glt_base_instance >= 0 ? glt_base_instance : glt_base_instances[glt_draw_id]; }\n";
+        preprocess_builtin("gl_BaseInstance", "glt_get_base_instance()", declaration);
+    } else {
+        preprocess_builtin("gl_BaseInstance", "glt_base_instance", "uniform int glt_base_instance;\n");
+    }
+
+    if (!builtin_declarations.empty()) {
+        size_t version_end_pos = source_str.find('\n');
+        if (version_end_pos == std::string::npos) {
+            source_str += "\n" + builtin_declarations;
+        } else {
+            source_str.insert(version_end_pos + 1, builtin_declarations);
+        }
+    }
 
     size_t version_pos = source_str.find("#version");
     size_t first_char_pos = source_str.find_first_not_of(" \t\r\n");
@@ -9,6 +9,16 @@ extern "C" {
 
 char* shader_translate(GLenum shader_type, const char* source);
 
+// Storage buffer binding that translated vertex shaders read per-draw base
+// instances from when glt_base_instance is negative, or -1 if the driver can't
+// provide one. The binding below it is reserved as well, for the GPU command
+// rewrite that fills the buffer.
+GLint shader_base_instance_binding(void);
+
+// Vertex input location that translated vertex shaders read gl_DrawID from when
+// LIBGL_DRAW_ID_ATTRIB is set, or -1 when gl_DrawID is the glt_draw_id uniform.
+GLint shader_draw_id_attribute(void);
+
 #ifdef __cplusplus
 }
 #endif
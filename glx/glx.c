@@ -1,5 +1,10 @@
 #define _GNU_SOURCE
 #include "gles.h" // Your main generated header
+#include "stats.h"
+#include "state.h"
+#include "glthread.h"
+#include "page_track.h"
+#include "stb_ds.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,6 +12,7 @@
 #include <dlfcn.h>
 #include <signal.h>
 #include <setjmp.h>
+#include <pthread.h>
 
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
@@ -15,21 +21,16 @@
 // --- Forward declarations ---
 void* get_gles_lib_handle();
 void* get_egl_lib_handle();
+void gl_flush_draw_batch(void);
+void gl_end_frame(void);
+void gl_delete_orphaned_objects(void);
 
 // --- Global State for the Bridge ---
 static bool g_bridge_initialized = false;
 static bool g_egl_initialized = false;
 static EGLDisplay g_egl_display = EGL_NO_DISPLAY;
-static EGLConfig  g_egl_config = NULL;
-static EGLSurface g_egl_surface = EGL_NO_SURFACE;
-static EGLContext g_egl_context = EGL_NO_CONTEXT;
-static GLXDrawable g_current_drawable = 0;
+static EGLConfig  g_egl_config = NULL; // Last config a context was created with, for glXCreateContext
 static void* g_self_handle = NULL;
-
-// --- State for the Pbuffer-based Shim ---
-static void* g_pixel_buffer = NULL; // CPU-side buffer for glReadPixels
-static int g_window_width = 0;
-static int g_window_height = 0;
 struct gles_version_t gles_version;
 
 typedef enum {
@@ -38,7 +39,32 @@ typedef enum {
     SHIM_MODE_PBUFFER_COPY   // Using a Pbuffer with glReadPixels (fallback path)
 } ShimMode;
 
-static ShimMode g_shim_mode = SHIM_MODE_UNINITIALIZED;
+// What a GLXContext handed to the application points to.
+struct glx_context {
+    EGLContext egl_context;
+    EGLConfig egl_config;
+    struct state_context* state;
+};
+
+// One EGL surface per X drawable, shared by every context that draws to it.
+struct glx_surface {
+    EGLSurface egl_surface;
+    ShimMode shim_mode;
+    // --- State for the Pbuffer-based Shim ---
+    void* pixel_buffer; // CPU-side buffer for glReadPixels
+    int width;
+    int height;
+};
+
+static struct {
+    GLXDrawable key;
+    struct glx_surface* value;
+} *g_surfaces = NULL;
+static pthread_mutex_t g_surfaces_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// --- Per-thread current context and drawable ---
+static __thread GLXDrawable t_current_drawable = 0;
+static __thread struct glx_surface* t_current_surface = NULL;
 
 // =================================================================================================
 //                                     INITIALIZATION LOGIC
@@ -54,6 +80,7 @@ static void ensure_bridge_initialized() {
         if (!egl.eglGetProcAddress) { fprintf(stderr, "[Bridge] FATAL: Could not dlsym eglGetProcAddress.\n"); exit(1); }
     }
     load_gles_functions(get_gles_lib_handle());
+    glthread_init();
     g_bridge_initialized = true;
     fprintf(stderr, "[Bridge] Function pointers loaded.\n");
 }
@@ -141,103 +168,145 @@ GLXContext glXCreateContextAttribsARB(Display* dpy, GLXFBConfig config, GLXConte
     ensure_bridge_initialized();
     printf("[Bridge] Intercepted glXCreateContextAttribsARB\n");
     g_egl_config = (EGLConfig)config;
+    struct glx_context* share = (struct glx_context*)share_context;
+    EGLContext egl_context = EGL_NO_CONTEXT;
     // Always assume GLES 3.0+ support.
     EGLint egl_attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 2, EGL_NONE };
     printf("[Bridge] Creating EGL context for GLES 3.2\n");
-    while(g_egl_context == EGL_NO_CONTEXT && egl_attribs[3] > 0) {
-        g_egl_context = egl.eglCreateContext(g_egl_display, g_egl_config, (EGLContext)share_context, egl_attribs);
-        if (g_egl_context == EGL_NO_CONTEXT) {
+    while(egl_context == EGL_NO_CONTEXT && egl_attribs[3] > 0) {
+        egl_context = egl.eglCreateContext(g_egl_display, g_egl_config, share ? share->egl_context : EGL_NO_CONTEXT, egl_attribs);
+        if (egl_context == EGL_NO_CONTEXT) {
             egl_attribs[3] -= 1;
             fprintf(stderr, "[Bridge] eglCreateContext failed! Trying GLES %d.%d\n", 3, egl_attribs[3]);
         }
     }
-    if (g_egl_context == EGL_NO_CONTEXT) { fprintf(stderr, "[Bridge] eglCreateContext failed! EGL error: 0x%x\n", egl.eglGetError()); }
+    if (egl_context == EGL_NO_CONTEXT) {
+        fprintf(stderr, "[Bridge] eglCreateContext failed! EGL error: 0x%x\n", egl.eglGetError());
+        return NULL;
+    }
     gles_version.major = 3; gles_version.minor = egl_attribs[3];
-    return (GLXContext)g_egl_context;
+
+    struct glx_context* context = calloc(1, sizeof(*context));
+    if (context) context->state = state_context_create(share ? share->state : NULL);
+    if (!context || !context->state) {
+        fprintf(stderr, "[Bridge] Failed to allocate layer state for the new context.\n");
+        egl.eglDestroyContext(g_egl_display, egl_context);
+        free(context);
+        return NULL;
+    }
+    context->egl_context = egl_context;
+    context->egl_config = g_egl_config;
+    return (GLXContext)context;
 }
 
 // If EGL doesn't support X11 (Android), passing the X11 window handler to EGL will cause a crash.
-// We'll handle the crash to at least allow the PBuffer path to work.
-static jmp_buf g_crash_recovery_buffer;
-static void sigsegv_handler(int sig) {
-    longjmp(g_crash_recovery_buffer, 1);
+// We'll handle the crash to at least allow the PBuffer path to work. The guard only covers this
+// thread and shares the SIGSEGV handler of persistent mapping emulation.
+
+// Returns the surface for draw, creating it on first use. Called with g_surfaces_lock held.
+static struct glx_surface* create_surface(Display* dpy, GLXDrawable draw, EGLConfig config) {
+    struct glx_surface* surface = calloc(1, sizeof(*surface));
+    if (!surface) return NULL;
+
+    bool native_success = false;
+    sigjmp_buf crash_guard;
+    if (sigsetjmp(crash_guard, 1) == 0) {
+        page_track_set_crash_guard(&crash_guard);
+        printf("[Bridge] Attempting to create a native EGL window surface (fast path)...\n");
+        surface->egl_surface = egl.eglCreateWindowSurface(g_egl_display, config, (EGLNativeWindowType)draw, NULL);
+        page_track_set_crash_guard(NULL);
+
+        if (surface->egl_surface != EGL_NO_SURFACE) {
+            native_success = true;
+        }
+    }
+    if (native_success) {
+        printf("[Bridge] Success! Using native EGL window surface.\n");
+        surface->shim_mode = SHIM_MODE_NATIVE_X11;
+        return surface;
+    }
+
+    // This block is reached if eglCreateWindowSurface returned an error OR if it crashed.
+    fprintf(stderr, "[Bridge] Native window surface creation failed. Falling back to Pbuffer copy method.\n");
+    // --- Fallback to the Pbuffer copy method ---
+    Window root; int x, y; unsigned int w, h, border, depth;
+    XGetGeometry(dpy, draw, &root, &x, &y, &w, &h, &border, &depth);
+    surface->width = w; surface->height = h;
+    surface->pixel_buffer = malloc(w * h * 4);
+    const EGLint pbuf_attribs[] = { EGL_WIDTH, w, EGL_HEIGHT, h, EGL_NONE };
+    surface->egl_surface = egl.eglCreatePbufferSurface(g_egl_display, config, pbuf_attribs);
+
+    if (surface->egl_surface == EGL_NO_SURFACE) {
+        fprintf(stderr, "[Bridge] FATAL: Fallback Pbuffer surface creation also failed (EGL error: 0x%x).\n", egl.eglGetError());
+        free(surface->pixel_buffer);
+        free(surface);
+        return NULL;
+    }
+    printf("[Bridge] Fallback Pbuffer surface created successfully.\n");
+    surface->shim_mode = SHIM_MODE_PBUFFER_COPY;
+    return surface;
+}
+
+static struct glx_surface* get_surface(Display* dpy, GLXDrawable draw, EGLConfig config) {
+    if (draw == t_current_drawable && t_current_surface) return t_current_surface;
+    pthread_mutex_lock(&g_surfaces_lock);
+    struct glx_surface* surface = hmget(g_surfaces, draw);
+    if (!surface && config) {
+        surface = create_surface(dpy, draw, config);
+        if (surface) hmput(g_surfaces, draw, surface);
+    }
+    pthread_mutex_unlock(&g_surfaces_lock);
+    return surface;
 }
 
 Bool glXMakeContextCurrent(Display* dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx) {
     ensure_bridge_initialized();
     ensure_egl_display(dpy);
 
-    if (g_current_drawable != draw) {
-        if (g_egl_surface != EGL_NO_SURFACE) { egl.eglDestroySurface(g_egl_display, g_egl_surface); g_egl_surface = EGL_NO_SURFACE; }
-        if (g_pixel_buffer) { free(g_pixel_buffer); g_pixel_buffer = NULL; }
-        g_shim_mode = SHIM_MODE_UNINITIALIZED;
-
-        if (draw != 0) {
-            bool native_success = false;
-            struct sigaction new_action = { .sa_handler = sigsegv_handler };
-            struct sigaction old_action;
-            sigemptyset(&new_action.sa_mask);
-            if (setjmp(g_crash_recovery_buffer) == 0) {
-                sigaction(SIGSEGV, &new_action, &old_action);
-                printf("[Bridge] Attempting to create a native EGL window surface (fast path)...\n");
-                g_egl_surface = egl.eglCreateWindowSurface(g_egl_display, g_egl_config, (EGLNativeWindowType)draw, NULL);
-                sigaction(SIGSEGV, &old_action, NULL);
-
-                if (g_egl_surface != EGL_NO_SURFACE) {
-                    native_success = true;
-                }
-            }
-            if (native_success) {
-                printf("[Bridge] Success! Using native EGL window surface.\n");
-                g_shim_mode = SHIM_MODE_NATIVE_X11;
-            } else {
-                // This block is reached if eglCreateWindowSurface returned an error OR if it crashed.
-                fprintf(stderr, "[Bridge] Native window surface creation failed. Falling back to Pbuffer copy method.\n");
-                // --- Fallback to the Pbuffer copy method ---
-                Window root; int x, y; unsigned int w, h, border, depth;
-                XGetGeometry(dpy, draw, &root, &x, &y, &w, &h, &border, &depth);
-                g_window_width = w; g_window_height = h;
-                g_pixel_buffer = malloc(w * h * 4);
-                const EGLint pbuf_attribs[] = { EGL_WIDTH, w, EGL_HEIGHT, h, EGL_NONE };
-                g_egl_surface = egl.eglCreatePbufferSurface(g_egl_display, g_egl_config, pbuf_attribs);
-
-                if (g_egl_surface != EGL_NO_SURFACE) {
-                    printf("[Bridge] Fallback Pbuffer surface created successfully.\n");
-                    g_shim_mode = SHIM_MODE_PBUFFER_COPY;
-                } else {
-                    fprintf(stderr, "[Bridge] FATAL: Fallback Pbuffer surface creation also failed (EGL error: 0x%x).\n", egl.eglGetError());
-                    free(g_pixel_buffer); g_pixel_buffer = NULL;
-                    return False;
-                }
-            }
-        }
-        g_current_drawable = draw;
+    struct glx_context* context = (struct glx_context*)ctx;
+    struct glx_surface* surface = NULL;
+    if (context && draw != 0) {
+        surface = get_surface(dpy, draw, context->egl_config);
+        if (!surface) return False;
     }
-    if (!egl.eglMakeCurrent(g_egl_display, g_egl_surface, g_egl_surface, (EGLContext)ctx)) return False;
+
+    gl_flush_draw_batch();
+    EGLSurface egl_surface = surface ? surface->egl_surface : EGL_NO_SURFACE;
+    if (!glthread_make_current(g_egl_display, egl_surface, egl_surface, context ? context->egl_context : EGL_NO_CONTEXT)) return False;
+    t_current_drawable = surface ? draw : 0;
+    t_current_surface = surface;
+    state_context_make_current(context ? context->state : NULL);
+    gl_delete_orphaned_objects();
     return True;
 }
 
 void glXSwapBuffers(Display* dpy, GLXDrawable drawable) {
     ensure_bridge_initialized();
+    stats_inc(STATS_FRAMES);
+    gl_flush_draw_batch();
+    gl_end_frame();
 
-    switch (g_shim_mode) {
+    struct glx_surface* surface = get_surface(dpy, drawable, NULL);
+    if (!surface) return; // No surface was ever made current for this drawable
+
+    switch (surface->shim_mode) {
         case SHIM_MODE_NATIVE_X11:
             // FAST PATH: The driver handles the swap directly.
-            egl.eglSwapBuffers(g_egl_display, g_egl_surface);
+            glthread_swap_buffers(g_egl_display, surface->egl_surface);
             break;
 
         case SHIM_MODE_PBUFFER_COPY:
             // FALLBACK PATH: We must manually copy pixels from our off-screen Pbuffer.
-            if (!g_pixel_buffer || !gles.core.glReadPixels) return;
+            if (!surface->pixel_buffer || !gles.core.glReadPixels) return;
 
-            gles.core.glReadPixels(0, 0, g_window_width, g_window_height, GL_RGBA, GL_UNSIGNED_BYTE, g_pixel_buffer);
+            gles.core.glReadPixels(0, 0, surface->width, surface->height, GL_RGBA, GL_UNSIGNED_BYTE, surface->pixel_buffer);
 
             XImage* image = XCreateImage(dpy, DefaultVisual(dpy, DefaultScreen(dpy)),
                                          DefaultDepth(dpy, DefaultScreen(dpy)), ZPixmap, 0,
-                                         (char*)g_pixel_buffer, g_window_width, g_window_height, 32, 0);
+                                         (char*)surface->pixel_buffer, surface->width, surface->height, 32, 0);
             if (!image) { fprintf(stderr, "[Bridge] XCreateImage failed!\n"); return; }
             GC gc = XCreateGC(dpy, drawable, 0, NULL);
-            XPutImage(dpy, drawable, gc, image, 0, 0, 0, 0, g_window_width, g_window_height);
+            XPutImage(dpy, drawable, gc, image, 0, 0, 0, 0, surface->width, surface->height);
             XFreeGC(dpy, gc);
             XFlush(dpy);
 
@@ -256,7 +325,16 @@ const char* glXQueryExtensionsString(Display* dpy, int screen) { return ""; }
 Bool glXQueryExtension(Display* dpy, int* error_base, int* event_base) { return True; }
 GLXContext glXCreateNewContext(Display *dpy, GLXFBConfig config, int r_type, GLXContext share, Bool direct) { return glXCreateContextAttribsARB(dpy, config, share, direct, NULL); }
 GLXContext glXCreateContext(Display* dpy, XVisualInfo* vis, GLXContext share, Bool direct) { return glXCreateContextAttribsARB(dpy, (GLXFBConfig)g_egl_config, share, direct, NULL); }
-void glXDestroyContext(Display *dpy, GLXContext ctx) { if (g_egl_display != EGL_NO_DISPLAY && (EGLContext)ctx != EGL_NO_CONTEXT) egl.eglDestroyContext(g_egl_display, (EGLContext)ctx); }
+void glXDestroyContext(Display *dpy, GLXContext ctx) {
+    struct glx_context* context = (struct glx_context*)ctx;
+    if (!context) return;
+    if (g_egl_display != EGL_NO_DISPLAY) egl.eglDestroyContext(g_egl_display, context->egl_context);
+    // Freed once no thread has it current, the scratch objects of a context
+    // freed right away go to whichever context of its group runs next.
+    state_context_destroy(context->state);
+    gl_delete_orphaned_objects();
+    free(context);
+}
 Bool glXMakeCurrent(Display* dpy, GLXDrawable drawable, GLXContext ctx) { return glXMakeContextCurrent(dpy, drawable, drawable, ctx); }
 Bool glXIsDirect(Display *dpy, GLXContext ctx) { return True; }
 
@@ -1,6 +1,8 @@
 #include "gles.h" // The one header to rule them all
 #include "cache.h"
 #include "state.h"
+#include "config.h"
+#include "stats.h"
 #include <stdlib.h>
 
 static void* gles_handle = NULL;
@@ -38,6 +40,7 @@ void initialize_translation_layer() {
         fprintf(stderr, "Layer: Failed to bind EGL functions. Aborting.\n");
         exit(1);
     }
+    config_init();
     shader_cache_init();
     fprintf(stderr, "--- Translation Layer Initialized Successfully (pre-bridge) ---\n");
 }
@@ -45,7 +48,9 @@ void initialize_translation_layer() {
 __attribute__((destructor))
 void shutdown_translation_layer() {
     fprintf(stderr, "--- Translation Layer Shutting Down ---\n");
+    if (g_config.stats) stats_dump();
     shader_cache_shutdown();
+    state_shutdown();
     if (gles_handle) dlclose(gles_handle);
     if (egl_handle) dlclose(egl_handle);
 }
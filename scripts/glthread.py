@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Generates gl/core/glthread_marshal.c, the threaded dispatch marshallers.
+
+Every function of the GLES tables in gles/gles.h gets a marshaller that
+records the call into the current thread's command ring and an executor that
+replays it on the GL thread against the driver tables. Calls without return
+values or client memory are recorded asynchronously. Client arrays with a
+known size are copied into the ring. Everything else waits for the GL thread.
+"""
+import argparse
+import os
+import re
+import xml.etree.ElementTree as ET
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(SCRIPT_DIR)
+
+
+def get_full_text(element):
+    text = element.text or ''
+    for child in element:
+        text += get_full_text(child)
+        if child.tail:
+            text += child.tail
+    return text.strip()
+
+
+def read_tables(header):
+    """Returns (table, name) for every function pointer of the GLES tables."""
+    source = open(header).read()
+    functions = []
+    for table in ('core', 'ext'):
+        body = re.search(r'struct gles_%s_procs \{(.*?)\n\};' % table, source, re.S).group(1)
+        functions += [(table, m.group(1)) for m in re.finditer(r'PFN\w+ (\w+);', body)]
+    return functions
+
+
+def read_prototypes(registry):
+    prototypes = {}
+    for command in ET.parse(registry).getroot().findall('commands/command'):
+        proto = command.find('proto')
+        name = proto.find('name').text
+        return_type = get_full_text(proto)[:-len(name)].strip()
+        params = []
+        for param in command.findall('param'):
+            param_name = param.find('name').text
+            full = get_full_text(param)
+            ptype = TYPE_OVERRIDES.get((name, param_name), full[:full.rfind(param_name)].strip())
+            params.append((ptype, param_name))
+        prototypes[name] = (return_type, params)
+    return prototypes
+
+
+# --- Parameter classification ---
+# ('offset',)            pointer that is a buffer offset in the core profile, passed as is
+# ('copy', size)         client array of size bytes, copied into the ring
+# ('unpack', size)       pixel data, an offset while a pixel unpack buffer is bound,
+#                        otherwise copied when size is known or waited for when it is None
+# ('pack',)              pixel destination, an offset while a pixel pack buffer is bound,
+#                        otherwise waited for
+
+def classify(name, ptype, pname, params):
+    base = re.sub(r'(EXT|OES|KHR|NV)$', '', name)
+    # Element count of the arrays of the glDelete* and glMultiDraw* calls
+    count = [p for t, p in params if t == 'GLsizei']
+    count = count[0] if base.startswith('glDelete') else count[-1] if count else None
+
+    if ptype == 'const void *' and pname in ('indices', 'indirect', 'pointer') and \
+            (base.startswith('glDraw') or base.startswith('glMultiDraw') or base.startswith('glVertexAttrib')):
+        return ('offset',)
+
+    m = re.match(r'gl(?:Program)?Uniform([1-4])(?:f|i|ui)v$', base)
+    if m and pname == 'value':
+        return ('copy', 'count * %s * sizeof(*value)' % m.group(1))
+    m = re.match(r'gl(?:Program)?UniformMatrix([2-4])(?:x([2-4]))?fv$', base)
+    if m and pname == 'value':
+        return ('copy', 'count * %d * sizeof(*value)' % (int(m.group(1)) * int(m.group(2) or m.group(1))))
+    m = re.match(r'glVertexAttrib([1-4])fv$', base)
+    if m:
+        return ('copy', '%s * sizeof(*%s)' % (m.group(1), pname))
+    if re.match(r'glVertexAttribI4u?iv$', base):
+        return ('copy', '4 * sizeof(*%s)' % pname)
+    if re.match(r'glDelete\w+s$', base) and ptype == 'const GLuint *':
+        return ('copy', '%s * sizeof(*%s)' % (count, pname))
+    if base == 'glDrawBuffers':
+        return ('copy', 'n * sizeof(*%s)' % pname)
+    if base in ('glInvalidateFramebuffer', 'glInvalidateSubFramebuffer'):
+        return ('copy', 'numAttachments * sizeof(*attachments)')
+    if base == 'glDiscardFramebuffer':
+        return ('copy', 'numAttachments * sizeof(*attachments)')
+    if re.match(r'glClearBuffer(?:f|i|ui)v$', base):
+        return ('copy', '(buffer == GL_COLOR ? 4 : 1) * sizeof(*value)')
+    if re.match(r'gl(?:Tex|Sampler)Parameter(?:f|i|Ii|Iui)v$', base):
+        return ('copy', '(pname == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(*%s)' % pname)
+    if base in ('glBufferData', 'glBufferSubData') and pname == 'data':
+        return ('copy', 'size')
+    if base in ('glMultiDrawArrays', 'glMultiDrawElements', 'glMultiDrawElementsBaseVertex') and ptype != 'GLsizei':
+        return ('copy', '%s * sizeof(*%s)' % (count, pname))
+
+    if re.match(r'gl(?:Compressed)?Tex(?:Sub)?Image[23]D$', base) and pname in ('pixels', 'data'):
+        return ('unpack', 'imageSize' if 'Compressed' in base else None)
+    if base == 'glReadPixels' and pname == 'pixels':
+        return ('pack',)
+    return None
+
+
+# Parameters the GLES headers declare differently from the registry.
+TYPE_OVERRIDES = {
+    ('glCreateShaderProgramvEXT', 'strings'): 'const GLchar **',
+}
+
+# Extra bookkeeping recorded along with some calls.
+TRACKING = {
+    'glBindBuffer': 'glthread_track_bind_buffer(target, buffer);',
+    'glDeleteBuffers': 'glthread_track_delete_buffers(n, buffers);',
+}
+
+# Calls whose side effects the caller expects on return.
+ALWAYS_SYNC = {'glFinish'}
+
+
+def declaration(ctype, name):
+    return ctype + name if ctype.endswith('*') else '%s %s' % (ctype, name)
+
+
+def generate(table, name, return_type, params):
+    returns = return_type != 'void'
+    call_args = ', '.join(p for _, p in params)
+    sig = ', '.join(declaration(t, p) for t, p in params) or 'void'
+    driver = 'gles_driver.%s.%s' % (table, name)
+    struct = 'struct marshal_%s' % name
+    out = []
+
+    out.append('%s {' % struct)
+    for ptype, pname in params:
+        out.append('    %s;' % declaration(ptype, pname))
+    if returns:
+        out.append('    %s;' % declaration(return_type + ' *', 'result'))
+    if not params and not returns:
+        out.append('    char unused;')
+    out.append('};')
+    out.append('')
+
+    out.append('static void exec_%s(const void* args) {' % name)
+    if params or returns:
+        out.append('    const %s* cmd = args;' % struct)
+    else:
+        out.append('    (void)args;')
+    call = '%s(%s)' % (driver, ', '.join('cmd->%s' % p for _, p in params))
+    out.append('    %s%s;' % ('*cmd->result = ' if returns else '', call))
+    out.append('}')
+    out.append('')
+
+    kinds = [(ptype, pname, classify(name, ptype, pname, params) if '*' in ptype else None) for ptype, pname in params]
+    always_sync = returns or name in ALWAYS_SYNC or any('*' in t and k is None for t, _, k in kinds)
+
+    out.append('static %s GL_APIENTRY marshal_%s(%s) {' % (return_type, name, sig))
+    if returns:
+        out.append('    if (!glthread_active()) return %s(%s);' % (driver, call_args))
+    else:
+        out.append('    if (!glthread_active()) {')
+        out.append('        %s(%s);' % (driver, call_args))
+        out.append('        return;')
+        out.append('    }')
+    if name in TRACKING:
+        out.append('    ' + TRACKING[name])
+
+    copies = []
+    if not always_sync:
+        out.append('    int glt_sync = 0;')
+        for ptype, pname, kind in kinds:
+            if not kind or kind[0] == 'offset':
+                continue
+            if kind[0] in ('unpack', 'pack'):
+                target = 'GL_PIXEL_UNPACK_BUFFER' if kind[0] == 'unpack' else 'GL_PIXEL_PACK_BUFFER'
+                out.append('    int %s_bound = glthread_pixel_buffer_bound(%s);' % (pname, target))
+                if kind[0] == 'pack' or kind[1] is None:
+                    out.append('    glt_sync |= %s_bound <= 0;' % pname)
+                    continue
+                out.append('    glt_sync |= %s_bound < 0;' % pname)
+                out.append('    size_t %s_size = %s_bound || !%s ? 0 : (size_t)(%s);' % (pname, pname, pname, kind[1]))
+                copies.append((pname, '%s_bound' % pname))
+            else:
+                out.append('    size_t %s_size = %s ? (size_t)(%s) : 0;' % (pname, pname, kind[1]))
+                copies.append((pname, None))
+        if copies:
+            total = ' + '.join('GLTHREAD_ALIGN(%s_size)' % p for p, _ in copies)
+            out.append('    size_t glt_copy_size = %s;' % total)
+            out.append('    glt_sync |= glt_copy_size > GLTHREAD_MAX_COPY;')
+
+    extra = ' + (glt_sync ? 0 : glt_copy_size)' if copies else ''
+    out.append('    %s* cmd = glthread_alloc(exec_%s, sizeof(*cmd)%s);' % (struct, name, extra))
+    if copies:
+        out.append('    char* glt_tail = (char*)(cmd + 1);')
+    copied = dict(copies)
+    for ptype, pname in params:
+        if pname in copied:
+            keep = 'glt_sync' if copied[pname] is None else 'glt_sync || %s' % copied[pname]
+            out.append('    cmd->%s = %s ? %s : glthread_copy(&glt_tail, %s, %s_size);' % (pname, keep, pname, pname, pname))
+        else:
+            out.append('    cmd->%s = %s;' % (pname, pname))
+    if returns:
+        out.append('    %s;' % declaration(return_type, 'glt_result'))
+        out.append('    cmd->result = &glt_result;')
+    if always_sync:
+        out.append('    glthread_sync();')
+    else:
+        out.append('    if (glt_sync) glthread_sync();')
+        out.append('    else glthread_submit();')
+    if returns:
+        out.append('    return glt_result;')
+    out.append('}')
+    out.append('')
+    return out
+
+
+def main(header, registry, output):
+    functions = read_tables(header)
+    prototypes = read_prototypes(registry)
+
+    lines = [
+        '/*',
+        ' * Threaded dispatch marshallers for the GLES tables',
+        ' * Generated by scripts/glthread.py',
+        ' * DO NOT EDIT THIS FILE DIRECTLY.',
+        ' */',
+        '',
+        '#include "glthread.h"',
+        '#include <string.h>',
+        '',
+    ]
+    for table, name in functions:
+        return_type, params = prototypes[name]
+        lines += generate(table, name, return_type, params)
+
+    lines.append('void glthread_install_marshallers(void) {')
+    for table, name in functions:
+        lines.append('    if (gles.%s.%s) gles.%s.%s = marshal_%s;' % (table, name, table, name, name))
+    lines.append('}')
+
+    with open(output, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+    print('Generated %d marshallers in %s' % (len(functions), output))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Generate the threaded dispatch marshallers.')
+    parser.add_argument('--header', default=os.path.join(REPO_DIR, 'gles', 'gles.h'))
+    parser.add_argument('--registry', default=os.path.join(SCRIPT_DIR, 'gl.xml'))
+    parser.add_argument('--output', default=os.path.join(REPO_DIR, 'gl', 'core', 'glthread_marshal.c'))
+    args = parser.parse_args()
+    main(args.header, args.registry, args.output)
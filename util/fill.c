@@ -0,0 +1,52 @@
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "fill.h"
+
+// Every supported pattern repeats within 48 bytes, three vector registers'
+// worth, so the pattern is laid out once and stored three vectors at a time.
+#define FILL_PERIOD 48
+
+void fill_pattern(void* dst, size_t size, const void* pattern, size_t pattern_size) {
+    // Patterns of one repeated byte, zero clears among them, are memset's job,
+    // which also picks wider and non-temporal stores where they pay off.
+    const uint8_t* bytes = pattern;
+    size_t same = 1;
+    while (same < pattern_size && bytes[same] == bytes[0]) same++;
+    if (same == pattern_size) {
+        memset(dst, bytes[0], size);
+        return;
+    }
+
+    uint8_t period[FILL_PERIOD];
+    for (size_t i = 0; i < FILL_PERIOD; i += pattern_size) memcpy(period + i, pattern, pattern_size);
+
+    uint8_t* d = dst;
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    uint8x16x3_t v = { { vld1q_u8(period), vld1q_u8(period + 16), vld1q_u8(period + 32) } };
+    for (; i + FILL_PERIOD <= size; i += FILL_PERIOD) {
+        vst1q_u8(d + i, v.val[0]);
+        vst1q_u8(d + i + 16, v.val[1]);
+        vst1q_u8(d + i + 32, v.val[2]);
+    }
+#elif defined(__SSE2__)
+    __m128i a = _mm_loadu_si128((const __m128i*)period);
+    __m128i b = _mm_loadu_si128((const __m128i*)(period + 16));
+    __m128i c = _mm_loadu_si128((const __m128i*)(period + 32));
+    for (; i + FILL_PERIOD <= size; i += FILL_PERIOD) {
+        _mm_storeu_si128((__m128i*)(d + i), a);
+        _mm_storeu_si128((__m128i*)(d + i + 16), b);
+        _mm_storeu_si128((__m128i*)(d + i + 32), c);
+    }
+#else
+    for (; i + FILL_PERIOD <= size; i += FILL_PERIOD) memcpy(d + i, period, FILL_PERIOD);
+#endif
+    memcpy(d + i, period, size - i);
+}
@@ -0,0 +1,11 @@
+#ifndef FILL_H
+#define FILL_H
+
+#include <stddef.h>
+
+// Fills size bytes of dst with copies of a pattern of pattern_size bytes,
+// which must divide 48 (1, 2, 3, 4, 6, 8, 12, 16, 24 or 48). A trailing
+// partial copy is written as far as it fits.
+void fill_pattern(void* dst, size_t size, const void* pattern, size_t pattern_size);
+
+#endif
@@ -0,0 +1,203 @@
+#include <stdint.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "index.h"
+
+// The all-ones index is every bit set, so a restart index becomes
+// index | (index == restart) lane by lane.
+
+void index_restart_to_fixed_u8(uint8_t* dst, const uint8_t* src, size_t count, uint8_t restart) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = src[i] == restart ? UINT8_MAX : src[i];
+    }
+}
+
+void index_restart_to_fixed_u16(uint16_t* dst, const uint16_t* src, size_t count, uint16_t restart) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    uint16x8_t r = vdupq_n_u16(restart);
+    for (; i + 8 <= count; i += 8) {
+        uint16x8_t v = vld1q_u16(src + i);
+        vst1q_u16(dst + i, vorrq_u16(v, vceqq_u16(v, r)));
+    }
+#elif defined(__SSE2__) || defined(__SSE4_1__)
+    __m128i r = _mm_set1_epi16((short)restart);
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(v, _mm_cmpeq_epi16(v, r)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = src[i] == restart ? UINT16_MAX : src[i];
+    }
+}
+
+void index_restart_to_fixed_u32(uint32_t* dst, const uint32_t* src, size_t count, uint32_t restart) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    uint32x4_t r = vdupq_n_u32(restart);
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t v = vld1q_u32(src + i);
+        vst1q_u32(dst + i, vorrq_u32(v, vceqq_u32(v, r)));
+    }
+#elif defined(__SSE2__) || defined(__SSE4_1__)
+    __m128i r = _mm_set1_epi32((int)restart);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(v, _mm_cmpeq_epi32(v, r)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = src[i] == restart ? UINT32_MAX : src[i];
+    }
+}
+
+uint32_t index_max_u32(const uint32_t* src, size_t count) {
+    size_t i = 0;
+    uint32_t result = 0;
+#if defined(__ARM_NEON)
+    uint32x4_t m = vdupq_n_u32(0);
+    for (; i + 4 <= count; i += 4) {
+        m = vmaxq_u32(m, vld1q_u32(src + i));
+    }
+    uint32x2_t pair = vpmax_u32(vget_low_u32(m), vget_high_u32(m));
+    result = vget_lane_u32(vpmax_u32(pair, pair), 0);
+#elif defined(__SSE4_1__)
+    __m128i m = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        m = _mm_max_epu32(m, _mm_loadu_si128((const __m128i*)(src + i)));
+    }
+    m = _mm_max_epu32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_epu32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    result = (uint32_t)_mm_cvtsi128_si32(m);
+#elif defined(__SSE2__)
+    // No unsigned 32-bit max before SSE4.1, compare with the sign bit flipped.
+    const __m128i bias = _mm_set1_epi32((int)0x80000000u);
+    __m128i m = bias;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(src + i)), bias);
+        __m128i greater = _mm_cmpgt_epi32(v, m);
+        m = _mm_or_si128(_mm_and_si128(greater, v), _mm_andnot_si128(greater, m));
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, _mm_xor_si128(m, bias));
+    for (int j = 0; j < 4; ++j) {
+        if (lanes[j] > result) result = lanes[j];
+    }
+#endif
+    for (; i < count; ++i) {
+        if (src[i] > result) result = src[i];
+    }
+    return result;
+}
+
+void index_narrow_u32_to_u16(uint16_t* dst, const uint32_t* src, size_t count) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) {
+        uint16x4_t lo = vmovn_u32(vld1q_u32(src + i));
+        uint16x4_t hi = vmovn_u32(vld1q_u32(src + i + 4));
+        vst1q_u16(dst + i, vcombine_u16(lo, hi));
+    }
+#elif defined(__SSE4_1__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 4));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi32(lo, hi));
+    }
+#elif defined(__SSE2__)
+    // Signed saturation only, shift the range down and back up around the pack.
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(src + i)), bias32);
+        __m128i hi = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(src + i + 4)), bias32);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi16(_mm_packs_epi32(lo, hi), bias16));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = (uint16_t)src[i];
+    }
+}
+
+// Line lists are triangles' corners as (a b b) (c c a) triples, so NEON
+// deinterleaves the corners, pairs them up with zips and interleaves the
+// triples back on store. SSE shuffles each output vector out of an
+// overlapping load that covers its source indices; loads stay within the
+// triangles of the step.
+
+void index_triangles_to_lines_u16(uint16_t* dst, const uint16_t* src, size_t triangles) {
+    size_t t = 0;
+#if defined(__ARM_NEON)
+    for (; t + 8 <= triangles; t += 8) {
+        uint16x8x3_t v = vld3q_u16(src + t * 3);
+        uint16x8x2_t ac = vzipq_u16(v.val[0], v.val[2]);
+        uint16x8x2_t bc = vzipq_u16(v.val[1], v.val[2]);
+        uint16x8x2_t ba = vzipq_u16(v.val[1], v.val[0]);
+        uint16x8x3_t lo = { { ac.val[0], bc.val[0], ba.val[0] } };
+        uint16x8x3_t hi = { { ac.val[1], bc.val[1], ba.val[1] } };
+        vst3q_u16(dst + t * 6, lo);
+        vst3q_u16(dst + t * 6 + 24, hi);
+    }
+#elif defined(__SSSE3__)
+    // 16-bit lanes need pshufb, 4 triangles from indices 0-7, 2-9 and 4-11.
+    const __m128i s0 = _mm_setr_epi8(0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 0, 1, 6, 7, 8, 9);
+    const __m128i s1 = _mm_setr_epi8(4, 5, 6, 7, 6, 7, 2, 3, 8, 9, 10, 11, 10, 11, 12, 13);
+    const __m128i s2 = _mm_setr_epi8(8, 9, 4, 5, 10, 11, 12, 13, 12, 13, 14, 15, 14, 15, 10, 11);
+    for (; t + 4 <= triangles; t += 4) {
+        const uint16_t* s = src + t * 3;
+        __m128i* d = (__m128i*)(dst + t * 6);
+        _mm_storeu_si128(d, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)s), s0));
+        _mm_storeu_si128(d + 1, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + 2)), s1));
+        _mm_storeu_si128(d + 2, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + 4)), s2));
+    }
+#endif
+    for (; t < triangles; ++t) {
+        uint16_t a = src[t * 3], b = src[t * 3 + 1], c = src[t * 3 + 2];
+        uint16_t* d = dst + t * 6;
+        d[0] = a; d[1] = b; d[2] = b; d[3] = c; d[4] = c; d[5] = a;
+    }
+}
+
+void index_triangles_to_lines_u32(uint32_t* dst, const uint32_t* src, size_t triangles) {
+    size_t t = 0;
+#if defined(__ARM_NEON)
+    for (; t + 4 <= triangles; t += 4) {
+        uint32x4x3_t v = vld3q_u32(src + t * 3);
+        uint32x4x2_t ac = vzipq_u32(v.val[0], v.val[2]);
+        uint32x4x2_t bc = vzipq_u32(v.val[1], v.val[2]);
+        uint32x4x2_t ba = vzipq_u32(v.val[1], v.val[0]);
+        uint32x4x3_t lo = { { ac.val[0], bc.val[0], ba.val[0] } };
+        uint32x4x3_t hi = { { ac.val[1], bc.val[1], ba.val[1] } };
+        vst3q_u32(dst + t * 6, lo);
+        vst3q_u32(dst + t * 6 + 12, hi);
+    }
+#elif defined(__SSE2__)
+    // 2 triangles from indices 0-3 and 2-5, the middle vector takes a pair
+    // from each.
+    for (; t + 2 <= triangles; t += 2) {
+        const uint32_t* s = src + t * 3;
+        __m128i* d = (__m128i*)(dst + t * 6);
+        __m128i lo = _mm_loadu_si128((const __m128i*)s);
+        __m128i hi = _mm_loadu_si128((const __m128i*)(s + 2));
+        __m128 mid = _mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(2, 1, 0, 2));
+        _mm_storeu_si128(d, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 1, 1, 0)));
+        _mm_storeu_si128(d + 1, _mm_castps_si128(mid));
+        _mm_storeu_si128(d + 2, _mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 3, 3, 2)));
+    }
+#endif
+    for (; t < triangles; ++t) {
+        uint32_t a = src[t * 3], b = src[t * 3 + 1], c = src[t * 3 + 2];
+        uint32_t* d = dst + t * 6;
+        d[0] = a; d[1] = b; d[2] = b; d[3] = c; d[4] = c; d[5] = a;
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Index buffer conversion kernels. Source and destination may be unaligned
+// and must not overlap.
+
+// Copies count indices, replacing every restart index with the all-ones index
+// GL_PRIMITIVE_RESTART_FIXED_INDEX restarts at.
+void index_restart_to_fixed_u8(uint8_t* dst, const uint8_t* src, size_t count, uint8_t restart);
+void index_restart_to_fixed_u16(uint16_t* dst, const uint16_t* src, size_t count, uint16_t restart);
+void index_restart_to_fixed_u32(uint32_t* dst, const uint32_t* src, size_t count, uint32_t restart);
+
+// Largest of count indices, 0 when count is 0.
+uint32_t index_max_u32(const uint32_t* src, size_t count);
+
+// Copies count indices that all fit in 16 bits into a 16-bit array.
+void index_narrow_u32_to_u16(uint16_t* dst, const uint32_t* src, size_t count);
+
+// Writes the edges ab, bc and ca of each triangle of a triangle list as a line
+// list, 6 indices per triangle.
+void index_triangles_to_lines_u16(uint16_t* dst, const uint16_t* src, size_t triangles);
+void index_triangles_to_lines_u32(uint32_t* dst, const uint32_t* src, size_t triangles);
+
+#endif
@@ -0,0 +1,70 @@
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "object_table.h"
+#include "stb_ds.h"
+
+void* object_table_fetch(struct object_table* table, uint32_t name) {
+    void* entry = object_table_lookup(table, name);
+    if (entry) return entry;
+
+    while (atomic_flag_test_and_set_explicit(&table->lock, memory_order_acquire)) {}
+
+    uint32_t page_index = name >> OBJECT_PAGE_SHIFT;
+    struct object_directory* directory = atomic_load_explicit(&table->directory, memory_order_relaxed);
+    if (!directory || page_index >= directory->page_count) {
+        uint32_t page_count = directory ? directory->page_count : 1;
+        while (page_count <= page_index) page_count *= 2;
+        struct object_directory* grown = calloc(1, sizeof(*grown) + page_count * sizeof(grown->pages[0]));
+        if (!grown) goto out;
+        grown->page_count = page_count;
+        if (directory) {
+            for (uint32_t i = 0; i < directory->page_count; ++i) {
+                atomic_init(&grown->pages[i], atomic_load_explicit(&directory->pages[i], memory_order_relaxed));
+            }
+            arrput(table->retired, directory);
+        }
+        atomic_store_explicit(&table->directory, grown, memory_order_release);
+        directory = grown;
+    }
+    if (!atomic_load_explicit(&directory->pages[page_index], memory_order_relaxed)) {
+        void* page = calloc(OBJECT_PAGE_SIZE, table->entry_size);
+        if (!page) goto out;
+        atomic_store_explicit(&directory->pages[page_index], page, memory_order_release);
+    }
+    entry = (char*)atomic_load_explicit(&directory->pages[page_index], memory_order_relaxed) + (size_t)(name & OBJECT_PAGE_MASK) * table->entry_size;
+
+out:
+    atomic_flag_clear_explicit(&table->lock, memory_order_release);
+    if (!entry) fprintf(stderr, "Warning: out of memory tracking object %u\n", name);
+    return entry;
+}
+
+void object_table_clear(struct object_table* table, uint32_t name) {
+    void* entry = object_table_lookup(table, name);
+    if (!entry) return;
+    if (table->destroy) table->destroy(entry);
+    memset(entry, 0, table->entry_size);
+}
+
+void object_table_free(struct object_table* table) {
+    struct object_directory* directory = atomic_load_explicit(&table->directory, memory_order_relaxed);
+    if (directory) {
+        for (uint32_t i = 0; i < directory->page_count; ++i) {
+            char* page = atomic_load_explicit(&directory->pages[i], memory_order_relaxed);
+            if (page && table->destroy) {
+                for (uint32_t j = 0; j < OBJECT_PAGE_SIZE; ++j) table->destroy(page + j * table->entry_size);
+            }
+            free(page);
+        }
+        free(directory);
+    }
+    for (ptrdiff_t i = 0; i < arrlen(table->retired); ++i) free(table->retired[i]);
+    arrfree(table->retired);
+    atomic_store_explicit(&table->directory, NULL, memory_order_relaxed);
+}
+
@@ -0,0 +1,52 @@
+#ifndef OBJECT_TABLE_H
+#define OBJECT_TABLE_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// GL names are small and mostly sequential, so per-object records live in a
+// paged array indexed directly by name. Pages are allocated on first write and
+// never move, and the page directory is replaced (never resized in place) when
+// it grows, so lookups only need two acquire loads and no lock. Directories
+// that have been replaced are kept until the table is freed since a reader may
+// still hold them.
+
+#define OBJECT_PAGE_SHIFT 10
+#define OBJECT_PAGE_SIZE (1u << OBJECT_PAGE_SHIFT)
+#define OBJECT_PAGE_MASK (OBJECT_PAGE_SIZE - 1)
+
+struct object_directory {
+    uint32_t page_count;
+    void* _Atomic pages[];
+};
+
+struct object_table {
+    size_t entry_size;
+    void (*destroy)(void* entry); // Optional, releases what a record owns before it is cleared
+    struct object_directory* _Atomic directory;
+    atomic_flag lock; // Serializes writers that allocate pages or grow the directory
+    struct object_directory** retired; // stb_ds array
+};
+
+#define OBJECT_TABLE_INIT(type) { .entry_size = sizeof(type), .lock = ATOMIC_FLAG_INIT }
+#define OBJECT_TABLE_INIT_DESTROY(type, fn) { .entry_size = sizeof(type), .destroy = fn, .lock = ATOMIC_FLAG_INIT }
+
+// Returns the record for name, or NULL when its page was never allocated.
+static inline void* object_table_lookup(struct object_table* table, uint32_t name) {
+    struct object_directory* directory = atomic_load_explicit(&table->directory, memory_order_acquire);
+    uint32_t page_index = name >> OBJECT_PAGE_SHIFT;
+    if (!directory || page_index >= directory->page_count) return NULL;
+    char* page = atomic_load_explicit(&directory->pages[page_index], memory_order_acquire);
+    if (!page) return NULL;
+    return page + (size_t)(name & OBJECT_PAGE_MASK) * table->entry_size;
+}
+
+// Returns the record for name, allocating its page if needed. Only fails on out of memory.
+void* object_table_fetch(struct object_table* table, uint32_t name);
+// Zeroes the record for name.
+void object_table_clear(struct object_table* table, uint32_t name);
+// Frees every page and directory. The table is empty and usable afterwards.
+void object_table_free(struct object_table* table);
+
+#endif
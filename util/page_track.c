@@ -0,0 +1,185 @@
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "page_track.h"
+
+// Tracks live in a fixed table so the fault handler can look them up without
+// locks or pointers to memory that may be freed under it.
+#define PAGE_TRACK_MAX 256
+
+struct page_track {
+    _Atomic uintptr_t base; // 0 while the slot is free
+    size_t size;
+    size_t pages;
+    atomic_uchar* dirty;    // One flag per page
+    atomic_int written;     // Some page was written since the last collection
+    atomic_int refs;
+    atomic_int tracking;    // Set once the memory is write-protected
+    atomic_flag used;
+};
+
+static struct page_track g_tracks[PAGE_TRACK_MAX];
+static size_t g_page_size;
+static struct sigaction g_previous_handler;
+static pthread_once_t g_install_once = PTHREAD_ONCE_INIT;
+static __thread sigjmp_buf* t_crash_guard __attribute__((tls_model("initial-exec")));
+
+static void page_track_fault(int sig, siginfo_t* info, void* context) {
+    uintptr_t address = (uintptr_t)info->si_addr;
+    for (int i = 0; i < PAGE_TRACK_MAX; ++i) {
+        struct page_track* track = &g_tracks[i];
+        uintptr_t base = atomic_load_explicit(&track->base, memory_order_acquire);
+        if (!base || address < base || address - base >= track->pages * g_page_size) continue;
+        size_t page = (address - base) / g_page_size;
+        // Unprotect before marking, so a collection that protects the page
+        // again in between still finds it dirty.
+        mprotect((void*)(base + page * g_page_size), g_page_size, PROT_READ | PROT_WRITE);
+        atomic_store_explicit(&track->dirty[page], 1, memory_order_relaxed);
+        atomic_store_explicit(&track->written, 1, memory_order_release);
+        return;
+    }
+
+    sigjmp_buf* guard = t_crash_guard;
+    if (guard) {
+        t_crash_guard = NULL;
+        siglongjmp(*guard, 1);
+    }
+
+    // Not ours, hand it to whoever was there before. Default dispositions are
+    // restored so the faulting instruction raises the signal again on return.
+    if (g_previous_handler.sa_handler == SIG_DFL || g_previous_handler.sa_handler == SIG_IGN) {
+        sigaction(SIGSEGV, &g_previous_handler, NULL);
+        return;
+    }
+    if (g_previous_handler.sa_flags & SA_RESETHAND) {
+        struct sigaction reset = { .sa_handler = SIG_DFL };
+        sigemptyset(&reset.sa_mask);
+        sigaction(SIGSEGV, &reset, NULL);
+    }
+    if (g_previous_handler.sa_flags & SA_SIGINFO) {
+        g_previous_handler.sa_sigaction(sig, info, context);
+    } else {
+        g_previous_handler.sa_handler(sig);
+    }
+}
+
+static void page_track_install(void) {
+    g_page_size = (size_t)sysconf(_SC_PAGESIZE);
+    // Chained faults run on the stack and with the signals blocked that the
+    // previous handler asked for.
+    sigaction(SIGSEGV, NULL, &g_previous_handler);
+    struct sigaction action = { 0 };
+    action.sa_sigaction = page_track_fault;
+    action.sa_flags = SA_SIGINFO | SA_RESTART | (g_previous_handler.sa_flags & SA_ONSTACK);
+    action.sa_mask = g_previous_handler.sa_mask;
+    sigaction(SIGSEGV, &action, NULL);
+}
+
+void page_track_set_crash_guard(sigjmp_buf* guard) {
+    pthread_once(&g_install_once, page_track_install);
+    t_crash_guard = guard;
+}
+
+struct page_track* page_track_create(size_t size) {
+    pthread_once(&g_install_once, page_track_install);
+    if (size == 0) return NULL;
+
+    struct page_track* track = NULL;
+    for (int i = 0; i < PAGE_TRACK_MAX && !track; ++i) {
+        if (!atomic_flag_test_and_set_explicit(&g_tracks[i].used, memory_order_acquire)) track = &g_tracks[i];
+    }
+    if (!track) return NULL;
+
+    track->size = size;
+    track->pages = (size + g_page_size - 1) / g_page_size;
+    track->dirty = calloc(track->pages, sizeof(*track->dirty));
+    void* memory = mmap(NULL, track->pages * g_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (!track->dirty || memory == MAP_FAILED) {
+        free(track->dirty);
+        if (memory != MAP_FAILED) munmap(memory, track->pages * g_page_size);
+        atomic_flag_clear_explicit(&track->used, memory_order_release);
+        return NULL;
+    }
+    atomic_store_explicit(&track->written, 0, memory_order_relaxed);
+    atomic_store_explicit(&track->refs, 1, memory_order_relaxed);
+    atomic_store_explicit(&track->tracking, 0, memory_order_relaxed);
+    atomic_store_explicit(&track->base, (uintptr_t)memory, memory_order_release);
+    return track;
+}
+
+void page_track_retain(struct page_track* track) {
+    atomic_fetch_add_explicit(&track->refs, 1, memory_order_relaxed);
+}
+
+void page_track_release(struct page_track* track) {
+    if (!track || atomic_fetch_sub_explicit(&track->refs, 1, memory_order_acq_rel) != 1) return;
+    uintptr_t base = atomic_exchange_explicit(&track->base, 0, memory_order_acq_rel);
+    munmap((void*)base, track->pages * g_page_size);
+    free(track->dirty);
+    track->dirty = NULL;
+    atomic_flag_clear_explicit(&track->used, memory_order_release);
+}
+
+void* page_track_memory(const struct page_track* track) {
+    return (void*)atomic_load_explicit(&track->base, memory_order_relaxed);
+}
+
+void page_track_start(struct page_track* track) {
+    for (size_t i = 0; i < track->pages; ++i) atomic_store_explicit(&track->dirty[i], 0, memory_order_relaxed);
+    mprotect(page_track_memory(track), track->pages * g_page_size, PROT_READ);
+    atomic_store_explicit(&track->tracking, 1, memory_order_relaxed);
+}
+
+void page_track_write(struct page_track* track, size_t offset, const void* data, size_t size) {
+    char* base = page_track_memory(track);
+    if (size == 0) return;
+    if (!atomic_load_explicit(&track->tracking, memory_order_relaxed)) {
+        memcpy(base + offset, data, size);
+        return;
+    }
+    size_t first = offset / g_page_size;
+    size_t end = (offset + size + g_page_size - 1) / g_page_size;
+    mprotect(base + first * g_page_size, (end - first) * g_page_size, PROT_READ | PROT_WRITE);
+    memcpy(base + offset, data, size);
+    // Pages that were already dirty stay writable until their collection.
+    size_t page = first;
+    while (page < end) {
+        if (atomic_load_explicit(&track->dirty[page], memory_order_relaxed)) {
+            ++page;
+            continue;
+        }
+        size_t run = page;
+        while (page < end && !atomic_load_explicit(&track->dirty[page], memory_order_relaxed)) ++page;
+        mprotect(base + run * g_page_size, (page - run) * g_page_size, PROT_READ);
+    }
+}
+
+void page_track_collect(struct page_track* track, void (*fn)(void* user, size_t offset, size_t size), void* user) {
+    if (!atomic_exchange_explicit(&track->written, 0, memory_order_acquire)) return;
+    char* base = page_track_memory(track);
+    size_t page = 0;
+    while (page < track->pages) {
+        if (!atomic_exchange_explicit(&track->dirty[page], 0, memory_order_relaxed)) {
+            ++page;
+            continue;
+        }
+        // Claiming pages one at a time lets collections overlap without
+        // uploading a page twice. Clear before protecting: a write in between
+        // lands before the protection and is still part of this run.
+        size_t first = page++;
+        while (page < track->pages && atomic_exchange_explicit(&track->dirty[page], 0, memory_order_relaxed)) ++page;
+        mprotect(base + first * g_page_size, (page - first) * g_page_size, PROT_READ);
+
+        size_t offset = first * g_page_size;
+        size_t end = page * g_page_size < track->size ? page * g_page_size : track->size;
+        fn(user, offset, end - offset);
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef PAGE_TRACK_H
+#define PAGE_TRACK_H
+
+#include <setjmp.h>
+#include <stddef.h>
+
+// Write tracking through page protection. Tracked memory is kept read-only
+// and the first write to each page faults, which marks the page dirty and
+// makes it writable until the next collection. Any thread may write to the
+// memory or collect the writes.
+//
+// Only faults from user space are caught. The kernel fails writes into
+// tracked memory with EFAULT instead, so read() and the like must not target
+// it directly.
+//
+// The fault handler is installed for the whole process on first use and
+// chains to the handler that was there before. Code that needs to survive a
+// crash of its own must go through page_track_set_crash_guard rather than
+// install a SIGSEGV handler of its own.
+
+struct page_track;
+
+// Allocates size bytes of zeroed, page-aligned memory. It starts writable and
+// untracked so it can be filled first, with one reference. NULL on failure.
+struct page_track* page_track_create(size_t size);
+// The memory is freed when the last reference is released.
+void page_track_retain(struct page_track* track);
+void page_track_release(struct page_track* track);
+void* page_track_memory(const struct page_track* track);
+
+// Write-protects the memory, writes from now on are tracked.
+void page_track_start(struct page_track* track);
+
+// Copies size bytes of data to offset in the memory without marking it
+// dirty, for contents that came from elsewhere.
+void page_track_write(struct page_track* track, size_t offset, const void* data, size_t size);
+
+// Calls fn with the offset and size of every run of pages written since the
+// previous collection, after write-protecting them again. Runs are clipped to
+// the size the memory was created with.
+void page_track_collect(struct page_track* track, void (*fn)(void* user, size_t offset, size_t size), void* user);
+
+// While guard is set, faults of the calling thread outside tracked memory
+// siglongjmp to it, once. Set it to NULL again after the guarded code.
+void page_track_set_crash_guard(sigjmp_buf* guard);
+
+#endif